@@ -33,167 +33,292 @@
 
 /*================== Includes =============================================*/
 #include "bal.h"
+#include "bal_mask.h"
+#include "bal_plan.h"
+#include "bal_duty.h"
+#include "bal_charge.h"
 #include "general.h"
 #include "mcu.h"
 #include "diag.h"
 #include "cmsis_os.h"
 #include "database.h"
+#include "sm.h"
 /*================== Macros and Definitions ===============================*/
 
-/**
- * Saves the last state and the last substate
- */
-#define BAL_SAVELASTSTATES()    bal_state.laststate=bal_state.state; \
-                                bal_state.lastsubstate = bal_state.substate
+/*================== Function Prototypes ==================================*/
 
+static uint8_t BAL_CheckStateRequest(uint8_t statereq);
+
+static void BAL_Init(void);
+static void BAL_Deactivate(void);
+#if BAL_USE_PLANNER == TRUE
+static uint8_t BAL_ActivatePlan(void);
+#endif
+static uint8_t BAL_ActivateThreshold(void);
+static void BAL_WriteMask(const uint32_t *mask, uint8_t enable);
+static void BAL_AddChargeMask(uint32_t *mask);
+
+static void BAL_Cyclic(void);
+static void BAL_EntryInitialization(void);
+static void BAL_EntryInactive(void);
+static void BAL_RunActive(void);
+static void BAL_RunInactiveOverride(void);
+static void BAL_RunActiveOverride(void);
 
 /*================== Constant and Variable Definitions ====================*/
 static DATA_BLOCK_CURRENT_s bal_current;
 static DATA_BLOCK_MINMAX_s bal_minmax;
 
 /**
- * contains the state of the contactor state machine
+ * cells balanced since the last write to the database, bit n -> cell n of the module
+ */
+static uint32_t bal_mask[BS_NR_OF_MODULES];
+
+/**
+ * contains the balancing specific variables of the BAL state machine
  *
  */
 static BAL_STATE_s bal_state = {
-    .timer                  = 0,
-    .statereq               = BAL_STATE_NO_REQUEST,
-    .state                  = BAL_STATEMACH_UNINITIALIZED,
-    .substate               = BAL_ENTRY,
-    .laststate              = BAL_STATEMACH_UNINITIALIZED,
-    .lastsubstate           = 0,
-    .triggerentry           = 0,
-    .ErrRequestCounter      = 0,
     .active                 = FALSE,
     .resting                = TRUE,
+    .charging               = FALSE,
     .rest_timer             = BAL_TIME_BEFORE_BALANCING_S*100,
     .balancing_threshold    = BAL_THRESHOLD_MV + BAL_HYSTERESIS_MV,
 };
 
+static const SM_TRANSITION_s bal_uninitialized_transitions[] = {
+    {BAL_STATE_INIT_REQUEST,                    NULL_PTR,   BAL_STATEMACH_INITIALIZATION,       BAL_STATEMACH_SHORTTIME_10MS},
+    {SM_REQ_ANY,                                NULL_PTR,   SM_STATE_REJECT,                    0},
+};
 
-/*================== Function Prototypes ==================================*/
+static const SM_TRANSITION_s bal_initialization_transitions[] = {
+    {SM_REQ_NONE,                               NULL_PTR,   BAL_STATEMACH_INITIALIZED,          BAL_STATEMACH_SHORTTIME_10MS},
+};
 
-static BAL_RETURN_TYPE_e BAL_CheckStateRequest(BAL_STATE_REQUEST_e statereq);
-static BAL_STATE_REQUEST_e BAL_GetStateRequest(void);
-static BAL_STATE_REQUEST_e BAL_TransferStateRequest(void);
-static uint8_t BAL_CheckReEntrance(void);
+static const SM_TRANSITION_s bal_initialized_transitions[] = {
+    {SM_REQ_NONE,                               NULL_PTR,   BAL_STATEMACH_INACTIVE,             BAL_STATEMACH_SHORTTIME_10MS},
+};
 
-static void BAL_Init(void);
-static void BAL_Deactivate(void);
-static uint8_t BAL_Activate(void);
+static const SM_TRANSITION_s bal_inactive_transitions[] = {
+    {BAL_STATE_ACTIVE_OVERRIDE_REQUEST,         NULL_PTR,   BAL_STATEMACH_ACTIVE_OVERRIDE,      BAL_STATEMACH_SHORTTIME_10MS},
+    {BAL_STATE_INACTIVE_OVERRIDE_REQUEST,       NULL_PTR,   BAL_STATEMACH_INACTIVE_OVERRIDE,    BAL_STATEMACH_SHORTTIME_10MS},
+    {BAL_STATE_ACTIVE_REQUEST,                  NULL_PTR,   BAL_STATEMACH_ACTIVE,               BAL_STATEMACH_SHORTTIME_10MS},
+    {SM_REQ_ANY,                                NULL_PTR,   SM_STATE_STAY,                      0},
+};
 
+static const SM_TRANSITION_s bal_active_transitions[] = {
+    {BAL_STATE_ACTIVE_OVERRIDE_REQUEST,         NULL_PTR,   BAL_STATEMACH_ACTIVE_OVERRIDE,      BAL_STATEMACH_SHORTTIME_10MS},
+    {BAL_STATE_INACTIVE_OVERRIDE_REQUEST,       NULL_PTR,   BAL_STATEMACH_INACTIVE_OVERRIDE,    BAL_STATEMACH_SHORTTIME_10MS},
+    {BAL_STATE_INACTIVE_REQUEST,                NULL_PTR,   BAL_STATEMACH_INACTIVE,             BAL_STATEMACH_SHORTTIME_10MS},
+    {SM_REQ_ANY,                                NULL_PTR,   SM_STATE_STAY,                      0},
+};
+
+static const SM_TRANSITION_s bal_inactive_override_transitions[] = {
+    {BAL_STATE_ACTIVE_OVERRIDE_REQUEST,         NULL_PTR,   BAL_STATEMACH_ACTIVE_OVERRIDE,      BAL_STATEMACH_SHORTTIME_10MS},
+    {BAL_STATE_STOP_OVERRIDE_INACTIVE_REQUEST,  NULL_PTR,   BAL_STATEMACH_INACTIVE,             BAL_STATEMACH_SHORTTIME_10MS},
+    {BAL_STATE_STOP_OVERRIDE_ACTIVE_REQUEST,    NULL_PTR,   BAL_STATEMACH_ACTIVE,               BAL_STATEMACH_SHORTTIME_10MS},
+    {SM_REQ_ANY,                                NULL_PTR,   SM_STATE_STAY,                      0},
+};
+
+static const SM_TRANSITION_s bal_active_override_transitions[] = {
+    {BAL_STATE_INACTIVE_OVERRIDE_REQUEST,       NULL_PTR,   BAL_STATEMACH_INACTIVE_OVERRIDE,    BAL_STATEMACH_SHORTTIME_10MS},
+    {BAL_STATE_STOP_OVERRIDE_INACTIVE_REQUEST,  NULL_PTR,   BAL_STATEMACH_INACTIVE,             BAL_STATEMACH_SHORTTIME_10MS},
+    {BAL_STATE_STOP_OVERRIDE_ACTIVE_REQUEST,    NULL_PTR,   BAL_STATEMACH_ACTIVE,               BAL_STATEMACH_SHORTTIME_10MS},
+    {SM_REQ_ANY,                                NULL_PTR,   SM_STATE_STAY,                      0},
+};
+
+/**
+ * state table of the BAL state machine, the first entry is the initial state
+ */
+static const SM_STATE_s bal_states[] = {
+    /* id                               entry                       run                         exit        timeout, target, substate   transitions */
+    {BAL_STATEMACH_UNINITIALIZED,       NULL_PTR,                   NULL_PTR,                   NULL_PTR,   0, 0, 0,    bal_uninitialized_transitions,      SM_NR_OF(bal_uninitialized_transitions)},
+    {BAL_STATEMACH_INITIALIZATION,      BAL_EntryInitialization,    NULL_PTR,                   NULL_PTR,   0, 0, 0,    bal_initialization_transitions,     SM_NR_OF(bal_initialization_transitions)},
+    {BAL_STATEMACH_INITIALIZED,         NULL_PTR,                   NULL_PTR,                   NULL_PTR,   0, 0, 0,    bal_initialized_transitions,        SM_NR_OF(bal_initialized_transitions)},
+    {BAL_STATEMACH_INACTIVE,            BAL_EntryInactive,          NULL_PTR,                   NULL_PTR,   0, 0, 0,    bal_inactive_transitions,           SM_NR_OF(bal_inactive_transitions)},
+    {BAL_STATEMACH_ACTIVE,              NULL_PTR,                   BAL_RunActive,              NULL_PTR,   0, 0, 0,    bal_active_transitions,             SM_NR_OF(bal_active_transitions)},
+    {BAL_STATEMACH_INACTIVE_OVERRIDE,   NULL_PTR,                   BAL_RunInactiveOverride,    NULL_PTR,   0, 0, 0,    bal_inactive_override_transitions,  SM_NR_OF(bal_inactive_override_transitions)},
+    {BAL_STATEMACH_ACTIVE_OVERRIDE,     NULL_PTR,                   BAL_RunActiveOverride,      NULL_PTR,   0, 0, 0,    bal_active_override_transitions,    SM_NR_OF(bal_active_override_transitions)},
+};
+
+static const SM_CONFIG_s bal_sm_cfg = {
+    .states         = bal_states,
+    .nr_states      = SM_NR_OF(bal_states),
+    .cyclic         = BAL_Cyclic,
+    .cycletime      = 1,
+    .noreq          = BAL_STATE_NO_REQUEST,
+};
+
+/**
+ * contains the state of the BAL state machine
+ */
+static SM_MACHINE_s bal_sm = {
+    .cfg                    = &bal_sm_cfg,
+    .timer                  = 0,
+    .statereq               = BAL_STATE_NO_REQUEST,
+    .index                  = 0,
+    .substate               = BAL_ENTRY,
+    .laststate              = BAL_STATEMACH_UNINITIALIZED,
+    .lastsubstate           = 0,
+    .entrypending           = FALSE,
+    .triggerentry           = 0,
+    .ErrRequestCounter      = 0,
+};
 
 /*================== Function Implementations =============================*/
 static void BAL_Init(void) {
-    DATA_BLOCK_BALANCING_CONTROL_s bal_balancing;
+    uint32_t mask[BS_NR_OF_MODULES] = {0};
 
-    DB_ReadBlock(&bal_balancing, DATA_BLOCK_ID_BALANCING_CONTROL_VALUES);
-    bal_balancing.enable_balancing = 0;
-    DB_WriteBlock(&bal_balancing, DATA_BLOCK_ID_BALANCING_CONTROL_VALUES);
+    BAL_WriteMask(mask, 0);
+    BAL_PlanInit();
 }
 
 static void BAL_Deactivate(void) {
-    DATA_BLOCK_BALANCING_CONTROL_s bal_balancing;
-    uint16_t i;
+    uint32_t mask[BS_NR_OF_MODULES] = {0};
 
-    DB_ReadBlock(&bal_balancing, DATA_BLOCK_ID_BALANCING_CONTROL_VALUES);
-
-    for (i=0;i<BS_NR_OF_BAT_CELLS;i++) {
-        bal_balancing.value[i] = 0;
-    }
+    BAL_WriteMask(mask, 0);
+    BAL_ChargeReset();
+#if BAL_USE_PLANNER == TRUE
+    BAL_PlanCountdown(NULL_PTR);
+#endif
+}
 
-    bal_balancing.enable_balancing = 0;
+#if BAL_USE_PLANNER == TRUE
+/**
+ * @brief   balances the cells of the plan of BAL_PlanUpdate() and the cells to balance while charging
+ *
+ * @return  TRUE if no cell is balanced, FALSE otherwise
+ */
+static uint8_t BAL_ActivatePlan(void) {
+    uint32_t mask[BS_NR_OF_MODULES];
+    uint8_t finished = TRUE;
 
-    bal_balancing.previous_timestamp = bal_balancing.timestamp;
-    bal_balancing.timestamp = MCU_GetTimeStamp();
-    DB_WriteBlock(&bal_balancing, DATA_BLOCK_ID_BALANCING_CONTROL_VALUES);
+    // the time since the last call is counted for the cells balanced since then
+    BAL_PlanCountdown(bal_mask);
+    BAL_PlanUpdate();
+    BAL_PlanGetMask(mask);
+    BAL_AddChargeMask(mask);
+    finished = (BAL_MaskAny(mask) == TRUE) ? FALSE : TRUE;
+#if BAL_DUTY_CYCLING == TRUE
+    BAL_DutyCycle(mask);
+#endif
+    BAL_WriteMask(mask, 1);
 
+    return finished;
 }
+#endif
 
-static uint8_t BAL_Activate(void) {
-    static DATA_BLOCK_BALANCING_CONTROL_s bal_balancing;
+/**
+ * @brief   balances the cells above the minimum cell voltage plus the balancing threshold and
+ *          the cells to balance while charging
+ *
+ * @return  TRUE if no cell is balanced, FALSE otherwise
+ */
+static uint8_t BAL_ActivateThreshold(void) {
     static DATA_BLOCK_CELLVOLTAGE_s bal_cellvoltage;
     static DATA_BLOCK_MINMAX_s bal_minmax;
-    uint32_t i = 0;
-    uint16_t min = 0;
+    uint32_t mask[BS_NR_OF_MODULES];
+    uint32_t threshold = 0;
+    uint16_t m = 0;
+    uint8_t c = 0;
     uint8_t finished = TRUE;
 
-    DB_ReadBlock(&bal_balancing, DATA_BLOCK_ID_BALANCING_CONTROL_VALUES);
     DB_ReadBlock(&bal_cellvoltage, DATA_BLOCK_ID_CELLVOLTAGE);
     DB_ReadBlock(&bal_minmax, DATA_BLOCK_ID_MINMAX);
 
-    min = bal_minmax.voltage_min;
+    threshold = bal_minmax.voltage_min + bal_state.balancing_threshold;
 
-    for (i=0;i<BS_NR_OF_BAT_CELLS;i++) {
-        if ( bal_cellvoltage.voltage[i] > min+bal_state.balancing_threshold ) {
-            bal_balancing.value[i] = 1;
-            finished = FALSE;
-        } else {
-            bal_balancing.value[i] = 0;
+    // the voltages under charge current include the drop over the cell resistance, so only the
+    // cells of the charge balancing are balanced while charging
+    for (m = 0; m < BS_NR_OF_MODULES; m++) {
+        mask[m] = 0;
+        if (bal_state.charging == TRUE) {
+            continue;
+        }
+        for (c = 0; c < BS_NR_OF_BAT_CELLS_PER_MODULE; c++) {
+            if (bal_cellvoltage.voltage[m * BS_NR_OF_BAT_CELLS_PER_MODULE + c] > threshold) {
+                mask[m] |= (1uL << c);
+            }
         }
     }
 
-    bal_balancing.enable_balancing = 1;
-
-    bal_balancing.previous_timestamp = bal_balancing.timestamp;
-    bal_balancing.timestamp = MCU_GetTimeStamp();
-    DB_WriteBlock(&bal_balancing, DATA_BLOCK_ID_BALANCING_CONTROL_VALUES);
+    BAL_AddChargeMask(mask);
+    finished = (BAL_MaskAny(mask) == TRUE) ? FALSE : TRUE;
+#if BAL_DUTY_CYCLING == TRUE
+    BAL_DutyCycle(mask);
+#endif
+    BAL_WriteMask(mask, 1);
 
     return finished;
-
 }
 
-
-
 /**
- * @brief   re-entrance check of BAL state machine trigger function
- *
- * This function is not re-entrant and should only be called time- or event-triggered.
- * It increments the triggerentry counter from the state variable bal_state.
- * It should never be called by two different processes, so if it is the case, triggerentry
- * should never be higher than 0 when this function is called.
- *
+ * @brief   adds the cells to balance while charging
  *
- * @return  retval  0 if no further instance of the function is active, 0xff else
+ * Resets the taper of the charge current when no cell is balanced while charging.
  *
+ * @param   mask    BS_NR_OF_MODULES cell masks to extend
  */
-static uint8_t BAL_CheckReEntrance(void)
-{
-    uint8_t retval=0;
-
-    taskENTER_CRITICAL();
-    if(!bal_state.triggerentry)
-    {
-        bal_state.triggerentry++;
-    }
-    else
-        retval = 0xFF;    // multiple calls of function
-    taskEXIT_CRITICAL();
+static void BAL_AddChargeMask(uint32_t *mask) {
+    uint32_t charge[BS_NR_OF_MODULES];
+    uint16_t m = 0;
 
-    return (retval);
+    if (bal_state.charging == TRUE && BAL_ChargeGetMask(charge) == TRUE) {
+        for (m = 0; m < BS_NR_OF_MODULES; m++) {
+            mask[m] |= charge[m];
+        }
+    } else {
+        BAL_ChargeReset();
+    }
 }
 
-
-
 /**
- * @brief   gets the current state request.
+ * @brief   writes the balanced cells to the database
  *
- * This function is used in the functioning of the BAL state machine.
+ * Only the cells whose bit changed are written to the per-cell values, and the data block is only
+ * written if a cell or the enable flag changed. The masks are compared with the database, not
+ * with a local copy, so an overwrite by another writer of the data block is repaired in the next
+ * cycle.
  *
- * @return  retval  current state request, taken from BAL_STATE_REQUEST_e
+ * @param   mask    BS_NR_OF_MODULES cell masks, bit n -> cell n of the module
+ * @param   enable  enable flag of the balancing
  */
-static BAL_STATE_REQUEST_e BAL_GetStateRequest(void) {
+static void BAL_WriteMask(const uint32_t *mask, uint8_t enable) {
+    static DATA_BLOCK_BALANCING_CONTROL_s bal_balancing;
+    uint32_t diff = 0;
+    uint16_t m = 0;
+    uint8_t c = 0;
+    uint8_t changed = FALSE;
 
-    BAL_STATE_REQUEST_e retval = BAL_STATE_NO_REQUEST;
+    DB_ReadBlock(&bal_balancing, DATA_BLOCK_ID_BALANCING_CONTROL_VALUES);
 
-    taskENTER_CRITICAL();
-    retval    = bal_state.statereq;
-    taskEXIT_CRITICAL();
+    if (bal_balancing.enable_balancing != enable) {
+        bal_balancing.enable_balancing = enable;
+        changed = TRUE;
+    }
+    for (m = 0; m < BS_NR_OF_MODULES; m++) {
+        bal_mask[m] = mask[m];
+        diff = mask[m] ^ bal_balancing.module_mask[m];
+        if (diff != 0) {
+            changed = TRUE;
+            bal_balancing.module_mask[m] = mask[m];
+            while (diff != 0) {
+                c = BAL_MaskHighestCell(diff);
+                bal_balancing.value[m * BS_NR_OF_BAT_CELLS_PER_MODULE + c] = (mask[m] >> c) & 1;
+                diff &= ~(1uL << c);
+            }
+        }
+    }
 
-    return (retval);
+    if (changed == TRUE) {
+        bal_balancing.previous_timestamp = bal_balancing.timestamp;
+        bal_balancing.timestamp = MCU_GetTimeStamp();
+        DB_WriteBlock(&bal_balancing, DATA_BLOCK_ID_BALANCING_CONTROL_VALUES);
+    }
 }
 
 
+
 /**
  * @brief   gets the current state.
  *
@@ -202,35 +327,12 @@ static BAL_STATE_REQUEST_e BAL_GetStateRequest(void) {
  * @return  current state, taken from BAL_STATEMACH_e
  */
 BAL_STATEMACH_e BAL_GetState(void) {
-    return (bal_state.state);
+    return ((BAL_STATEMACH_e)SM_GetState(&bal_sm));
 }
 
 
-
 /**
- * @brief   transfers the current state request to the state machine.
- *
- * This function takes the current state request from bal_state and transfers it to the state machine.
- * It resets the value from bal_state to BAL_STATE_NO_REQUEST
- *
- * @return  retVal          current state request, taken from BAL_STATE_REQUEST_e
- *
- */
-static BAL_STATE_REQUEST_e BAL_TransferStateRequest(void)
-{
-    BAL_STATE_REQUEST_e retval = BAL_STATE_NO_REQUEST;
-
-    taskENTER_CRITICAL();
-    retval    = bal_state.statereq;
-    bal_state.statereq = BAL_STATE_NO_REQUEST;
-    taskEXIT_CRITICAL();
-
-    return (retval);
-}
-
-
-/**
- * @brief   sets the current state request of the state variable bal_state.
+ * @brief   sets the current state request of the BAL state machine.
  *
  * This function is used to make a state request to the state machine,e.g, start voltage measurement,
  * read result of voltage measurement, re-initialization
@@ -243,20 +345,8 @@ static BAL_STATE_REQUEST_e BAL_TransferStateRequest(void)
  *
  * @return  retVal                  current state request, taken from BAL_STATE_REQUEST_e
  */
-BAL_RETURN_TYPE_e BAL_SetStateRequest(BAL_STATE_REQUEST_e statereq)
-{
-    BAL_RETURN_TYPE_e retVal = BAL_STATE_NO_REQUEST;
-
-    taskENTER_CRITICAL();
-    retVal=BAL_CheckStateRequest(statereq);
-
-    if (retVal==BAL_OK)
-        {
-            bal_state.statereq   = statereq;
-        }
-    taskEXIT_CRITICAL();
-
-    return (retVal);
+BAL_RETURN_TYPE_e BAL_SetStateRequest(BAL_STATE_REQUEST_e statereq) {
+    return ((BAL_RETURN_TYPE_e)SM_SetStateRequest(&bal_sm, statereq, BAL_CheckStateRequest));
 }
 
 
@@ -266,21 +356,22 @@ BAL_RETURN_TYPE_e BAL_SetStateRequest(BAL_STATE_REQUEST_e statereq)
  *
  * This function checks the validity of the state requests.
  * The resuls of the checked is returned immediately.
+ * It is called by the state machine engine within a critical section.
  *
  * @param   statereq    state request to be checked
  *
  * @return              result of the state request that was made, taken from BAL_RETURN_TYPE_e
  */
-static BAL_RETURN_TYPE_e BAL_CheckStateRequest(BAL_STATE_REQUEST_e statereq) {
+static uint8_t BAL_CheckStateRequest(uint8_t statereq) {
 
     if (statereq == BAL_STATE_ERROR_REQUEST){
         return BAL_OK;
     }
 
-    if (bal_state.statereq == BAL_STATE_NO_REQUEST){
+    if (bal_sm.statereq == BAL_STATE_NO_REQUEST){
         //init only allowed from the uninitialized state
         if (statereq == BAL_STATE_INIT_REQUEST) {
-            if (bal_state.state==BAL_STATEMACH_UNINITIALIZED) {
+            if (SM_GetState(&bal_sm) == BAL_STATEMACH_UNINITIALIZED) {
                 return BAL_OK;
             } else {
                 return BAL_ALREADY_INITIALIZED;
@@ -306,43 +397,34 @@ static BAL_RETURN_TYPE_e BAL_CheckStateRequest(BAL_STATE_REQUEST_e statereq) {
 }
 
 
-
-
-
-
-
 /**
  * @brief   trigger function for the BAL driver state machine.
  *
  * This function contains the sequence of events in the BAL state machine.
- * It must be called time-triggered, every 1ms.
+ * It must be called time-triggered, every 10ms.
  *
  * @return  void
  */
-void BAL_Trigger(void)
-{
+void BAL_Trigger(void) {
+    SM_Trigger(&bal_sm);
+}
 
-    BAL_STATE_REQUEST_e statereq = BAL_STATE_NO_REQUEST;
-    uint8_t finished = FALSE;
 
+/**
+ * @brief   cyclic action of the BAL state machine, called on every trigger
+ *
+ * Counts down the rest timer and restarts it when the current drops below BAL_REST_CURRENT.
+ */
+static void BAL_Cyclic(void) {
     if (bal_state.rest_timer > 0) {
         bal_state.rest_timer--;
     }
 
-    // Check re-entrance of function
-    if (BAL_CheckReEntrance())
-        return;
-
-    if(bal_state.timer)
-    {
-        if(--bal_state.timer)
-        {
-            bal_state.triggerentry--;
-            return;    // handle state machine only if timer has elapsed
-        }
-    }
-
     DB_ReadBlock(&bal_current, DATA_BLOCK_ID_CURRENT);
+#if BAL_CHARGE_BALANCING == TRUE
+    bal_state.charging = (BS_CheckCurrentValue_Direction(bal_current.current) == BS_CURRENT_CHARGE &&
+                          (bal_current.current >= BAL_REST_CURRENT || bal_current.current <= -BAL_REST_CURRENT)) ? TRUE : FALSE;
+#endif
     if (bal_current.current < 0.0) {
         bal_current.current = -bal_current.current;
     }
@@ -355,271 +437,110 @@ void BAL_Trigger(void)
     else {
         bal_state.resting = FALSE;
     }
-
-
-    switch(bal_state.state) {
-
-        /****************************UNINITIALIZED***********************************/
-        case BAL_STATEMACH_UNINITIALIZED:
-            // waiting for Initialization Request
-            statereq = BAL_TransferStateRequest();
-            if(statereq == BAL_STATE_INIT_REQUEST){
-                BAL_SAVELASTSTATES();
-                bal_state.timer = BAL_STATEMACH_SHORTTIME_10MS;
-                bal_state.state = BAL_STATEMACH_INITIALIZATION;
-                bal_state.substate = BAL_ENTRY;
-            }
-            else if(statereq == BAL_STATE_NO_REQUEST){
-                // no actual request pending //
-            }
-            else{
-                bal_state.ErrRequestCounter++;   // illegal request pending
-            }
-            break;
-
-
-        /****************************INITIALIZATION**********************************/
-        case BAL_STATEMACH_INITIALIZATION:
-
-            BAL_SAVELASTSTATES();
-            BAL_Init();
-
-            bal_state.timer = BAL_STATEMACH_SHORTTIME_10MS;
-            bal_state.state = BAL_STATEMACH_INITIALIZED;
-            bal_state.substate = BAL_ENTRY;
-
-            break;
-
-        /****************************INITIALIZED*************************************/
-        case BAL_STATEMACH_INITIALIZED:
-            BAL_SAVELASTSTATES();
-            bal_state.timer = BAL_STATEMACH_SHORTTIME_10MS;
-            bal_state.state = BAL_STATEMACH_INACTIVE;
-            bal_state.substate = BAL_ENTRY;
-
-            break;
-
-        /****************************INACTIVE*************************************/
-        case BAL_STATEMACH_INACTIVE:
-            BAL_SAVELASTSTATES();
-            if (bal_state.active == TRUE) {
-                BAL_Deactivate();
-                bal_state.active = FALSE;
-            }
-            bal_state.timer = BAL_STATEMACH_SHORTTIME_10MS;
-
-            statereq=BAL_TransferStateRequest();
-            if (statereq == BAL_STATE_ACTIVE_OVERRIDE_REQUEST){
-                bal_state.timer = BAL_STATEMACH_SHORTTIME_10MS;
-                bal_state.state = BAL_STATEMACH_ACTIVE_OVERRIDE;
-                bal_state.substate = BAL_ENTRY;
-                break;
-            }
-            if (statereq == BAL_STATE_INACTIVE_OVERRIDE_REQUEST){
-                bal_state.timer = BAL_STATEMACH_SHORTTIME_10MS;
-                bal_state.state = BAL_STATEMACH_INACTIVE_OVERRIDE;
-                bal_state.substate = BAL_ENTRY;
-                break;
-            }
-            if (statereq == BAL_STATE_ACTIVE_REQUEST){
-                bal_state.timer = BAL_STATEMACH_SHORTTIME_10MS;
-                bal_state.state = BAL_STATEMACH_ACTIVE;
-                bal_state.substate = BAL_ENTRY;
-                break;
-            }
-            break;
-
-        /****************************ACTIVE*************************************/
-        case BAL_STATEMACH_ACTIVE:
-            BAL_SAVELASTSTATES();
-            bal_state.timer = BAL_STATEMACH_SHORTTIME_10MS;
-
-            statereq=BAL_TransferStateRequest();
-            if (statereq == BAL_STATE_ACTIVE_OVERRIDE_REQUEST){
-                bal_state.timer = BAL_STATEMACH_SHORTTIME_10MS;
-                bal_state.state = BAL_STATEMACH_ACTIVE_OVERRIDE;
-                bal_state.substate = BAL_ENTRY;
-                break;
-            }
-            if (statereq == BAL_STATE_INACTIVE_OVERRIDE_REQUEST){
-                bal_state.timer = BAL_STATEMACH_SHORTTIME_10MS;
-                bal_state.state = BAL_STATEMACH_INACTIVE_OVERRIDE;
-                bal_state.substate = BAL_ENTRY;
-                break;
-            }
-            if (statereq == BAL_STATE_INACTIVE_REQUEST){
-                bal_state.timer = BAL_STATEMACH_SHORTTIME_10MS;
-                bal_state.state = BAL_STATEMACH_INACTIVE;
-                bal_state.substate = BAL_ENTRY;
-                break;
-            }
-
-            if (bal_state.substate == BAL_ENTRY){
-                if (bal_state.resting == TRUE) {
-                    if (bal_state.rest_timer == 0) {
-                        bal_state.timer = BAL_STATEMACH_SHORTTIME_10MS;
-                        bal_state.substate = BAL_BALANCE_ACTIVE;
-                        break;
-                    }
-                    else {
-                        bal_state.timer = BAL_STATEMACH_SHORTTIME_10MS;
-                        bal_state.substate = BAL_BALANCE_INACTIVE;
-                        break;
-                    }
-                }
-                else {
-                    bal_state.timer = BAL_STATEMACH_SHORTTIME_10MS;
-                    bal_state.substate = BAL_BALANCE_INACTIVE;
-                }
-                break;
-            }
-            else if (bal_state.substate == BAL_BALANCE_ACTIVE){
-                DB_ReadBlock(&bal_minmax,DATA_BLOCK_ID_MINMAX);
-                //do not balance under a certain voltage level
-                if (bal_minmax.voltage_min>=BAL_LOWER_VOLTAGE_LIMIT_MV) {
-                    finished = BAL_Activate();
-                }
-                else {
-                    bal_state.substate = BAL_BALANCE_INACTIVE;
-                    break;
-                }
-                bal_state.timer = BAL_STATEMACH_SHORTTIME_10MS;
-                if (finished == FALSE) {
-                    bal_state.active = TRUE;
-                    bal_state.balancing_threshold = BAL_THRESHOLD_MV;
-                    bal_state.substate = BAL_ENTRY;
-                }
-                else {
-                    bal_state.substate = BAL_BALANCE_ACTIVE_FINISHED;
-                }
-                break;
-            }
-            else if (bal_state.substate == BAL_BALANCE_INACTIVE){
-                if (bal_state.active == TRUE) {
-                    BAL_Deactivate();
-                    bal_state.balancing_threshold = BAL_THRESHOLD_MV + BAL_HYSTERESIS_MV;
-                    bal_state.active = FALSE;
-                }
-                bal_state.timer = BAL_STATEMACH_SHORTTIME_10MS;
-                bal_state.substate = BAL_ENTRY;
-                break;
-            }
-            else if (bal_state.substate == BAL_BALANCE_ACTIVE_FINISHED){
-                //send CAN message if needed
-                if (bal_state.active == TRUE) {
-                    BAL_Deactivate();
-                }
-                bal_state.balancing_threshold = BAL_THRESHOLD_MV + BAL_HYSTERESIS_MV;
-                bal_state.active = FALSE;
-                bal_state.timer = BAL_STATEMACH_LONGTIME_10MS; //balancing reached: wait longer time to avoid oscillations
-                bal_state.substate = BAL_STATEMACH_INACTIVE;
-                bal_state.substate = BAL_ENTRY;
-                break;
-            }
-
-            break;
-
-            /****************************INACTIVE OVERRIDE*************************************/
-            case BAL_STATEMACH_INACTIVE_OVERRIDE:
-                BAL_SAVELASTSTATES();
-
-                BAL_Deactivate();
-                bal_state.active = FALSE;
-
-                bal_state.timer = BAL_STATEMACH_SHORTTIME_10MS;
-
-                statereq=BAL_TransferStateRequest();
-                if (statereq == BAL_STATE_ACTIVE_OVERRIDE_REQUEST){
-                    bal_state.timer = BAL_STATEMACH_SHORTTIME_10MS;
-                    bal_state.state = BAL_STATEMACH_ACTIVE_OVERRIDE;
-                    bal_state.substate = BAL_ENTRY;
-                    break;
-                }
-                if (statereq == BAL_STATE_STOP_OVERRIDE_INACTIVE_REQUEST){
-                    bal_state.timer = BAL_STATEMACH_SHORTTIME_10MS;
-                    bal_state.state = BAL_STATEMACH_INACTIVE;
-                    bal_state.substate = BAL_ENTRY;
-                    break;
-                }
-                if (statereq == BAL_STATE_STOP_OVERRIDE_ACTIVE_REQUEST){
-                    bal_state.timer = BAL_STATEMACH_SHORTTIME_10MS;
-                    bal_state.state = BAL_STATEMACH_ACTIVE;
-                    bal_state.substate = BAL_ENTRY;
-                    break;
-                }
-
-                break;
-
-            /****************************ACTIVE OVERRIDE*************************************/
-            case BAL_STATEMACH_ACTIVE_OVERRIDE:
-                BAL_SAVELASTSTATES();
-
-                bal_state.timer = BAL_STATEMACH_SHORTTIME_10MS;
-
-                finished = BAL_Activate();
-                bal_state.active = TRUE;
-
-                statereq=BAL_TransferStateRequest();
-
-                if (finished == TRUE) {
-                    bal_state.state = BAL_BALANCE_ACTIVE;
-                    bal_state.substate = BAL_BALANCE_ACTIVE_FINISHED;
-                    break;
-                }
-
-                if (statereq == BAL_STATE_INACTIVE_OVERRIDE_REQUEST){
-                    bal_state.timer = BAL_STATEMACH_SHORTTIME_10MS;
-                    bal_state.state = BAL_STATEMACH_INACTIVE_OVERRIDE;
-                    bal_state.substate = BAL_ENTRY;
-                    break;
-                }
-                if (statereq == BAL_STATE_STOP_OVERRIDE_INACTIVE_REQUEST){
-                    bal_state.timer = BAL_STATEMACH_SHORTTIME_10MS;
-                    bal_state.state = BAL_STATEMACH_INACTIVE;
-                    bal_state.substate = BAL_ENTRY;
-                    break;
-                }
-                if (statereq == BAL_STATE_STOP_OVERRIDE_ACTIVE_REQUEST){
-                    bal_state.timer = BAL_STATEMACH_SHORTTIME_10MS;
-                    bal_state.state = BAL_STATEMACH_ACTIVE;
-                    bal_state.substate = BAL_ENTRY;
-                    break;
-                }
-
-                break;
-
-        default:
-            break;
-
-    } // end switch(bal_state.state)
-
-    bal_state.triggerentry--;
-
 }
 
 
+/**
+ * @brief   entry action of INITIALIZATION
+ */
+static void BAL_EntryInitialization(void) {
+    BAL_Init();
+    bal_sm.timer = BAL_STATEMACH_SHORTTIME_10MS;
+}
 
 
+/**
+ * @brief   entry action of INACTIVE: stops balancing
+ */
+static void BAL_EntryInactive(void) {
+    if (bal_state.active == TRUE) {
+        BAL_Deactivate();
+        bal_state.active = FALSE;
+    }
+    bal_sm.timer = BAL_STATEMACH_SHORTTIME_10MS;
+}
 
 
+/**
+ * @brief   run action of ACTIVE: balances once the battery rested long enough
+ */
+static void BAL_RunActive(void) {
+    uint8_t finished = FALSE;
 
+    if (bal_sm.substate == BAL_ENTRY) {
+#if BAL_USE_PLANNER == TRUE
+        // the planner keeps its schedule while current flows
+        if (BAL_PlanUpdate() == TRUE || bal_state.charging == TRUE) {
+#else
+        if ((bal_state.resting == TRUE && bal_state.rest_timer == 0) || bal_state.charging == TRUE) {
+#endif
+            SM_SetSubstate(&bal_sm, BAL_BALANCE_ACTIVE, BAL_STATEMACH_SHORTTIME_10MS);
+        } else {
+            SM_SetSubstate(&bal_sm, BAL_BALANCE_INACTIVE, BAL_STATEMACH_SHORTTIME_10MS);
+        }
+    } else if (bal_sm.substate == BAL_BALANCE_ACTIVE) {
+        DB_ReadBlock(&bal_minmax,DATA_BLOCK_ID_MINMAX);
+        //do not balance under a certain voltage level
+        if (bal_minmax.voltage_min < BAL_LOWER_VOLTAGE_LIMIT_MV) {
+            bal_sm.substate = BAL_BALANCE_INACTIVE;
+            return;
+        }
+#if BAL_USE_PLANNER == TRUE
+        finished = BAL_ActivatePlan();
+#else
+        finished = BAL_ActivateThreshold();
+#endif
+        if (finished == FALSE) {
+            bal_state.active = TRUE;
+            bal_state.balancing_threshold = BAL_THRESHOLD_MV;
+            SM_SetSubstate(&bal_sm, BAL_ENTRY, BAL_STATEMACH_SHORTTIME_10MS);
+        } else {
+            SM_SetSubstate(&bal_sm, BAL_BALANCE_ACTIVE_FINISHED, BAL_STATEMACH_SHORTTIME_10MS);
+        }
+    } else if (bal_sm.substate == BAL_BALANCE_INACTIVE) {
+        if (bal_state.active == TRUE) {
+            BAL_Deactivate();
+            bal_state.balancing_threshold = BAL_THRESHOLD_MV + BAL_HYSTERESIS_MV;
+            bal_state.active = FALSE;
+        }
+        SM_SetSubstate(&bal_sm, BAL_ENTRY, BAL_STATEMACH_SHORTTIME_10MS);
+    } else if (bal_sm.substate == BAL_BALANCE_ACTIVE_FINISHED) {
+        //send CAN message if needed
+        if (bal_state.active == TRUE) {
+            BAL_Deactivate();
+        }
+        bal_state.balancing_threshold = BAL_THRESHOLD_MV + BAL_HYSTERESIS_MV;
+        bal_state.active = FALSE;
+        //balancing reached: wait longer time to avoid oscillations
+        SM_SetSubstate(&bal_sm, BAL_ENTRY, BAL_STATEMACH_LONGTIME_10MS);
+    }
+}
 
 
+/**
+ * @brief   run action of INACTIVE_OVERRIDE: keeps balancing off
+ */
+static void BAL_RunInactiveOverride(void) {
+    BAL_Deactivate();
+    bal_state.active = FALSE;
+    bal_sm.timer = BAL_STATEMACH_SHORTTIME_10MS;
+}
 
 
+/**
+ * @brief   run action of ACTIVE_OVERRIDE: balances until all cells are within the threshold
+ *
+ * The override balances by the cell voltages also with BAL_USE_PLANNER: the planner needs a
+ * calibrated SOC of every cell and has no plan at an arbitrary override request.
+ */
+static void BAL_RunActiveOverride(void) {
+    uint8_t finished = BAL_ActivateThreshold();
 
+    bal_state.active = TRUE;
+    bal_sm.timer = BAL_STATEMACH_SHORTTIME_10MS;
 
-
-
-
-
-
-
-
-
-
-
-
-
-
-
+    if (finished == TRUE) {
+        // balancing finished, leave the override, INACTIVE stops balancing on entry
+        SM_Transition(&bal_sm, BAL_STATEMACH_INACTIVE, BAL_STATEMACH_SHORTTIME_10MS);
+    }
+}
@@ -117,20 +117,13 @@ typedef enum {
 
 
 /**
- * This structure contains all the variables relevant for the BAL state machine.
- * The user can get the current state of the BAL state machine with this variable
+ * This structure contains the balancing specific variables of the BAL state machine.
+ * The generic part (state, substate, timer, requests) is handled by the state machine engine.
  */
 typedef struct {
-    uint16_t timer;                         /*!< time in ms before the state machine processes the next state, e.g. in counts of 1ms    */
-    BAL_STATE_REQUEST_e statereq;           /*!< current state request made to the state machine                                        */
-    BAL_STATEMACH_e state;                  /*!< state of Driver State Machine                                                          */
-    uint8_t substate;                       /*!< current substate of the state machine                                                  */
-    BAL_STATEMACH_e laststate;              /*!< previous state of the state machine                                                    */
-    uint8_t lastsubstate;                   /*!< previous substate of the state machine                                                 */
-    uint8_t triggerentry;                   /*!< counter for re-entrance protection (function running flag) */
-    uint32_t ErrRequestCounter;             /*!< counts the number of illegal requests to the BAL state machine */
     uint8_t active;                         /*!< indicate if balancing active or not */
     uint8_t resting;                        /*!< indicate if current flowing through battery or not */
+    uint8_t charging;                       /*!< indicate if the battery is charged with more than BAL_REST_CURRENT */
     uint32_t rest_timer;                    /*!< counter since last timestamp with no current flowing */
     uint32_t balancing_threshold;           /*!< effective balancing threshod */
 } BAL_STATE_s;
@@ -0,0 +1,116 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    bal_charge.c
+ * @author  foxBMS Team
+ * @date    18.10.2026 (date of creation)
+ * @ingroup DRIVERS
+ * @prefix  BAL
+ *
+ * @brief   Balancing while charging and top-of-charge tapering
+ *
+ */
+
+/*================== Includes =============================================*/
+#include "general.h"
+#include "bal_charge.h"
+
+#include "batterycell_cfg.h"
+#include "database.h"
+#include "soh_cfg.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/*================== Constant and Variable Definitions ====================*/
+static DATA_BLOCK_CELLVOLTAGE_s bal_charge_cellvoltage;
+static DATA_BLOCK_SOH_s bal_charge_soh;
+static int32_t bal_charge_corrected[BS_NR_OF_BAT_CELLS];
+static float bal_charge_factor = 1.0;
+
+/*================== Function Prototypes ==================================*/
+
+/*================== Function Implementations =============================*/
+
+uint8_t BAL_ChargeGetMask(uint32_t *mask) {
+    DATA_BLOCK_CURRENT_s curr_tab;
+    float resistance = 0.0;
+    float current = 0.0;
+    float factor = 1.0;
+    int32_t corrected_min = 0x7FFFFFFF;
+    uint16_t voltage_max = 0;
+    uint16_t cell = 0;
+    uint16_t m = 0;
+    uint8_t c = 0;
+    uint8_t selected = FALSE;
+
+    DB_ReadBlock(&curr_tab, DATA_BLOCK_ID_CURRENT);
+    DB_ReadBlock(&bal_charge_cellvoltage, DATA_BLOCK_ID_CELLVOLTAGE);
+    DB_ReadBlock(&bal_charge_soh, DATA_BLOCK_ID_SOH);
+
+    current = curr_tab.current;
+    if (current < 0.0) {
+        current = -current;
+    }
+
+    for (cell = 0; cell < BS_NR_OF_BAT_CELLS; cell++) {
+        resistance = (bal_charge_soh.resistance[cell] > 0.0) ? bal_charge_soh.resistance[cell] : SOH_RESISTANCE_BOL;
+        // mA * mOhm = uV, divided by 1000 -> mV
+        bal_charge_corrected[cell] = (int32_t)bal_charge_cellvoltage.voltage[cell] - (int32_t)(current * resistance / 1000.0);
+        if (bal_charge_corrected[cell] < corrected_min) {
+            corrected_min = bal_charge_corrected[cell];
+        }
+        if (bal_charge_cellvoltage.voltage[cell] > voltage_max) {
+            voltage_max = bal_charge_cellvoltage.voltage[cell];
+        }
+    }
+
+    for (m = 0; m < BS_NR_OF_MODULES; m++) {
+        mask[m] = 0;
+        for (c = 0; c < BS_NR_OF_BAT_CELLS_PER_MODULE; c++) {
+            if (bal_charge_corrected[m * BS_NR_OF_BAT_CELLS_PER_MODULE + c] > corrected_min + BAL_CHARGE_THRESHOLD_MV) {
+                mask[m] |= (1uL << c);
+                selected = TRUE;
+            }
+        }
+    }
+
+    if (selected == TRUE && voltage_max > (BC_VOLTMAX - BAL_TOP_OF_CHARGE_MV)) {
+        factor = (float)(BC_VOLTMAX - (int32_t)voltage_max) / BAL_TOP_OF_CHARGE_MV;
+        if (factor < BAL_TOP_OF_CHARGE_MIN_FACTOR) {
+            factor = BAL_TOP_OF_CHARGE_MIN_FACTOR;
+        }
+    }
+    bal_charge_factor = factor;
+
+    return selected;
+}
+
+
+void BAL_ChargeReset(void) {
+    bal_charge_factor = 1.0;
+}
+
+
+float BAL_GetChargeFactor(void) {
+    return bal_charge_factor;
+}
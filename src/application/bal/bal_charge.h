@@ -0,0 +1,78 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    bal_charge.h
+ * @author  foxBMS Team
+ * @date    18.10.2026 (date of creation)
+ * @ingroup DRIVERS
+ * @prefix  BAL
+ *
+ * @brief   Balancing while charging and top-of-charge tapering
+ *
+ * While charging, the terminal voltage of a cell is raised by the current
+ * times its internal resistance. The resistances estimated by the SOH are
+ * used to correct the cell voltages by this IR drop, and the cells whose
+ * corrected voltage is more than BAL_CHARGE_THRESHOLD_MV above the lowest
+ * corrected voltage are balanced, in constant current and in constant voltage
+ * charging. When the highest cell voltage gets within BAL_TOP_OF_CHARGE_MV of
+ * BC_VOLTMAX while cells are still balanced, the charge current limit of the
+ * SOF is tapered so that the balancing can catch up before the first cell
+ * ends the charging.
+ */
+
+#ifndef BAL_CHARGE_H_
+#define BAL_CHARGE_H_
+
+/*================== Includes =============================================*/
+#include "bal_cfg.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/*================== Constant and Variable Definitions ====================*/
+
+/*================== Function Prototypes ==================================*/
+
+/**
+ * @brief   selects the cells to balance while charging and updates the taper factor
+ *
+ * @param   mask    pointer where to store BS_NR_OF_MODULES cell masks
+ *
+ * @return  TRUE if a cell is selected, FALSE otherwise
+ */
+extern uint8_t BAL_ChargeGetMask(uint32_t *mask);
+
+/**
+ * @brief   resets the taper factor when the balancing stops or the charging ends
+ */
+extern void BAL_ChargeReset(void);
+
+/**
+ * @brief   gets the factor for the charge current limits of the SOF
+ *
+ * @return  factor between BAL_TOP_OF_CHARGE_MIN_FACTOR and 1.0
+ */
+extern float BAL_GetChargeFactor(void);
+
+/*================== Function Implementations =============================*/
+
+#endif /* BAL_CHARGE_H_ */
@@ -0,0 +1,156 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    bal_duty.c
+ * @author  foxBMS Team
+ * @date    18.10.2026 (date of creation)
+ * @ingroup DRIVERS
+ * @prefix  BAL
+ *
+ * @brief   Thermally limited duty cycling of the balancing
+ *
+ */
+
+/*================== Includes =============================================*/
+#include "general.h"
+#include "bal_duty.h"
+
+#include "batterycell_cfg.h"
+#include "database.h"
+#include "mcu.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/**
+ * number of cells of a module that dissipate BAL_MODULE_POWER_BUDGET_W at the nominal cell voltage
+ */
+#define BAL_DUTY_BUDGET_CELLS   ((uint16_t)(BAL_MODULE_POWER_BUDGET_W * BAL_RESISTANCE_OHM * 1.0e6 / \
+                                            ((float)BC_VOLT_NOMINAL * BC_VOLT_NOMINAL)))
+
+/**
+ * 1.0 in the Q8 format of the thermal throttle
+ */
+#define BAL_DUTY_ONE            256
+
+/**
+ * cells with even index (cell 1, 3, ... in the numbering of the LTC)
+ */
+#define BAL_DUTY_EVEN_CELLS     0x55555555uL
+
+/*================== Constant and Variable Definitions ====================*/
+static uint8_t bal_duty_allowed[BS_NR_OF_MODULES];
+
+/*================== Function Prototypes ==================================*/
+static uint16_t BAL_DutyThrottle(int32_t temperature, int32_t derate, int32_t max);
+static uint32_t BAL_DutyLimit(uint32_t mask, uint8_t allowed, uint8_t start);
+
+/*================== Function Implementations =============================*/
+
+void BAL_DutyCycle(uint32_t *mask) {
+    static DATA_BLOCK_LTC_DEVICE_PARAMETER_s bal_ltc;
+    static DATA_BLOCK_CELLTEMPERATURE_s bal_celltemperature;
+    uint32_t period = MCU_GetTimeStamp() / BAL_DUTY_PERIOD_MS;
+    uint32_t phase = ((period & 1) == 0) ? BAL_DUTY_EVEN_CELLS : ~BAL_DUTY_EVEN_CELLS;
+    uint8_t start = (uint8_t)((period / 2) % BS_NR_OF_BAT_CELLS_PER_MODULE);
+    uint16_t throttle = 0;
+    uint16_t other = 0;
+    int16_t temperature = 0;
+    uint16_t m = 0;
+    uint8_t s = 0;
+
+    DB_ReadBlock(&bal_ltc, DATA_BLOCK_ID_LTC_DEVICE_PARAMETER);
+    DB_ReadBlock(&bal_celltemperature, DATA_BLOCK_ID_CELLTEMPERATURE);
+
+    for (m = 0; m < BS_NR_OF_MODULES; m++) {
+        // an invalid die temperature does not throttle, the module temperature still does
+        throttle = BAL_DUTY_ONE;
+        if (bal_ltc.valid_dieTemperature[m] == 0) {
+            throttle = BAL_DutyThrottle(bal_ltc.dieTemperature[m], BAL_DIE_TEMPERATURE_DERATE, BAL_DIE_TEMPERATURE_MAX);
+        }
+
+        temperature = -128;
+        for (s = 0; s < BS_NR_OF_TEMP_SENSORS_PER_MODULE; s++) {
+            if ((bal_celltemperature.valid_temperaturePECs[m] & (1 << s)) == 0 &&
+                bal_celltemperature.temperature[m * BS_NR_OF_TEMP_SENSORS_PER_MODULE + s] > temperature) {
+                temperature = bal_celltemperature.temperature[m * BS_NR_OF_TEMP_SENSORS_PER_MODULE + s];
+            }
+        }
+        other = BAL_DutyThrottle(temperature, BAL_MODULE_TEMPERATURE_DERATE, BAL_MODULE_TEMPERATURE_MAX);
+        if (other < throttle) {
+            throttle = other;
+        }
+
+        bal_duty_allowed[m] = (uint8_t)((BAL_DUTY_BUDGET_CELLS * throttle) / BAL_DUTY_ONE);
+        mask[m] = BAL_DutyLimit(mask[m] & phase, bal_duty_allowed[m], start);
+    }
+}
+
+
+uint8_t BAL_DutyGetAllowedCells(uint16_t module) {
+    return bal_duty_allowed[module];
+}
+
+
+/**
+ * @brief   calculates the linear reduction of the balancing power over a temperature
+ *
+ * @param   temperature     temperature in degC
+ * @param   derate          temperature in degC where the reduction starts
+ * @param   max             temperature in degC where the balancing stops
+ *
+ * @return  allowed share of the balancing power in Q8
+ */
+static uint16_t BAL_DutyThrottle(int32_t temperature, int32_t derate, int32_t max) {
+    if (temperature <= derate) {
+        return BAL_DUTY_ONE;
+    }
+    if (temperature >= max) {
+        return 0;
+    }
+    return (uint16_t)(((max - temperature) * BAL_DUTY_ONE) / (max - derate));
+}
+
+
+/**
+ * @brief   keeps at most a number of cells of a mask
+ *
+ * @param   mask        cell mask of the module
+ * @param   allowed     number of cells to keep
+ * @param   start       cell index where the search starts, wrapping around at the last cell
+ *
+ * @return  reduced cell mask
+ */
+static uint32_t BAL_DutyLimit(uint32_t mask, uint8_t allowed, uint8_t start) {
+    uint32_t result = 0;
+    uint8_t c = start;
+    uint8_t n = 0;
+
+    for (n = 0; n < BS_NR_OF_BAT_CELLS_PER_MODULE && allowed > 0; n++) {
+        if ((mask & (1uL << c)) != 0) {
+            result |= (1uL << c);
+            allowed--;
+        }
+        c = (c + 1 < BS_NR_OF_BAT_CELLS_PER_MODULE) ? (c + 1) : 0;
+    }
+    return result;
+}
@@ -0,0 +1,71 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    bal_duty.h
+ * @author  foxBMS Team
+ * @date    18.10.2026 (date of creation)
+ * @ingroup DRIVERS
+ * @prefix  BAL
+ *
+ * @brief   Thermally limited duty cycling of the balancing
+ *
+ * Adjacent cells share the heat sink of their balancing resistors, so only the
+ * odd or only the even cells of a module are balanced at a time, alternating
+ * every BAL_DUTY_PERIOD_MS. The number of cells balanced at once is limited to
+ * BAL_MODULE_POWER_BUDGET_W and reduced linearly when the LTC die temperature
+ * or the highest temperature of the module rise above their derating
+ * thresholds. The cells allowed to balance rotate, so all requested cells get
+ * the same share of the time.
+ */
+
+#ifndef BAL_DUTY_H_
+#define BAL_DUTY_H_
+
+/*================== Includes =============================================*/
+#include "bal_cfg.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/*================== Constant and Variable Definitions ====================*/
+
+/*================== Function Prototypes ==================================*/
+
+/**
+ * @brief   reduces the requested cells to the cells allowed to balance now
+ *
+ * @param   mask    BS_NR_OF_MODULES cell masks, requested cells on entry, allowed cells on return
+ */
+extern void BAL_DutyCycle(uint32_t *mask);
+
+/**
+ * @brief   gets the number of cells a module may balance at once
+ *
+ * @param   module  index of the module
+ *
+ * @return  number of cells, as calculated by the last call of BAL_DutyCycle()
+ */
+extern uint8_t BAL_DutyGetAllowedCells(uint16_t module);
+
+/*================== Function Implementations =============================*/
+
+#endif /* BAL_DUTY_H_ */
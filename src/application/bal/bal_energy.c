@@ -0,0 +1,181 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    bal_energy.c
+ * @author  foxBMS Team
+ * @date    19.10.2026 (date of creation)
+ * @ingroup DRIVERS
+ * @prefix  BAL
+ *
+ * @brief   Balancing charge accounting and self-discharge estimation
+ *
+ */
+
+/*================== Includes =============================================*/
+#include "general.h"
+#include "bal_energy.h"
+
+#include "bal_mask.h"
+#include "bkpsram_cfg.h"
+#include "database.h"
+#include "mcu.h"
+
+/*================== Macros and Definitions ===============================*/
+
+#if BAL_ENERGY_ACCOUNTING == TRUE
+/*================== Constant and Variable Definitions ====================*/
+static DATA_BLOCK_CELLVOLTAGE_s bal_energy_cellvoltage;
+static DATA_BLOCK_BALANCING_CONTROL_s bal_energy_balancing;
+#if BAL_ENERGY_USE_FEEDBACK == TRUE
+static DATA_BLOCK_BALANCING_FEEDBACK_s bal_energy_feedback;
+#endif
+static DATA_BLOCK_BALANCING_ENERGY_s bal_energy_tab;
+
+/**
+ * balancing counters, passed to the non-volatile memory
+ */
+static BAL_ENERGY_NVM_s bal_energy;
+
+/**
+ * charge and time below the resolution of the counters, unit: uAs and ms
+ */
+static uint16_t bal_energy_remainder[BS_NR_OF_BAT_CELLS];
+static uint16_t bal_energy_time_remainder = 0;
+
+static uint32_t bal_energy_timestamp = 0;
+
+/*================== Function Prototypes ==================================*/
+static void BAL_EnergyEstimate(void);
+
+/*================== Function Implementations =============================*/
+
+void BAL_EnergyInit(void) {
+    uint16_t cell = 0;
+
+    if (NVM_Get_balancing(&bal_energy) != E_OK) {
+        bal_energy = default_balancing.data;
+        NVM_Set_balancing(&bal_energy);
+    }
+    for (cell = 0; cell < BS_NR_OF_BAT_CELLS; cell++) {
+        bal_energy_remainder[cell] = 0;
+    }
+    bal_energy_time_remainder = 0;
+    bal_energy_timestamp = MCU_GetTimeStamp();
+
+    BAL_EnergyEstimate();
+}
+
+
+void BAL_EnergyTrigger(void) {
+    uint32_t timestamp = MCU_GetTimeStamp();
+    uint32_t elapsed = timestamp - bal_energy_timestamp;
+    uint32_t remainder = 0;
+    uint32_t mask = 0;
+    uint16_t cell = 0;
+    uint16_t m = 0;
+    uint8_t c = 0;
+#if BAL_ENERGY_USE_FEEDBACK == TRUE
+    uint32_t feedback[BAL_MODULE_MASK_WORDS];
+#endif
+
+    bal_energy_timestamp = timestamp;
+
+    DB_ReadBlock(&bal_energy_balancing, DATA_BLOCK_ID_BALANCING_CONTROL_VALUES);
+    DB_ReadBlock(&bal_energy_cellvoltage, DATA_BLOCK_ID_CELLVOLTAGE);
+#if BAL_ENERGY_USE_FEEDBACK == TRUE
+    DB_ReadBlock(&bal_energy_feedback, DATA_BLOCK_ID_BALANCING_FEEDBACK_VALUES);
+    BAL_FeedbackToMask(&bal_energy_feedback, feedback);
+#endif
+
+    if (bal_energy_balancing.enable_balancing == 1) {
+        for (m = 0; m < BS_NR_OF_MODULES; m++) {
+            mask = bal_energy_balancing.module_mask[m];
+#if BAL_ENERGY_USE_FEEDBACK == TRUE
+            if (((feedback[m / 32] >> (m % 32)) & 1) == 0) {
+                mask = 0;
+            }
+#endif
+            while (mask != 0) {
+                c = BAL_MaskHighestCell(mask);
+                mask &= ~(1uL << c);
+                cell = m * BS_NR_OF_BAT_CELLS_PER_MODULE + c;
+                // mV / Ohm = mA, mA * ms = uAs
+                remainder = bal_energy_remainder[cell] + (uint32_t)(bal_energy_cellvoltage.voltage[cell] / BAL_RESISTANCE_OHM * elapsed);
+                bal_energy.charge[cell] += remainder / 1000;
+                bal_energy_remainder[cell] = remainder % 1000;
+            }
+        }
+    }
+
+    remainder = bal_energy_time_remainder + elapsed;
+    bal_energy.observation_time += remainder / 1000;
+    bal_energy_time_remainder = remainder % 1000;
+
+    NVM_Set_balancing(&bal_energy);
+    BAL_EnergyEstimate();
+}
+
+
+/**
+ * @brief   estimates the self-discharge of the cells and writes the data block
+ *
+ * The self-discharge of a cell is estimated relative to the cell bled the most, which is assumed
+ * to have the lowest self-discharge.
+ */
+static void BAL_EnergyEstimate(void) {
+    uint32_t charge_max = 0;
+    float total = 0.0;
+    uint16_t cell = 0;
+
+    for (cell = 0; cell < BS_NR_OF_BAT_CELLS; cell++) {
+        if (bal_energy.charge[cell] > charge_max) {
+            charge_max = bal_energy.charge[cell];
+        }
+    }
+
+    bal_energy_tab.leakage_max = 0.0;
+    bal_energy_tab.cell_number_leakage_max = 0;
+    for (cell = 0; cell < BS_NR_OF_BAT_CELLS; cell++) {
+        bal_energy_tab.charge[cell] = bal_energy.charge[cell];
+        total += (float)bal_energy.charge[cell];
+        if (bal_energy.observation_time > 0) {
+            // mAs / s = mA, * 1000 -> uA
+            bal_energy_tab.leakage[cell] = (float)(charge_max - bal_energy.charge[cell]) * 1000.0 / (float)bal_energy.observation_time;
+        } else {
+            bal_energy_tab.leakage[cell] = 0.0;
+        }
+        if (bal_energy_tab.leakage[cell] > bal_energy_tab.leakage_max) {
+            bal_energy_tab.leakage_max = bal_energy_tab.leakage[cell];
+            bal_energy_tab.cell_number_leakage_max = cell;
+        }
+    }
+
+    // mAs -> Ah
+    bal_energy_tab.charge_total = total / 3600000.0;
+    bal_energy_tab.observation_time = bal_energy.observation_time;
+    bal_energy_tab.valid = (bal_energy.observation_time >= (uint32_t)BAL_LEAKAGE_MIN_OBSERVATION_H * 3600) ? 1 : 0;
+    bal_energy_tab.previous_timestamp = bal_energy_tab.timestamp;
+    bal_energy_tab.timestamp = MCU_GetTimeStamp();
+    DB_WriteBlock(&bal_energy_tab, DATA_BLOCK_ID_BALANCING_ENERGY);
+}
+#endif /* BAL_ENERGY_ACCOUNTING == TRUE */
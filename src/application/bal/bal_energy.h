@@ -0,0 +1,96 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    bal_energy.h
+ * @author  foxBMS Team
+ * @date    19.10.2026 (date of creation)
+ * @ingroup DRIVERS
+ * @prefix  BAL
+ *
+ * @brief   Balancing charge accounting and self-discharge estimation
+ *
+ * The charge bled from each cell is counted from the balanced cells in the
+ * database, the cell voltage and BAL_RESISTANCE_OHM, and stored in the
+ * non-volatile memory together with the operating time it was observed over.
+ *
+ * Passive balancing bleeds every cell down to the lowest one, so over a long
+ * time the cell with the highest self-discharge is bled the least. The
+ * self-discharge of each cell relative to the cell bled the most is therefore
+ * (charge of that cell - charge of the cell) / observation time. A cell with a
+ * growing self-discharge is an early indicator of an internal short. The
+ * observation time only counts while the BMS is running, so the estimation is
+ * an upper bound if the system is switched off for long times.
+ */
+
+#ifndef BAL_ENERGY_H_
+#define BAL_ENERGY_H_
+
+/*================== Includes =============================================*/
+#include "bal_cfg.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/**
+ * maximum number of cells of the balancing counters, limited by the size of
+ * the EEPROM channel EEPR_CH_BALANCING: (0x80 bytes - observation time - checksum) / 4 bytes
+ */
+#define BAL_ENERGY_MAX_CELLS        30
+
+#if BAL_ENERGY_ACCOUNTING == TRUE
+#if BS_NR_OF_BAT_CELLS > BAL_ENERGY_MAX_CELLS
+#error "BAL_ENERGY_ACCOUNTING: the EEPROM channel of the balancing counters holds up to BAL_ENERGY_MAX_CELLS (30) cells, set BAL_ENERGY_ACCOUNTING to FALSE in bal_cfg.h for larger battery systems"
+#endif
+#define BAL_ENERGY_NR_OF_CELLS      BS_NR_OF_BAT_CELLS
+#else
+/* the channel stays in the EEPROM layout, without counters */
+#define BAL_ENERGY_NR_OF_CELLS      1
+#endif
+
+/**
+ * balancing counters stored in the non-volatile memory
+ */
+typedef struct {
+    uint32_t charge[BAL_ENERGY_NR_OF_CELLS];    /*!< charge bled from each cell since the first use, unit: mAs    */
+    uint32_t observation_time;              /*!< operating time the charge was counted over, unit: s          */
+} BAL_ENERGY_NVM_s;
+
+/*================== Constant and Variable Definitions ====================*/
+
+/*================== Function Prototypes ==================================*/
+
+/**
+ * @brief   restores the balancing counters from the non-volatile memory
+ */
+extern void BAL_EnergyInit(void);
+
+/**
+ * @brief   counts the charge bled since the last call and updates the self-discharge estimation
+ *
+ * @details Must be called cyclically, e.g., every 100ms. The counters are passed to the
+ *          non-volatile memory on every call, which writes them according to NVM_POLICY_BALANCING.
+ */
+extern void BAL_EnergyTrigger(void);
+
+/*================== Function Implementations =============================*/
+
+#endif /* BAL_ENERGY_H_ */
@@ -0,0 +1,111 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    bal_mask.c
+ * @author  foxBMS Team
+ * @date    18.10.2026 (date of creation)
+ * @ingroup DRIVERS
+ * @prefix  BAL
+ *
+ * @brief   Packed bitmasks of the balanced cells
+ *
+ */
+
+/*================== Includes =============================================*/
+#include "general.h"
+#include "bal_mask.h"
+
+#include "mcu_cfg.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/*================== Constant and Variable Definitions ====================*/
+
+/*================== Function Prototypes ==================================*/
+
+/*================== Function Implementations =============================*/
+
+uint8_t BAL_MaskAny(const uint32_t *mask) {
+    uint32_t any = 0;
+    uint16_t m = 0;
+
+    for (m = 0; m < BS_NR_OF_MODULES; m++) {
+        any |= mask[m];
+    }
+    return (any != 0) ? TRUE : FALSE;
+}
+
+
+uint16_t BAL_MaskCount(const uint32_t *mask) {
+    uint16_t count = 0;
+    uint16_t m = 0;
+
+    for (m = 0; m < BS_NR_OF_MODULES; m++) {
+        count += BAL_MaskCountModule(mask[m]);
+    }
+    return count;
+}
+
+
+uint8_t BAL_MaskCountModule(uint32_t mask) {
+    uint8_t count = 0;
+
+    // one iteration per set bit, usually only a few cells are balanced
+    while (mask != 0) {
+        mask &= mask - 1;
+        count++;
+    }
+    return count;
+}
+
+
+uint8_t BAL_MaskHighestCell(uint32_t mask) {
+    if (mask == 0) {
+        return 0xFF;
+    }
+    return 31 - __CLZ(mask);
+}
+
+
+void BAL_MaskToLtcConfig(uint32_t mask, uint8_t *cfgra, uint8_t *cfgrb) {
+    cfgra[4] = (uint8_t)(mask & 0xFF);
+    cfgra[5] = (cfgra[5] & 0xF0) | (uint8_t)((mask >> 8) & 0x0F);
+    if (cfgrb != NULL_PTR) {
+        cfgrb[0] = (cfgrb[0] & 0x0F) | (uint8_t)((mask >> 8) & 0xF0);
+        cfgrb[1] = (cfgrb[1] & 0xFC) | (uint8_t)((mask >> 16) & 0x03);
+    }
+}
+
+
+void BAL_FeedbackToMask(const DATA_BLOCK_BALANCING_FEEDBACK_s *feedback, uint32_t *mask) {
+    uint16_t m = 0;
+
+    for (m = 0; m < BAL_MODULE_MASK_WORDS; m++) {
+        mask[m] = 0;
+    }
+    for (m = 0; m < BS_NR_OF_MODULES; m++) {
+        if (feedback->value[m] > BAL_FEEDBACK_THRESHOLD_MV) {
+            mask[m / 32] |= (1uL << (m % 32));
+        }
+    }
+}
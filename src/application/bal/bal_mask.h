@@ -0,0 +1,128 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    bal_mask.h
+ * @author  foxBMS Team
+ * @date    18.10.2026 (date of creation)
+ * @ingroup DRIVERS
+ * @prefix  BAL
+ *
+ * @brief   Packed bitmasks of the balanced cells
+ *
+ * One 32 bit mask per module, bit n is set when cell n of the module is
+ * balanced. The bit order is the order of the discharge control (DCC) bits
+ * of the LTC, so a mask can be copied into the configuration registers
+ * without repacking.
+ */
+
+#ifndef BAL_MASK_H_
+#define BAL_MASK_H_
+
+/*================== Includes =============================================*/
+#include "bal_cfg.h"
+
+#include "database.h"
+
+/*================== Macros and Definitions ===============================*/
+
+#if BS_NR_OF_BAT_CELLS_PER_MODULE > 32
+#error "balancing masks support up to 32 cells per module"
+#endif
+
+/**
+ * mask with all cells of a module set
+ */
+#define BAL_MASK_ALL_CELLS      ((uint32_t)(0xFFFFFFFFuL >> (32 - BS_NR_OF_BAT_CELLS_PER_MODULE)))
+
+/**
+ * number of 32 bit words of a mask with one bit per module
+ */
+#define BAL_MODULE_MASK_WORDS   ((BS_NR_OF_MODULES + 31) / 32)
+
+/*================== Constant and Variable Definitions ====================*/
+
+/*================== Function Prototypes ==================================*/
+
+/**
+ * @brief   checks if any cell is balanced
+ *
+ * @param   mask    BS_NR_OF_MODULES cell masks
+ *
+ * @return  TRUE if at least one bit is set, FALSE otherwise
+ */
+extern uint8_t BAL_MaskAny(const uint32_t *mask);
+
+/**
+ * @brief   counts the balanced cells
+ *
+ * @param   mask    BS_NR_OF_MODULES cell masks
+ *
+ * @return  number of set bits
+ */
+extern uint16_t BAL_MaskCount(const uint32_t *mask);
+
+/**
+ * @brief   counts the balanced cells of one module
+ *
+ * @param   mask    cell mask of the module
+ *
+ * @return  number of set bits
+ */
+extern uint8_t BAL_MaskCountModule(uint32_t mask);
+
+/**
+ * @brief   finds the balanced cell with the highest index of one module
+ *
+ * @param   mask    cell mask of the module
+ *
+ * @return  index of the highest set bit, 0xFF if no bit is set
+ */
+extern uint8_t BAL_MaskHighestCell(uint32_t mask);
+
+/**
+ * @brief   writes a cell mask into the discharge control bits of the LTC configuration registers
+ *
+ * @details DCC1..DCC8 are bits 0..7 of CFGR4, DCC9..DCC12 bits 0..3 of CFGR5. On devices with 18
+ *          cells DCC13..DCC16 are bits 4..7 of CFGRB0 and DCC17..DCC18 bits 0..1 of CFGRB1. The
+ *          other bits of the registers are kept.
+ *
+ * @param   mask    cell mask of the module
+ * @param   cfgra   configuration register group A, 6 bytes
+ * @param   cfgrb   configuration register group B, 6 bytes, NULL_PTR on devices with 12 cells
+ */
+extern void BAL_MaskToLtcConfig(uint32_t mask, uint8_t *cfgra, uint8_t *cfgrb);
+
+/**
+ * @brief   packs the balancing feedback into one bit per module
+ *
+ * @details The feedback of a module is set when its opto-coupler output is above
+ *          BAL_FEEDBACK_THRESHOLD_MV.
+ *
+ * @param   feedback    balancing feedback of the measurement
+ * @param   mask        pointer where to store BAL_MODULE_MASK_WORDS words, bit m for module m
+ */
+extern void BAL_FeedbackToMask(const DATA_BLOCK_BALANCING_FEEDBACK_s *feedback, uint32_t *mask);
+
+/*================== Function Implementations =============================*/
+
+#endif /* BAL_MASK_H_ */
@@ -0,0 +1,172 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    bal_plan.c
+ * @author  foxBMS Team
+ * @date    18.10.2026 (date of creation)
+ * @ingroup DRIVERS
+ * @prefix  BAL
+ *
+ * @brief   Balancing planner based on the SOC of the cells
+ *
+ */
+
+/*================== Includes =============================================*/
+#include "general.h"
+#include "bal_plan.h"
+
+#include "batterycell_cfg.h"
+#include "database.h"
+#include "mcu.h"
+#include "sox_cfg.h"
+
+/*================== Macros and Definitions ===============================*/
+
+#if BAL_USE_PLANNER == TRUE && SOX_SOC_PER_CELL != TRUE
+#error "the balancing planner needs the SOC of each cell (SOX_SOC_PER_CELL)"
+#endif
+
+/**
+ * bleed current through the balancing resistor at the nominal cell voltage in mA
+ */
+#define BAL_PLAN_CURRENT_MA     ((float)BC_VOLT_NOMINAL / BAL_RESISTANCE_OHM)
+
+/*================== Constant and Variable Definitions ====================*/
+static uint32_t bal_plan_remaining_ms[BS_NR_OF_BAT_CELLS];
+static uint16_t bal_plan_calibrations = 0;
+static uint32_t bal_plan_timestamp = 0;
+static uint8_t bal_plan_running = FALSE;
+
+/*================== Function Prototypes ==================================*/
+static void BAL_PlanCalculate(const DATA_BLOCK_CELLSOC_s *cellsoc);
+
+/*================== Function Implementations =============================*/
+
+void BAL_PlanInit(void) {
+    uint16_t i = 0;
+
+    for (i = 0; i < BS_NR_OF_BAT_CELLS; i++) {
+        bal_plan_remaining_ms[i] = 0;
+    }
+    bal_plan_calibrations = 0;
+    bal_plan_running = FALSE;
+}
+
+
+uint8_t BAL_PlanUpdate(void) {
+    static DATA_BLOCK_CELLSOC_s bal_cellsoc;
+    uint16_t i = 0;
+
+    DB_ReadBlock(&bal_cellsoc, DATA_BLOCK_ID_CELLSOC);
+    if (bal_cellsoc.timestamp != 0 && bal_cellsoc.calibrations != bal_plan_calibrations) {
+        bal_plan_calibrations = bal_cellsoc.calibrations;
+        BAL_PlanCalculate(&bal_cellsoc);
+    }
+
+    for (i = 0; i < BS_NR_OF_BAT_CELLS; i++) {
+        if (bal_plan_remaining_ms[i] > 0) {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+
+void BAL_PlanGetMask(uint32_t *mask) {
+    uint16_t m = 0;
+    uint8_t c = 0;
+
+    for (m = 0; m < BS_NR_OF_MODULES; m++) {
+        mask[m] = 0;
+        for (c = 0; c < BS_NR_OF_BAT_CELLS_PER_MODULE; c++) {
+            if (bal_plan_remaining_ms[m * BS_NR_OF_BAT_CELLS_PER_MODULE + c] > 0) {
+                mask[m] |= (1uL << c);
+            }
+        }
+    }
+}
+
+
+void BAL_PlanCountdown(const uint32_t *mask) {
+    uint32_t timestamp = MCU_GetTimeStamp();
+    uint32_t elapsed = timestamp - bal_plan_timestamp;
+    uint16_t cell = 0;
+    uint16_t m = 0;
+    uint8_t c = 0;
+
+    bal_plan_timestamp = timestamp;
+    if (mask == NULL_PTR) {
+        bal_plan_running = FALSE;
+        return;
+    }
+    if (bal_plan_running == FALSE) {
+        bal_plan_running = TRUE;
+        return;
+    }
+
+    for (m = 0; m < BS_NR_OF_MODULES; m++) {
+        for (c = 0; c < BS_NR_OF_BAT_CELLS_PER_MODULE; c++) {
+            cell = m * BS_NR_OF_BAT_CELLS_PER_MODULE + c;
+            if ((mask[m] & (1uL << c)) != 0) {
+                if (bal_plan_remaining_ms[cell] > elapsed) {
+                    bal_plan_remaining_ms[cell] -= elapsed;
+                } else {
+                    bal_plan_remaining_ms[cell] = 0;
+                }
+            }
+        }
+    }
+}
+
+
+uint32_t BAL_PlanGetRemaining(uint16_t cell) {
+    return bal_plan_remaining_ms[cell] / 1000;
+}
+
+
+/**
+ * @brief   calculates the balancing time of every cell from its SOC difference to the weakest cell
+ *
+ * @param   cellsoc     SOC of the cells, calibrated from the open circuit voltage
+ */
+static void BAL_PlanCalculate(const DATA_BLOCK_CELLSOC_s *cellsoc) {
+    static DATA_BLOCK_SOH_s bal_soh;
+    float difference = 0.0;
+    float capacity = 0.0;
+    float time = 0.0;
+    uint16_t i = 0;
+
+    DB_ReadBlock(&bal_soh, DATA_BLOCK_ID_SOH);
+
+    for (i = 0; i < BS_NR_OF_BAT_CELLS; i++) {
+        difference = cellsoc->soc[i] - cellsoc->soc_min;
+        if (difference <= BAL_PLAN_DEADBAND_PERC) {
+            bal_plan_remaining_ms[i] = 0;
+            continue;
+        }
+        capacity = (bal_soh.capacity[i] > 0.0) ? bal_soh.capacity[i] : SOX_CELL_CAPACITY;
+        // charge in mAh: capacity * difference / 100, time in ms: charge * 3600000 / current
+        time = capacity * difference * 36000.0 / BAL_PLAN_CURRENT_MA;
+        bal_plan_remaining_ms[i] = (time < 4.0e9) ? (uint32_t)time : 4000000000uL;
+    }
+}
@@ -0,0 +1,93 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    bal_plan.h
+ * @author  foxBMS Team
+ * @date    18.10.2026 (date of creation)
+ * @ingroup DRIVERS
+ * @prefix  BAL
+ *
+ * @brief   Balancing planner based on the SOC of the cells
+ *
+ * Each time the SOC of the cells is calibrated from the open circuit voltage,
+ * the planner converts the SOC difference of every cell to the weakest cell
+ * into the charge to remove and, with the bleed current through
+ * BAL_RESISTANCE_OHM at the nominal cell voltage, into a balancing time. The
+ * times are counted down only while the cell is actually balanced, so the
+ * schedule continues across drive and rest phases. Between two calibrations
+ * the cell voltages are not evaluated.
+ */
+
+#ifndef BAL_PLAN_H_
+#define BAL_PLAN_H_
+
+/*================== Includes =============================================*/
+#include "bal_cfg.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/*================== Constant and Variable Definitions ====================*/
+
+/*================== Function Prototypes ==================================*/
+
+/**
+ * @brief   clears the schedule
+ */
+extern void BAL_PlanInit(void);
+
+/**
+ * @brief   re-plans if the cells were calibrated since the last call
+ *
+ * @return  TRUE if a cell has remaining balancing time, FALSE otherwise
+ */
+extern uint8_t BAL_PlanUpdate(void);
+
+/**
+ * @brief   gets the cells with remaining balancing time
+ *
+ * @param   mask    pointer where to store BS_NR_OF_MODULES cell masks
+ */
+extern void BAL_PlanGetMask(uint32_t *mask);
+
+/**
+ * @brief   counts down the balancing time of the balanced cells
+ *
+ * @details The time since the last call is counted for the cells of the mask.
+ *          The first call after a pause only starts the time measurement.
+ *
+ * @param   mask    cells balanced since the last call, NULL_PTR if balancing was paused
+ */
+extern void BAL_PlanCountdown(const uint32_t *mask);
+
+/**
+ * @brief   gets the remaining balancing time of a cell
+ *
+ * @param   cell    index of the cell
+ *
+ * @return  remaining time in s
+ */
+extern uint32_t BAL_PlanGetRemaining(uint16_t cell);
+
+/*================== Function Implementations =============================*/
+
+#endif /* BAL_PLAN_H_ */
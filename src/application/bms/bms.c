@@ -33,6 +33,7 @@
 
 /*================== Includes =============================================*/
 #include "bms.h"
+#include "bkpsram_cfg.h"
 #include "contactor.h"
 #include "interlock.h"
 #include "os.h"
@@ -40,144 +41,188 @@
 #include "database.h"
 #include "bal.h"
 #include "batterycell_cfg.h"
+#include "sm.h"
+#include "lmon.h"
+#include "soa.h"
+#include "budget.h"
+#include "derating.h"
 
 /*================== Macros and Definitions ===============================*/
 
-/**
- * Saves the last state and the last substate
- */
-#define BMS_SAVELASTSTATES()    bms_state.laststate = bms_state.state; \
-                                bms_state.lastsubstate = bms_state.substate;
-
-/*================== Constant and Variable Definitions ====================*/
-
-/**
- * contains the state of the contactor state machine
- */
-static BMS_STATE_s bms_state = {
-    .timer                  = 0,
-    .statereq               = BMS_STATE_NO_REQUEST,
-    .state                  = BMS_STATEMACH_UNINITIALIZED,
-    .substate               = BMS_ENTRY,
-    .laststate              = BMS_STATEMACH_UNINITIALIZED,
-    .lastsubstate           = 0,
-    .triggerentry           = 0,
-    .ErrRequestCounter      = 0,
-    .counter                = 0,
-};
-
 /*================== Function Prototypes ==================================*/
 
-static BMS_RETURN_TYPE_e BMS_CheckStateRequest(BMS_STATE_REQUEST_e statereq);
-static BMS_STATE_REQUEST_e BMS_GetStateRequest(void);
-static BMS_STATE_REQUEST_e BMS_TransferStateRequest(void);
-static uint8_t BMS_CheckReEntrance(void);
+static uint8_t BMS_CheckStateRequest(uint8_t statereq);
 static uint8_t BMS_CheckCANRequests(void);
 static uint8_t BMS_CheckBalancingRequests(void);
 static STD_RETURN_TYPE_e BMS_CheckAnyErrorFlagSet(void);
 static void BMS_CheckVoltages(void);
 static void BMS_CheckTemperatures(void);
 static void BMS_CheckCurrent(void);
+static int32_t BMS_LimitValue(int32_t value, uint16_t nr_violations, BMS_LMON_e monitor);
+static void BMS_PublishState(void);
+static void BMS_ForwardBalancingRequest(BAL_STATE_REQUEST_e outofoverride, BAL_STATE_REQUEST_e norequest);
+
+static uint8_t BMS_IsDisconnectRequired(void);
+static uint8_t BMS_IsStandbyRequested(void);
+static uint8_t BMS_IsNormalRequested(void);
+static uint8_t BMS_IsChargeRequested(void);
+static uint8_t BMS_IsContactorNormal(void);
+static uint8_t BMS_IsContactorCharge(void);
+static uint8_t BMS_IsContactorError(void);
+static uint8_t BMS_IsInterlockClosedAfterError(void);
+
+static void BMS_ExitUninitialized(void);
+static void BMS_EntryPublish(void);
+static void BMS_EntryStandby(void);
+static void BMS_EntryPrecharge(void);
+static void BMS_EntryChargePrecharge(void);
+static void BMS_EntryError(void);
+static void BMS_RunStandby(void);
+static void BMS_RunDriving(void);
+static void BMS_RunError(void);
 
-/*================== Function Implementations =============================*/
+/*================== Constant and Variable Definitions ====================*/
+
+static const SM_TRANSITION_s bms_uninitialized_transitions[] = {
+    {BMS_STATE_INIT_REQUEST,    NULL_PTR,                   BMS_STATEMACH_INITIALIZATION,       BMS_STATEMACH_SHORTTIME_MS},
+    {SM_REQ_ANY,                NULL_PTR,                   SM_STATE_REJECT,                    0},
+};
+
+static const SM_TRANSITION_s bms_initialization_transitions[] = {
+    {SM_REQ_NONE,               NULL_PTR,                   BMS_STATEMACH_INITIALIZED,          BMS_STATEMACH_LONGTIME_MS},
+};
+
+static const SM_TRANSITION_s bms_initialized_transitions[] = {
+    {SM_REQ_NONE,               NULL_PTR,                   BMS_STATEMACH_IDLE,                 BMS_STATEMACH_SHORTTIME_MS},
+};
+
+static const SM_TRANSITION_s bms_idle_transitions[] = {
+    {BMS_STATE_ERROR_REQUEST,   NULL_PTR,                   BMS_STATEMACH_ERROR,                BMS_STATEMACH_SHORTTIME_MS},
+    {SM_REQ_NONE,               BMS_IsDisconnectRequired,   BMS_STATEMACH_ERROR,                BMS_STATEMACH_SHORTTIME_MS},
+    {SM_REQ_NONE,               BMS_IsStandbyRequested,     BMS_STATEMACH_STANDBY,              BMS_STATEMACH_SHORTTIME_MS},
+};
+
+static const SM_TRANSITION_s bms_standby_transitions[] = {
+    {BMS_STATE_ERROR_REQUEST,   NULL_PTR,                   BMS_STATEMACH_ERROR,                BMS_STATEMACH_SHORTTIME_MS},
+    {SM_REQ_NONE,               BMS_IsDisconnectRequired,   BMS_STATEMACH_ERROR,                BMS_STATEMACH_SHORTTIME_MS},
+    {SM_REQ_NONE,               BMS_IsNormalRequested,      BMS_STATEMACH_PRECHARGE,            BMS_STATEMACH_SHORTTIME_MS},
+    {SM_REQ_NONE,               BMS_IsChargeRequested,      BMS_STATEMACH_CHARGE_PRECHARGE,     BMS_STATEMACH_SHORTTIME_MS},
+};
+
+static const SM_TRANSITION_s bms_precharge_transitions[] = {
+    {BMS_STATE_ERROR_REQUEST,   NULL_PTR,                   BMS_STATEMACH_ERROR,                BMS_STATEMACH_SHORTTIME_MS},
+    {SM_REQ_NONE,               BMS_IsDisconnectRequired,   BMS_STATEMACH_ERROR,                BMS_STATEMACH_SHORTTIME_MS},
+    {SM_REQ_NONE,               BMS_IsStandbyRequested,     BMS_STATEMACH_STANDBY,              BMS_STATEMACH_SHORTTIME_MS},
+    {SM_REQ_NONE,               BMS_IsContactorNormal,      BMS_STATEMACH_NORMAL,               BMS_STATEMACH_SHORTTIME_MS},
+    {SM_REQ_NONE,               BMS_IsContactorError,       BMS_STATEMACH_ERROR,                BMS_STATEMACH_SHORTTIME_MS},
+};
+
+static const SM_TRANSITION_s bms_charge_precharge_transitions[] = {
+    {BMS_STATE_ERROR_REQUEST,   NULL_PTR,                   BMS_STATEMACH_ERROR,                BMS_STATEMACH_SHORTTIME_MS},
+    {SM_REQ_NONE,               BMS_IsDisconnectRequired,   BMS_STATEMACH_ERROR,                BMS_STATEMACH_SHORTTIME_MS},
+    {SM_REQ_NONE,               BMS_IsStandbyRequested,     BMS_STATEMACH_STANDBY,              BMS_STATEMACH_SHORTTIME_MS},
+    {SM_REQ_NONE,               BMS_IsContactorCharge,      BMS_STATEMACH_CHARGE,               BMS_STATEMACH_SHORTTIME_MS},
+    {SM_REQ_NONE,               BMS_IsContactorError,       BMS_STATEMACH_ERROR,                BMS_STATEMACH_SHORTTIME_MS},
+};
+
+/* NORMAL and CHARGE are left the same way */
+static const SM_TRANSITION_s bms_closed_transitions[] = {
+    {BMS_STATE_ERROR_REQUEST,   NULL_PTR,                   BMS_STATEMACH_ERROR,                BMS_STATEMACH_SHORTTIME_MS},
+    {SM_REQ_NONE,               BMS_IsDisconnectRequired,   BMS_STATEMACH_ERROR,                BMS_STATEMACH_SHORTTIME_MS},
+    {SM_REQ_NONE,               BMS_IsStandbyRequested,     BMS_STATEMACH_STANDBY,              BMS_STATEMACH_SHORTTIME_MS},
+};
+
+static const SM_TRANSITION_s bms_error_transitions[] = {
+    {BMS_STATE_ERROR_REQUEST,   NULL_PTR,                   SM_STATE_STAY,                      0},
+    {SM_REQ_NONE,               BMS_IsInterlockClosedAfterError, BMS_STATEMACH_STANDBY,         BMS_STATEMACH_SHORTTIME_MS},
+};
 
 /**
- * @brief   re-entrance check of SYS state machine trigger function
- *
- * @details This function is not re-entrant and should only be called time- or event-triggered. It
- *          increments the triggerentry counter from the state variable ltc_state. It should never
- *          be called by two different processes, so if it is the case, triggerentry should never
- *          be higher than 0 when this function is called.
- *
- * @return  retval  0 if no further instance of the function is active, 0xff else
+ * state table of the BMS state machine, the first entry is the initial state
  */
-static uint8_t BMS_CheckReEntrance(void) {
-    uint8_t retval = 0;
-    OS_TaskEnter_Critical();
-    if (!bms_state.triggerentry) {
-        bms_state.triggerentry++;
-    } else {
-        retval = 0xFF;  // multiple calls of function
-    }
-    OS_TaskExit_Critical();
-    return (retval);
-}
+static const SM_STATE_s bms_states[] = {
+    /* id                               entry                       run                 exit                    timeout, target, substate   transitions */
+    {BMS_STATEMACH_UNINITIALIZED,       NULL_PTR,                   NULL_PTR,           BMS_ExitUninitialized,  0, 0, 0,    bms_uninitialized_transitions,      SM_NR_OF(bms_uninitialized_transitions)},
+    {BMS_STATEMACH_INITIALIZATION,      NULL_PTR,                   NULL_PTR,           NULL_PTR,               0, 0, 0,    bms_initialization_transitions,     SM_NR_OF(bms_initialization_transitions)},
+    {BMS_STATEMACH_INITIALIZED,         NULL_PTR,                   NULL_PTR,           NULL_PTR,               0, 0, 0,    bms_initialized_transitions,        SM_NR_OF(bms_initialized_transitions)},
+    {BMS_STATEMACH_IDLE,                BMS_EntryPublish,           NULL_PTR,           NULL_PTR,               0, 0, 0,    bms_idle_transitions,               SM_NR_OF(bms_idle_transitions)},
+    {BMS_STATEMACH_STANDBY,             BMS_EntryStandby,           BMS_RunStandby,     NULL_PTR,               0, 0, 0,    bms_standby_transitions,            SM_NR_OF(bms_standby_transitions)},
+    {BMS_STATEMACH_PRECHARGE,           BMS_EntryPrecharge,         BMS_RunDriving,     NULL_PTR,               0, 0, 0,    bms_precharge_transitions,          SM_NR_OF(bms_precharge_transitions)},
+    {BMS_STATEMACH_NORMAL,              BMS_EntryPublish,           BMS_RunDriving,     NULL_PTR,               0, 0, 0,    bms_closed_transitions,             SM_NR_OF(bms_closed_transitions)},
+    {BMS_STATEMACH_CHARGE_PRECHARGE,    BMS_EntryChargePrecharge,   BMS_RunDriving,     NULL_PTR,               0, 0, 0,    bms_charge_precharge_transitions,   SM_NR_OF(bms_charge_precharge_transitions)},
+    {BMS_STATEMACH_CHARGE,              BMS_EntryPublish,           BMS_RunDriving,     NULL_PTR,               0, 0, 0,    bms_closed_transitions,             SM_NR_OF(bms_closed_transitions)},
+    {BMS_STATEMACH_ERROR,               BMS_EntryError,             BMS_RunError,       NULL_PTR,               0, 0, 0,    bms_error_transitions,              SM_NR_OF(bms_error_transitions)},
+};
+
+static const SM_CONFIG_s bms_sm_cfg = {
+    .states         = bms_states,
+    .nr_states      = SM_NR_OF(bms_states),
+    .cyclic         = NULL_PTR,
+    .cycletime      = 1,
+    .noreq          = BMS_STATE_NO_REQUEST,
+};
 
 /**
- * @brief   gets the current state request.
- *
- * @details This function is used in the functioning of the SYS state machine.
- *
- * @return  current state request, taken from BMS_STATE_REQUEST_e
+ * contains the state of the BMS state machine
  */
-static BMS_STATE_REQUEST_e BMS_GetStateRequest(void) {
-    BMS_STATE_REQUEST_e retval = BMS_STATE_NO_REQUEST;
-
-    OS_TaskEnter_Critical();
-    retval    = bms_state.statereq;
-    OS_TaskExit_Critical();
+static SM_MACHINE_s bms_sm = {
+    .cfg                    = &bms_sm_cfg,
+    .timer                  = 0,
+    .statereq               = BMS_STATE_NO_REQUEST,
+    .index                  = 0,
+    .substate               = BMS_ENTRY,
+    .laststate              = BMS_STATEMACH_UNINITIALIZED,
+    .lastsubstate           = 0,
+    .entrypending           = FALSE,
+    .triggerentry           = 0,
+    .ErrRequestCounter      = 0,
+};
 
-    return (retval);
-}
+static DATA_BLOCK_CELLVOLTAGE_s bms_cellvoltage;
+static DATA_BLOCK_CELLTEMPERATURE_s bms_celltemperature;
+static SOA_RESULT_s bms_voltage_soa;
+static SOA_RESULT_s bms_temperature_soa;
+static uint32_t bms_voltage_timestamp = 0;
+static uint32_t bms_temperature_timestamp = 0;
+static BS_CURRENT_DIRECTION_e bms_temperature_direction = BS_CURRENT_DISCHARGE;
+static LMON_MONITOR_s bms_lmon[BMS_LMON_NR_OF];
+static int32_t bms_lmon_value[BMS_LMON_NR_OF];
 
+/*================== Function Implementations =============================*/
 
 BMS_STATEMACH_e BMS_GetState(void) {
-    return (bms_state.state);
+    return ((BMS_STATEMACH_e)SM_GetState(&bms_sm));
 }
 
-/**
- * @brief   transfers the current state request to the state machine.
- *
- * @details This function takes the current state request from cont_state and transfers it to th
- *          state machine. It resets the value from cont_state to BMS_STATE_NO_REQUEST
- *
- * @return  retVal          current state request, taken from BMS_STATE_REQUEST_e
- */
-static BMS_STATE_REQUEST_e BMS_TransferStateRequest(void) {
-    BMS_STATE_REQUEST_e retval = BMS_STATE_NO_REQUEST;
-
-    OS_TaskEnter_Critical();
-    retval    = bms_state.statereq;
-    bms_state.statereq = BMS_STATE_NO_REQUEST;
-    OS_TaskExit_Critical();
-    return (retval);
-}
 
+LMON_LEVEL_e BMS_GetLimitLevel(BMS_LMON_e monitor) {
+    return LMON_GetLevel(&bms_lmon[monitor]);
+}
 
 
 BMS_RETURN_TYPE_e BMS_SetStateRequest(BMS_STATE_REQUEST_e statereq) {
-    BMS_RETURN_TYPE_e retVal = BMS_STATE_NO_REQUEST;
-
-    OS_TaskEnter_Critical();
-    retVal = BMS_CheckStateRequest(statereq);
-
-    if (retVal == BMS_OK) {
-            bms_state.statereq = statereq;
-    }
-    OS_TaskExit_Critical();
-
-    return (retVal);
+    return ((BMS_RETURN_TYPE_e)SM_SetStateRequest(&bms_sm, statereq, BMS_CheckStateRequest));
 }
 
 /**
  * @brief   checks the state requests that are made.
  *
  * @details This function checks the validity of the state requests. The results of the checked is
- *          returned immediately.
+ *          returned immediately. It is called by the state machine engine within a critical section.
  *
  * @param   statereq    state request to be checked
  *
  * @return  result of the state request that was made, taken from BMS_RETURN_TYPE_e
  */
-static BMS_RETURN_TYPE_e BMS_CheckStateRequest(BMS_STATE_REQUEST_e statereq) {
+static uint8_t BMS_CheckStateRequest(uint8_t statereq) {
     if (statereq == BMS_STATE_ERROR_REQUEST) {
         return BMS_OK;
     }
 
-    if (bms_state.statereq == BMS_STATE_NO_REQUEST) {
+    if (bms_sm.statereq == BMS_STATE_NO_REQUEST) {
         // init only allowed from the uninitialized state
         if (statereq == BMS_STATE_INIT_REQUEST) {
-            if (bms_state.state == BMS_STATEMACH_UNINITIALIZED) {
+            if (SM_GetState(&bms_sm) == BMS_STATEMACH_UNINITIALIZED) {
                 return BMS_OK;
             } else {
                 return BMS_ALREADY_INITIALIZED;
@@ -191,513 +236,233 @@ static BMS_RETURN_TYPE_e BMS_CheckStateRequest(BMS_STATE_REQUEST_e statereq) {
 }
 
 void BMS_Trigger(void) {
-    BMS_STATE_REQUEST_e statereq = BMS_STATE_NO_REQUEST;
-    CONT_STATEMACH_e contstate = CONT_STATEMACH_UNDEFINED;
-    DATA_BLOCK_SYSTEMSTATE_s systemstate = {0};
-    uint8_t bal_request = 0;
+    uint8_t state = 0;
 
     DIAG_SysMonNotify(DIAG_SYSMON_BMS_ID, 0);  // task is running, state = ok
 
-    if (bms_state.state != BMS_STATEMACH_UNINITIALIZED) {
+    if (SM_GetState(&bms_sm) != BMS_STATEMACH_UNINITIALIZED) {
         BMS_CheckVoltages();
         BMS_CheckTemperatures();
         BMS_CheckCurrent();
+        LMON_Evaluate(bms_lmon, bms_lmon_value, BMS_LMON_NR_OF);
     }
-    // Check re-entrance of function
-    if (BMS_CheckReEntrance()) {
-        return;
+
+    state = SM_GetState(&bms_sm);
+    SM_Trigger(&bms_sm);
+    if (SM_GetState(&bms_sm) != state) {
+        // write the values held back by the NVM persistence policies, e.g., before the system is switched off in STANDBY
+        NVM_PolicyFlush();
     }
+}
+
+/*================== Static functions =====================================*/
+
+/*================== Guards ===============================================*/
+
+/**
+ * @brief   guard: the derating manager requests to open the contactors
+ *
+ * @details Only errors that require a disconnection lead to ERROR. While the contactors are closed
+ *          in NORMAL or CHARGE, a ramp-down is finished before, errors that only derate the current
+ *          limits keep the battery connected.
+ */
+static uint8_t BMS_IsDisconnectRequired(void) {
+    uint8_t closed = FALSE;
+
+    if (BMS_CheckAnyErrorFlagSet() == E_OK) {
+        return FALSE;
+    }
+    closed = ((SM_GetState(&bms_sm) == BMS_STATEMACH_NORMAL) || (SM_GetState(&bms_sm) == BMS_STATEMACH_CHARGE));
+    return DRT_IsDisconnectRequired(closed);
+}
+
+/**
+ * @brief   guard: standby requested over CAN, once the entry sequence of the state is finished
+ */
+static uint8_t BMS_IsStandbyRequested(void) {
+    return ((bms_sm.substate == BMS_CHECK_STATE_REQUESTS) && (BMS_CheckCANRequests() == BMS_REQ_ID_STANDBY));
+}
+
+/**
+ * @brief   guard: normal mode requested over CAN, once the entry sequence of the state is finished
+ */
+static uint8_t BMS_IsNormalRequested(void) {
+    return ((bms_sm.substate == BMS_CHECK_STATE_REQUESTS) && (BMS_CheckCANRequests() == BMS_REQ_ID_NORMAL));
+}
+
+/**
+ * @brief   guard: charge mode requested over CAN, once the entry sequence of the state is finished
+ */
+static uint8_t BMS_IsChargeRequested(void) {
+    return ((bms_sm.substate == BMS_CHECK_STATE_REQUESTS) && (BMS_CheckCANRequests() == BMS_REQ_ID_CHARGE));
+}
+
+/**
+ * @brief   guard: contactor state machine reached normal
+ */
+static uint8_t BMS_IsContactorNormal(void) {
+    return (CONT_GetState() == CONT_STATEMACH_NORMAL);
+}
+
+/**
+ * @brief   guard: contactor state machine reached charge
+ */
+static uint8_t BMS_IsContactorCharge(void) {
+    return (CONT_GetState() == CONT_STATEMACH_CHARGE);
+}
 
-    if (bms_state.timer) {
-        if (--bms_state.timer) {
-            bms_state.triggerentry--;
-            return;    // handle state machine only if timer has elapsed
+/**
+ * @brief   guard: contactor state machine went to error
+ */
+static uint8_t BMS_IsContactorError(void) {
+    return (CONT_GetState() == CONT_STATEMACH_ERROR);
+}
+
+/**
+ * @brief   guard: interlock closed again after the error was cleared and standby was requested
+ */
+static uint8_t BMS_IsInterlockClosedAfterError(void) {
+    return ((bms_sm.substate == BMS_CHECK_INTERLOCK_CLOSE_AFTER_ERROR) && (ILCK_GetInterlockFeedback() == ILCK_SWITCH_ON));
+}
+
+/*================== Actions ==============================================*/
+
+/**
+ * @brief   exit action of UNINITIALIZED: sets the per-cell limits, the limit monitors and clears the current budgets before the first check
+ */
+static void BMS_ExitUninitialized(void) {
+    SOA_Init();
+    LMON_Init(bms_lmon, bms_lmon_cfg, BMS_LMON_NR_OF);
+    BUDG_Init();
+}
+
+/**
+ * @brief   entry action: publishes the new state in the database
+ */
+static void BMS_EntryPublish(void) {
+    BMS_PublishState();
+    SM_SetSubstate(&bms_sm, BMS_CHECK_STATE_REQUESTS, BMS_STATEMACH_SHORTTIME_MS);
+}
+
+/**
+ * @brief   entry action of STANDBY: opens the contactors and closes the interlock
+ */
+static void BMS_EntryStandby(void) {
+    CONT_SetStateRequest(CONT_STATE_STANDBY_REQUEST);
+    ILCK_SetStateRequest(ILCK_STATE_CLOSE_REQUEST);
+    BMS_ForwardBalancingRequest(BAL_STATE_STOP_OVERRIDE_ACTIVE_REQUEST, BAL_STATE_ACTIVE_REQUEST);
+    BMS_PublishState();
+    SM_SetSubstate(&bms_sm, BMS_INTERLOCK_CHECKED, BMS_STATEMACH_MEDIUMTIME_MS);
+}
+
+/**
+ * @brief   entry action of PRECHARGE: requests the contactors to close in normal mode
+ */
+static void BMS_EntryPrecharge(void) {
+    BMS_PublishState();
+    BMS_ForwardBalancingRequest(BAL_STATE_STOP_OVERRIDE_INACTIVE_REQUEST, BAL_STATE_INACTIVE_REQUEST);
+    CONT_SetStateRequest(CONT_STATE_NORMAL_REQUEST);
+    SM_SetSubstate(&bms_sm, BMS_CHECK_STATE_REQUESTS, BMS_STATEMACH_SHORTTIME_MS);
+}
+
+/**
+ * @brief   entry action of CHARGE_PRECHARGE: requests the contactors to close in charge mode
+ */
+static void BMS_EntryChargePrecharge(void) {
+    BMS_PublishState();
+    BMS_ForwardBalancingRequest(BAL_STATE_STOP_OVERRIDE_INACTIVE_REQUEST, BAL_STATE_ACTIVE_REQUEST);
+    CONT_SetStateRequest(CONT_STATE_CHARGE_REQUEST);
+    SM_SetSubstate(&bms_sm, BMS_CHECK_STATE_REQUESTS, BMS_STATEMACH_SHORTTIME_MS);
+}
+
+/**
+ * @brief   entry action of ERROR: stops balancing and opens the contactors
+ */
+static void BMS_EntryError(void) {
+    BAL_SetStateRequest(BAL_STATE_STOP_OVERRIDE_INACTIVE_REQUEST);
+    CONT_SetStateRequest(CONT_STATE_ERROR_REQUEST);
+    BMS_PublishState();
+    SM_SetSubstate(&bms_sm, BMS_OPEN_INTERLOCK, BMS_STATEMACH_MEDIUMTIME_MS);
+}
+
+/**
+ * @brief   run action of STANDBY: waits for the interlock, then forwards balancing requests
+ */
+static void BMS_RunStandby(void) {
+    if (bms_sm.substate == BMS_INTERLOCK_CHECKED) {
+        SM_SetSubstate(&bms_sm, BMS_CHECK_STATE_REQUESTS, BMS_STATEMACH_VERYLONGTIME_MS);
+    } else {
+        BMS_ForwardBalancingRequest(BAL_STATE_STOP_OVERRIDE_ACTIVE_REQUEST, BAL_STATE_NO_REQUEST);
+        bms_sm.timer = BMS_STATEMACH_SHORTTIME_MS;
+    }
+}
+
+/**
+ * @brief   run action of the states with (closing) contactors: forwards balancing requests
+ */
+static void BMS_RunDriving(void) {
+    BMS_ForwardBalancingRequest(BAL_STATE_STOP_OVERRIDE_INACTIVE_REQUEST, BAL_STATE_NO_REQUEST);
+    bms_sm.timer = BMS_STATEMACH_SHORTTIME_MS;
+}
+
+/**
+ * @brief   run action of ERROR: opens the interlock and waits for the error flags to be reset
+ */
+static void BMS_RunError(void) {
+    if (bms_sm.substate == BMS_OPEN_INTERLOCK) {
+        ILCK_SetStateRequest(ILCK_STATE_OPEN_REQUEST);
+        SM_SetSubstate(&bms_sm, BMS_CHECK_ERROR_FLAGS, BMS_STATEMACH_VERYLONGTIME_MS);
+    } else if (bms_sm.substate == BMS_CHECK_ERROR_FLAGS) {
+        if (BMS_CheckAnyErrorFlagSet() == E_NOT_OK) {
+            // we stay already in requested state, nothing to do
+        } else {
+            SM_SetSubstate(&bms_sm, BMS_CHECK_STATE_REQUESTS, BMS_STATEMACH_SHORTTIME_MS);
         }
+    } else if (bms_sm.substate == BMS_CHECK_STATE_REQUESTS) {
+        if (BMS_CheckCANRequests() == BMS_REQ_ID_STANDBY) {
+            ILCK_SetStateRequest(ILCK_STATE_CLOSE_REQUEST);
+            SM_SetSubstate(&bms_sm, BMS_CHECK_INTERLOCK_CLOSE_AFTER_ERROR, BMS_STATEMACH_MEDIUMTIME_MS);
+        } else {
+            SM_SetSubstate(&bms_sm, BMS_CHECK_ERROR_FLAGS, BMS_STATEMACH_SHORTTIME_MS);
+        }
+    } else if (bms_sm.substate == BMS_CHECK_INTERLOCK_CLOSE_AFTER_ERROR) {
+        // interlock not closed, the guard of the transition to STANDBY failed
+        SM_SetSubstate(&bms_sm, BMS_CHECK_ERROR_FLAGS, BMS_STATEMACH_SHORTTIME_MS);
     }
+}
 
-    /****Happens every time the state machine is triggered**************/
-    switch (bms_state.state) {
-        /****************************UNINITIALIZED***********************************/
-        case BMS_STATEMACH_UNINITIALIZED:
-            // waiting for Initialization Request
-            statereq = BMS_TransferStateRequest();
-            if (statereq == BMS_STATE_INIT_REQUEST) {
-                BMS_SAVELASTSTATES();
-                bms_state.timer = BMS_STATEMACH_SHORTTIME_MS;
-                bms_state.state = BMS_STATEMACH_INITIALIZATION;
-                bms_state.substate = BMS_ENTRY;
-            } else if (statereq == BMS_STATE_NO_REQUEST) {
-                // no actual request pending //
-            } else {
-                bms_state.ErrRequestCounter++;  // illegal request pending
-            }
-            break;
-
-
-        /****************************INITIALIZATION**********************************/
-        case BMS_STATEMACH_INITIALIZATION:
-            BMS_SAVELASTSTATES();
-            // CONT_SetStateRequest(CONT_STATE_INIT_REQUEST);
-
-            bms_state.timer = BMS_STATEMACH_LONGTIME_MS;
-            bms_state.state = BMS_STATEMACH_INITIALIZED;
-            bms_state.substate = BMS_ENTRY;
-
-            break;
-
-        /****************************INITIALIZED*************************************/
-        case BMS_STATEMACH_INITIALIZED:
-            BMS_SAVELASTSTATES();
-            bms_state.timer = BMS_STATEMACH_SHORTTIME_MS;
-            bms_state.state = BMS_STATEMACH_IDLE;
-            bms_state.substate = BMS_ENTRY;
-            break;
-
-        /****************************IDLE*************************************/
-        case BMS_STATEMACH_IDLE:
-            BMS_SAVELASTSTATES();
-
-            if (bms_state.substate == BMS_ENTRY) {
-                DB_ReadBlock(&systemstate, DATA_BLOCK_ID_SYSTEMSTATE);
-                systemstate.bms_state = BMS_STATEMACH_IDLE;
-                DB_WriteBlock(&systemstate, DATA_BLOCK_ID_SYSTEMSTATE);
-                bms_state.timer = BMS_STATEMACH_SHORTTIME_MS;
-                bms_state.substate = BMS_CHECK_ERROR_FLAGS;
-                break;
-            } else if (bms_state.substate == BMS_CHECK_ERROR_FLAGS) {
-                if (BMS_CheckAnyErrorFlagSet() == E_NOT_OK) {
-                    bms_state.timer = BMS_STATEMACH_SHORTTIME_MS;
-                    bms_state.state = BMS_STATEMACH_ERROR;
-                    bms_state.substate = BMS_ENTRY;
-                    break;
-                } else {
-                    bms_state.timer = BMS_STATEMACH_SHORTTIME_MS;
-                    bms_state.substate = BMS_CHECK_STATE_REQUESTS;
-                    break;
-                }
-            } else if (bms_state.substate == BMS_CHECK_STATE_REQUESTS) {
-                if (BMS_CheckCANRequests() == BMS_REQ_ID_STANDBY) {
-                    bms_state.timer = BMS_STATEMACH_SHORTTIME_MS;
-                    bms_state.state = BMS_STATEMACH_STANDBY;
-                    bms_state.substate = BMS_ENTRY;
-                    break;
-                } else {
-                    bms_state.timer = BMS_STATEMACH_SHORTTIME_MS;
-                    bms_state.substate = BMS_CHECK_ERROR_FLAGS;
-                    break;
-                }
-            }
-            break;
-
-
-        /****************************STANDBY*************************************/
-        case BMS_STATEMACH_STANDBY:
-            BMS_SAVELASTSTATES();
-
-            if (bms_state.substate == BMS_ENTRY){
-                CONT_SetStateRequest(CONT_STATE_STANDBY_REQUEST);
-                ILCK_SetStateRequest(ILCK_STATE_CLOSE_REQUEST);
-                bal_request = BMS_CheckBalancingRequests();
-                if (bal_request == BMS_BAL_INACTIVE_OVERRIDE) {
-                    BAL_SetStateRequest(BAL_STATE_INACTIVE_OVERRIDE_REQUEST);
-                }
-                else if (bal_request == BMS_BAL_ACTIVE_OVERRIDE) {
-                    BAL_SetStateRequest(BAL_STATE_ACTIVE_OVERRIDE_REQUEST);
-                }
-                else if (bal_request == BMS_BAL_OUT_OF_OVERRIDE) {
-                    BAL_SetStateRequest(BAL_STATE_STOP_OVERRIDE_ACTIVE_REQUEST);
-                } else {
-                    BAL_SetStateRequest(BAL_STATE_ACTIVE_REQUEST);
-                }
-                bms_state.timer = BMS_STATEMACH_MEDIUMTIME_MS;
-                bms_state.substate = BMS_CHECK_ERROR_FLAGS_INTERLOCK;
-                DB_ReadBlock(&systemstate, DATA_BLOCK_ID_SYSTEMSTATE);
-                systemstate.bms_state = BMS_STATEMACH_STANDBY;
-                DB_WriteBlock(&systemstate, DATA_BLOCK_ID_SYSTEMSTATE);
-                break;
-            } else if (bms_state.substate == BMS_CHECK_ERROR_FLAGS_INTERLOCK) {
-                if (BMS_CheckAnyErrorFlagSet() == E_NOT_OK) {
-                    bms_state.timer = BMS_STATEMACH_SHORTTIME_MS;
-                    bms_state.state = BMS_STATEMACH_ERROR;
-                    bms_state.substate = BMS_ENTRY;
-                    break;
-                } else {
-                    bms_state.timer = BMS_STATEMACH_SHORTTIME_MS;
-                    bms_state.substate = BMS_INTERLOCK_CHECKED;
-                    break;
-                }
-            }
-            else if (bms_state.substate == BMS_INTERLOCK_CHECKED){
-                bms_state.timer = BMS_STATEMACH_VERYLONGTIME_MS;
-                bms_state.substate = BMS_CHECK_ERROR_FLAGS;
-                break;
-            } else if (bms_state.substate == BMS_CHECK_ERROR_FLAGS) {
-                if (BMS_CheckAnyErrorFlagSet() == E_NOT_OK) {
-                    bms_state.timer = BMS_STATEMACH_SHORTTIME_MS;
-                    bms_state.state = BMS_STATEMACH_ERROR;
-                    bms_state.substate = BMS_ENTRY;
-                    break;
-                } else {
-                    bms_state.timer = BMS_STATEMACH_SHORTTIME_MS;
-                    bms_state.substate = BMS_CHECK_BALANCING_REQUESTS;
-                    break;
-                }
-            } else if (bms_state.substate == BMS_CHECK_BALANCING_REQUESTS) {
-                bal_request = BMS_CheckBalancingRequests();
-                if (bal_request == BMS_BAL_INACTIVE_OVERRIDE) {
-                    BAL_SetStateRequest(BAL_STATE_INACTIVE_OVERRIDE_REQUEST);
-                }
-                if (bal_request == BMS_BAL_ACTIVE_OVERRIDE) {
-                    BAL_SetStateRequest(BAL_STATE_ACTIVE_OVERRIDE_REQUEST);
-                }
-                if (bal_request == BMS_BAL_OUT_OF_OVERRIDE) {
-                    BAL_SetStateRequest(BAL_STATE_STOP_OVERRIDE_ACTIVE_REQUEST);
-                }
-                bms_state.timer = BMS_STATEMACH_SHORTTIME_MS;
-                bms_state.substate = BMS_CHECK_STATE_REQUESTS;
-                break;
-            } else if (bms_state.substate == BMS_CHECK_STATE_REQUESTS) {
-                if (BMS_CheckCANRequests() == BMS_REQ_ID_NORMAL) {
-                    bms_state.timer = BMS_STATEMACH_SHORTTIME_MS;
-                    bms_state.state = BMS_STATEMACH_PRECHARGE;
-                    bms_state.substate = BMS_ENTRY;
-                    break;
-                }
-                if (BMS_CheckCANRequests() == BMS_REQ_ID_CHARGE){
-                    bms_state.timer = BMS_STATEMACH_SHORTTIME_MS;
-                    bms_state.state = BMS_STATEMACH_CHARGE_PRECHARGE;
-                    bms_state.substate = BMS_ENTRY;
-                    break;
-                } else {
-                    bms_state.timer = BMS_STATEMACH_SHORTTIME_MS;
-                    bms_state.substate = BMS_CHECK_ERROR_FLAGS;
-                    break;
-                }
-            }
-            break;
-
-        /****************************PRECHARGE*************************************/
-        case BMS_STATEMACH_PRECHARGE:
-            BMS_SAVELASTSTATES();
-
-            if (bms_state.substate == BMS_ENTRY) {
-                DB_ReadBlock(&systemstate, DATA_BLOCK_ID_SYSTEMSTATE);
-                systemstate.bms_state = BMS_STATEMACH_PRECHARGE;
-                DB_WriteBlock(&systemstate, DATA_BLOCK_ID_SYSTEMSTATE);
-                bal_request = BMS_CheckBalancingRequests();
-                if (bal_request == BMS_BAL_INACTIVE_OVERRIDE) {
-                    BAL_SetStateRequest(BAL_STATE_INACTIVE_OVERRIDE_REQUEST);
-                }
-                else if (bal_request == BMS_BAL_ACTIVE_OVERRIDE) {
-                    BAL_SetStateRequest(BAL_STATE_ACTIVE_OVERRIDE_REQUEST);
-                }
-                else if (bal_request == BMS_BAL_OUT_OF_OVERRIDE) {
-                    BAL_SetStateRequest(BAL_STATE_STOP_OVERRIDE_INACTIVE_REQUEST);
-                } else {
-                    BAL_SetStateRequest(BAL_STATE_INACTIVE_REQUEST);
-                }
-                CONT_SetStateRequest(CONT_STATE_NORMAL_REQUEST);
-                bms_state.substate = BMS_CHECK_ERROR_FLAGS;
-                bms_state.timer = BMS_STATEMACH_SHORTTIME_MS;
-                break;
-            } else if (bms_state.substate == BMS_CHECK_ERROR_FLAGS) {
-                if (BMS_CheckAnyErrorFlagSet() == E_NOT_OK) {
-                    bms_state.timer = BMS_STATEMACH_SHORTTIME_MS;
-                    bms_state.state = BMS_STATEMACH_ERROR;
-                    bms_state.substate = BMS_ENTRY;
-                    break;
-                } else {
-                    bms_state.timer = BMS_STATEMACH_SHORTTIME_MS;
-                    bms_state.substate = BMS_CHECK_BALANCING_REQUESTS;
-                    break;
-                }
-            } else if (bms_state.substate == BMS_CHECK_BALANCING_REQUESTS) {
-                bal_request = BMS_CheckBalancingRequests();
-                if (bal_request == BMS_BAL_INACTIVE_OVERRIDE) {
-                    BAL_SetStateRequest(BAL_STATE_INACTIVE_OVERRIDE_REQUEST);
-                }
-                if (bal_request == BMS_BAL_ACTIVE_OVERRIDE) {
-                    BAL_SetStateRequest(BAL_STATE_ACTIVE_OVERRIDE_REQUEST);
-                }
-                if (bal_request == BMS_BAL_OUT_OF_OVERRIDE) {
-                    BAL_SetStateRequest(BAL_STATE_STOP_OVERRIDE_INACTIVE_REQUEST);
-                }
-                bms_state.timer = BMS_STATEMACH_SHORTTIME_MS;
-                bms_state.substate = BMS_CHECK_STATE_REQUESTS;
-                break;
-            } else if (bms_state.substate == BMS_CHECK_STATE_REQUESTS) {
-                if (BMS_CheckCANRequests() == BMS_REQ_ID_STANDBY) {
-                    bms_state.timer = BMS_STATEMACH_SHORTTIME_MS;
-                    bms_state.state = BMS_STATEMACH_STANDBY;
-                    bms_state.substate = BMS_ENTRY;
-                    break;
-                } else {
-                    bms_state.timer = BMS_STATEMACH_SHORTTIME_MS;
-                    bms_state.substate = BMS_CHECK_CONTACTOR_NORMAL_STATE;
-                    break;
-                }
-            } else if (bms_state.substate == BMS_CHECK_CONTACTOR_NORMAL_STATE) {
-                contstate = CONT_GetState();
-                if (contstate == CONT_STATEMACH_NORMAL) {
-                    bms_state.timer = BMS_STATEMACH_SHORTTIME_MS;
-                    bms_state.state = BMS_STATEMACH_NORMAL;
-                    bms_state.substate = BMS_ENTRY;
-                    break;
-                } else if (contstate == CONT_STATEMACH_ERROR) {
-                    bms_state.timer = BMS_STATEMACH_SHORTTIME_MS;
-                    bms_state.state = BMS_STATEMACH_ERROR;
-                    bms_state.substate = BMS_ENTRY;
-                    break;
-                } else {
-                    bms_state.timer = BMS_STATEMACH_SHORTTIME_MS;
-                    bms_state.substate = BMS_CHECK_ERROR_FLAGS;
-                }
-            }
-            break;
-
-        /****************************NORMAL*************************************/
-        case BMS_STATEMACH_NORMAL:
-            BMS_SAVELASTSTATES();
-            if (bms_state.substate == BMS_ENTRY) {
-                DB_ReadBlock(&systemstate, DATA_BLOCK_ID_SYSTEMSTATE);
-                systemstate.bms_state = BMS_STATEMACH_NORMAL;
-                DB_WriteBlock(&systemstate, DATA_BLOCK_ID_SYSTEMSTATE);
-                bms_state.timer = BMS_STATEMACH_SHORTTIME_MS;
-                bms_state.substate = BMS_CHECK_ERROR_FLAGS;
-                break;
-            } else if (bms_state.substate == BMS_CHECK_ERROR_FLAGS) {
-                if (BMS_CheckAnyErrorFlagSet() == E_NOT_OK) {
-                    bms_state.timer = BMS_STATEMACH_SHORTTIME_MS;
-                    bms_state.state = BMS_STATEMACH_ERROR;
-                    bms_state.substate = BMS_ENTRY;
-                    break;
-                } else {
-                    bms_state.timer = BMS_STATEMACH_SHORTTIME_MS;
-                    bms_state.substate = BMS_CHECK_BALANCING_REQUESTS;
-                    break;
-                }
-            } else if (bms_state.substate == BMS_CHECK_BALANCING_REQUESTS) {
-                bal_request = BMS_CheckBalancingRequests();
-                if (bal_request == BMS_BAL_INACTIVE_OVERRIDE) {
-                    BAL_SetStateRequest(BAL_STATE_INACTIVE_OVERRIDE_REQUEST);
-                }
-                if (bal_request == BMS_BAL_ACTIVE_OVERRIDE) {
-                    BAL_SetStateRequest(BAL_STATE_ACTIVE_OVERRIDE_REQUEST);
-                }
-                if (bal_request == BMS_BAL_OUT_OF_OVERRIDE) {
-                    BAL_SetStateRequest(BAL_STATE_STOP_OVERRIDE_INACTIVE_REQUEST);
-                }
-                bms_state.timer = BMS_STATEMACH_SHORTTIME_MS;
-                bms_state.substate = BMS_CHECK_STATE_REQUESTS;
-                break;
-            } else if (bms_state.substate == BMS_CHECK_STATE_REQUESTS) {
-                if (BMS_CheckCANRequests() == BMS_REQ_ID_STANDBY) {
-                    bms_state.timer = BMS_STATEMACH_SHORTTIME_MS;
-                    bms_state.state = BMS_STATEMACH_STANDBY;
-                    bms_state.substate = BMS_ENTRY;
-                    break;
-                } else {
-                    bms_state.timer = BMS_STATEMACH_SHORTTIME_MS;
-                    bms_state.substate = BMS_CHECK_ERROR_FLAGS;
-                    break;
-                }
-            }
-            break;
-
-            /****************************CHARGE_PRECHARGE*************************************/
-            case BMS_STATEMACH_CHARGE_PRECHARGE:
-                BMS_SAVELASTSTATES();
-
-                if (bms_state.substate == BMS_ENTRY){
-                    DB_ReadBlock(&systemstate, DATA_BLOCK_ID_SYSTEMSTATE);
-                    systemstate.bms_state = BMS_STATEMACH_CHARGE_PRECHARGE;
-                    DB_WriteBlock(&systemstate, DATA_BLOCK_ID_SYSTEMSTATE);
-                    bal_request = BMS_CheckBalancingRequests();
-                    if (bal_request == BMS_BAL_INACTIVE_OVERRIDE) {
-                        BAL_SetStateRequest(BAL_STATE_INACTIVE_OVERRIDE_REQUEST);
-                    }
-                    else if (bal_request == BMS_BAL_ACTIVE_OVERRIDE) {
-                        BAL_SetStateRequest(BAL_STATE_ACTIVE_OVERRIDE_REQUEST);
-                    }
-                    else if (bal_request == BMS_BAL_OUT_OF_OVERRIDE) {
-                        BAL_SetStateRequest(BAL_STATE_STOP_OVERRIDE_INACTIVE_REQUEST);
-                    } else {
-                        BAL_SetStateRequest(BAL_STATE_ACTIVE_REQUEST);
-                    }
-                    CONT_SetStateRequest(CONT_STATE_CHARGE_REQUEST);
-                    bms_state.substate = BMS_CHECK_ERROR_FLAGS;
-                    bms_state.timer = BMS_STATEMACH_SHORTTIME_MS;
-                    break;
-                }
-                else if (bms_state.substate == BMS_CHECK_ERROR_FLAGS){
-                    if (BMS_CheckAnyErrorFlagSet() == E_NOT_OK){
-                        bms_state.timer = BMS_STATEMACH_SHORTTIME_MS;
-                        bms_state.state = BMS_STATEMACH_ERROR;
-                        bms_state.substate = BMS_ENTRY;
-                        break;
-                    } else{
-                        bms_state.timer = BMS_STATEMACH_SHORTTIME_MS;
-                        bms_state.substate = BMS_CHECK_BALANCING_REQUESTS;
-                        break;
-                    }
-                }
-                else if (bms_state.substate == BMS_CHECK_BALANCING_REQUESTS) {
-                    bal_request = BMS_CheckBalancingRequests();
-                    if (bal_request == BMS_BAL_INACTIVE_OVERRIDE) {
-                        BAL_SetStateRequest(BAL_STATE_INACTIVE_OVERRIDE_REQUEST);
-                    }
-                    if (bal_request == BMS_BAL_ACTIVE_OVERRIDE) {
-                        BAL_SetStateRequest(BAL_STATE_ACTIVE_OVERRIDE_REQUEST);
-                    }
-                    if (bal_request == BMS_BAL_OUT_OF_OVERRIDE) {
-                        BAL_SetStateRequest(BAL_STATE_STOP_OVERRIDE_INACTIVE_REQUEST);
-                    }
-                    bms_state.timer = BMS_STATEMACH_SHORTTIME_MS;
-                    bms_state.substate = BMS_CHECK_STATE_REQUESTS;
-                    break;
-                } else if (bms_state.substate == BMS_CHECK_STATE_REQUESTS){
-                    if (BMS_CheckCANRequests() == BMS_REQ_ID_STANDBY){
-                        bms_state.timer = BMS_STATEMACH_SHORTTIME_MS;
-                        bms_state.state = BMS_STATEMACH_STANDBY;
-                        bms_state.substate = BMS_ENTRY;
-                        break;
-                    } else {
-                        bms_state.timer = BMS_STATEMACH_SHORTTIME_MS;
-                        bms_state.substate = BMS_CHECK_CONTACTOR_CHARGE_STATE;
-                        break;
-                    }
-                }
-                else if (bms_state.substate == BMS_CHECK_CONTACTOR_CHARGE_STATE){
-                    contstate = CONT_GetState();
-                    if (contstate == CONT_STATEMACH_CHARGE){
-                        bms_state.timer = BMS_STATEMACH_SHORTTIME_MS;
-                        bms_state.state = BMS_STATEMACH_CHARGE;
-                        bms_state.substate = BMS_ENTRY;
-                        break;
-                    } else if (contstate == CONT_STATEMACH_ERROR){
-                        bms_state.timer = BMS_STATEMACH_SHORTTIME_MS;
-                        bms_state.state = BMS_STATEMACH_ERROR;
-                        bms_state.substate = BMS_ENTRY;
-                        break;
-                    } else{
-                        bms_state.timer = BMS_STATEMACH_SHORTTIME_MS;
-                        bms_state.substate = BMS_CHECK_ERROR_FLAGS;
-                    }
-                }
-                break;
-
-
-
-
-            /****************************CHARGE*************************************/
-            case BMS_STATEMACH_CHARGE:
-                BMS_SAVELASTSTATES();
-
-                if (bms_state.substate == BMS_ENTRY){
-                    DB_ReadBlock(&systemstate, DATA_BLOCK_ID_SYSTEMSTATE);
-                    systemstate.bms_state = BMS_STATEMACH_CHARGE;
-                    DB_WriteBlock(&systemstate, DATA_BLOCK_ID_SYSTEMSTATE);
-                    bms_state.timer = BMS_STATEMACH_SHORTTIME_MS;
-                    bms_state.substate = BMS_CHECK_ERROR_FLAGS;
-                    break;
-                } else if (bms_state.substate == BMS_CHECK_ERROR_FLAGS){
-                    if (BMS_CheckAnyErrorFlagSet() == E_NOT_OK){
-                        bms_state.timer = BMS_STATEMACH_SHORTTIME_MS;
-                        bms_state.state = BMS_STATEMACH_ERROR;
-                        bms_state.substate = BMS_ENTRY;
-                        break;
-                    } else{
-                        bms_state.timer = BMS_STATEMACH_SHORTTIME_MS;
-                        bms_state.substate = BMS_CHECK_BALANCING_REQUESTS;
-                        break;
-                    }
-                }
-                else if (bms_state.substate == BMS_CHECK_BALANCING_REQUESTS) {
-                    bal_request = BMS_CheckBalancingRequests();
-                    if (bal_request == BMS_BAL_INACTIVE_OVERRIDE) {
-                        BAL_SetStateRequest(BAL_STATE_INACTIVE_OVERRIDE_REQUEST);
-                    }
-                    if (bal_request == BMS_BAL_ACTIVE_OVERRIDE) {
-                        BAL_SetStateRequest(BAL_STATE_ACTIVE_OVERRIDE_REQUEST);
-                    }
-                    if (bal_request == BMS_BAL_OUT_OF_OVERRIDE) {
-                        BAL_SetStateRequest(BAL_STATE_STOP_OVERRIDE_INACTIVE_REQUEST);
-                    }
-                    bms_state.timer = BMS_STATEMACH_SHORTTIME_MS;
-                    bms_state.substate = BMS_CHECK_STATE_REQUESTS;
-                    break;
-                } else if (bms_state.substate == BMS_CHECK_STATE_REQUESTS){
-                    if (BMS_CheckCANRequests() == BMS_REQ_ID_STANDBY){
-                        bms_state.timer = BMS_STATEMACH_SHORTTIME_MS;
-                        bms_state.state = BMS_STATEMACH_STANDBY;
-                        bms_state.substate = BMS_ENTRY;
-                        break;
-                    } else {
-                        bms_state.timer = BMS_STATEMACH_SHORTTIME_MS;
-                        bms_state.substate = BMS_CHECK_ERROR_FLAGS;
-                        break;
-                    }
-                }
-                break;
-
-        /****************************ERROR*************************************/
-        case BMS_STATEMACH_ERROR:
-            BMS_SAVELASTSTATES();
-            if (bms_state.substate == BMS_ENTRY) {
-                BAL_SetStateRequest(BAL_STATE_STOP_OVERRIDE_INACTIVE_REQUEST);
-                CONT_SetStateRequest(CONT_STATE_ERROR_REQUEST);
-                bms_state.timer = BMS_STATEMACH_MEDIUMTIME_MS;
-                bms_state.substate = BMS_OPEN_INTERLOCK;
-                DB_ReadBlock(&systemstate, DATA_BLOCK_ID_SYSTEMSTATE);
-                systemstate.bms_state = BMS_STATEMACH_ERROR;
-                DB_WriteBlock(&systemstate, DATA_BLOCK_ID_SYSTEMSTATE);
-                break;
-            } else if (bms_state.substate == BMS_OPEN_INTERLOCK) {
-                ILCK_SetStateRequest(ILCK_STATE_OPEN_REQUEST);
-                bms_state.timer = BMS_STATEMACH_VERYLONGTIME_MS;
-                bms_state.substate = BMS_CHECK_ERROR_FLAGS;
-                break;
-            } else if (bms_state.substate == BMS_CHECK_ERROR_FLAGS) {
-                if (BMS_CheckAnyErrorFlagSet() == E_NOT_OK) {
-                    // we stay already in requested state, nothing to do
-                } else {
-                    bms_state.timer = BMS_STATEMACH_SHORTTIME_MS;
-                    bms_state.substate = BMS_CHECK_STATE_REQUESTS;
-                    break;
-                }
-            } else if (bms_state.substate == BMS_CHECK_STATE_REQUESTS) {
-                if (BMS_CheckCANRequests() == BMS_REQ_ID_STANDBY) {
-                    ILCK_SetStateRequest(ILCK_STATE_CLOSE_REQUEST);
-                    bms_state.timer = BMS_STATEMACH_MEDIUMTIME_MS;
-                    bms_state.substate = BMS_CHECK_INTERLOCK_CLOSE_AFTER_ERROR;
-                    break;
-                } else {
-                    bms_state.timer = BMS_STATEMACH_SHORTTIME_MS;
-                    bms_state.substate = BMS_CHECK_ERROR_FLAGS;
-                    break;
-                }
-            } else if (bms_state.substate == BMS_CHECK_INTERLOCK_CLOSE_AFTER_ERROR) {
-                if (ILCK_GetInterlockFeedback() == ILCK_SWITCH_ON) {
-                    bms_state.timer = BMS_STATEMACH_SHORTTIME_MS;
-                    bms_state.state = BMS_STATEMACH_STANDBY;
-                    bms_state.substate = BMS_ENTRY;
-                    break;
-                } else {
-                    bms_state.timer = BMS_STATEMACH_SHORTTIME_MS;
-                    bms_state.substate = BMS_CHECK_ERROR_FLAGS;
-                    break;
-                }
-            }
-            break;
-        default:
-            break;
-    }  // end switch(bms_state.state)
+/**
+ * @brief   writes the current state of the BMS state machine to the database
+ */
+static void BMS_PublishState(void) {
+    DATA_BLOCK_SYSTEMSTATE_s systemstate;
 
-    bms_state.triggerentry--;
-    bms_state.counter++;
+    DB_ReadBlock(&systemstate, DATA_BLOCK_ID_SYSTEMSTATE);
+    systemstate.bms_state = SM_GetState(&bms_sm);
+    DB_WriteBlock(&systemstate, DATA_BLOCK_ID_SYSTEMSTATE);
+}
+
+/**
+ * @brief   forwards the balancing request from the database to the BAL state machine
+ *
+ * @param   outofoverride   BAL request made when leaving the override mode is requested
+ * @param   norequest       BAL request made if there is no balancing request,
+ *                          BAL_STATE_NO_REQUEST to make none
+ */
+static void BMS_ForwardBalancingRequest(BAL_STATE_REQUEST_e outofoverride, BAL_STATE_REQUEST_e norequest) {
+    uint8_t bal_request = BMS_CheckBalancingRequests();
+
+    if (bal_request == BMS_BAL_INACTIVE_OVERRIDE) {
+        BAL_SetStateRequest(BAL_STATE_INACTIVE_OVERRIDE_REQUEST);
+    } else if (bal_request == BMS_BAL_ACTIVE_OVERRIDE) {
+        BAL_SetStateRequest(BAL_STATE_ACTIVE_OVERRIDE_REQUEST);
+    } else if (bal_request == BMS_BAL_OUT_OF_OVERRIDE) {
+        BAL_SetStateRequest(outofoverride);
+    } else if (norequest != BAL_STATE_NO_REQUEST) {
+        BAL_SetStateRequest(norequest);
+    }
 }
 
-/*================== Static functions =====================================*/
 /*
  * @brief   Checks the state requests made to the BMS state machine
  *
@@ -756,82 +521,116 @@ static uint8_t BMS_CheckBalancingRequests(void) {
 
 
 /**
- * @brief   checks the abidance by the safe operating area
+ * @brief   raises a value to the error level of a monitor if cell-specific limits are violated
+ *
+ * @details The per-cell limits of the SOA module may be tighter than the limits of the monitor,
+ *          e.g., for cell-specific derating. A violation of a per-cell limit is treated as an
+ *          error level value.
  *
- * @details verify for cell voltage measurements (U), if minimum and maximum values are out of range
+ * @param   value           minimum or maximum value of all cells
+ * @param   nr_violations   number of cells violating their per-cell limit in the direction of the monitor
+ * @param   monitor         limit monitor the value is checked by
+ *
+ * @return  value to pass to the limit monitor
  */
-static void BMS_CheckVoltages(void) {
-    DATA_BLOCK_MINMAX_s minmax;
+static int32_t BMS_LimitValue(int32_t value, uint16_t nr_violations, BMS_LMON_e monitor) {
+    const LMON_CONFIG_s *cfg = &bms_lmon_cfg[monitor];
+    int32_t set = cfg->level[LMON_LEVEL_ERROR - 1].set;
+
+    if (nr_violations > 0) {
+        if ((cfg->direction == LMON_UPPER_LIMIT) && (value <= set)) {
+            value = set + 1;
+        } else if ((cfg->direction == LMON_LOWER_LIMIT) && (value >= set)) {
+            value = set - 1;
+        }
+    }
+    return value;
+}
 
-    DB_ReadBlock(&minmax, DATA_BLOCK_ID_MINMAX);
 
-    if (minmax.voltage_max > BC_VOLTMAX) {
-        DIAG_Handler(DIAG_CH_CELLVOLTAGE_OVERVOLTAGE, DIAG_EVENT_NOK, 0, NULL_PTR);
-    } else {
-        DIAG_Handler(DIAG_CH_CELLVOLTAGE_OVERVOLTAGE, DIAG_EVENT_OK, 0, NULL_PTR);
+/**
+ * @brief   checks the abidance by the safe operating area
+ *
+ * @details Passes the minimum and maximum cell voltage (U) to the limit monitors. The SOA check only
+ *          runs on new measurements, the monitors are evaluated every call.
+ */
+static void BMS_CheckVoltages(void) {
+    DB_ReadBlock(&bms_cellvoltage, DATA_BLOCK_ID_CELLVOLTAGE);
+    if (bms_cellvoltage.timestamp != bms_voltage_timestamp) {
+        bms_voltage_timestamp = bms_cellvoltage.timestamp;
+        SOA_CheckCellVoltages(&bms_cellvoltage, &bms_voltage_soa);
     }
 
-    if (minmax.voltage_min < BC_VOLTMIN) {
-        DIAG_Handler(DIAG_CH_CELLVOLTAGE_UNDERVOLTAGE, DIAG_EVENT_NOK, 0, NULL_PTR);
-    } else {
-        DIAG_Handler(DIAG_CH_CELLVOLTAGE_UNDERVOLTAGE, DIAG_EVENT_OK, 0, NULL_PTR);
-    }
+    bms_lmon_value[BMS_LMON_OVERVOLTAGE] = BMS_LimitValue(bms_voltage_soa.max, bms_voltage_soa.nr_above, BMS_LMON_OVERVOLTAGE);
+    bms_lmon_value[BMS_LMON_UNDERVOLTAGE] = BMS_LimitValue(bms_voltage_soa.min, bms_voltage_soa.nr_below, BMS_LMON_UNDERVOLTAGE);
 }
 
 
 /**
  * @brief   checks the abidance by the safe operating area
  *
- * @details verify for cell temperature measurements (T), if minimum and maximum values are out of range
+ * @details Passes the minimum and maximum cell temperature (T) to the limit monitors of the current
+ *          direction, the monitors of the other direction keep their state. The limits depend on the
+ *          current direction, so the SOA check also runs when it changes. The core temperature
+ *          predicted by the thermal model is monitored for an early derating against the limit of
+ *          the current direction in the same way.
  */
 static void BMS_CheckTemperatures(void) {
-    DATA_BLOCK_MINMAX_s minmax;
+    static DATA_BLOCK_THERMAL_s thermal_tab;
     DATA_BLOCK_CURRENT_s curr_tab;
+    BS_CURRENT_DIRECTION_e direction;
+    int32_t max = 0;
+    int32_t min = 0;
 
     DB_ReadBlock(&curr_tab, DATA_BLOCK_ID_CURRENT);
-    DB_ReadBlock(&minmax, DATA_BLOCK_ID_MINMAX);
+    DB_ReadBlock(&bms_celltemperature, DATA_BLOCK_ID_CELLTEMPERATURE);
+    direction = BS_CheckCurrentValue_Direction(curr_tab.current);
 
-    if (BS_CheckCurrentValue_Direction(curr_tab.current) == BS_CURRENT_DISCHARGE){
-        if (minmax.temperature_max > BC_TEMPMAX_DISCHARGE) {
-            DIAG_Handler(DIAG_CH_TEMP_OVERTEMPERATURE_DISCHARGE,DIAG_EVENT_NOK,0, NULL_PTR);
-        } else{
-            DIAG_Handler(DIAG_CH_TEMP_OVERTEMPERATURE_DISCHARGE,DIAG_EVENT_OK,0, NULL_PTR);
-        }
-    } else{
-        if (minmax.temperature_max > BC_TEMPMAX_CHARGE) {
-            DIAG_Handler(DIAG_CH_TEMP_OVERTEMPERATURE_CHARGE,DIAG_EVENT_NOK,0, NULL_PTR);
-        } else{
-            DIAG_Handler(DIAG_CH_TEMP_OVERTEMPERATURE_CHARGE,DIAG_EVENT_OK,0, NULL_PTR);
-        }
+    if ((bms_celltemperature.timestamp != bms_temperature_timestamp) || (direction != bms_temperature_direction)) {
+        bms_temperature_timestamp = bms_celltemperature.timestamp;
+        bms_temperature_direction = direction;
+        SOA_CheckCellTemperatures(&bms_celltemperature, direction, &bms_temperature_soa);
     }
 
-    if (BS_CheckCurrentValue_Direction(curr_tab.current) == BS_CURRENT_DISCHARGE){
-        if (minmax.temperature_min < BC_TEMPMIN_DISCHARGE) {
-            DIAG_Handler(DIAG_CH_TEMP_UNDERTEMPERATURE_DISCHARGE,DIAG_EVENT_NOK,0, NULL_PTR);
-        } else{
-            DIAG_Handler(DIAG_CH_TEMP_UNDERTEMPERATURE_DISCHARGE,DIAG_EVENT_OK,0, NULL_PTR);
-        }
-    } else{
-        if (minmax.temperature_min < BC_TEMPMIN_CHARGE) {
-            DIAG_Handler(DIAG_CH_TEMP_UNDERTEMPERATURE_CHARGE,DIAG_EVENT_NOK,0, NULL_PTR);
-        } else{
-            DIAG_Handler(DIAG_CH_TEMP_UNDERTEMPERATURE_CHARGE,DIAG_EVENT_OK,0, NULL_PTR);
+    if (direction == BS_CURRENT_DISCHARGE) {
+        max = BMS_LimitValue(bms_temperature_soa.max, bms_temperature_soa.nr_above, BMS_LMON_OVERTEMPERATURE_DISCHARGE);
+        min = BMS_LimitValue(bms_temperature_soa.min, bms_temperature_soa.nr_below, BMS_LMON_UNDERTEMPERATURE_DISCHARGE);
+        bms_lmon_value[BMS_LMON_OVERTEMPERATURE_DISCHARGE] = max;
+        bms_lmon_value[BMS_LMON_UNDERTEMPERATURE_DISCHARGE] = min;
+        bms_lmon_value[BMS_LMON_OVERTEMPERATURE_CHARGE] = LMON_VALUE_HOLD;
+        bms_lmon_value[BMS_LMON_UNDERTEMPERATURE_CHARGE] = LMON_VALUE_HOLD;
+    } else {
+        max = BMS_LimitValue(bms_temperature_soa.max, bms_temperature_soa.nr_above, BMS_LMON_OVERTEMPERATURE_CHARGE);
+        min = BMS_LimitValue(bms_temperature_soa.min, bms_temperature_soa.nr_below, BMS_LMON_UNDERTEMPERATURE_CHARGE);
+        bms_lmon_value[BMS_LMON_OVERTEMPERATURE_CHARGE] = max;
+        bms_lmon_value[BMS_LMON_UNDERTEMPERATURE_CHARGE] = min;
+        bms_lmon_value[BMS_LMON_OVERTEMPERATURE_DISCHARGE] = LMON_VALUE_HOLD;
+        bms_lmon_value[BMS_LMON_UNDERTEMPERATURE_DISCHARGE] = LMON_VALUE_HOLD;
+    }
+
+    DB_ReadBlock(&thermal_tab, DATA_BLOCK_ID_THERMAL);
+    bms_lmon_value[BMS_LMON_OVERTEMPERATURE_PREDICTED_CHARGE] = LMON_VALUE_HOLD;
+    bms_lmon_value[BMS_LMON_OVERTEMPERATURE_PREDICTED_DISCHARGE] = LMON_VALUE_HOLD;
+    if (thermal_tab.timestamp != 0) {
+        if (direction == BS_CURRENT_DISCHARGE) {
+            bms_lmon_value[BMS_LMON_OVERTEMPERATURE_PREDICTED_DISCHARGE] = (int32_t)thermal_tab.temperature_predicted_max;
+        } else {
+            bms_lmon_value[BMS_LMON_OVERTEMPERATURE_PREDICTED_CHARGE] = (int32_t)thermal_tab.temperature_predicted_max;
         }
     }
 }
 
 
-
-
-
 /**
  * @brief   checks the abidance by the safe operating area
  *
- * @details verify for cell current measurements (I), if minimum and maximum values are out of range
+ * @details Passes the absolute current (I) in mA to the limit monitor of the current direction.
+ *          The time-window based current budgets are checked while the contactors are closed.
  */
 static void BMS_CheckCurrent(void) {
     DATA_BLOCK_SOX_s sof_tab;
     DATA_BLOCK_CURRENT_s curr_tab;
+    int32_t current = 0;
 
     DB_ReadBlock(&sof_tab, DATA_BLOCK_ID_SOX);
     DB_ReadBlock(&curr_tab, DATA_BLOCK_ID_CURRENT);
@@ -843,26 +642,20 @@ static void BMS_CheckCurrent(void) {
     }
 #endif
 
-    if (BS_CheckCurrentValue_Direction(curr_tab.current) == BS_CURRENT_CHARGE){
-        if (curr_tab.current<0.0){
-            curr_tab.current = - curr_tab.current;
-        }
-        if (curr_tab.current > BC_CURRENTMAX_CHARGE) {
-            DIAG_Handler(DIAG_CH_OVERCURRENT_CHARGE,DIAG_EVENT_NOK,0, NULL_PTR);
-        } else{
-            DIAG_Handler(DIAG_CH_OVERCURRENT_CHARGE,DIAG_EVENT_OK,0, NULL_PTR);
-        }
-    } else{
-        if (curr_tab.current<0.0){
-            curr_tab.current = - curr_tab.current;
-        }
-        if (curr_tab.current > BC_CURRENTMAX_DISCHARGE) {
-            DIAG_Handler(DIAG_CH_OVERCURRENT_DISCHARGE,DIAG_EVENT_NOK,0, NULL_PTR);
-        } else{
-            DIAG_Handler(DIAG_CH_OVERCURRENT_DISCHARGE,DIAG_EVENT_OK,0, NULL_PTR);
-        }
+    current = (int32_t)curr_tab.current;
+    if (current < 0) {
+        current = -current;
+    }
+
+    if (BS_CheckCurrentValue_Direction(curr_tab.current) == BS_CURRENT_CHARGE) {
+        bms_lmon_value[BMS_LMON_OVERCURRENT_CHARGE] = current;
+        bms_lmon_value[BMS_LMON_OVERCURRENT_DISCHARGE] = LMON_VALUE_HOLD;
+    } else {
+        bms_lmon_value[BMS_LMON_OVERCURRENT_DISCHARGE] = current;
+        bms_lmon_value[BMS_LMON_OVERCURRENT_CHARGE] = LMON_VALUE_HOLD;
     }
 
+    BUDG_Trigger((SM_GetState(&bms_sm) == BMS_STATEMACH_NORMAL) || (SM_GetState(&bms_sm) == BMS_STATEMACH_CHARGE));
 }
 
 /**
@@ -898,7 +691,10 @@ static STD_RETURN_TYPE_e BMS_CheckAnyErrorFlagSet(void) {
         error_flags.spi_error                   == 1 ||
         error_flags.currentsensorresponding     == 1 ||
         error_flags.can_timing_cc               == 1 ||
-        error_flags.can_timing                  == 1 ) {
+        error_flags.can_timing                  == 1 ||
+        error_flags.fast_fault_reaction         == 1 ||
+        error_flags.current_budget_charge       == 1 ||
+        error_flags.current_budget_discharge    == 1 ) {
         retVal = E_NOT_OK;
         error_flags.general_error = 1;
 
@@ -147,21 +147,6 @@ typedef enum {
 
 
 
-/**
- * This structure contains all the variables relevant for the CONT state machine.
- * The user can get the current state of the CONT state machine with this variable
- */
-typedef struct {
-    uint16_t timer;                         /*!< time in ms before the state machine processes the next state, e.g. in counts of 1ms    */
-    BMS_STATE_REQUEST_e statereq;           /*!< current state request made to the state machine                                        */
-    BMS_STATEMACH_e state;                  /*!< state of Driver State Machine                                                          */
-    BMS_STATEMACH_SUB_e substate;           /*!< current substate of the state machine                                                  */
-    BMS_STATEMACH_e laststate;              /*!< previous state of the state machine                                                    */
-    BMS_STATEMACH_SUB_e lastsubstate;       /*!< previous substate of the state machine                                                 */
-    uint32_t ErrRequestCounter;             /*!< counts the number of illegal requests to the LTC state machine */
-    uint8_t triggerentry;                   /*!< counter for re-entrance protection (function running flag) */
-    uint8_t counter;                        /*!< general purpose counter*/
-} BMS_STATE_s;
 
 
 /*================== Function Prototypes ==================================*/
@@ -197,5 +182,17 @@ extern  BMS_STATEMACH_e BMS_GetState(void);
  */
 extern void BMS_Trigger(void);
 
+/**
+ * @brief   gets the debounced level of a BMS limit monitor
+ *
+ * @details Warning levels are raised before the error limits are reached and
+ *          can be used to stage the derating.
+ *
+ * @param   monitor     limit monitor, taken from BMS_LMON_e
+ *
+ * @return  current level of the monitor
+ */
+extern LMON_LEVEL_e BMS_GetLimitLevel(BMS_LMON_e monitor);
+
 
 #endif /* BMS_H_ */
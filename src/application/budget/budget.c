@@ -0,0 +1,292 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    budget.c
+ * @author  foxBMS Team
+ * @date    18.10.2026 (date of creation)
+ * @ingroup APPLICATION
+ * @prefix  BUDG
+ *
+ * @brief   Time-window based peak and continuous current budgets
+ *
+ * The current is integrated every 1ms into buckets of BUDG_BUCKET_MS. A window
+ * consists of the last full buckets plus the running bucket, so it is up to one
+ * bucket longer than configured, which errs on the safe side. The window sums
+ * are recalculated from the buckets whenever a bucket is closed, so rounding
+ * errors do not accumulate.
+ *
+ * The I2t budget of a window is I_w^2 * t_w, where the allowed RMS current I_w
+ * lies between the continuous and the peak SOF limit (see budg_window_cfg[]).
+ * The charge throughput is tracked for information only: if the I2t of a window
+ * is within its budget, the charge throughput is within I_w * t_w as well.
+ */
+
+/*================== Includes =============================================*/
+#include "general.h"
+#include "budget.h"
+
+#include "database.h"
+#include "diag.h"
+#include "os.h"
+#include "batterysystem_cfg.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/**
+ * integration state of one current direction
+ */
+typedef struct {
+    float i2t[BUDG_NR_OF_BUCKETS];              /*!< I2t of the closed buckets in A^2s                  */
+    float charge[BUDG_NR_OF_BUCKETS];           /*!< charge throughput of the closed buckets in As      */
+    float running_i2t;                          /*!< I2t of the running bucket in A^2s                  */
+    float running_charge;                       /*!< charge throughput of the running bucket in As      */
+    float closed_i2t[BUDG_NR_OF_WINDOWS];       /*!< I2t of the closed buckets of each window           */
+    float closed_charge[BUDG_NR_OF_WINDOWS];    /*!< charge throughput of the closed buckets of each window */
+    float continuous_i2;                        /*!< low-pass filtered squared current in A^2           */
+    float peak;                                 /*!< current limit of the shortest window in A          */
+    float continuous;                           /*!< continuous current limit in A                      */
+} BUDG_TRACKER_s;
+
+/*================== Constant and Variable Definitions ====================*/
+static BUDG_TRACKER_s budg_tracker[BUDG_NR_OF_DIRECTIONS];
+static BUDG_STATE_s budg_state[BUDG_NR_OF_DIRECTIONS];
+static uint16_t budg_bucket = 0;        /* index of the next bucket to be closed */
+static uint16_t budg_bucket_ms = 0;     /* time in the running bucket */
+
+/*================== Function Prototypes ==================================*/
+static void BUDG_CloseBucket(void);
+static void BUDG_SetLimits(BUDG_DIRECTION_e direction, float peak, float continuous);
+static void BUDG_Evaluate(BUDG_DIRECTION_e direction, uint8_t active);
+
+/*================== Function Implementations =============================*/
+
+void BUDG_Init(void) {
+    uint8_t i = 0;
+    uint8_t w = 0;
+    uint16_t b = 0;
+
+    for (i = 0; i < BUDG_NR_OF_DIRECTIONS; i++) {
+        for (b = 0; b < BUDG_NR_OF_BUCKETS; b++) {
+            budg_tracker[i].i2t[b] = 0.0;
+            budg_tracker[i].charge[b] = 0.0;
+        }
+        for (w = 0; w < BUDG_NR_OF_WINDOWS; w++) {
+            budg_tracker[i].closed_i2t[w] = 0.0;
+            budg_tracker[i].closed_charge[w] = 0.0;
+            budg_state[i].i2t[w] = 0.0;
+            budg_state[i].charge[w] = 0.0;
+            budg_state[i].budget[w] = 0.0;
+        }
+        budg_tracker[i].running_i2t = 0.0;
+        budg_tracker[i].running_charge = 0.0;
+        budg_tracker[i].continuous_i2 = 0.0;
+        budg_tracker[i].peak = 0.0;
+        budg_tracker[i].continuous = 0.0;
+        budg_state[i].continuous_i2 = 0.0;
+        budg_state[i].usage_perc = 0;
+        budg_state[i].remaining_peak_ms = 0;
+        budg_state[i].grade = BUDG_GRADE_OK;
+    }
+    budg_bucket = 0;
+    budg_bucket_ms = 0;
+}
+
+
+void BUDG_Trigger(uint8_t active) {
+    DATA_BLOCK_CURRENT_s curr_tab;
+    BUDG_DIRECTION_e direction = BUDG_DISCHARGE;
+    float current = 0.0;
+
+    DB_ReadBlock(&curr_tab, DATA_BLOCK_ID_CURRENT);
+
+    if (BS_CheckCurrentValue_Direction(curr_tab.current) == BS_CURRENT_CHARGE) {
+        direction = BUDG_CHARGE;
+    }
+    current = curr_tab.current / 1000.0;        // mA -> A
+    if (current < 0.0) {
+        current = -current;
+    }
+
+    budg_tracker[direction].running_i2t += current * current * 0.001;
+    budg_tracker[direction].running_charge += current * 0.001;
+
+    budg_bucket_ms++;
+    if (budg_bucket_ms >= BUDG_BUCKET_MS) {
+        BUDG_CloseBucket();
+        budg_bucket_ms = 0;
+    }
+
+    BUDG_Evaluate(BUDG_CHARGE, active);
+    BUDG_Evaluate(BUDG_DISCHARGE, active);
+}
+
+
+void BUDG_GetState(BUDG_DIRECTION_e direction, BUDG_STATE_s *state) {
+    OS_TaskEnter_Critical();
+    *state = budg_state[direction];
+    OS_TaskExit_Critical();
+}
+
+
+/**
+ * @brief   closes the running bucket, recalculates the window sums and takes over the SOF limits
+ */
+static void BUDG_CloseBucket(void) {
+    DATA_BLOCK_SOX_s sox_tab;
+    BUDG_TRACKER_s *tracker = NULL_PTR;
+    float i2t = 0.0;
+    float charge = 0.0;
+    uint16_t b = 0;
+    uint16_t n = 0;
+    uint8_t i = 0;
+    uint8_t w = 0;
+
+    for (i = 0; i < BUDG_NR_OF_DIRECTIONS; i++) {
+        tracker = &budg_tracker[i];
+        tracker->i2t[budg_bucket] = tracker->running_i2t;
+        tracker->charge[budg_bucket] = tracker->running_charge;
+        tracker->continuous_i2 += ((tracker->running_i2t * (1000.0 / BUDG_BUCKET_MS)) - tracker->continuous_i2) *
+                                  ((float)BUDG_BUCKET_MS / BUDG_CONTINUOUS_TAU_MS);
+        tracker->running_i2t = 0.0;
+        tracker->running_charge = 0.0;
+
+        // sum up from the newest bucket backwards, the windows are ordered by length
+        i2t = 0.0;
+        charge = 0.0;
+        b = budg_bucket;
+        w = 0;
+        for (n = 1; n <= BUDG_NR_OF_BUCKETS && w < BUDG_NR_OF_WINDOWS; n++) {
+            i2t += tracker->i2t[b];
+            charge += tracker->charge[b];
+            while (w < BUDG_NR_OF_WINDOWS && n == (budg_window_cfg[w].length_ms / BUDG_BUCKET_MS)) {
+                tracker->closed_i2t[w] = i2t;
+                tracker->closed_charge[w] = charge;
+                w++;
+            }
+            b = (b == 0) ? (BUDG_NR_OF_BUCKETS - 1) : (b - 1);
+        }
+    }
+    budg_bucket = (budg_bucket + 1) % BUDG_NR_OF_BUCKETS;
+
+    DB_ReadBlock(&sox_tab, DATA_BLOCK_ID_SOX);
+    BUDG_SetLimits(BUDG_CHARGE, sox_tab.sof_peak_charge, sox_tab.sof_continuous_charge);
+    BUDG_SetLimits(BUDG_DISCHARGE, sox_tab.sof_peak_discharge, sox_tab.sof_continuous_discharge);
+}
+
+
+/**
+ * @brief   calculates the I2t budgets of all windows of one direction
+ *
+ * @param   direction   current direction
+ * @param   peak        peak current limit of the SOF in A
+ * @param   continuous  continuous current limit of the SOF in A
+ */
+static void BUDG_SetLimits(BUDG_DIRECTION_e direction, float peak, float continuous) {
+    float current = 0.0;
+    uint8_t w = 0;
+
+    if (peak < continuous) {
+        peak = continuous;
+    }
+    for (w = 0; w < BUDG_NR_OF_WINDOWS; w++) {
+        current = continuous + ((peak - continuous) * budg_window_cfg[w].peak_perc / 100.0);
+        budg_state[direction].budget[w] = current * current * (budg_window_cfg[w].length_ms / 1000.0);
+        if (w == 0) {
+            budg_tracker[direction].peak = current;
+        }
+    }
+    budg_tracker[direction].continuous = continuous;
+}
+
+
+/**
+ * @brief   checks the budgets of one direction and reports the result to the DIAG module
+ *
+ * @param   direction   current direction
+ * @param   active      TRUE if the budgets are checked, FALSE if only the sums are updated
+ */
+static void BUDG_Evaluate(BUDG_DIRECTION_e direction, uint8_t active) {
+    BUDG_TRACKER_s *tracker = &budg_tracker[direction];
+    BUDG_STATE_s *state = &budg_state[direction];
+    float usage = 0.0;
+    float ratio = 0.0;
+    float remaining = BUDG_WINDOW_MAX_MS / 1000.0;
+    float peak2 = tracker->peak * tracker->peak;
+    float continuous2 = tracker->continuous * tracker->continuous;
+    uint8_t w = 0;
+
+    for (w = 0; w < BUDG_NR_OF_WINDOWS; w++) {
+        state->i2t[w] = tracker->closed_i2t[w] + tracker->running_i2t;
+        state->charge[w] = tracker->closed_charge[w] + tracker->running_charge;
+        if (state->budget[w] > 0.0) {
+            ratio = state->i2t[w] / state->budget[w];
+        } else {
+            ratio = (state->i2t[w] > 0.0) ? 2.55 : 0.0;
+        }
+        if (ratio > usage) {
+            usage = ratio;
+        }
+        // time at the peak current until this budget is used up, neglecting the buckets leaving the window
+        if (peak2 > 0.0) {
+            ratio = (state->budget[w] - state->i2t[w]) / peak2;
+            if (ratio < remaining) {
+                remaining = ratio;
+            }
+        } else {
+            remaining = 0.0;
+        }
+    }
+    if (continuous2 > 0.0) {
+        ratio = tracker->continuous_i2 / continuous2;
+    } else {
+        ratio = (tracker->continuous_i2 > 0.0) ? 2.55 : 0.0;
+    }
+    if (ratio > usage) {
+        usage = ratio;
+    }
+    if (remaining < 0.0) {
+        remaining = 0.0;
+    }
+
+    state->continuous_i2 = tracker->continuous_i2;
+    state->usage_perc = (usage >= 2.55) ? 255 : (uint8_t)(usage * 100.0);
+    state->remaining_peak_ms = (uint32_t)(remaining * 1000.0);
+
+    if (active == FALSE) {
+        state->grade = BUDG_GRADE_OK;
+    } else if (usage > 1.0) {
+        state->grade = BUDG_GRADE_EXCEEDED;
+    } else if (state->usage_perc >= BUDG_WARNING_PERC) {
+        state->grade = BUDG_GRADE_WARNING;
+    } else {
+        state->grade = BUDG_GRADE_OK;
+    }
+
+    if (direction == BUDG_CHARGE) {
+        DIAG_Handler(DIAG_CH_CURRENT_BUDGET_WARNING_CHARGE, (state->grade >= BUDG_GRADE_WARNING) ? DIAG_EVENT_NOK : DIAG_EVENT_OK, 0, NULL_PTR);
+        DIAG_Handler(DIAG_CH_CURRENT_BUDGET_CHARGE, (state->grade == BUDG_GRADE_EXCEEDED) ? DIAG_EVENT_NOK : DIAG_EVENT_OK, 0, NULL_PTR);
+    } else {
+        DIAG_Handler(DIAG_CH_CURRENT_BUDGET_WARNING_DISCHARGE, (state->grade >= BUDG_GRADE_WARNING) ? DIAG_EVENT_NOK : DIAG_EVENT_OK, 0, NULL_PTR);
+        DIAG_Handler(DIAG_CH_CURRENT_BUDGET_DISCHARGE, (state->grade == BUDG_GRADE_EXCEEDED) ? DIAG_EVENT_NOK : DIAG_EVENT_OK, 0, NULL_PTR);
+    }
+}
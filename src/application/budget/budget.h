@@ -0,0 +1,109 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    budget.h
+ * @author  foxBMS Team
+ * @date    18.10.2026 (date of creation)
+ * @ingroup APPLICATION
+ * @prefix  BUDG
+ *
+ * @brief   Time-window based peak and continuous current budgets
+ *
+ * The battery current is integrated every 1ms into the charge throughput and
+ * the I2t of rolling windows (e.g., 2s, 10s and 30s). Each window has an I2t
+ * budget derived from the peak and continuous SOF limits, so short spikes
+ * above the continuous limit are accepted as long as the budget of every
+ * window is kept.
+ */
+
+#ifndef BUDGET_H_
+#define BUDGET_H_
+
+/*================== Includes =============================================*/
+#include "budget_cfg.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/**
+ * current directions of the budgets
+ */
+typedef enum {
+    BUDG_CHARGE         = 0,    /*!< charge direction       */
+    BUDG_DISCHARGE      = 1,    /*!< discharge direction    */
+    BUDG_NR_OF_DIRECTIONS = 2,  /*!< number of directions   */
+} BUDG_DIRECTION_e;
+
+/**
+ * grade of the budget usage
+ */
+typedef enum {
+    BUDG_GRADE_OK       = 0,    /*!< all budgets below the warning threshold    */
+    BUDG_GRADE_WARNING  = 1,    /*!< one budget above BUDG_WARNING_PERC         */
+    BUDG_GRADE_EXCEEDED = 2,    /*!< one budget exceeded                        */
+} BUDG_GRADE_e;
+
+/**
+ * state of the budgets of one current direction
+ */
+typedef struct {
+    float i2t[BUDG_NR_OF_WINDOWS];          /*!< I2t in the windows in A^2s                                     */
+    float charge[BUDG_NR_OF_WINDOWS];       /*!< charge throughput in the windows in As                         */
+    float budget[BUDG_NR_OF_WINDOWS];       /*!< I2t budgets of the windows in A^2s                             */
+    float continuous_i2;                    /*!< low-pass filtered squared current in A^2                       */
+    uint8_t usage_perc;                     /*!< largest used part of all budgets in %, saturated at 255        */
+    uint32_t remaining_peak_ms;             /*!< time the peak current can still be drawn before a budget is
+                                                 exhausted, in ms                                               */
+    BUDG_GRADE_e grade;                     /*!< grade of the budget usage                                      */
+} BUDG_STATE_s;
+
+/*================== Constant and Variable Definitions ====================*/
+
+/*================== Function Prototypes ==================================*/
+
+/**
+ * @brief   resets all windows
+ */
+extern void BUDG_Init(void);
+
+/**
+ * @brief   integrates the current and checks the budgets
+ *
+ * @details Must be called every 1ms. The current is always integrated, the
+ *          budgets are only checked and reported to the DIAG module while the
+ *          contactors are closed, since the SOF limits are 0 otherwise.
+ *
+ * @param   active  TRUE if the contactors are closed
+ */
+extern void BUDG_Trigger(uint8_t active);
+
+/**
+ * @brief   returns the state of the budgets of one direction
+ *
+ * @param   direction   current direction
+ * @param   state       pointer where the state is stored
+ */
+extern void BUDG_GetState(BUDG_DIRECTION_e direction, BUDG_STATE_s *state);
+
+/*================== Function Implementations =============================*/
+
+#endif /* BUDGET_H_ */
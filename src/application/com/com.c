@@ -56,6 +56,7 @@
 #include "uart.h"
 #include "contactor.h"
 #include "mcu.h"
+#include "database.h"
 
 
 /*================== Macros and Definitions ===============================*/
@@ -67,6 +68,7 @@
 /*================== Constant and Variable Definitions ====================*/
 
 uint8_t printHelp = 0;
+uint8_t printBalancing = 0;
 
 static uint8_t com_testmode_enabled = 0;
 static uint32_t com_tickcount = 0;
@@ -149,6 +151,7 @@ void COM_printHelpCommand(void) {
             DEBUG_PRINTF((const uint8_t * )"gettime               get system time\r\n");
             DEBUG_PRINTF((const uint8_t * )"getruntime            get runtime since last reset\r\n");
             DEBUG_PRINTF((const uint8_t * )"getoperatingtime      get total operating time\r\n");
+            DEBUG_PRINTF((const uint8_t * )"printbalancinginfo    get charge bled from each cell and estimated self-discharge\r\n");
             break;
 
         case 2:
@@ -203,6 +206,48 @@ void COM_printHelpCommand(void) {
 }
 
 
+void COM_printBalancingInfo(void) {
+
+    static DATA_BLOCK_BALANCING_ENERGY_s com_energy;
+    static uint16_t cell = 0;
+    uint16_t tmp = 0;
+
+    if(printBalancing==0)
+        return;
+
+    if(cell == 0) {
+        DB_ReadBlock(&com_energy, DATA_BLOCK_ID_BALANCING_ENERGY);
+
+        DEBUG_PRINTF((const uint8_t * )"\r\nBalancing observed over ");
+        tmp = (com_energy.observation_time / 3600 > 0xFFFF) ? 0xFFFF : com_energy.observation_time / 3600;
+        DEBUG_PRINTF(U16ToDecascii(com_buf, &tmp, 5));
+        DEBUG_PRINTF((const uint8_t * )"h");
+        if(com_energy.valid == 0) {
+            DEBUG_PRINTF((const uint8_t * )", self-discharge not yet valid");
+        }
+        DEBUG_PRINTF((const uint8_t * )"\r\n");
+    }
+
+    /* one cell per call, charge in mAh and self-discharge relative to the cell bled the most in uA */
+    DEBUG_PRINTF((const uint8_t * )"Cell ");
+    DEBUG_PRINTF(U16ToDecascii(com_buf, &cell, 3));
+    DEBUG_PRINTF((const uint8_t * )": ");
+    tmp = (com_energy.charge[cell] / 3600 > 0xFFFF) ? 0xFFFF : com_energy.charge[cell] / 3600;
+    DEBUG_PRINTF(U16ToDecascii(com_buf, &tmp, 5));
+    DEBUG_PRINTF((const uint8_t * )"mAh ");
+    tmp = (com_energy.leakage[cell] > 65535.0) ? 0xFFFF : (uint16_t)com_energy.leakage[cell];
+    DEBUG_PRINTF(U16ToDecascii(com_buf, &tmp, 5));
+    DEBUG_PRINTF((const uint8_t * )"uA\r\n");
+
+    cell++;
+
+    if(cell == BS_NR_OF_BAT_CELLS) {
+        printBalancing = 0;
+        cell = 0;
+    }
+}
+
+
 void COM_Decoder(void) {
 
     /* Command Received - Replace Carrier Return with null character */
@@ -349,6 +394,22 @@ void COM_Decoder(void) {
             return;
         }
 
+        /* PRINT BALANCING INFO */
+        if (strcmp(com_receivedbyte, "printbalancinginfo") == 0) {
+
+            /* Print balancing info */
+            printBalancing = 1;
+
+            /* Clear received command */
+            memset(com_receivedbyte, 0, sizeof(com_receivedbyte));
+            com_receive_slot = 0;
+
+            /* Reset timeout to TESTMODE_TIMEOUT */
+            com_tickcount = osKernelSysTick();
+
+            return;
+        }
+
         /* Command received and testmode enabled */
         if (com_testmode_enabled) {
 
@@ -38,6 +38,7 @@
  * gettime                    -- prints mcu time and date
  * getruntime                 -- get runtime since last reset
  * getoperatingtime           -- get total operating time
+ * printbalancinginfo         -- prints the charge bled from each cell and its estimated self-discharge
  *
  * Following commands only available in testmode!
  *
@@ -100,6 +101,13 @@ extern void COM_printTimeAndDate(void);
  */
 extern void COM_printHelpCommand(void);
 
+/**
+ * Prints the charge bled from each cell and its estimated self-discharge, one cell per call
+ *
+ * @return (type: void)
+ */
+extern void COM_printBalancingInfo(void);
+
 
 /*================== Function Implementations =============================*/
 
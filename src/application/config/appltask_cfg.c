@@ -46,9 +46,15 @@
 #include "diag.h"
 #include "bal.h"
 #include "sox.h"
+#include "soh.h"
+#include "derating.h"
+#include "thermal.h"
+#include "bal_energy.h"
 #include "com.h"
 #include "led.h"
 #include "cansignal.h"
+#include "canmux.h"
+#include "isotp.h"
 #include "database.h"
 #include "meas.h"
 
@@ -87,14 +93,23 @@ void APPL_Cyclic_10ms(void) {
     /*   ...                            */
     /*   ...                            */
     CANS_MainFunction();
+#if CAN_USE_CELLDATA_MUX == 1
+    CANMUX_Trigger();
+#endif
+#if CAN_USE_ISOTP == 1
+    ISOTP_Trigger();
+#endif
     BAL_Trigger();
 
 #if BUILD_MODULE_ENABLE_SAFETY_FEATURES == 0
     LED_Ctrl();
 #endif
 
+    DRT_Trigger();
     SOC_Ctrl();
+    SOH_Ctrl();
     SOF_Ctrl();
+    SOE_Ctrl();
 
 #if BUILD_MODULE_ENABLE_COM
     COM_Decoder();
@@ -107,12 +122,18 @@ void APPL_Cyclic_100ms(void) {
 
     DIAG_SysMonNotify(DIAG_SYSMON_APPL_CYCLIC_100ms, 0);        // task is running, state = ok
 
+    THM_Trigger();
+#if BAL_ENERGY_ACCOUNTING == TRUE
+    BAL_EnergyTrigger();
+#endif
+
     /* User specific implementations:   */
     /*   ...                            */
     /*   ...                            */
 
 #if BUILD_MODULE_ENABLE_COM
         COM_printHelpCommand();
+        COM_printBalancingInfo();
 #endif
 
     if (first_cycle<10) {
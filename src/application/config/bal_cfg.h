@@ -84,6 +84,137 @@
 #define BAL_LOWER_VOLTAGE_LIMIT_MV     2000
 
 
+/**
+ * BAL opto-coupler output of the balancing feedback above which a module is balancing, in mV
+ */
+
+#define BAL_FEEDBACK_THRESHOLD_MV     2500
+
+
+/**
+ * BAL use the balancing planner (see bal_plan.h) instead of the voltage threshold.
+ * The planner balances independently of the rest timer and needs SOX_SOC_PER_CELL.
+ */
+
+#define BAL_USE_PLANNER     TRUE
+
+
+/**
+ * BAL resistance of the balancing resistor of one cell in Ohm
+ */
+
+#define BAL_RESISTANCE_OHM     68.0
+
+
+/**
+ * BAL SOC difference to the weakest cell in % below which a cell is not balanced by the planner
+ */
+
+#define BAL_PLAN_DEADBAND_PERC     0.5
+
+
+/**
+ * BAL limit the number of simultaneously balanced cells per module and alternate odd and even
+ * cells (see bal_duty.h)
+ */
+
+#define BAL_DUTY_CYCLING     TRUE
+
+
+/**
+ * BAL time in ms after which the balancing alternates between the odd and the even cells
+ */
+
+#define BAL_DUTY_PERIOD_MS     10000
+
+
+/**
+ * BAL balancing power that one module may dissipate in W
+ */
+
+#define BAL_MODULE_POWER_BUDGET_W     2.0
+
+
+/**
+ * BAL LTC die temperature in degC above which the balancing power of the module is reduced
+ */
+
+#define BAL_DIE_TEMPERATURE_DERATE     70
+
+
+/**
+ * BAL LTC die temperature in degC at which the balancing of the module stops
+ */
+
+#define BAL_DIE_TEMPERATURE_MAX     90
+
+
+/**
+ * BAL module temperature in degC above which the balancing power of the module is reduced
+ */
+
+#define BAL_MODULE_TEMPERATURE_DERATE     40
+
+
+/**
+ * BAL module temperature in degC at which the balancing of the module stops
+ */
+
+#define BAL_MODULE_TEMPERATURE_MAX     50
+
+
+/**
+ * BAL balance the highest cells while charging (see bal_charge.h)
+ */
+
+#define BAL_CHARGE_BALANCING     TRUE
+
+
+/**
+ * BAL difference of the IR-drop corrected cell voltage to the lowest corrected voltage in mV
+ * above which a cell is balanced while charging
+ */
+
+#define BAL_CHARGE_THRESHOLD_MV     20
+
+
+/**
+ * BAL band below BC_VOLTMAX in mV in which the charge current is tapered while cells are balanced
+ */
+
+#define BAL_TOP_OF_CHARGE_MV     100
+
+
+/**
+ * BAL smallest factor the charge current is tapered to at the top of charge
+ */
+
+#define BAL_TOP_OF_CHARGE_MIN_FACTOR     0.2
+
+
+/**
+ * BAL count the charge bled from each cell and estimate the self-discharge of the cells (see bal_energy.h).
+ * The counters are stored in an EEPROM channel of 0x80 bytes, which limits the battery system to
+ * BAL_ENERGY_MAX_CELLS (30) cells. Must be FALSE for larger battery systems.
+ */
+
+#define BAL_ENERGY_ACCOUNTING     TRUE
+
+
+/**
+ * BAL only count the cells of modules whose balancing feedback (opto-coupler) confirms the balancing
+ */
+
+#define BAL_ENERGY_USE_FEEDBACK     FALSE
+
+
+/**
+ * BAL observed operating time in h after which the self-discharge estimation is valid
+ */
+
+#define BAL_LEAKAGE_MIN_OBSERVATION_H     24
+
+
 /*================== Constant and Variable Definitions ====================*/
 
 /*================== Function Prototypes ==================================*/
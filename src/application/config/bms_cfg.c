@@ -34,8 +34,93 @@
 #include "general.h"
 #include "bms_cfg.h"
 
+#include "batterycell_cfg.h"
+#include "ffr_cfg.h"
+
 /*================== Macros and Definitions ===============================*/
 
+/*================== Constant and Variable Definitions ====================*/
+
+/*
+ * The error levels keep the former debounce time of the DIAG channels
+ * (threshold of 500 at a 1ms check cycle). The critical levels match the
+ * limits of the fast fault reaction and bypass the on delay of the error
+ * level.
+ */
+const LMON_CONFIG_s bms_lmon_cfg[BMS_LMON_NR_OF] = {
+    [BMS_LMON_OVERVOLTAGE] = {
+        LMON_UPPER_LIMIT, {
+            /* enabled, set,                           reset,                          on,  off,  DIAG channel */
+            { TRUE, BC_VOLTMAX - 50,                    BC_VOLTMAX - 80,                100, 1000, LMON_NO_DIAG_CH },
+            { TRUE, BC_VOLTMAX,                         BC_VOLTMAX - 20,                500,  500, DIAG_CH_CELLVOLTAGE_OVERVOLTAGE },
+            { TRUE, FFR_VOLTMAX_MV,                     BC_VOLTMAX,                       0,  500, LMON_NO_DIAG_CH },
+        }
+    },
+    [BMS_LMON_UNDERVOLTAGE] = {
+        LMON_LOWER_LIMIT, {
+            { TRUE, BC_VOLTMIN + 50,                    BC_VOLTMIN + 80,                100, 1000, LMON_NO_DIAG_CH },
+            { TRUE, BC_VOLTMIN,                         BC_VOLTMIN + 20,                500,  500, DIAG_CH_CELLVOLTAGE_UNDERVOLTAGE },
+            { TRUE, FFR_VOLTMIN_MV,                     BC_VOLTMIN,                       0,  500, LMON_NO_DIAG_CH },
+        }
+    },
+    [BMS_LMON_OVERTEMPERATURE_CHARGE] = {
+        LMON_UPPER_LIMIT, {
+            { TRUE, BC_TEMPMAX_CHARGE - 5,              BC_TEMPMAX_CHARGE - 7,          500, 5000, LMON_NO_DIAG_CH },
+            { TRUE, BC_TEMPMAX_CHARGE,                  BC_TEMPMAX_CHARGE - 2,          500,  500, DIAG_CH_TEMP_OVERTEMPERATURE_CHARGE },
+            { TRUE, BC_TEMPMAX_CHARGE + 5,              BC_TEMPMAX_CHARGE,              100,  500, LMON_NO_DIAG_CH },
+        }
+    },
+    [BMS_LMON_OVERTEMPERATURE_DISCHARGE] = {
+        LMON_UPPER_LIMIT, {
+            { TRUE, BC_TEMPMAX_DISCHARGE - 5,           BC_TEMPMAX_DISCHARGE - 7,       500, 5000, LMON_NO_DIAG_CH },
+            { TRUE, BC_TEMPMAX_DISCHARGE,               BC_TEMPMAX_DISCHARGE - 2,       500,  500, DIAG_CH_TEMP_OVERTEMPERATURE_DISCHARGE },
+            { TRUE, BC_TEMPMAX_DISCHARGE + 5,           BC_TEMPMAX_DISCHARGE,           100,  500, LMON_NO_DIAG_CH },
+        }
+    },
+    [BMS_LMON_UNDERTEMPERATURE_CHARGE] = {
+        LMON_LOWER_LIMIT, {
+            { TRUE, BC_TEMPMIN_CHARGE + 5,              BC_TEMPMIN_CHARGE + 7,          500, 5000, LMON_NO_DIAG_CH },
+            { TRUE, BC_TEMPMIN_CHARGE,                  BC_TEMPMIN_CHARGE + 2,          500,  500, DIAG_CH_TEMP_UNDERTEMPERATURE_CHARGE },
+            LMON_LEVEL_UNUSED,
+        }
+    },
+    [BMS_LMON_UNDERTEMPERATURE_DISCHARGE] = {
+        LMON_LOWER_LIMIT, {
+            { TRUE, BC_TEMPMIN_DISCHARGE + 5,           BC_TEMPMIN_DISCHARGE + 7,       500, 5000, LMON_NO_DIAG_CH },
+            { TRUE, BC_TEMPMIN_DISCHARGE,               BC_TEMPMIN_DISCHARGE + 2,       500,  500, DIAG_CH_TEMP_UNDERTEMPERATURE_DISCHARGE },
+            LMON_LEVEL_UNUSED,
+        }
+    },
+    [BMS_LMON_OVERCURRENT_CHARGE] = {
+        LMON_UPPER_LIMIT, {
+            { TRUE, (BC_CURRENTMAX_CHARGE/10)*9,        (BC_CURRENTMAX_CHARGE/10)*8,    100, 1000, LMON_NO_DIAG_CH },
+            { TRUE, BC_CURRENTMAX_CHARGE,               (BC_CURRENTMAX_CHARGE/20)*19,   500,  500, DIAG_CH_OVERCURRENT_CHARGE },
+            { TRUE, FFR_CURRENTMAX_CHARGE_MA,           BC_CURRENTMAX_CHARGE,             0,  500, LMON_NO_DIAG_CH },
+        }
+    },
+    [BMS_LMON_OVERCURRENT_DISCHARGE] = {
+        LMON_UPPER_LIMIT, {
+            { TRUE, (BC_CURRENTMAX_DISCHARGE/10)*9,     (BC_CURRENTMAX_DISCHARGE/10)*8, 100, 1000, LMON_NO_DIAG_CH },
+            { TRUE, BC_CURRENTMAX_DISCHARGE,            (BC_CURRENTMAX_DISCHARGE/20)*19, 500, 500, DIAG_CH_OVERCURRENT_DISCHARGE },
+            { TRUE, FFR_CURRENTMAX_DISCHARGE_MA,        BC_CURRENTMAX_DISCHARGE,          0,  500, LMON_NO_DIAG_CH },
+        }
+    },
+    [BMS_LMON_OVERTEMPERATURE_PREDICTED_CHARGE] = {
+        LMON_UPPER_LIMIT, {
+            { TRUE, BC_TEMPMAX_CHARGE,                  BC_TEMPMAX_CHARGE - 3,         1000, 5000, LMON_NO_DIAG_CH },
+            LMON_LEVEL_UNUSED,
+            LMON_LEVEL_UNUSED,
+        }
+    },
+    [BMS_LMON_OVERTEMPERATURE_PREDICTED_DISCHARGE] = {
+        LMON_UPPER_LIMIT, {
+            { TRUE, BC_TEMPMAX_DISCHARGE,               BC_TEMPMAX_DISCHARGE - 3,      1000, 5000, LMON_NO_DIAG_CH },
+            LMON_LEVEL_UNUSED,
+            LMON_LEVEL_UNUSED,
+        }
+    },
+};
+
 /*================== Function Prototypes ==================================*/
 
 /*================== Function Implementations =============================*/
@@ -37,6 +37,7 @@
 
 #include "mcu.h"
 #include "contactor.h"
+#include "lmon.h"
 
 /*================== Macros and Definitions ===============================*/
 
@@ -305,6 +306,31 @@
 #define BMS_CONT_CHARGE_MAINPLUS_OFF()         CONT_SetContactorState(CONT_CHARGE_PLUS_MAIN, CONT_SWITCH_OFF)
 #endif  // BS_SEPARATE_POWERLINES == 1
 
+/**
+ * Limit monitors of the BMS, index into bms_lmon_cfg[]
+ */
+typedef enum {
+    BMS_LMON_OVERVOLTAGE                         = 0,  /*!< maximum cell voltage in mV                      */
+    BMS_LMON_UNDERVOLTAGE                        = 1,  /*!< minimum cell voltage in mV                      */
+    BMS_LMON_OVERTEMPERATURE_CHARGE              = 2,  /*!< maximum cell temperature in degC, charge        */
+    BMS_LMON_OVERTEMPERATURE_DISCHARGE           = 3,  /*!< maximum cell temperature in degC, discharge     */
+    BMS_LMON_UNDERTEMPERATURE_CHARGE             = 4,  /*!< minimum cell temperature in degC, charge        */
+    BMS_LMON_UNDERTEMPERATURE_DISCHARGE          = 5,  /*!< minimum cell temperature in degC, discharge     */
+    BMS_LMON_OVERCURRENT_CHARGE                  = 6,  /*!< absolute charge current in mA                   */
+    BMS_LMON_OVERCURRENT_DISCHARGE               = 7,  /*!< absolute discharge current in mA                */
+    BMS_LMON_OVERTEMPERATURE_PREDICTED_CHARGE    = 8,  /*!< predicted core temperature in degC, charge      */
+    BMS_LMON_OVERTEMPERATURE_PREDICTED_DISCHARGE = 9,  /*!< predicted core temperature in degC, discharge   */
+    BMS_LMON_NR_OF                               = 10, /*!< number of limit monitors                        */
+} BMS_LMON_e;
+
+/*================== Constant and Variable Definitions ====================*/
+
+/**
+ * Warning, error and critical levels of the BMS limit monitors. The error
+ * levels are reported to the DIAG channels of the safe operating area.
+ */
+extern const LMON_CONFIG_s bms_lmon_cfg[BMS_LMON_NR_OF];
+
 /*================== Function Prototypes ==================================*/
 
 /*================== Function Implementations =============================*/
@@ -0,0 +1,129 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    budget_cfg.h
+ * @author  foxBMS Team
+ * @date    18.10.2026 (date of creation)
+ * @ingroup APPLICATION_CONF
+ * @prefix  BUDG
+ *
+ * @brief   Configuration of the time-window based current budgets
+ *
+ */
+
+#ifndef BUDGET_CFG_H_
+#define BUDGET_CFG_H_
+
+/*================== Includes =============================================*/
+#include "general.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/**
+ * @ingroup CONFIG_BUDGET
+ * length of one bucket of the rolling windows. The current is integrated
+ * every 1ms, the windows move in steps of one bucket.
+ * \par Type:
+ * int
+ * \par Unit:
+ * ms
+ * \par Default:
+ * 100
+*/
+#define BUDG_BUCKET_MS                      100
+
+/**
+ * @ingroup CONFIG_BUDGET
+ * number of peak windows, configured in budg_window_cfg[]
+ * \par Type:
+ * int
+ * \par Default:
+ * 3
+*/
+#define BUDG_NR_OF_WINDOWS                  3
+
+/**
+ * @ingroup CONFIG_BUDGET
+ * length of the longest peak window, determines the number of buckets kept
+ * \par Type:
+ * int
+ * \par Unit:
+ * ms
+ * \par Default:
+ * 30000
+*/
+#define BUDG_WINDOW_MAX_MS                  30000
+
+/**
+ * number of buckets needed for the longest window
+ */
+#define BUDG_NR_OF_BUCKETS                  (BUDG_WINDOW_MAX_MS / BUDG_BUCKET_MS)
+
+/**
+ * @ingroup CONFIG_BUDGET
+ * time constant of the low-pass filter of the squared current that is
+ * compared with the continuous current limit
+ * \par Type:
+ * int
+ * \par Unit:
+ * ms
+ * \par Default:
+ * 300000
+*/
+#define BUDG_CONTINUOUS_TAU_MS              300000
+
+/**
+ * @ingroup CONFIG_BUDGET
+ * used part of a budget above which a warning is reported
+ * \par Type:
+ * int
+ * \par Unit:
+ * %
+ * \par Range:
+ * [0,100]
+ * \par Default:
+ * 80
+*/
+#define BUDG_WARNING_PERC                   80
+
+/*================== Constant and Variable Definitions ====================*/
+
+/**
+ * configuration of one peak window
+ */
+typedef struct {
+    uint32_t length_ms;         /*!< length of the window in ms, multiple of BUDG_BUCKET_MS and at most BUDG_WINDOW_MAX_MS  */
+    uint8_t peak_perc;          /*!< allowed RMS current in the window: continuous limit plus this part of
+                                     the difference between peak and continuous limit, in %                             */
+} BUDG_WINDOW_CFG_s;
+
+/**
+ * peak windows, ordered from the shortest to the longest window
+ */
+extern const BUDG_WINDOW_CFG_s budg_window_cfg[BUDG_NR_OF_WINDOWS];
+
+/*================== Function Prototypes ==================================*/
+
+/*================== Function Implementations =============================*/
+
+#endif /* BUDGET_CFG_H_ */
@@ -0,0 +1,94 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    derating_cfg.c
+ * @author  foxBMS Team
+ * @date    18.10.2026 (date of creation)
+ * @ingroup APPLICATION_CONF
+ * @prefix  DRT
+ *
+ * @brief   Configuration of the derating manager
+ *
+ */
+
+/*================== Includes =============================================*/
+#include "general.h"
+#include "derating_cfg.h"
+
+#include "bms_cfg.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/*================== Constant and Variable Definitions ====================*/
+
+/*
+ * Violations of the safe operating area ramp the current down before the
+ * contactors are opened, the critical levels and hardware related errors
+ * open them immediately. The error levels of the limit monitors are covered
+ * by the error flags set by their DIAG channels.
+ */
+const DRT_RULE_s drt_rules[] = {
+        /* limit monitor                        warning                     error       critical */
+        DRT_LIMIT(BMS_LMON_OVERVOLTAGE,                 DRT_LIMIT_CHARGE(0),        DRT_NONE,   DRT_OPEN),
+        DRT_LIMIT(BMS_LMON_UNDERVOLTAGE,                DRT_LIMIT_DISCHARGE(50),    DRT_NONE,   DRT_OPEN),
+        DRT_LIMIT(BMS_LMON_OVERTEMPERATURE_CHARGE,      DRT_LIMIT_CHARGE(50),       DRT_NONE,   DRT_OPEN),
+        DRT_LIMIT(BMS_LMON_OVERTEMPERATURE_DISCHARGE,   DRT_REDUCE(50),             DRT_NONE,   DRT_OPEN),
+        DRT_LIMIT(BMS_LMON_UNDERTEMPERATURE_CHARGE,     DRT_LIMIT_CHARGE(50),       DRT_NONE,   DRT_NONE),
+        DRT_LIMIT(BMS_LMON_UNDERTEMPERATURE_DISCHARGE,  DRT_LIMIT_DISCHARGE(50),    DRT_NONE,   DRT_NONE),
+        DRT_LIMIT(BMS_LMON_OVERCURRENT_CHARGE,          DRT_LIMIT_CHARGE(80),       DRT_NONE,   DRT_OPEN),
+        DRT_LIMIT(BMS_LMON_OVERCURRENT_DISCHARGE,       DRT_LIMIT_DISCHARGE(80),    DRT_NONE,   DRT_OPEN),
+        DRT_LIMIT(BMS_LMON_OVERTEMPERATURE_PREDICTED_CHARGE,    DRT_LIMIT_CHARGE(70),       DRT_NONE,   DRT_NONE),
+        DRT_LIMIT(BMS_LMON_OVERTEMPERATURE_PREDICTED_DISCHARGE, DRT_REDUCE(70),             DRT_NONE,   DRT_NONE),
+
+        /* error flag                           action */
+        DRT_FLAG(over_voltage,                  DRT_RAMP_DOWN),
+        DRT_FLAG(under_voltage,                 DRT_RAMP_DOWN),
+        DRT_FLAG(over_temperature_charge,       DRT_RAMP_DOWN),
+        DRT_FLAG(over_temperature_discharge,    DRT_RAMP_DOWN),
+        DRT_FLAG(under_temperature_charge,      DRT_RAMP_DOWN),
+        DRT_FLAG(under_temperature_discharge,   DRT_RAMP_DOWN),
+        DRT_FLAG(over_current_charge,           DRT_RAMP_DOWN),
+        DRT_FLAG(over_current_discharge,        DRT_RAMP_DOWN),
+        DRT_FLAG(current_budget_charge,         DRT_LIMIT_CHARGE(50)),
+        DRT_FLAG(current_budget_discharge,      DRT_LIMIT_DISCHARGE(50)),
+        DRT_FLAG(crc_error,                     DRT_RAMP_DOWN),
+        DRT_FLAG(mux_error,                     DRT_RAMP_DOWN),
+        DRT_FLAG(spi_error,                     DRT_RAMP_DOWN),
+        DRT_FLAG(can_timing,                    DRT_RAMP_DOWN),
+        DRT_FLAG(can_timing_cc,                 DRT_RAMP_DOWN),
+        DRT_FLAG(currentsensorresponding,       DRT_OPEN),
+        DRT_FLAG(main_plus,                     DRT_OPEN),
+        DRT_FLAG(main_minus,                    DRT_OPEN),
+        DRT_FLAG(precharge,                     DRT_OPEN),
+        DRT_FLAG(charge_main_plus,              DRT_OPEN),
+        DRT_FLAG(charge_main_minus,             DRT_OPEN),
+        DRT_FLAG(charge_precharge,              DRT_OPEN),
+        DRT_FLAG(interlock,                     DRT_OPEN),
+        DRT_FLAG(fast_fault_reaction,           DRT_OPEN),
+};
+
+const uint8_t drt_rules_length = sizeof(drt_rules)/sizeof(drt_rules[0]);
+
+/*================== Function Prototypes ==================================*/
+
+/*================== Function Implementations =============================*/
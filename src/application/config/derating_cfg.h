@@ -0,0 +1,183 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    derating_cfg.h
+ * @author  foxBMS Team
+ * @date    18.10.2026 (date of creation)
+ * @ingroup APPLICATION_CONF
+ * @prefix  DRT
+ *
+ * @brief   Configuration of the derating manager
+ *
+ */
+
+#ifndef DERATING_CFG_H_
+#define DERATING_CFG_H_
+
+/*================== Includes =============================================*/
+#include <stddef.h>
+#include "general.h"
+#include "lmon.h"
+#include "database.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/**
+ * @ingroup CONFIG_DERATING
+ * cycle time of DRT_Trigger(), the output ramps are limited in steps of this time
+ * \par Type:
+ * int
+ * \par Unit:
+ * ms
+ * \par Default:
+ * 10
+*/
+#define DRT_CYCLE_TIME_MS                   10
+
+/**
+ * @ingroup CONFIG_DERATING
+ * maximum rate at which the current limits are reduced
+ * \par Type:
+ * int
+ * \par Unit:
+ * %/s
+ * \par Range:
+ * [10,1000]
+ * \par Default:
+ * 100
+*/
+#define DRT_RAMP_DOWN_PERC_PER_S            100
+
+/**
+ * @ingroup CONFIG_DERATING
+ * maximum rate at which the current limits are restored
+ * \par Type:
+ * int
+ * \par Unit:
+ * %/s
+ * \par Range:
+ * [10,1000]
+ * \par Default:
+ * 10
+*/
+#define DRT_RAMP_UP_PERC_PER_S              10
+
+/**
+ * @ingroup CONFIG_DERATING
+ * maximum duration of a ramp-down before the contactors are opened under load
+ * \par Type:
+ * int
+ * \par Unit:
+ * ms
+ * \par Default:
+ * 3000
+*/
+#define DRT_RAMP_DOWN_TIMEOUT_MS            3000
+
+/**
+ * @ingroup CONFIG_DERATING
+ * absolute current below which a finished ramp-down opens the contactors
+ * \par Type:
+ * int
+ * \par Unit:
+ * mA
+ * \par Default:
+ * 2000
+*/
+#define DRT_RAMP_DOWN_CURRENT_MA            2000
+
+/**
+ * disconnection requested by a derating action, ordered by severity
+ */
+typedef enum {
+    DRT_DISCONNECT_NONE         = 0,    /*!< contactors stay closed                                                 */
+    DRT_DISCONNECT_RAMP_DOWN    = 1,    /*!< ramp the limits to 0, request the ramp-down over CAN, then open        */
+    DRT_DISCONNECT_IMMEDIATE    = 2,    /*!< open the contactors immediately                                        */
+} DRT_DISCONNECT_e;
+
+/**
+ * action taken while a rule is active
+ */
+typedef struct {
+    uint8_t charge_perc;            /*!< charge current limits are scaled to this value in %      */
+    uint8_t discharge_perc;         /*!< discharge current limits are scaled to this value in %   */
+    DRT_DISCONNECT_e disconnect;    /*!< requested disconnection                                   */
+} DRT_ACTION_s;
+
+/**
+ * actions used in the rule table
+ */
+#define DRT_NONE                    { 100, 100, DRT_DISCONNECT_NONE }
+#define DRT_REDUCE(perc)            { (perc), (perc), DRT_DISCONNECT_NONE }
+#define DRT_LIMIT_CHARGE(perc)      { (perc), 100, DRT_DISCONNECT_NONE }
+#define DRT_LIMIT_DISCHARGE(perc)   { 100, (perc), DRT_DISCONNECT_NONE }
+#define DRT_RAMP_DOWN               { 0, 0, DRT_DISCONNECT_RAMP_DOWN }
+#define DRT_OPEN                    { 0, 0, DRT_DISCONNECT_IMMEDIATE }
+
+/**
+ * source of a rule
+ */
+typedef enum {
+    DRT_SOURCE_ERRORFLAG    = 0,    /*!< error flag in DATA_BLOCK_ERRORSTATE_s, set by the DIAG callbacks   */
+    DRT_SOURCE_LIMIT        = 1,    /*!< level of a BMS limit monitor, taken from BMS_LMON_e                */
+} DRT_SOURCE_e;
+
+/**
+ * rule mapping a diagnosis source and its severity to an action
+ */
+typedef struct {
+    DRT_SOURCE_e source;                        /*!< source of the rule                                             */
+    uint16_t index;                             /*!< offset of the error flag or index of the limit monitor         */
+    DRT_ACTION_s action[LMON_NR_OF_LEVELS];     /*!< action per level (warning, error, critical), a set error flag
+                                                     counts as error level                                          */
+} DRT_RULE_s;
+
+/**
+ * rule for an error flag of DATA_BLOCK_ERRORSTATE_s
+ */
+#define DRT_FLAG(flag, action)                      { DRT_SOURCE_ERRORFLAG, offsetof(DATA_BLOCK_ERRORSTATE_s, flag), { DRT_NONE, action, DRT_NONE } }
+
+/**
+ * rule for a BMS limit monitor
+ */
+#define DRT_LIMIT(monitor, warning, error, critical) { DRT_SOURCE_LIMIT, (monitor), { warning, error, critical } }
+
+/*================== Constant and Variable Definitions ====================*/
+
+/**
+ * rule table of the derating manager. Error flags without a rule do not
+ * lead to a disconnection, so every flag of DATA_BLOCK_ERRORSTATE_s except
+ * general_error and can_cc_used needs an entry.
+ */
+extern const DRT_RULE_s drt_rules[];
+
+/**
+ * number of entries in drt_rules[]
+ */
+extern const uint8_t drt_rules_length;
+
+/*================== Function Prototypes ==================================*/
+
+/*================== Function Implementations =============================*/
+
+#endif /* DERATING_CFG_H_ */
@@ -0,0 +1,83 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    soa_cfg.h
+ * @author  foxBMS Team
+ * @date    18.10.2026 (date of creation)
+ * @ingroup APPLICATION_CONF
+ * @prefix  SOA
+ *
+ * @brief   Configuration of the per-cell safe operating area checks
+ *
+ */
+
+#ifndef SOA_CFG_H_
+#define SOA_CFG_H_
+
+/*================== Includes =============================================*/
+#include "general.h"
+#include "batterysystem_cfg.h"
+#include "batterycell_cfg.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/**
+ * uses the SIMD instructions of the Cortex-M4/M7 DSP extension for the limit
+ * checks. The portable C implementation is used if set to FALSE or if the
+ * compiler does not target a core with the DSP extension (e.g., host builds).
+ *
+ * \par Type:
+ * toggle
+ * \par Default:
+ * TRUE
+*/
+#define SOA_USE_SIMD                        TRUE
+
+/**
+ * default upper cell voltage limit in mV, can be changed per cell at runtime
+ */
+#define SOA_DEFAULT_VOLTMAX_MV              BC_VOLTMAX
+
+/**
+ * default lower cell voltage limit in mV, can be changed per cell at runtime
+ */
+#define SOA_DEFAULT_VOLTMIN_MV              BC_VOLTMIN
+
+/**
+ * maximum number of values checked in one call, determines the size of the
+ * violation bitmasks
+ */
+#define SOA_MAX_CHANNELS                    ((BS_NR_OF_BAT_CELLS > BS_NR_OF_TEMP_SENSORS) ? BS_NR_OF_BAT_CELLS : BS_NR_OF_TEMP_SENSORS)
+
+/**
+ * number of 32bit words of the violation bitmasks
+ */
+#define SOA_MASK_WORDS                      ((SOA_MAX_CHANNELS + 31) / 32)
+
+/*================== Constant and Variable Definitions ====================*/
+
+/*================== Function Prototypes ==================================*/
+
+/*================== Function Implementations =============================*/
+
+#endif /* SOA_CFG_H_ */
@@ -0,0 +1,198 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    soh_cfg.h
+ * @author  foxBMS Team
+ * @date    18.10.2026 (date of creation)
+ * @ingroup APPLICATION_CONF
+ * @prefix  SOH
+ *
+ * @brief   Configuration of the state of health estimation
+ *
+ */
+
+#ifndef SOH_CFG_H_
+#define SOH_CFG_H_
+
+/*================== Includes =============================================*/
+#include "sox_cfg.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/**
+ * @ingroup CONFIG_SOH
+ * internal resistance of a new cell, defaults to the ohmic resistance of
+ * the cell model of the SOC Kalman filter
+ * \par Type:
+ * float
+ * \par Unit:
+ * mOhm
+ * \par Default:
+ * 1.2
+*/
+#define SOH_RESISTANCE_BOL              (SOX_EKF_R0 * 1000.0f)
+
+/**
+ * @ingroup CONFIG_SOH
+ * growth of the internal resistance at the end of life, as a multiple of
+ * SOH_RESISTANCE_BOL
+ * \par Type:
+ * float
+ * \par Range:
+ * (1.0,5.0]
+ * \par Default:
+ * 2.0
+*/
+#define SOH_RESISTANCE_EOL_FACTOR       2.0f
+
+/**
+ * @ingroup CONFIG_SOH
+ * SOH at the end of life. A cell reaches it when its capacity falls to this
+ * share of SOX_CELL_CAPACITY or when its resistance grows to
+ * SOH_RESISTANCE_EOL_FACTOR times SOH_RESISTANCE_BOL.
+ * \par Type:
+ * float
+ * \par Unit:
+ * %
+ * \par Range:
+ * [50.0,95.0]
+ * \par Default:
+ * 80.0
+*/
+#define SOH_EOL_PERC                    80.0f
+
+/**
+ * @ingroup CONFIG_SOH
+ * minimum change of the current between two cell voltage measurements for an
+ * update of the internal resistance
+ * \par Type:
+ * int
+ * \par Unit:
+ * mA
+ * \par Default:
+ * 10000
+*/
+#define SOH_RESISTANCE_MIN_STEP_MA      10000
+
+/**
+ * @ingroup CONFIG_SOH
+ * maximum time between two cell voltage measurements for an update of the
+ * internal resistance. Over longer times the open circuit voltage and the
+ * polarization change too much to be neglected.
+ * \par Type:
+ * int
+ * \par Unit:
+ * ms
+ * \par Default:
+ * 250
+*/
+#define SOH_RESISTANCE_MAX_STEP_TIME_MS 250
+
+/**
+ * @ingroup CONFIG_SOH
+ * the internal resistance is only updated while the mean cell temperature is
+ * in this range, so that the estimate stays comparable to SOH_RESISTANCE_BOL
+ * \par Type:
+ * int
+ * \par Unit:
+ * degC
+ * \par Default:
+ * 15, 35
+*/
+#define SOH_RESISTANCE_TEMPERATURE_MIN  15
+#define SOH_RESISTANCE_TEMPERATURE_MAX  35
+
+/**
+ * @ingroup CONFIG_SOH
+ * forgetting factor of the recursive least squares estimation of the internal
+ * resistance, per current step
+ * \par Type:
+ * float
+ * \par Range:
+ * [0.9,1.0]
+ * \par Default:
+ * 0.995
+*/
+#define SOH_RLS_FORGETTING              0.995f
+
+/**
+ * @ingroup CONFIG_SOH
+ * initial and maximum covariance of the recursive least squares estimation,
+ * relative to the variance of the voltage measurement (1 mV^2). Small values
+ * trust the stored resistance more than a new current step.
+ * \par Type:
+ * float
+ * \par Unit:
+ * mOhm^2/mV^2
+ * \par Default:
+ * 0.01
+*/
+#define SOH_RLS_P0                      0.01f
+
+/**
+ * @ingroup CONFIG_SOH
+ * minimum change of the mean SOC between two rest points for a capacity
+ * estimation. Small changes make the estimate sensitive to errors of the
+ * open circuit voltage table.
+ * \par Type:
+ * float
+ * \par Unit:
+ * %
+ * \par Range:
+ * [10.0,90.0]
+ * \par Default:
+ * 30.0
+*/
+#define SOH_CAPACITY_MIN_DELTA_SOC      30.0f
+
+/**
+ * @ingroup CONFIG_SOH
+ * weight of a new capacity estimation in the filtered cell capacity
+ * \par Type:
+ * float
+ * \par Range:
+ * (0.0,1.0]
+ * \par Default:
+ * 0.25
+*/
+#define SOH_CAPACITY_GAIN               0.25f
+
+/**
+ * @ingroup CONFIG_SOH
+ * plausible range of a capacity estimation, as a share of SOX_CELL_CAPACITY.
+ * Estimations outside of this range are discarded.
+ * \par Type:
+ * float
+ * \par Default:
+ * 0.5, 1.2
+*/
+#define SOH_CAPACITY_PLAUSIBLE_MIN      0.5f
+#define SOH_CAPACITY_PLAUSIBLE_MAX      1.2f
+
+/*================== Constant and Variable Definitions ====================*/
+
+/*================== Function Prototypes ==================================*/
+
+/*================== Function Implementations =============================*/
+
+#endif /* SOH_CFG_H_ */
@@ -62,6 +62,9 @@ SOX_SOF_CONFIG_s sox_sof_config = {
         .Cutoff_Voltage_Discha  = SOX_VOLT_CUTOFF_DISCHARGE
 };
 
+const int16_t sox_soe_resistance_temperature[SOX_SOE_RESISTANCE_POINTS] = { -20, 0, 25, 45 };
+const uint16_t sox_soe_resistance_factor[SOX_SOE_RESISTANCE_POINTS] = { 400, 200, 100, 80 };
+
 
 /*================== Function Prototypes ==================================*/
 
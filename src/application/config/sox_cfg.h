@@ -51,6 +51,22 @@
 */
 #define SOX_SOC_INIT_CURRENT_LIMIT      100
 
+/**
+ * @ingroup CONFIG_SOX
+ * relaxation time after which the SOC is recalibrated from the open circuit
+ * voltage. The current must stay below SOX_SOC_INIT_CURRENT_LIMIT for this
+ * time, the recalibration is done once per rest period.
+ * \par Type:
+ * int
+ * \par Unit:
+ * ms
+ * \par Range:
+ * [60000,86400000]
+ * \par Default:
+ * 1800000
+*/
+#define SOX_SOC_REST_TIME_MS            1800000
+
 /**
  * @ingroup CONFIG_SOX
  * when initializing SOC from SOC-Voltage lookup table, the difference between
@@ -370,6 +386,390 @@
 */
 #define SOX_VOLT_LIMIT_DISCHARGE 1750
 
+/**
+ * @ingroup CONFIG_SOX
+ * use the temperature and SOC dependent current limit maps (sox_sof_map) for
+ * the SOF. If set to FALSE, the piecewise-linear SOC and temperature ramps
+ * defined above are used.
+ * \par Type:
+ * toggle
+ * \par Default:
+ * TRUE
+*/
+#define SOX_SOF_USE_MAPS TRUE
+
+/**
+ * @ingroup CONFIG_SOX
+ * run SOF_Benchmark() in SOF_Init() to compare the execution time and the
+ * results of the current limit maps with the piecewise-linear ramps
+ * \par Type:
+ * toggle
+ * \par Default:
+ * FALSE
+*/
+#define SOX_SOF_BENCHMARK FALSE
+
+/**
+ * @ingroup CONFIG_SOX
+ * calculate the SOF in fixed point: currents in mA, slopes of the ramps in
+ * Q16 mA per input unit. The inputs stay integers (mV, 0.01% SOC, degC), so
+ * no FPU is needed up to the conversion of the result to A. Only the SOF is
+ * covered: the SOC, SOE and SOP and the derating and balancing factors
+ * applied to the SOF are still calculated in floating point.
+ * \par Type:
+ * toggle
+ * \par Default:
+ * FALSE
+*/
+#define SOX_SOF_FIXED_POINT FALSE
+
+/**
+ * @ingroup CONFIG_SOX
+ * run SOF_FixedPointCheck() in SOF_Init() to compare the fixed-point SOF with
+ * the floating-point SOF over the complete input range of every ramp.
+ * "tools/sox_host/sox_host.py sof" sweeps the complete input space of the
+ * input types on the host.
+ * \par Type:
+ * toggle
+ * \par Default:
+ * FALSE
+*/
+#define SOX_SOF_FIXED_POINT_CHECK FALSE
+
+/**
+ * @ingroup CONFIG_SOX
+ * largest allowed difference between the fixed-point and the floating-point
+ * SOF, reported by SOF_FixedPointCheck()
+ * \par Type:
+ * float
+ * \par Unit:
+ * A
+ * \par Range:
+ * [0.001,1.0]
+ * \par Default:
+ * 0.002
+*/
+#define SOX_SOF_FIXED_POINT_TOLERANCE 0.002f
+
+/**
+ * @ingroup CONFIG_SOX
+ * maximum number of temperature and SOC breakpoints of the current limit maps
+ * \par Type:
+ * int
+ * \par Range:
+ * [2,255]
+ * \par Default:
+ * 16
+*/
+#define SOX_SOF_MAP_MAX_POINTS 16
+
+/**
+ * @ingroup CONFIG_SOX
+ * run SOC_OcvBenchmark() in SOC_Init() to compare the execution time and the
+ * results of the binary search in the open circuit voltage table with a
+ * linear search in floating point. "tools/sox_host/sox_host.py ocv" runs the
+ * same comparison on the host.
+ * \par Type:
+ * toggle
+ * \par Default:
+ * FALSE
+*/
+#define SOX_OCV_BENCHMARK FALSE
+
+/**
+ * @ingroup CONFIG_SOX
+ * estimate the SOC with an extended Kalman filter (see sox_ekf.c) fed by the
+ * current and the minimum, mean and maximum cell voltage. If set to FALSE,
+ * the SOC is calculated by coulomb counting only. "tools/sox_host/sox_host.py ekf"
+ * benchmarks the filter on a synthetic drive cycle on the host.
+ * \par Type:
+ * toggle
+ * \par Default:
+ * TRUE
+*/
+#define SOX_SOC_EKF TRUE
+
+/**
+ * @ingroup CONFIG_SOX
+ * ohmic resistance R0 of the equivalent circuit cell model
+ * \par Type:
+ * float
+ * \par Unit:
+ * Ohm
+ * \par Default:
+ * 0.0012
+*/
+#define SOX_EKF_R0 0.0012f
+
+/**
+ * @ingroup CONFIG_SOX
+ * resistance R1 of the first RC element of the equivalent circuit cell model
+ * \par Type:
+ * float
+ * \par Unit:
+ * Ohm
+ * \par Default:
+ * 0.0008
+*/
+#define SOX_EKF_R1 0.0008f
+
+/**
+ * @ingroup CONFIG_SOX
+ * time constant R1*C1 of the first RC element of the equivalent circuit cell model
+ * \par Type:
+ * float
+ * \par Unit:
+ * s
+ * \par Range:
+ * ]0.0,inf[
+ * \par Default:
+ * 10.0
+*/
+#define SOX_EKF_TAU1 10.0f
+
+/**
+ * @ingroup CONFIG_SOX
+ * resistance R2 of the second RC element of the equivalent circuit cell
+ * model. Set to 0.0 for a 1RC model.
+ * \par Type:
+ * float
+ * \par Unit:
+ * Ohm
+ * \par Default:
+ * 0.001
+*/
+#define SOX_EKF_R2 0.001f
+
+/**
+ * @ingroup CONFIG_SOX
+ * time constant R2*C2 of the second RC element of the equivalent circuit cell model
+ * \par Type:
+ * float
+ * \par Unit:
+ * s
+ * \par Range:
+ * ]0.0,inf[
+ * \par Default:
+ * 200.0
+*/
+#define SOX_EKF_TAU2 200.0f
+
+/**
+ * @ingroup CONFIG_SOX
+ * process noise of the SOC (0.0..1.0) per second, covers the error of the
+ * current measurement and of the capacity
+ * \par Type:
+ * float
+ * \par Unit:
+ * 1/s
+ * \par Default:
+ * 1.0e-8
+*/
+#define SOX_EKF_Q_SOC 1.0e-8f
+
+/**
+ * @ingroup CONFIG_SOX
+ * process noise of the voltages over the RC elements per second
+ * \par Type:
+ * float
+ * \par Unit:
+ * V^2/s
+ * \par Default:
+ * 1.0e-6
+*/
+#define SOX_EKF_Q_RC 1.0e-6f
+
+/**
+ * @ingroup CONFIG_SOX
+ * measurement noise of the cell voltage, covers the error of the voltage
+ * measurement and of the cell model
+ * \par Type:
+ * float
+ * \par Unit:
+ * V^2
+ * \par Default:
+ * 1.0e-4
+*/
+#define SOX_EKF_R_VOLTAGE 1.0e-4f
+
+/**
+ * @ingroup CONFIG_SOX
+ * initial variance of the SOC (0.0..1.0) after the SOC has been set
+ * \par Type:
+ * float
+ * \par Default:
+ * 0.01
+*/
+#define SOX_EKF_P0_SOC 0.01f
+
+/**
+ * @ingroup CONFIG_SOX
+ * track the SOC of each cell (DATA_BLOCK_ID_CELLSOC). soc_min and soc_max of
+ * DATA_BLOCK_SOX_s are then taken from the weakest and the strongest cell.
+ * \par Type:
+ * toggle
+ * \par Default:
+ * TRUE
+*/
+#define SOX_SOC_PER_CELL TRUE
+
+/**
+ * @ingroup CONFIG_SOX
+ * gain of the correction of the cell SOC offsets with the deviation of the
+ * cell voltages from the mean cell voltage
+ * \par Type:
+ * float
+ * \par Unit:
+ * 1/s
+ * \par Range:
+ * [0.0,0.1]
+ * \par Default:
+ * 0.002
+*/
+#define SOX_CELL_SOC_GAIN 0.002f
+
+/**
+ * @ingroup CONFIG_SOX
+ * the cell SOC offsets are only corrected with the cell voltages if the slope
+ * of the open circuit voltage is at least this value, e.g., not on the
+ * plateau of LFP cells
+ * \par Type:
+ * float
+ * \par Unit:
+ * mV/%
+ * \par Default:
+ * 1.0
+*/
+#define SOX_CELL_SOC_MIN_SLOPE 1.0f
+
+/**
+ * @ingroup CONFIG_SOX
+ * maximum time between two current samples that is integrated by the
+ * coulomb counter (see sox_cc.c). Longer gaps, e.g., after a timeout of the
+ * current sensor, are not integrated but counted. Must be below the wrap
+ * around time of the cycle counter (25s at 168MHz).
+ * \par Type:
+ * int
+ * \par Unit:
+ * ms
+ * \par Range:
+ * [1,20000]
+ * \par Default:
+ * 200
+*/
+#define SOX_CC_MAX_SAMPLE_GAP_MS 200
+
+/**
+ * @ingroup CONFIG_SOX
+ * the cell SOC offsets are only corrected with the cell voltages if the
+ * current is below this value, as the voltage deviations at higher currents
+ * are dominated by the differences of the cell resistances
+ * \par Type:
+ * int
+ * \par Unit:
+ * mA
+ * \par Default:
+ * 5000
+*/
+#define SOX_CELL_SOC_CORRECTION_CURRENT 5000
+
+/**
+ * @ingroup CONFIG_SOX
+ * maximum number of voltages (temperature breakpoints times SOC breakpoints)
+ * of the open circuit voltage table that are integrated for the SOE. Rows
+ * beyond this limit are not used.
+ * \par Type:
+ * int
+ * \par Default:
+ * 64
+*/
+#define SOX_OCV_MAX_POINTS 64
+
+/**
+ * @ingroup CONFIG_SOX
+ * update period of the SOE
+ * \par Type:
+ * int
+ * \par Unit:
+ * ms
+ * \par Default:
+ * 1000
+*/
+#define SOX_SOE_PERIOD_MS 1000
+
+/**
+ * @ingroup CONFIG_SOX
+ * SOC window of the SOE. The remaining energy is counted down to
+ * SOX_SOE_SOC_MIN, the charge energy up to SOX_SOE_SOC_MAX.
+ * \par Type:
+ * float
+ * \par Unit:
+ * %
+ * \par Default:
+ * 0.0, 100.0
+*/
+#define SOX_SOE_SOC_MIN 0.0f
+#define SOX_SOE_SOC_MAX 100.0f
+
+/**
+ * @ingroup CONFIG_SOX
+ * time constant of the low-pass filter of the current used for the losses
+ * of the SOE
+ * \par Type:
+ * float
+ * \par Unit:
+ * s
+ * \par Default:
+ * 60.0
+*/
+#define SOX_SOE_CURRENT_FILTER_S 60.0f
+
+/**
+ * @ingroup CONFIG_SOX
+ * minimum discharge and charge currents the losses of the available energies
+ * are calculated with, used when the filtered current is lower, e.g., at rest
+ * \par Type:
+ * int
+ * \par Unit:
+ * mA
+ * \par Default:
+ * 20000, 10000
+*/
+#define SOX_SOE_DISCHARGE_CURRENT 20000
+#define SOX_SOE_CHARGE_CURRENT 10000
+
+/**
+ * @ingroup CONFIG_SOX
+ * number of breakpoints of the temperature factor of the cell resistance
+ * used for the losses of the SOE
+ * \par Type:
+ * int
+ * \par Default:
+ * 4
+*/
+#define SOX_SOE_RESISTANCE_POINTS 4
+
+/**
+ * @ingroup CONFIG_SOX
+ * prediction horizons of the SOP. For each horizon, the SOP calculates the
+ * maximum constant current that keeps the weakest cell within BC_VOLTMIN and
+ * BC_VOLTMAX until the end of the horizon.
+ * \par Type:
+ * float
+ * \par Unit:
+ * s
+ * \par Default:
+ * 2.0, 10.0, 30.0
+*/
+#define SOX_SOP_HORIZON_SHORT_S 2.0f
+#define SOX_SOP_HORIZON_MEDIUM_S 10.0f
+#define SOX_SOP_HORIZON_LONG_S 30.0f
+
+/**
+ * number of prediction horizons of the SOP
+ */
+#define SOX_SOP_NR_OF_HORIZONS 3
+
 /*================== Constant and Variable Definitions ====================*/
 
 /**
@@ -407,6 +807,60 @@ typedef struct {
 
 extern SOX_SOF_CONFIG_s sox_sof_config;
 
+/**
+ * current limit maps of the SOF
+ */
+typedef enum {
+    SOX_SOF_MAP_CHARGE_CONT     = 0,    /*!< maximum continuous charge current      */
+    SOX_SOF_MAP_CHARGE_PEAK     = 1,    /*!< maximum peak charge current            */
+    SOX_SOF_MAP_DISCHA_CONT     = 2,    /*!< maximum continuous discharge current   */
+    SOX_SOF_MAP_DISCHA_PEAK     = 3,    /*!< maximum peak discharge current         */
+    SOX_SOF_MAP_NR_OF           = 4,    /*!< number of maps                         */
+} SOX_SOF_MAP_e;
+
+/**
+ * temperature x SOC maps of the maximum currents, generated from the cell
+ * datasheet with tools/sof_csv2map.py. The maps are stored row by row, i.e.,
+ * the current at temperature breakpoint i and SOC breakpoint j is
+ * current[map][i * nr_soc + j]. Both axes must be strictly increasing and have
+ * 2 to SOX_SOF_MAP_MAX_POINTS breakpoints.
+ */
+typedef struct {
+    const int16_t *temperature;                     /*!< temperature breakpoints in degC    */
+    uint8_t nr_temperature;                         /*!< number of temperature breakpoints  */
+    const int16_t *soc;                             /*!< SOC breakpoints in 0.01%           */
+    uint8_t nr_soc;                                 /*!< number of SOC breakpoints          */
+    const uint16_t *current[SOX_SOF_MAP_NR_OF];     /*!< maximum currents in 0.1A           */
+} SOX_SOF_MAP_s;
+
+extern const SOX_SOF_MAP_s sox_sof_map;
+
+/**
+ * open circuit voltage table of the cell chemistry selected with BC_CHEMISTRY.
+ * The voltages are stored row by row, i.e., the OCV at temperature breakpoint i
+ * and SOC breakpoint j is voltage[i * nr_soc + j]. The temperature axis must be
+ * strictly increasing and have at least 1 breakpoint, the SOC axis and each
+ * row of voltages must be strictly increasing and have at least 2 breakpoints.
+ */
+typedef struct {
+    const int16_t *temperature;     /*!< temperature breakpoints in degC    */
+    uint8_t nr_temperature;         /*!< number of temperature breakpoints  */
+    const int16_t *soc;             /*!< SOC breakpoints in 0.01%           */
+    uint8_t nr_soc;                 /*!< number of SOC breakpoints          */
+    const uint16_t *voltage;        /*!< open circuit voltages in mV        */
+} SOX_OCV_TABLE_s;
+
+extern const SOX_OCV_TABLE_s sox_ocv_table;
+
+/**
+ * temperature factor of the cell resistance for the losses of the SOE. The
+ * resistance estimated by the SOH at 25degC is scaled with the factor in %
+ * interpolated at the mean cell temperature. The temperature breakpoints in
+ * degC must be strictly increasing.
+ */
+extern const int16_t sox_soe_resistance_temperature[SOX_SOE_RESISTANCE_POINTS];
+extern const uint16_t sox_soe_resistance_factor[SOX_SOE_RESISTANCE_POINTS];
+
 /*================== Function Prototypes ==================================*/
 
 
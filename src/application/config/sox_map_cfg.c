@@ -0,0 +1,112 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    sox_map_cfg.c
+ * @author  foxBMS Team
+ * @date    18.10.2026 (date of creation)
+ * @ingroup APPLICATION_CONF
+ * @prefix  SOX
+ *
+ * @brief   Current limit maps of the SOF
+ *
+ * @details Generated by tools/sof_csv2map.py from sox_map_cfg.csv, do not edit.
+ *
+ */
+
+/*================== Includes =============================================*/
+#include "general.h"
+#include "sox_cfg.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/*================== Constant and Variable Definitions ====================*/
+/**
+ * temperature breakpoints of the current limit maps in degC
+ */
+static const int16_t sox_map_temperature[] = { -10, 0, 25, 45, 55 };
+
+/**
+ * SOC breakpoints of the current limit maps in 0.01%
+ */
+static const int16_t sox_map_soc[] = { 0, 500, 1500, 5000, 8500, 9500, 10000 };
+
+/**
+ * maximum continuous charge current in 0.1A, one row per temperature breakpoint
+ */
+static const uint16_t sox_map_charge_cont[] = {
+    /*  -10degC */     0,     0,     0,     0,     0,     0,     0,
+    /*    0degC */  1200,  1200,  1200,  1200,  1200,     0,     0,
+    /*   25degC */  1200,  1200,  1200,  1200,  1200,     0,     0,
+    /*   45degC */  1200,  1200,  1200,  1200,  1200,     0,     0,
+    /*   55degC */     0,     0,     0,     0,     0,     0,     0,
+};
+
+/**
+ * maximum peak charge current in 0.1A, one row per temperature breakpoint
+ */
+static const uint16_t sox_map_charge_peak[] = {
+    /*  -10degC */     0,     0,     0,     0,     0,     0,     0,
+    /*    0degC */  1200,  1200,  1200,  1200,  1200,     0,     0,
+    /*   25degC */  1200,  1200,  1200,  1200,  1200,     0,     0,
+    /*   45degC */  1200,  1200,  1200,  1200,  1200,     0,     0,
+    /*   55degC */     0,     0,     0,     0,     0,     0,     0,
+};
+
+/**
+ * maximum continuous discharge current in 0.1A, one row per temperature breakpoint
+ */
+static const uint16_t sox_map_discharge_cont[] = {
+    /*  -10degC */   200,   200,   200,   200,   200,   200,   200,
+    /*    0degC */   200,   200,  1200,  1200,  1200,  1200,  1200,
+    /*   25degC */   200,   200,  1200,  1200,  1200,  1200,  1200,
+    /*   45degC */   200,   200,  1200,  1200,  1200,  1200,  1200,
+    /*   55degC */     0,     0,     0,     0,     0,     0,     0,
+};
+
+/**
+ * maximum peak discharge current in 0.1A, one row per temperature breakpoint
+ */
+static const uint16_t sox_map_discharge_peak[] = {
+    /*  -10degC */   200,   200,   200,   200,   200,   200,   200,
+    /*    0degC */   200,   200,  1200,  1200,  1200,  1200,  1200,
+    /*   25degC */   200,   200,  1200,  1200,  1200,  1200,  1200,
+    /*   45degC */   200,   200,  1200,  1200,  1200,  1200,  1200,
+    /*   55degC */     0,     0,     0,     0,     0,     0,     0,
+};
+
+const SOX_SOF_MAP_s sox_sof_map = {
+    .temperature    = sox_map_temperature,
+    .nr_temperature = 5,
+    .soc            = sox_map_soc,
+    .nr_soc         = 7,
+    .current        = {
+        [SOX_SOF_MAP_CHARGE_CONT] = sox_map_charge_cont,
+        [SOX_SOF_MAP_CHARGE_PEAK] = sox_map_charge_peak,
+        [SOX_SOF_MAP_DISCHA_CONT] = sox_map_discharge_cont,
+        [SOX_SOF_MAP_DISCHA_PEAK] = sox_map_discharge_peak,
+    },
+};
+
+/*================== Function Prototypes ==================================*/
+
+/*================== Function Implementations =============================*/
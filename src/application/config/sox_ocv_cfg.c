@@ -0,0 +1,102 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    sox_ocv_cfg.c
+ * @author  foxBMS Team
+ * @date    18.10.2026 (date of creation)
+ * @ingroup APPLICATION_CONF
+ * @prefix  SOX
+ *
+ * @brief   Open circuit voltage tables of the supported cell chemistries
+ *
+ * @details The table of the chemistry selected with BC_CHEMISTRY in
+ *          batterycell_cfg.h is used to initialize and recalibrate the SOC.
+ *          The voltages are typical values of relaxed cells and should be
+ *          replaced with the datasheet values of the used cell.
+ *
+ */
+
+/*================== Includes =============================================*/
+#include "general.h"
+#include "sox_cfg.h"
+
+#include "batterycell_cfg.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/*================== Constant and Variable Definitions ====================*/
+/**
+ * temperature breakpoints of the open circuit voltage table in degC
+ */
+static const int16_t sox_ocv_temperature[] = { -10, 25, 45 };
+
+/**
+ * SOC breakpoints of the open circuit voltage table in 0.01%
+ */
+static const int16_t sox_ocv_soc[] = { 0, 500, 1000, 2000, 3000, 4000, 5000, 6000, 7000, 8000, 9000, 9500, 10000 };
+
+#if BC_CHEMISTRY == BC_CHEMISTRY_LTO
+/**
+ * open circuit voltage in mV of lithium titanate cells, one row per temperature breakpoint
+ */
+static const uint16_t sox_ocv_voltage[] = {
+    /*  -10degC */  1890,  2105,  2170,  2220,  2250,  2280,  2310,  2340,  2380,  2420,  2480,  2530,  2640,
+    /*   25degC */  1900,  2120,  2180,  2230,  2260,  2290,  2320,  2350,  2390,  2430,  2490,  2540,  2650,
+    /*   45degC */  1905,  2125,  2185,  2235,  2265,  2295,  2325,  2355,  2395,  2435,  2495,  2545,  2655,
+};
+#elif BC_CHEMISTRY == BC_CHEMISTRY_LFP
+/**
+ * open circuit voltage in mV of lithium iron phosphate cells, one row per temperature breakpoint
+ *
+ * Due to the flat plateau between 30% and 90% SOC, a voltage error of a few mV
+ * leads to a large SOC error in this range.
+ */
+static const uint16_t sox_ocv_voltage[] = {
+    /*  -10degC */  2480,  2980,  3160,  3205,  3240,  3260,  3275,  3285,  3300,  3318,  3328,  3340,  3480,
+    /*   25degC */  2500,  3000,  3180,  3220,  3250,  3270,  3285,  3295,  3310,  3325,  3335,  3345,  3500,
+    /*   45degC */  2510,  3010,  3185,  3225,  3255,  3273,  3288,  3298,  3312,  3327,  3337,  3347,  3505,
+};
+#elif BC_CHEMISTRY == BC_CHEMISTRY_NMC
+/**
+ * open circuit voltage in mV of lithium nickel manganese cobalt oxide cells, one row per temperature breakpoint
+ */
+static const uint16_t sox_ocv_voltage[] = {
+    /*  -10degC */  2980,  3330,  3435,  3540,  3600,  3650,  3700,  3780,  3870,  3960,  4060,  4110,  4180,
+    /*   25degC */  3000,  3350,  3450,  3550,  3610,  3660,  3710,  3790,  3880,  3970,  4070,  4120,  4190,
+    /*   45degC */  3010,  3360,  3455,  3555,  3615,  3665,  3715,  3795,  3885,  3975,  4075,  4125,  4195,
+};
+#else
+#error "Please select a cell chemistry with an open circuit voltage table (BC_CHEMISTRY)"
+#endif
+
+const SOX_OCV_TABLE_s sox_ocv_table = {
+    .temperature    = sox_ocv_temperature,
+    .nr_temperature = sizeof(sox_ocv_temperature)/sizeof(sox_ocv_temperature[0]),
+    .soc            = sox_ocv_soc,
+    .nr_soc         = sizeof(sox_ocv_soc)/sizeof(sox_ocv_soc[0]),
+    .voltage        = sox_ocv_voltage,
+};
+
+/*================== Function Prototypes ==================================*/
+
+/*================== Function Implementations =============================*/
@@ -0,0 +1,201 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    thermal_cfg.h
+ * @author  foxBMS Team
+ * @date    18.10.2026 (date of creation)
+ * @ingroup APPLICATION_CONF
+ * @prefix  THM
+ *
+ * @brief   Configuration of the lumped thermal model of the modules
+ *
+ */
+
+#ifndef THERMAL_CFG_H_
+#define THERMAL_CFG_H_
+
+/*================== Includes =============================================*/
+#include "general.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/**
+ * @ingroup CONFIG_THERMAL
+ * cycle time of THM_Trigger(), the model is integrated with this time step
+ * \par Type:
+ * int
+ * \par Unit:
+ * ms
+ * \par Default:
+ * 100
+*/
+#define THM_CYCLE_TIME_MS                   100
+
+/**
+ * @ingroup CONFIG_THERMAL
+ * heat capacity of one module (cells and housing)
+ * \par Type:
+ * float
+ * \par Unit:
+ * J/K
+ * \par Default:
+ * 1000.0
+*/
+#define THM_MODULE_HEAT_CAPACITY            1000.0f
+
+/**
+ * @ingroup CONFIG_THERMAL
+ * thermal conductance from one module to the coolant
+ * \par Type:
+ * float
+ * \par Unit:
+ * W/K
+ * \par Default:
+ * 2.0
+*/
+#define THM_CONDUCTANCE_COOLANT             2.0f
+
+/**
+ * @ingroup CONFIG_THERMAL
+ * thermal conductance between two neighbouring modules. The modules are
+ * stacked in the order of their index, the first and the last module have
+ * one neighbour.
+ * \par Type:
+ * float
+ * \par Unit:
+ * W/K
+ * \par Default:
+ * 0.5
+*/
+#define THM_CONDUCTANCE_NEIGHBOUR           0.5f
+
+/**
+ * @ingroup CONFIG_THERMAL
+ * thermal resistance from the core of a cell to its surface, where the
+ * sensors are mounted. The core of the cells is not measured.
+ * \par Type:
+ * float
+ * \par Unit:
+ * K/W
+ * \par Default:
+ * 3.0
+*/
+#define THM_CELL_CORE_RESISTANCE            3.0f
+
+/**
+ * @ingroup CONFIG_THERMAL
+ * coolant temperature used until THM_SetCoolantTemperature() is called
+ * \par Type:
+ * float
+ * \par Unit:
+ * degC
+ * \par Default:
+ * 25.0
+*/
+#define THM_COOLANT_TEMPERATURE             25.0f
+
+/**
+ * @ingroup CONFIG_THERMAL
+ * gain with which the model is corrected towards the plausible sensors
+ * \par Type:
+ * float
+ * \par Unit:
+ * 1/s
+ * \par Range:
+ * [0.0,1.0]
+ * \par Default:
+ * 0.05
+*/
+#define THM_OBSERVER_GAIN                   0.05f
+
+/**
+ * @ingroup CONFIG_THERMAL
+ * horizon of the temperature prediction used for the early derating
+ * \par Type:
+ * float
+ * \par Unit:
+ * s
+ * \par Default:
+ * 60.0
+*/
+#define THM_PREDICTION_HORIZON_S            60.0f
+
+/**
+ * @ingroup CONFIG_THERMAL
+ * time constant of the low-pass filter of the squared current that is
+ * assumed to flow over the prediction horizon
+ * \par Type:
+ * float
+ * \par Unit:
+ * s
+ * \par Default:
+ * 10.0
+*/
+#define THM_CURRENT_FILTER_S                10.0f
+
+/**
+ * @ingroup CONFIG_THERMAL
+ * maximum deviation of a sensor from the modelled surface temperature
+ * \par Type:
+ * float
+ * \par Unit:
+ * K
+ * \par Default:
+ * 8.0
+*/
+#define THM_SENSOR_TOLERANCE                8.0f
+
+/**
+ * @ingroup CONFIG_THERMAL
+ * number of cycles a sensor has to deviate by more than THM_SENSOR_TOLERANCE
+ * while the other sensors of its module agree with the model, until it is
+ * flagged as implausible. The flag is removed after the same number of cycles
+ * within the tolerance.
+ * \par Type:
+ * int
+ * \par Range:
+ * [1,255]
+ * \par Default:
+ * 50
+*/
+#define THM_SENSOR_DEBOUNCE                 50
+
+/**
+ * @ingroup CONFIG_THERMAL
+ * maximum execution time of THM_Trigger(), longer executions are counted
+ * \par Type:
+ * int
+ * \par Unit:
+ * us
+ * \par Default:
+ * 200
+*/
+#define THM_CYCLE_BUDGET_US                 200
+
+/*================== Constant and Variable Definitions ====================*/
+
+/*================== Function Prototypes ==================================*/
+
+/*================== Function Implementations =============================*/
+
+#endif /* THERMAL_CFG_H_ */
@@ -0,0 +1,200 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    derating.c
+ * @author  foxBMS Team
+ * @date    18.10.2026 (date of creation)
+ * @ingroup APPLICATION
+ * @prefix  DRT
+ *
+ * @brief   Derating manager
+ *
+ */
+
+/*================== Includes =============================================*/
+#include "general.h"
+#include "derating.h"
+
+#include "bms.h"
+#include "database.h"
+#include "os.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/**
+ * maximum change of a factor per cycle in 0.1%
+ */
+#define DRT_RAMP_DOWN_STEP      ((DRT_RAMP_DOWN_PERC_PER_S * DRT_CYCLE_TIME_MS) / 100)
+#define DRT_RAMP_UP_STEP        ((DRT_RAMP_UP_PERC_PER_S * DRT_CYCLE_TIME_MS) / 100)
+
+/*================== Constant and Variable Definitions ====================*/
+
+static DRT_STATE_s drt_state = {
+    .charge_permille        = 1000,
+    .discharge_permille     = 1000,
+    .target_charge_perc     = 100,
+    .target_discharge_perc  = 100,
+    .disconnect             = DRT_DISCONNECT_NONE,
+    .ramp_down_ms           = 0,
+    .ramp_down_finished     = FALSE,
+};
+
+/*================== Function Prototypes ==================================*/
+
+static void DRT_Evaluate(DRT_ACTION_s *result);
+static uint16_t DRT_Ramp(uint16_t value, uint8_t target_perc);
+
+/*================== Function Implementations =============================*/
+
+/**
+ * @brief   combines the actions of all active rules
+ *
+ * @details The factors are the minimum and the disconnection the most severe
+ *          of all active rules.
+ *
+ * @param   result  pointer where the combined action is stored
+ */
+static void DRT_Evaluate(DRT_ACTION_s *result) {
+    DATA_BLOCK_ERRORSTATE_s error_flags;
+    const DRT_RULE_s *rule = NULL_PTR;
+    const DRT_ACTION_s *action = NULL_PTR;
+    LMON_LEVEL_e level = LMON_LEVEL_OK;
+    uint8_t i = 0;
+
+    DB_ReadBlock(&error_flags, DATA_BLOCK_ID_ERRORSTATE);
+
+    result->charge_perc = 100;
+    result->discharge_perc = 100;
+    result->disconnect = DRT_DISCONNECT_NONE;
+
+    for (i = 0; i < drt_rules_length; i++) {
+        rule = &drt_rules[i];
+        if (rule->source == DRT_SOURCE_ERRORFLAG) {
+            level = (((uint8_t *)&error_flags)[rule->index] != 0) ? LMON_LEVEL_ERROR : LMON_LEVEL_OK;
+        } else {
+            level = BMS_GetLimitLevel((BMS_LMON_e)rule->index);
+        }
+
+        if (level != LMON_LEVEL_OK) {
+            action = &rule->action[level - 1];
+            if (action->charge_perc < result->charge_perc) {
+                result->charge_perc = action->charge_perc;
+            }
+            if (action->discharge_perc < result->discharge_perc) {
+                result->discharge_perc = action->discharge_perc;
+            }
+            if (action->disconnect > result->disconnect) {
+                result->disconnect = action->disconnect;
+            }
+        }
+    }
+}
+
+
+/**
+ * @brief   moves a factor towards its target, limited to one step per cycle
+ *
+ * @param   value       factor in 0.1%
+ * @param   target_perc target in %
+ *
+ * @return  new factor in 0.1%
+ */
+static uint16_t DRT_Ramp(uint16_t value, uint8_t target_perc) {
+    uint16_t target = (uint16_t)target_perc * 10;
+
+    if (value > target) {
+        value = (value - target > DRT_RAMP_DOWN_STEP) ? (value - DRT_RAMP_DOWN_STEP) : target;
+    } else if (value < target) {
+        value = (target - value > DRT_RAMP_UP_STEP) ? (value + DRT_RAMP_UP_STEP) : target;
+    }
+    return value;
+}
+
+
+void DRT_Trigger(void) {
+    DATA_BLOCK_CURRENT_s current_tab;
+    DRT_ACTION_s action;
+    float current = 0.0;
+    uint16_t charge = 0;
+    uint16_t discharge = 0;
+    uint32_t ramp_down_ms = 0;
+    uint8_t finished = FALSE;
+
+    DRT_Evaluate(&action);
+    DB_ReadBlock(&current_tab, DATA_BLOCK_ID_CURRENT);
+
+    charge = DRT_Ramp(drt_state.charge_permille, action.charge_perc);
+    discharge = DRT_Ramp(drt_state.discharge_permille, action.discharge_perc);
+
+    if (action.disconnect == DRT_DISCONNECT_RAMP_DOWN) {
+        ramp_down_ms = drt_state.ramp_down_ms;
+        if (ramp_down_ms < DRT_RAMP_DOWN_TIMEOUT_MS) {
+            ramp_down_ms += DRT_CYCLE_TIME_MS;
+        }
+        current = (current_tab.current < 0.0) ? -current_tab.current : current_tab.current;
+        if (((charge == 0) && (discharge == 0) && (current < DRT_RAMP_DOWN_CURRENT_MA)) ||
+                (ramp_down_ms >= DRT_RAMP_DOWN_TIMEOUT_MS)) {
+            finished = TRUE;
+        }
+    }
+
+    OS_TaskEnter_Critical();
+    drt_state.charge_permille = charge;
+    drt_state.discharge_permille = discharge;
+    drt_state.target_charge_perc = action.charge_perc;
+    drt_state.target_discharge_perc = action.discharge_perc;
+    drt_state.disconnect = action.disconnect;
+    drt_state.ramp_down_ms = ramp_down_ms;
+    drt_state.ramp_down_finished = finished;
+    OS_TaskExit_Critical();
+}
+
+
+void DRT_GetFactors(float *charge, float *discharge) {
+    OS_TaskEnter_Critical();
+    *charge = drt_state.charge_permille / 1000.0;
+    *discharge = drt_state.discharge_permille / 1000.0;
+    OS_TaskExit_Critical();
+}
+
+
+uint8_t DRT_IsDisconnectRequired(uint8_t closed) {
+    DRT_ACTION_s action;
+
+    DRT_Evaluate(&action);
+
+    if (action.disconnect == DRT_DISCONNECT_IMMEDIATE) {
+        return TRUE;
+    }
+    if (action.disconnect == DRT_DISCONNECT_RAMP_DOWN) {
+        return ((closed == FALSE) || (drt_state.ramp_down_finished == TRUE));
+    }
+    return FALSE;
+}
+
+
+void DRT_GetState(DRT_STATE_s *state) {
+    OS_TaskEnter_Critical();
+    *state = drt_state;
+    OS_TaskExit_Critical();
+}
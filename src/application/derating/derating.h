@@ -0,0 +1,102 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    derating.h
+ * @author  foxBMS Team
+ * @date    18.10.2026 (date of creation)
+ * @ingroup APPLICATION
+ * @prefix  DRT
+ *
+ * @brief   Derating manager
+ *
+ * Maps the active error flags and the levels of the BMS limit monitors to
+ * derating actions (see drt_rules[]). The current limits of the SOF are
+ * scaled with rate-limited factors, a ramp-down is requested over CAN before
+ * the contactors are opened, and only actions with an immediate
+ * disconnection open the contactors right away.
+ */
+
+#ifndef DERATING_H_
+#define DERATING_H_
+
+/*================== Includes =============================================*/
+#include "derating_cfg.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/**
+ * state of the derating manager
+ */
+typedef struct {
+    uint16_t charge_permille;           /*!< applied factor of the charge current limits in 0.1%                */
+    uint16_t discharge_permille;        /*!< applied factor of the discharge current limits in 0.1%             */
+    uint8_t target_charge_perc;         /*!< factor of the charge current limits the ramp moves to in %         */
+    uint8_t target_discharge_perc;      /*!< factor of the discharge current limits the ramp moves to in %      */
+    DRT_DISCONNECT_e disconnect;        /*!< most severe requested disconnection                                */
+    uint32_t ramp_down_ms;              /*!< time since the ramp-down was requested in ms                       */
+    uint8_t ramp_down_finished;         /*!< TRUE if the contactors may be opened after a ramp-down             */
+} DRT_STATE_s;
+
+/*================== Constant and Variable Definitions ====================*/
+
+/*================== Function Prototypes ==================================*/
+
+/**
+ * @brief   evaluates the rules and moves the factors of the current limits
+ *
+ * @details Must be called every DRT_CYCLE_TIME_MS, before SOF_Ctrl().
+ */
+extern void DRT_Trigger(void);
+
+/**
+ * @brief   gets the factors the SOF current limits are scaled with
+ *
+ * @param   charge      pointer where the factor of the charge limits (0.0 to 1.0) is stored
+ * @param   discharge   pointer where the factor of the discharge limits (0.0 to 1.0) is stored
+ */
+extern void DRT_GetFactors(float *charge, float *discharge);
+
+/**
+ * @brief   checks if the contactors have to be opened
+ *
+ * @details Evaluates the rules on every call, so immediate disconnections are
+ *          not delayed by the cycle time of DRT_Trigger(). A ramp-down opens
+ *          the contactors once it is finished, or right away if the
+ *          contactors are not closed yet.
+ *
+ * @param   closed  TRUE if the battery is connected and may ramp down under load
+ *
+ * @return  TRUE if the contactors have to be opened
+ */
+extern uint8_t DRT_IsDisconnectRequired(uint8_t closed);
+
+/**
+ * @brief   returns the state of the derating manager
+ *
+ * @param   state   pointer where the state is stored
+ */
+extern void DRT_GetState(DRT_STATE_s *state);
+
+/*================== Function Implementations =============================*/
+
+#endif /* DERATING_H_ */
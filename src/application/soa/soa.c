@@ -0,0 +1,263 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    soa.c
+ * @author  foxBMS Team
+ * @date    18.10.2026 (date of creation)
+ * @ingroup APPLICATION
+ * @prefix  SOA
+ *
+ * @brief   Per-cell safe operating area checks
+ *
+ * On cores with the DSP extension, two int16_t values are processed per
+ * instruction: SSUB16 sets the GE flags per halfword for the comparisons and
+ * SEL picks the halfwords for minimum, maximum and their indices. SMLAD sums
+ * both halfwords. 432 cells take about 220 loop iterations, i.e., a few
+ * microseconds at 180MHz.
+ */
+
+/*================== Includes =============================================*/
+#include "general.h"
+#include "soa.h"
+
+#include <string.h>
+
+#if (SOA_USE_SIMD == TRUE) && defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#include "mcu_cfg.h"
+#define SOA_SIMD_AVAILABLE
+#endif
+
+/*================== Macros and Definitions ===============================*/
+
+/*================== Constant and Variable Definitions ====================*/
+static int16_t soa_voltage_lower[BS_NR_OF_BAT_CELLS];
+static int16_t soa_voltage_upper[BS_NR_OF_BAT_CELLS];
+
+static int16_t soa_temperature_lower_charge[BS_NR_OF_TEMP_SENSORS];
+static int16_t soa_temperature_upper_charge[BS_NR_OF_TEMP_SENSORS];
+static int16_t soa_temperature_lower_discharge[BS_NR_OF_TEMP_SENSORS];
+static int16_t soa_temperature_upper_discharge[BS_NR_OF_TEMP_SENSORS];
+
+/*================== Function Prototypes ==================================*/
+static uint16_t SOA_CountBits(const uint32_t *mask);
+
+/*================== Function Implementations =============================*/
+
+void SOA_Init(void) {
+    for (uint16_t i = 0; i < BS_NR_OF_BAT_CELLS; i++) {
+        soa_voltage_lower[i] = SOA_DEFAULT_VOLTMIN_MV;
+        soa_voltage_upper[i] = SOA_DEFAULT_VOLTMAX_MV;
+    }
+    for (uint16_t i = 0; i < BS_NR_OF_TEMP_SENSORS; i++) {
+        soa_temperature_lower_charge[i] = BC_TEMPMIN_CHARGE;
+        soa_temperature_upper_charge[i] = BC_TEMPMAX_CHARGE;
+        soa_temperature_lower_discharge[i] = BC_TEMPMIN_DISCHARGE;
+        soa_temperature_upper_discharge[i] = BC_TEMPMAX_DISCHARGE;
+    }
+}
+
+
+#ifdef SOA_SIMD_AVAILABLE
+
+void SOA_CheckLimits(const int16_t *values, const int16_t *lower, const int16_t *upper, uint16_t length, SOA_RESULT_s *result) {
+    uint32_t value, limit, ge;
+    uint32_t min = 0x7FFF7FFF;          // both halfwords INT16_MAX
+    uint32_t max = 0x80008000;          // both halfwords INT16_MIN
+    uint32_t min_index = 0x00010000;    // halfword index 1 | index 0
+    uint32_t max_index = 0x00010000;
+    uint32_t index = 0x00010000;
+    int32_t sum = 0;
+    uint16_t i = 0;
+    int16_t min_lo, min_hi, max_lo, max_hi;
+
+    memset(result->above, 0, sizeof(result->above));
+    memset(result->below, 0, sizeof(result->below));
+
+    for (i = 0; (i + 1) < length; i += 2) {
+        // unaligned 32bit loads are allowed on Cortex-M4/M7
+        memcpy(&value, &values[i], sizeof(value));
+
+        // GE set per halfword if upper >= value
+        memcpy(&limit, &upper[i], sizeof(limit));
+        (void)__SSUB16(limit, value);
+        ge = ~__SEL(0xFFFFFFFF, 0);
+        result->above[i >> 5] |= ((ge & 1u) | ((ge >> 15) & 2u)) << (i & 31);
+
+        // GE set per halfword if value >= lower
+        memcpy(&limit, &lower[i], sizeof(limit));
+        (void)__SSUB16(value, limit);
+        ge = ~__SEL(0xFFFFFFFF, 0);
+        result->below[i >> 5] |= ((ge & 1u) | ((ge >> 15) & 2u)) << (i & 31);
+
+        // keep the old minimum on ties, so the index of the first minimum is kept
+        (void)__SSUB16(value, min);
+        min = __SEL(min, value);
+        min_index = __SEL(min_index, index);
+
+        (void)__SSUB16(max, value);
+        max = __SEL(max, value);
+        max_index = __SEL(max_index, index);
+
+        sum = __SMLAD(value, 0x00010001, sum);
+        index = __SADD16(index, 0x00020002);
+    }
+
+    // reduce both halfwords
+    min_lo = (int16_t)(min & 0xFFFF);
+    min_hi = (int16_t)(min >> 16);
+    max_lo = (int16_t)(max & 0xFFFF);
+    max_hi = (int16_t)(max >> 16);
+    result->min = min_lo;
+    result->min_index = (uint16_t)(min_index & 0xFFFF);
+    if ((min_hi < min_lo) || ((min_hi == min_lo) && ((min_index >> 16) < result->min_index))) {
+        result->min = min_hi;
+        result->min_index = (uint16_t)(min_index >> 16);
+    }
+    result->max = max_lo;
+    result->max_index = (uint16_t)(max_index & 0xFFFF);
+    if ((max_hi > max_lo) || ((max_hi == max_lo) && ((max_index >> 16) < result->max_index))) {
+        result->max = max_hi;
+        result->max_index = (uint16_t)(max_index >> 16);
+    }
+
+    // odd number of values
+    if (i < length) {
+        if (values[i] > upper[i]) {
+            result->above[i >> 5] |= 1u << (i & 31);
+        }
+        if (values[i] < lower[i]) {
+            result->below[i >> 5] |= 1u << (i & 31);
+        }
+        if ((length == 1) || (values[i] < result->min)) {
+            result->min = values[i];
+            result->min_index = i;
+        }
+        if ((length == 1) || (values[i] > result->max)) {
+            result->max = values[i];
+            result->max_index = i;
+        }
+        sum += values[i];
+    }
+
+    result->nr_above = SOA_CountBits(result->above);
+    result->nr_below = SOA_CountBits(result->below);
+    result->mean = (length > 0) ? (int16_t)(sum / length) : 0;
+}
+
+#else
+
+void SOA_CheckLimits(const int16_t *values, const int16_t *lower, const int16_t *upper, uint16_t length, SOA_RESULT_s *result) {
+    int32_t sum = 0;
+
+    memset(result->above, 0, sizeof(result->above));
+    memset(result->below, 0, sizeof(result->below));
+    result->min = INT16_MAX;
+    result->max = INT16_MIN;
+    result->min_index = 0;
+    result->max_index = 0;
+
+    for (uint16_t i = 0; i < length; i++) {
+        if (values[i] > upper[i]) {
+            result->above[i >> 5] |= 1u << (i & 31);
+        }
+        if (values[i] < lower[i]) {
+            result->below[i >> 5] |= 1u << (i & 31);
+        }
+        if ((i == 0) || (values[i] < result->min)) {
+            result->min = values[i];
+            result->min_index = i;
+        }
+        if ((i == 0) || (values[i] > result->max)) {
+            result->max = values[i];
+            result->max_index = i;
+        }
+        sum += values[i];
+    }
+
+    result->nr_above = SOA_CountBits(result->above);
+    result->nr_below = SOA_CountBits(result->below);
+    result->mean = (length > 0) ? (int16_t)(sum / length) : 0;
+}
+
+#endif
+
+
+void SOA_CheckCellVoltages(const DATA_BLOCK_CELLVOLTAGE_s *cellvoltage, SOA_RESULT_s *result) {
+    SOA_CheckLimits((const int16_t *)cellvoltage->voltage, soa_voltage_lower, soa_voltage_upper, BS_NR_OF_BAT_CELLS, result);
+}
+
+
+void SOA_CheckCellTemperatures(const DATA_BLOCK_CELLTEMPERATURE_s *celltemperature, BS_CURRENT_DIRECTION_e direction, SOA_RESULT_s *result) {
+    if (direction == BS_CURRENT_CHARGE) {
+        SOA_CheckLimits(celltemperature->temperature, soa_temperature_lower_charge, soa_temperature_upper_charge, BS_NR_OF_TEMP_SENSORS, result);
+    } else {
+        SOA_CheckLimits(celltemperature->temperature, soa_temperature_lower_discharge, soa_temperature_upper_discharge, BS_NR_OF_TEMP_SENSORS, result);
+    }
+}
+
+
+STD_RETURN_TYPE_e SOA_SetCellVoltageLimits(uint16_t cell, int16_t lower, int16_t upper) {
+    if (cell >= BS_NR_OF_BAT_CELLS) {
+        return E_NOT_OK;
+    }
+    soa_voltage_lower[cell] = lower;
+    soa_voltage_upper[cell] = upper;
+    return E_OK;
+}
+
+
+STD_RETURN_TYPE_e SOA_SetTemperatureLimits(uint16_t sensor, BS_CURRENT_DIRECTION_e direction, int16_t lower, int16_t upper) {
+    if (sensor >= BS_NR_OF_TEMP_SENSORS) {
+        return E_NOT_OK;
+    }
+    if (direction == BS_CURRENT_CHARGE) {
+        soa_temperature_lower_charge[sensor] = lower;
+        soa_temperature_upper_charge[sensor] = upper;
+    } else {
+        soa_temperature_lower_discharge[sensor] = lower;
+        soa_temperature_upper_discharge[sensor] = upper;
+    }
+    return E_OK;
+}
+
+
+/**
+ * @brief   counts the set bits of a violation bitmask
+ *
+ * @param   mask    bitmask of SOA_MASK_WORDS words
+ *
+ * @return  number of set bits
+ */
+static uint16_t SOA_CountBits(const uint32_t *mask) {
+    uint16_t count = 0;
+    uint32_t word;
+
+    for (uint8_t i = 0; i < SOA_MASK_WORDS; i++) {
+        word = mask[i];
+        while (word != 0) {
+            word &= word - 1;   // clear lowest set bit
+            count++;
+        }
+    }
+    return count;
+}
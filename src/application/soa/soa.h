@@ -0,0 +1,129 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    soa.h
+ * @author  foxBMS Team
+ * @date    18.10.2026 (date of creation)
+ * @ingroup APPLICATION
+ * @prefix  SOA
+ *
+ * @brief   Per-cell safe operating area checks
+ *
+ * Checks every cell voltage and every temperature sensor against its own
+ * lower and upper limit. One pass over the measurement values yields the
+ * violation bitmasks together with minimum, maximum and mean.
+ */
+
+#ifndef SOA_H_
+#define SOA_H_
+
+/*================== Includes =============================================*/
+#include "soa_cfg.h"
+#include "database.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/**
+ * result of a limit check
+ */
+typedef struct {
+    uint32_t above[SOA_MASK_WORDS];     /*!< bit i set: value i above its upper limit   */
+    uint32_t below[SOA_MASK_WORDS];     /*!< bit i set: value i below its lower limit   */
+    uint16_t nr_above;                  /*!< number of values above their upper limit   */
+    uint16_t nr_below;                  /*!< number of values below their lower limit   */
+    int16_t min;                        /*!< minimum value                              */
+    int16_t max;                        /*!< maximum value                              */
+    int16_t mean;                       /*!< arithmetic mean of all values              */
+    uint16_t min_index;                 /*!< index of the first minimum                 */
+    uint16_t max_index;                 /*!< index of the first maximum                 */
+} SOA_RESULT_s;
+
+/*================== Constant and Variable Definitions ====================*/
+
+/*================== Function Prototypes ==================================*/
+
+/**
+ * @brief   sets all per-cell limits to their default values
+ */
+extern void SOA_Init(void);
+
+/**
+ * @brief   limit check kernel
+ *
+ * @details Checks values[i] against lower[i] and upper[i] for all i < length and
+ *          computes minimum, maximum and mean in the same pass.
+ *
+ * @param   values  values to check
+ * @param   lower   lower limit of each value
+ * @param   upper   upper limit of each value
+ * @param   length  number of values, at most SOA_MAX_CHANNELS
+ * @param   result  pointer where the result is stored
+ */
+extern void SOA_CheckLimits(const int16_t *values, const int16_t *lower, const int16_t *upper, uint16_t length, SOA_RESULT_s *result);
+
+/**
+ * @brief   checks all cell voltages against their per-cell limits
+ *
+ * @details Cell voltages are handled as int16_t, values from 32768mV upwards
+ *          (e.g., invalid markers) are therefore reported below the lower limit.
+ *
+ * @param   cellvoltage pointer to the cell voltages
+ * @param   result      pointer where the result is stored
+ */
+extern void SOA_CheckCellVoltages(const DATA_BLOCK_CELLVOLTAGE_s *cellvoltage, SOA_RESULT_s *result);
+
+/**
+ * @brief   checks all cell temperatures against their per-sensor limits
+ *
+ * @param   celltemperature pointer to the cell temperatures
+ * @param   direction       current direction, selects the charge or discharge limits
+ * @param   result          pointer where the result is stored
+ */
+extern void SOA_CheckCellTemperatures(const DATA_BLOCK_CELLTEMPERATURE_s *celltemperature, BS_CURRENT_DIRECTION_e direction, SOA_RESULT_s *result);
+
+/**
+ * @brief   sets the voltage limits of one cell, e.g., for cell-specific derating
+ *
+ * @param   cell    index of the cell
+ * @param   lower   lower limit in mV
+ * @param   upper   upper limit in mV
+ *
+ * @return  E_OK if the cell index is valid, E_NOT_OK otherwise
+ */
+extern STD_RETURN_TYPE_e SOA_SetCellVoltageLimits(uint16_t cell, int16_t lower, int16_t upper);
+
+/**
+ * @brief   sets the temperature limits of one sensor for one current direction
+ *
+ * @param   sensor      index of the temperature sensor
+ * @param   direction   current direction the limits apply to
+ * @param   lower       lower limit in degree Celsius
+ * @param   upper       upper limit in degree Celsius
+ *
+ * @return  E_OK if the sensor index is valid, E_NOT_OK otherwise
+ */
+extern STD_RETURN_TYPE_e SOA_SetTemperatureLimits(uint16_t sensor, BS_CURRENT_DIRECTION_e direction, int16_t lower, int16_t upper);
+
+/*================== Function Implementations =============================*/
+
+#endif /* SOA_H_ */
@@ -0,0 +1,374 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    soh.c
+ * @author  foxBMS Team
+ * @date    18.10.2026 (date of creation)
+ * @ingroup APPLICATION
+ * @prefix  SOH
+ *
+ * @brief   Online estimation of the internal resistance and the capacity of the cells
+ *
+ */
+
+/*================== Includes =============================================*/
+/* recommended include order of header files:
+ *
+ * 1.    include general.h
+ * 2.    include module's own header
+ * 3...  other headers
+ *
+ */
+#include "general.h"
+#include "soh.h"
+
+#include "bkpsram_cfg.h"
+#include "database.h"
+#include "mcu.h"
+#include "sox.h"
+#include "sox_cc.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/**
+ * drop of the SOH per mOhm of resistance growth
+ */
+#define SOH_RESISTANCE_SLOPE    ((100.0f - SOH_EOL_PERC) / (SOH_RESISTANCE_BOL * (SOH_RESISTANCE_EOL_FACTOR - 1.0f)))
+
+/*================== Constant and Variable Definitions ====================*/
+static DATA_BLOCK_CURRENT_s soh_current_tab;
+static DATA_BLOCK_CELLVOLTAGE_s soh_cellvoltage;
+static DATA_BLOCK_MINMAX_s soh_minmax;
+static DATA_BLOCK_SOH_s soh;
+static SOH_NVM_s soh_nvm;
+static SOH_NVM_CELLS_s soh_nvm_cells;
+
+/**
+ * cell voltages and current (mA, positive when discharging) of the last cell voltage measurement
+ */
+static uint16_t soh_previous_voltage[BS_NR_OF_BAT_CELLS];
+static float soh_previous_current = 0.0;
+static uint32_t soh_previous_voltage_timestamp = 0;
+static uint32_t soh_previous_current_timestamp = 0;
+
+/**
+ * covariance of the resistance estimation, shared by all cells
+ */
+static float soh_rls_p = SOH_RLS_P0;
+
+/**
+ * SOC of each cell and net charge of the coulomb counter in uAs (positive when discharging) at the
+ * last rest point
+ */
+static float soh_rest_soc[BS_NR_OF_BAT_CELLS];
+static uint8_t soh_rest_soc_valid = FALSE;
+static int64_t soh_rest_charge = 0;
+static uint32_t soh_rest_timestamp = 0;
+static uint8_t soh_rest_reached = FALSE;
+
+/*================== Function Prototypes ==================================*/
+static void SOH_ResistanceUpdate(float current);
+static void SOH_RestPoint(void);
+static void SOH_Publish(void);
+
+/*================== Function Implementations =============================*/
+
+void SOH_Init(void) {
+    uint16_t i = 0;
+
+    if (NVM_Get_soh(&soh_nvm) != E_OK) {
+        soh_nvm = default_soh.data;
+        NVM_Set_soh(&soh_nvm);
+    }
+    if (NVM_Get_soh_cells(&soh_nvm_cells) != E_OK) {
+        soh_nvm_cells = default_soh_cells.data;
+    }
+
+    for (i = 0; i < BS_NR_OF_BAT_CELLS; i++) {
+        if (SOH_NVM_NR_OF_CELLS == BS_NR_OF_BAT_CELLS && soh_nvm_cells.nr_of_cells == BS_NR_OF_BAT_CELLS) {
+            soh.resistance[i] = soh_nvm_cells.resistance[i];
+            soh.capacity[i] = soh_nvm_cells.capacity[i];
+        } else {
+            // without the cell values, the weakest stored values keep SOP and balancing on the safe side
+            soh.resistance[i] = soh_nvm.resistance_max;
+            soh.capacity[i] = soh_nvm.capacity_min;
+        }
+#if SOX_SOC_PER_CELL == TRUE
+        SOC_SetCellCapacity(i, soh.capacity[i]);
+#endif
+    }
+    soh.resistance_updates = 0;
+    soh.capacity_updates = soh_nvm.capacity_updates;
+    soh.state = 0;
+    soh.timestamp = 0;
+    soh.previous_timestamp = 0;
+    soh_rls_p = SOH_RLS_P0;
+
+    DB_ReadBlock(&soh_current_tab, DATA_BLOCK_ID_CURRENT);
+    DB_ReadBlock(&soh_cellvoltage, DATA_BLOCK_ID_CELLVOLTAGE);
+    for (i = 0; i < BS_NR_OF_BAT_CELLS; i++) {
+        soh_previous_voltage[i] = soh_cellvoltage.voltage[i];
+    }
+    if (POSITIVE_DISCHARGE_CURRENT == TRUE) {
+        soh_previous_current = soh_current_tab.current;
+    } else {
+        soh_previous_current = -soh_current_tab.current;
+    }
+    soh_previous_voltage_timestamp = soh_cellvoltage.timestamp;
+    soh_previous_current_timestamp = soh_current_tab.timestamp;
+
+    // the time the battery rested before startup is unknown, so the first rest point is taken
+    // after a full rest period
+    soh_rest_soc_valid = FALSE;
+    soh_rest_charge = 0;
+    soh_rest_timestamp = MCU_GetTimeStamp();
+    soh_rest_reached = FALSE;
+
+    SOH_Publish();
+}
+
+
+void SOH_Ctrl(void) {
+    uint32_t timestamp = MCU_GetTimeStamp();
+    float current = 0.0;
+
+    DB_ReadBlock(&soh_current_tab, DATA_BLOCK_ID_CURRENT);
+    if (POSITIVE_DISCHARGE_CURRENT == TRUE) {
+        current = soh_current_tab.current;
+    } else {
+        current = -soh_current_tab.current;
+    }
+
+    if (soh_previous_current_timestamp != soh_current_tab.timestamp) { // check if current measurement has been updated
+        soh_previous_current_timestamp = soh_current_tab.timestamp;
+
+        if (current >= SOX_SOC_INIT_CURRENT_LIMIT || current <= -SOX_SOC_INIT_CURRENT_LIMIT) {
+            soh_rest_timestamp = timestamp;
+            soh_rest_reached = FALSE;
+        }
+    }
+
+    DB_ReadBlock(&soh_cellvoltage, DATA_BLOCK_ID_CELLVOLTAGE);
+    if (soh_previous_voltage_timestamp != soh_cellvoltage.timestamp) { // check if voltage measurement has been updated
+        SOH_ResistanceUpdate(current);
+    }
+
+    if (soh_rest_reached == FALSE && (timestamp - soh_rest_timestamp) >= SOX_SOC_REST_TIME_MS) {
+        SOH_RestPoint();
+        soh_rest_reached = TRUE;
+    }
+}
+
+
+/**
+ * @brief   updates the internal resistance of the cells with a new cell voltage measurement
+ *
+ * Between two measurements taken within SOH_RESISTANCE_MAX_STEP_TIME_MS, the change of the open
+ * circuit voltage and of the polarization is neglected, so the voltage drop of each cell over the
+ * current step is its internal resistance times the step. The resistance is fitted with a
+ * recursive least squares estimation with the forgetting factor SOH_RLS_FORGETTING. As the
+ * regressor is the same for all cells, the gain is calculated once.
+ *
+ * @param   current     current at the new measurement in mA, positive when discharging
+ *
+ * @return  void
+ */
+static void SOH_ResistanceUpdate(float current) {
+    uint32_t timestep = soh_cellvoltage.timestamp - soh_previous_voltage_timestamp;
+    float step = current - soh_previous_current;
+    float x = 0.0;
+    float k = 0.0;
+    uint16_t i = 0;
+
+    DB_ReadBlock(&soh_minmax, DATA_BLOCK_ID_MINMAX);
+
+    if ((step >= SOH_RESISTANCE_MIN_STEP_MA || step <= -SOH_RESISTANCE_MIN_STEP_MA) &&
+            timestep <= SOH_RESISTANCE_MAX_STEP_TIME_MS &&
+            soh_minmax.temperature_mean >= SOH_RESISTANCE_TEMPERATURE_MIN &&
+            soh_minmax.temperature_mean <= SOH_RESISTANCE_TEMPERATURE_MAX) {
+        // regressor in A and voltage drop in mV give the resistance in mOhm
+        x = 0.001 * step;
+        k = soh_rls_p * x / (SOH_RLS_FORGETTING + x * soh_rls_p * x);
+        for (i = 0; i < BS_NR_OF_BAT_CELLS; i++) {
+            soh.resistance[i] += k * (((float)soh_previous_voltage[i] - (float)soh_cellvoltage.voltage[i]) - x * soh.resistance[i]);
+        }
+        soh_rls_p = (soh_rls_p - k * x * soh_rls_p) / SOH_RLS_FORGETTING;
+        if (soh_rls_p > SOH_RLS_P0) {
+            soh_rls_p = SOH_RLS_P0;
+        }
+        soh.resistance_updates++;
+        SOH_Publish();
+    }
+
+    for (i = 0; i < BS_NR_OF_BAT_CELLS; i++) {
+        soh_previous_voltage[i] = soh_cellvoltage.voltage[i];
+    }
+    soh_previous_current = current;
+    soh_previous_voltage_timestamp = soh_cellvoltage.timestamp;
+}
+
+
+/**
+ * @brief   estimates the capacity of the cells at the end of a rest period
+ *
+ * The SOC of each cell is looked up from its open circuit voltage. If the mean SOC changed by at
+ * least SOH_CAPACITY_MIN_DELTA_SOC since the last rest point, the capacity of each cell is the
+ * charge since then divided by its change of the SOC. Plausible estimations are filtered into
+ * the cell capacity with SOH_CAPACITY_GAIN and passed to the SOC of each cell.
+ *
+ * @return  void
+ */
+static void SOH_RestPoint(void) {
+    SOX_CC_s cc;
+    int16_t temperature = 0;
+    float charge = 0.0;
+    float deltasoc_mean = 0.0;
+    float deltasoc = 0.0;
+    float capacity = 0.0;
+    float soc = 0.0;
+    uint16_t i = 0;
+
+    DB_ReadBlock(&soh_minmax, DATA_BLOCK_ID_MINMAX);
+    temperature = (int16_t)soh_minmax.temperature_mean;
+    // charge since the last rest point in mAh
+    SOC_CcGetCounters(&cc);
+    charge = (float)(cc.charge - soh_rest_charge) * (float)(1.0 / 3600000.0);
+
+    if (soh_rest_soc_valid == TRUE) {
+        for (i = 0; i < BS_NR_OF_BAT_CELLS; i++) {
+            deltasoc_mean += soh_rest_soc[i] - SOC_GetFromVoltage(soh_cellvoltage.voltage[i], temperature);
+        }
+        deltasoc_mean *= 1.0 / BS_NR_OF_BAT_CELLS;
+    }
+
+    // a discharge has to lower the SOC and a charge has to raise it
+    if ((deltasoc_mean >= SOH_CAPACITY_MIN_DELTA_SOC && charge > 0.0) ||
+            (deltasoc_mean <= -SOH_CAPACITY_MIN_DELTA_SOC && charge < 0.0)) {
+        for (i = 0; i < BS_NR_OF_BAT_CELLS; i++) {
+            soc = SOC_GetFromVoltage(soh_cellvoltage.voltage[i], temperature);
+            deltasoc = soh_rest_soc[i] - soc;
+            soh_rest_soc[i] = soc;
+            if (deltasoc * deltasoc_mean > 0.0) {
+                capacity = 100.0 * charge / deltasoc;
+                if (capacity >= SOH_CAPACITY_PLAUSIBLE_MIN * SOX_CELL_CAPACITY &&
+                        capacity <= SOH_CAPACITY_PLAUSIBLE_MAX * SOX_CELL_CAPACITY) {
+                    soh.capacity[i] += SOH_CAPACITY_GAIN * (capacity - soh.capacity[i]);
+#if SOX_SOC_PER_CELL == TRUE
+                    SOC_SetCellCapacity(i, soh.capacity[i]);
+#endif
+                }
+            }
+        }
+        soh.capacity_updates++;
+        SOH_Publish();
+    } else {
+        for (i = 0; i < BS_NR_OF_BAT_CELLS; i++) {
+            soh_rest_soc[i] = SOC_GetFromVoltage(soh_cellvoltage.voltage[i], temperature);
+        }
+    }
+
+    soh_rest_charge = cc.charge;
+    soh_rest_soc_valid = TRUE;
+}
+
+
+/**
+ * @brief   calculates the SOH of the cells and writes the results to the database and the NVM
+ *
+ * The SOH of a cell is the lower of its capacity in % of SOX_CELL_CAPACITY and its resistance
+ * mapped linearly from SOH_RESISTANCE_BOL (100%) to SOH_RESISTANCE_EOL_FACTOR times
+ * SOH_RESISTANCE_BOL (SOH_EOL_PERC).
+ *
+ * @return  void
+ */
+static void SOH_Publish(void) {
+    float soh_capacity = 0.0;
+    float soh_resistance = 0.0;
+    float value = 0.0;
+    float resistance_min = 0.0;
+    float capacity_max = 0.0;
+    float soh_sum = 0.0;
+    float resistance_sum = 0.0;
+    float capacity_sum = 0.0;
+    uint16_t i = 0;
+
+    soh.soh_min = 100.0;
+    soh.soh_max = 0.0;
+    soh.resistance_max = 0.0;
+    soh.capacity_min = soh.capacity[0];
+    resistance_min = soh.resistance[0];
+    capacity_max = soh.capacity[0];
+
+    for (i = 0; i < BS_NR_OF_BAT_CELLS; i++) {
+        if (soh.resistance[i] < 0.0) {
+            soh.resistance[i] = 0.0;
+        }
+        soh_capacity = (100.0 / SOX_CELL_CAPACITY) * soh.capacity[i];
+        soh_resistance = 100.0 - SOH_RESISTANCE_SLOPE * (soh.resistance[i] - SOH_RESISTANCE_BOL);
+        value = (soh_capacity < soh_resistance) ? soh_capacity : soh_resistance;
+        if (value > 100.0) { value = 100.0; }
+        if (value < 0.0)   { value = 0.0;   }
+
+        if (value <= soh.soh_min) {
+            soh.soh_min = value;
+            soh.cell_number_min = i;
+        }
+        if (value >= soh.soh_max) {
+            soh.soh_max = value;
+            soh.cell_number_max = i;
+        }
+        if (soh.resistance[i] > soh.resistance_max) { soh.resistance_max = soh.resistance[i]; }
+        if (soh.resistance[i] < resistance_min)     { resistance_min = soh.resistance[i];     }
+        if (soh.capacity[i] < soh.capacity_min)     { soh.capacity_min = soh.capacity[i];     }
+        if (soh.capacity[i] > capacity_max)         { capacity_max = soh.capacity[i];         }
+        soh_sum += value;
+        resistance_sum += soh.resistance[i];
+        capacity_sum += soh.capacity[i];
+    }
+    soh.soh_mean = soh_sum * (1.0 / BS_NR_OF_BAT_CELLS);
+    soh.resistance_mean = resistance_sum * (1.0 / BS_NR_OF_BAT_CELLS);
+    soh.capacity_mean = capacity_sum * (1.0 / BS_NR_OF_BAT_CELLS);
+
+    soh.state++;
+    soh.previous_timestamp = soh.timestamp;
+    soh.timestamp = MCU_GetTimeStamp();
+    DB_WriteBlock(&soh, DATA_BLOCK_ID_SOH);
+
+    /* the EEPROM is only written on a capacity estimation or a relevant resistance change, see NVM_POLICY_SOH */
+    soh_nvm.capacity_mean = soh.capacity_mean;
+    soh_nvm.capacity_min = soh.capacity_min;
+    soh_nvm.capacity_max = capacity_max;
+    soh_nvm.resistance_mean = soh.resistance_mean;
+    soh_nvm.resistance_min = resistance_min;
+    soh_nvm.resistance_max = soh.resistance_max;
+    soh_nvm.capacity_updates = soh.capacity_updates;
+#if SOH_NVM_NR_OF_CELLS == BS_NR_OF_BAT_CELLS
+    for (i = 0; i < BS_NR_OF_BAT_CELLS; i++) {
+        soh_nvm_cells.resistance[i] = soh.resistance[i];
+        soh_nvm_cells.capacity[i] = soh.capacity[i];
+    }
+    soh_nvm_cells.nr_of_cells = BS_NR_OF_BAT_CELLS;
+    NVM_Set_soh_cells(&soh_nvm_cells);
+#endif
+    NVM_Set_soh(&soh_nvm);
+}
@@ -0,0 +1,119 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    soh.h
+ * @author  foxBMS Team
+ * @date    18.10.2026 (date of creation)
+ * @ingroup APPLICATION
+ * @prefix  SOH
+ *
+ * @brief   Online estimation of the internal resistance and the capacity of the cells
+ *
+ * The internal resistance of each cell is estimated with a recursive least
+ * squares fit of the voltage change over the current change between two cell
+ * voltage measurements. All cells see the same current step, so the gain and
+ * the covariance of the estimation are shared and only the resistance is
+ * stored per cell. The capacity of each cell is the charge integrated between
+ * two rest points divided by the change of the SOC looked up from the open
+ * circuit voltages at these points. The capacities are passed to the SOC of
+ * each cell, the pack values are kept in the backup SRAM and the EEPROM.
+ */
+
+#ifndef SOH_H_
+#define SOH_H_
+
+/*================== Includes =============================================*/
+#include "soh_cfg.h"
+#include "batterysystem_cfg.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/**
+ * state of health data stored in the non-volatile memory
+ */
+typedef struct {
+    float capacity_mean;        /*!< mean capacity in mAh                               */
+    float capacity_min;         /*!< lowest capacity in mAh                             */
+    float capacity_max;         /*!< highest capacity in mAh                            */
+    float resistance_mean;      /*!< mean internal resistance in mOhm                   */
+    float resistance_min;       /*!< lowest internal resistance in mOhm                 */
+    float resistance_max;       /*!< highest internal resistance in mOhm                */
+    uint16_t capacity_updates;  /*!< number of capacity estimations since first use     */
+    uint16_t reserved;          /*!< reserved for future use                            */
+} SOH_NVM_s;
+
+/**
+ * maximum number of cells of the stored cell values, limited by the size of the EEPROM channel
+ * EEPR_CH_SOH_CELLS: (0x100 bytes - number of cells - checksum) / 8 bytes
+ */
+#define SOH_NVM_MAX_CELLS       31
+
+#if BS_NR_OF_BAT_CELLS <= SOH_NVM_MAX_CELLS
+#define SOH_NVM_NR_OF_CELLS     BS_NR_OF_BAT_CELLS
+#else
+/* the channel stays in the EEPROM layout without cells, the cells start with the pack values */
+#define SOH_NVM_NR_OF_CELLS     1
+#endif
+
+/**
+ * resistance and capacity of each cell stored in the non-volatile memory
+ */
+typedef struct {
+    float resistance[SOH_NVM_NR_OF_CELLS];  /*!< internal resistance of each cell in mOhm                */
+    float capacity[SOH_NVM_NR_OF_CELLS];    /*!< capacity of each cell in mAh                            */
+    uint16_t nr_of_cells;                   /*!< number of stored cells, 0 if no cells were stored yet   */
+    uint16_t reserved;                      /*!< reserved for future use                                 */
+} SOH_NVM_CELLS_s;
+
+/*================== Constant and Variable Definitions ====================*/
+
+/*================== Function Prototypes ==================================*/
+
+/**
+ * @brief   initializes the estimation with the values stored in the non-volatile memory
+ *
+ * @details Each cell starts with its stored resistance and capacity. If the
+ *          cells were not stored, e.g. for more than SOH_NVM_MAX_CELLS cells,
+ *          all cells start with the highest stored resistance and the lowest
+ *          stored capacity. The capacities are passed to the SOC of each cell,
+ *          so SOC_Init() has to be called before.
+ *
+ * @return  void
+ */
+extern void SOH_Init(void);
+
+/**
+ * @brief   updates the internal resistance and the capacity of the cells
+ *
+ * @details Must be called cyclically, e.g., every 10ms after SOC_Ctrl(). The
+ *          resistances are updated with every new cell voltage measurement
+ *          after a current step, the capacities once at the end of each rest
+ *          period (see SOX_SOC_REST_TIME_MS).
+ *
+ * @return  void
+ */
+extern void SOH_Ctrl(void);
+
+/*================== Function Implementations =============================*/
+
+#endif /* SOH_H_ */
@@ -44,11 +44,60 @@
 #include "general.h"
 #include "sox.h"
 
+#include "bal_charge.h"
+#include "batterycell_cfg.h"
 #include "database.h"
+#include "derating.h"
 #include "eepr.h"
 #include "mcu.h"
+#include "mcu_cfg.h"
+#include "sox_cc.h"
+#include "sox_ekf.h"
+#include "soh_cfg.h"
+#include <float.h>
 
 /*================== Macros and Definitions ===============================*/
+/**
+ * 1.0 in the Q15 format of the interpolation weights of the current limit maps
+ */
+#define SOF_MAP_ONE     (1uL << 15)
+
+/**
+ * ramps of the fixed-point SOF
+ */
+typedef enum {
+    SOF_RAMP_VOLTAGE_DISCHA     = 0,    /*!< discharge current over the minimum cell voltage    */
+    SOF_RAMP_VOLTAGE_CHARGE     = 1,    /*!< charge current over the maximum cell voltage       */
+    SOF_RAMP_SOC_DISCHA         = 2,    /*!< discharge current over the minimum SOC             */
+    SOF_RAMP_SOC_CHARGE         = 3,    /*!< charge current over the maximum SOC                */
+    SOF_RAMP_TLOW_DISCHA        = 4,    /*!< discharge current over the minimum temperature     */
+    SOF_RAMP_TLOW_CHARGE        = 5,    /*!< charge current over the minimum temperature        */
+    SOF_RAMP_THIGH_DISCHA       = 6,    /*!< discharge current over the maximum temperature     */
+    SOF_RAMP_THIGH_CHARGE       = 7,    /*!< charge current over the maximum temperature        */
+    SOF_RAMP_NR_OF              = 8,    /*!< number of ramps                                    */
+} SOF_RAMP_e;
+
+/**
+ * ramp of the fixed-point SOF: the current is at_limit at and beyond the limit, rises linearly
+ * to max at the cutoff and stays at max beyond the cutoff. The input is in mV, 0.01% SOC or degC.
+ */
+typedef struct {
+    int32_t limit;          /*!< input where the current is at_limit                        */
+    int32_t cutoff;         /*!< input where the current reaches max                        */
+    int32_t at_limit;       /*!< current at the limit in mA                                 */
+    int32_t max;            /*!< current beyond the cutoff in mA                            */
+    int64_t slope;          /*!< slope from the limit to the cutoff in Q16 mA per input unit */
+} SOF_RAMP_s;
+
+/**
+ * fixed-point SOF currents in mA
+ */
+typedef struct {
+    int32_t charge_cont;    /*!< maximum current for continuous charging    */
+    int32_t charge_peak;    /*!< maximum current for peak charging          */
+    int32_t discha_cont;    /*!< maximum current for continuous discharging */
+    int32_t discha_peak;    /*!< maximum current for peak discharging       */
+} SOF_FIXED_s;
 
 /*================== Constant and Variable Definitions ====================*/
 static SOX_STATE_s sox_state = {
@@ -68,6 +117,46 @@ static SOX_SOF_s values_sof;
 static uint32_t soc_previous_current_timestamp = 0;
 static uint32_t soc_previous_current_timestamp_cc = 0;
 
+/**
+ * counters of the coulomb counter at the last SOC update
+ */
+static SOX_CC_s soc_cc_previous;
+
+/**
+ * SOC and net charge of the coulomb counter in uAs when the SOC was last set. The SOC is calculated
+ * from the charge since then, so the round-off of the float SOC does not accumulate.
+ */
+static SOX_SOC_s soc_cc_reference = {50.0, 50.0, 50.0};
+static int64_t soc_cc_reference_charge = 0;
+
+/**
+ * start of the current rest period in ms and whether the SOC has already been recalibrated in it
+ */
+static uint32_t soc_rest_timestamp = 0;
+static uint8_t soc_rest_recalibrated = FALSE;
+
+#if SOX_SOC_EKF == TRUE
+/** @{
+ * extended Kalman filters of the cells with the minimum, mean and maximum voltage
+ */
+static SOX_EKF_s soc_ekf_min;
+static SOX_EKF_s soc_ekf_mean;
+static SOX_EKF_s soc_ekf_max;
+/** @} */
+#endif
+
+#if SOX_SOC_PER_CELL == TRUE
+/** @{
+ * SOC offsets of the cells to soc_mean in % and reciprocals of the cell capacities in 1/mAh,
+ * stored as separate arrays for the update loop
+ */
+static float soc_cell_offset[BS_NR_OF_BAT_CELLS];
+static float soc_cell_inv_capacity[BS_NR_OF_BAT_CELLS];
+/** @} */
+static DATA_BLOCK_CELLSOC_s soc_cell;
+static SOX_CC_s soc_cell_cc_previous;
+#endif
+
 
 /** @{
  * module-local static Variables that are calculated at startup and used later to avoid divisions at runtime
@@ -93,13 +182,94 @@ static float Slope_VoltageCharge = 0.0;
 static float Offset_VoltageCharge = 0.0;
 /** @} */
 
+/** @{
+ * module-local reciprocals of the breakpoint distances of the current limit maps, in 2^31/distance,
+ * calculated at startup to avoid divisions at runtime
+ */
+static uint32_t sof_map_temperature_inv[SOX_SOF_MAP_MAX_POINTS];
+static uint32_t sof_map_soc_inv[SOX_SOF_MAP_MAX_POINTS];
+/** @} */
+
+/**
+ * ramps of the fixed-point SOF, calculated at startup from sox_sof_config
+ */
+static SOF_RAMP_s sof_ramp[SOF_RAMP_NR_OF];
+
+/**
+ * capacity and resistance of the cells, read from the SOH for the SOE and the SOP
+ */
+static DATA_BLOCK_SOH_s sox_soh;
+
+/**
+ * horizons of the SOP in s and the decay of the voltages over the two RC elements over them
+ */
+static const float sop_horizon[SOX_SOP_NR_OF_HORIZONS] = { SOX_SOP_HORIZON_SHORT_S, SOX_SOP_HORIZON_MEDIUM_S, SOX_SOP_HORIZON_LONG_S };
+static float sop_decay1[SOX_SOP_NR_OF_HORIZONS];
+static float sop_decay2[SOX_SOP_NR_OF_HORIZONS];
+
+/**
+ * energy per capacity (Wh/Ah) from 0% SOC up to each breakpoint of the open circuit voltage
+ * table, stored like the voltages of sox_ocv_table
+ */
+static float soe_ocv_energy[SOX_OCV_MAX_POINTS];
+static uint8_t soe_nr_temperature = 0;
+static uint32_t soe_timestamp = 0;
+static float soe_current = 0.0;
+
+/**
+ * SOC of a cell used for the SOE
+ */
+#if SOX_SOC_PER_CELL == TRUE
+#define SOE_CELL_SOC(cell)      (soc_cell.soc[(cell)])
+#else
+#define SOE_CELL_SOC(cell)      (sox.soc_mean)
+#endif
+
+#if SOX_SOF_BENCHMARK == TRUE
+static SOX_SOF_BENCHMARK_s sof_benchmark;
+#endif
+
+#if SOX_SOF_FIXED_POINT_CHECK == TRUE
+static SOX_SOF_FIXED_CHECK_s sof_fixed_check;
+#endif
+
+#if SOX_OCV_BENCHMARK == TRUE
+static SOX_OCV_BENCHMARK_s ocv_benchmark;
+#endif
+
 /*================== Function Prototypes ==================================*/
-static float SOC_GetFromVoltage(float voltage);
+static uint32_t SOC_OcvSearch(const uint16_t *row, uint16_t voltage);
+static float SOC_OcvLinearSearch(uint16_t voltage, int16_t temperature);
+static void SOC_CheckRest(void);
+static void SOC_CcSetReference(float soc_min, float soc_max, float soc_mean);
+#if SOX_SOC_EKF == TRUE
+static void SOC_EkfCtrl(void);
+static void SOC_EkfSetValue(float soc_value_min, float soc_value_max, float soc_value_mean);
+#endif
+#if SOX_SOC_PER_CELL == TRUE
+static void SOC_CellCalibrate(void);
+static void SOC_CellCtrl(void);
+#endif
+static void SOP_Calculate(void);
+static float SOE_EnergyRow(uint8_t row, float soc);
+static float SOE_Energy(float soc, int16_t temperature);
+static float SOE_ResistanceFactor(int16_t temperature);
 static void SOF_Calculate(int16_t maxtemp, int16_t mintemp, uint16_t maxvolt, uint16_t minvolt, uint16_t maxsoc, uint16_t minsoc);
 static void SOF_CalculateVoltageBased (float MinVoltage,float MaxVoltage, SOX_SOF_s *ResultValues);
 static void SOF_CalculateSocBased (float MinSoc,float MaxSoc, SOX_SOF_s *ResultValues);
 static void SOF_CalculateTemperatureBased (float MinTemp,float MaxTemp, SOX_SOF_s *ResultValues);
-static void SOF_MinimumOfThreeSofValues(SOX_SOF_s Ubased, SOX_SOF_s Sbased, SOX_SOF_s Tbased, SOX_SOF_s *resultValues);
+static void SOF_CalculateMapBased(int16_t mintemp, int16_t maxtemp, uint16_t minsoc, uint16_t maxsoc, SOX_SOF_s *ResultValues);
+static void SOF_MapCurrents(int16_t mintemp, int16_t maxtemp, uint16_t minsoc, uint16_t maxsoc, uint16_t *current);
+static void SOF_CalculateFixed(int16_t maxtemp, int16_t mintemp, uint16_t maxvolt, uint16_t minvolt, uint16_t maxsoc, uint16_t minsoc, SOF_FIXED_s *result);
+static void SOF_RampInit(SOF_RAMP_e ramp, float limit, float cutoff, float at_limit, float max);
+static int32_t SOF_Ramp(SOF_RAMP_e ramp, int32_t x);
+static int32_t SOF_TemperatureFixed(SOF_RAMP_e low, SOF_RAMP_e high, int32_t mintemp, int32_t maxtemp);
+static int32_t SOF_MinimumFixed(int32_t value1, int32_t value2);
+static void SOF_FixedPointCompare(const SOX_SOF_s *reference, int32_t charge, int32_t discha, SOX_SOF_FIXED_CHECK_s *result);
+static void SOF_MapInitAxis(const int16_t *axis, uint8_t nr, uint32_t *inv);
+static uint32_t SOF_MapWeight(const int16_t *axis, uint8_t nr, const uint32_t *inv, int32_t x, uint8_t *index);
+static uint16_t SOF_MapInterpolate(SOX_SOF_MAP_e map, uint8_t itemp, uint32_t wtemp, uint8_t isoc, uint32_t wsoc);
+static void SOF_MinimumOfThreeSofValues(const SOX_SOF_s *Ubased, const SOX_SOF_s *Sbased, const SOX_SOF_s *Tbased, SOX_SOF_s *resultValues);
 static float SOF_MinimumOfThreeValues (float value1,float value2, float value3);
 
 /*================== Function Implementations =============================*/
@@ -107,11 +277,16 @@ static float SOF_MinimumOfThreeValues (float value1,float value2, float value3);
 void SOC_Init(uint8_t cc_present) {
     SOX_SOC_s soc = {50.0, 50.0, 50.0};
     DATA_BLOCK_ERRORSTATE_s error_flags;
+    STD_RETURN_TYPE_e nvm_valid = E_NOT_OK;
+#if SOX_SOC_PER_CELL == TRUE
+    uint16_t i = 0;
+#endif
 
 
     DB_ReadBlock(&error_flags, DATA_BLOCK_ID_ERRORSTATE);
     DB_ReadBlock(&sox_current_tab, DATA_BLOCK_ID_CURRENT);
-    NVM_Get_soc(&soc);
+    SOC_CcGetCounters(&soc_cc_previous);
+    nvm_valid = NVM_Get_soc(&soc);
 
     if (cc_present == TRUE) {
         soc_previous_current_timestamp_cc = sox_current_tab.timestamp_cc;
@@ -134,8 +309,6 @@ void SOC_Init(uint8_t cc_present) {
         if (sox.soc_min < 0.0)    { sox.soc_min = 0.0;    }
         if (sox.soc_max > 100.0)  { sox.soc_max = 100.0;  }
         if (sox.soc_max < 0.0)    { sox.soc_max = 0.0;    }
-        //Alternatively, SOC can be initialized with {V,SOC} lookup table if available
-        //with the function SOC_Init_Lookup_Table()
         sox.state = 0;
         sox.timestamp = 0;
         sox.previous_timestamp = 0;
@@ -144,14 +317,40 @@ void SOC_Init(uint8_t cc_present) {
         soc_previous_current_timestamp = sox_current_tab.timestamp;
         error_flags.can_cc_used = 0;
         sox_state.sensor_cc_used = FALSE;
-
+        SOC_CcSetReference(soc.min, soc.max, soc.mean);
     }
+#if SOX_SOC_EKF == TRUE
+    soc_previous_current_timestamp = sox_current_tab.timestamp;
+    SOC_EkfSetValue(soc.min, soc.max, soc.mean);
+#endif
     DB_WriteBlock(&error_flags, DATA_BLOCK_ID_ERRORSTATE);
     DB_WriteBlock(&sox, DATA_BLOCK_ID_SOX);
+
+#if SOX_SOC_PER_CELL == TRUE
+    for (i = 0; i < BS_NR_OF_BAT_CELLS; i++) {
+        soc_cell_inv_capacity[i] = 1.0 / SOX_CELL_CAPACITY;
+    }
+    soc_cell_cc_previous = soc_cc_previous;
+    SOC_CellCalibrate();
+#endif
+
+    // without a valid SOC in the backup SRAM, the SOC is initialized with the open circuit voltage table
+    if (nvm_valid != E_OK) {
+        SOC_Set_Lookup_Table();
+    }
+    soc_rest_timestamp = MCU_GetTimeStamp();
+    soc_rest_recalibrated = FALSE;
+
+#if SOX_OCV_BENCHMARK == TRUE
+    SOC_OcvBenchmark(&ocv_benchmark);
+#endif
 }
 
 void SOC_SetValue(float soc_value_min, float soc_value_max, float soc_value_mean) {
     SOX_SOC_s soc = {50.0, 50.0, 50.0};
+#if SOX_SOC_PER_CELL == TRUE
+    uint16_t i = 0;
+#endif
 
     if (soc_value_min < 0.0) {
         soc_value_min = 0.0;
@@ -174,11 +373,21 @@ void SOC_SetValue(float soc_value_min, float soc_value_max, float soc_value_mean
         soc_value_mean = 100.0;
     }
 
+#if SOX_SOC_EKF == TRUE
+    SOC_EkfSetValue(soc_value_min, soc_value_max, soc_value_mean);
+#endif
+#if SOX_SOC_PER_CELL == TRUE
+    for (i = 0; i < BS_NR_OF_BAT_CELLS; i++) {
+        soc_cell_offset[i] = 0.0;
+    }
+#endif
+
     if (sox_state.sensor_cc_used == FALSE) {
         soc.mean = soc_value_mean;
         soc.min = soc_value_min;
         soc.max = soc_value_max;
         NVM_Set_soc(&soc);
+        SOC_CcSetReference(soc.min, soc.max, soc.mean);
 
         sox.soc_mean = soc.mean;
         sox.soc_min = soc.min;
@@ -225,70 +434,67 @@ void SOC_Set_Lookup_Table(void) {
     DB_ReadBlock(&cellminmax, DATA_BLOCK_ID_MINMAX);
     DB_ReadBlock(&sox_current_tab, DATA_BLOCK_ID_CURRENT);
 
-    soc_mean = SOC_GetFromVoltage((float)(cellminmax.voltage_mean));
-    soc_min = SOC_GetFromVoltage((float)(cellminmax.voltage_min));
-    soc_max = SOC_GetFromVoltage((float)(cellminmax.voltage_max));
+    soc_mean = SOC_GetFromVoltage((uint16_t)(cellminmax.voltage_mean), (int16_t)(cellminmax.temperature_mean));
+    soc_min = SOC_GetFromVoltage(cellminmax.voltage_min, (int16_t)(cellminmax.temperature_mean));
+    soc_max = SOC_GetFromVoltage(cellminmax.voltage_max, (int16_t)(cellminmax.temperature_mean));
 
     SOC_SetValue(soc_min, soc_max, soc_mean);
-
+#if SOX_SOC_PER_CELL == TRUE
+    SOC_CellCalibrate();
+#endif
 }
 
 
 void SOC_Ctrl(void) {
+#if SOX_SOC_EKF == TRUE
+    SOC_EkfCtrl();
+#else
     uint32_t timestamp = 0;
     uint32_t previous_timestamp = 0;
 
     uint32_t timestamp_cc = 0;
     uint32_t previous_timestamp_cc = 0;
 
-    uint32_t timestep = 0;
-
     DATA_BLOCK_CURRENT_s cans_current_tab;
     SOX_SOC_s soc = {50.0, 50.0, 50.0};
+    SOX_CC_s cc;
     float deltaSOC = 0.0;
+    uint8_t clamped = FALSE;
 
     if (sox_state.sensor_cc_used == FALSE) {
         DB_ReadBlock(&sox_current_tab, DATA_BLOCK_ID_CURRENT);
+        SOC_CcGetCounters(&cc);
+
+        if (soc_cc_previous.samples != cc.samples) { // check if current measurement has been updated
+            // charge in uAs, positive when discharging, since the SOC was set: ((uAs / (3600000(uAs/mAh) * mAh)) * 100%
+            deltaSOC = (float)(cc.charge - soc_cc_reference_charge) * (float)(100.0 / (3600000.0 * SOX_CELL_CAPACITY));
+            soc.mean = soc_cc_reference.mean - deltaSOC;
+            soc.min = soc_cc_reference.min - deltaSOC;
+            soc.max = soc_cc_reference.max - deltaSOC;
+            if (soc.mean > 100.0) { soc.mean = 100.0; clamped = TRUE; }
+            if (soc.mean < 0.0)   { soc.mean = 0.0;   clamped = TRUE; }
+            if (soc.min > 100.0)  { soc.min = 100.0;  clamped = TRUE; }
+            if (soc.min < 0.0)    { soc.min = 0.0;    clamped = TRUE; }
+            if (soc.max > 100.0)  { soc.max = 100.0;  clamped = TRUE; }
+            if (soc.max < 0.0)    { soc.max = 0.0;    clamped = TRUE; }
+            if (clamped == TRUE) {
+                SOC_CcSetReference(soc.min, soc.max, soc.mean);
+            }
 
-        timestamp = sox_current_tab.timestamp;
-        previous_timestamp = sox_current_tab.previous_timestamp;
-
-        if (soc_previous_current_timestamp != timestamp) { // check if current measurement has been updated
-            timestep = timestamp - previous_timestamp;
-            if (timestep > 0) {
-
-                NVM_Get_soc(&soc);
-                // Current in charge direction negative means SOC increasing --> BAT naming, not ROB
-                //soc_mean = soc_mean - (sox_current_tab.current/*mA*/ /(float)SOX_CELL_CAPACITY /*mAh*/) * (float)(timestep) * (10.0/3600.0); /*milliseconds*/
-                if (POSITIVE_DISCHARGE_CURRENT == TRUE) {
-                    deltaSOC = (((sox_current_tab.current)*(float)(timestep)/10))/(3600.0*SOX_CELL_CAPACITY); // ((mA *ms *(1s/1000ms)) / (3600(s/h) *mAh)) *100%
-                } else {
-                    deltaSOC = -(((sox_current_tab.current)*(float)(timestep)/10))/(3600.0*SOX_CELL_CAPACITY); // ((mA *ms *(1s/1000ms)) / (3600(s/h) *mAh)) *100%
-                }
-                soc.mean = soc.mean - deltaSOC;
-                soc.min = soc.min - deltaSOC;
-                soc.max = soc.max - deltaSOC;
-                if (soc.mean > 100.0) { soc.mean = 100.0; }
-                if (soc.mean < 0.0)   { soc.mean = 0.0;   }
-                if (soc.min > 100.0)  { soc.min = 100.0;  }
-                if (soc.min < 0.0)    { soc.min = 0.0;    }
-                if (soc.max > 100.0)  { soc.max = 100.0;  }
-                if (soc.max < 0.0)    { soc.max = 0.0;    }
-
-                sox.soc_mean = soc.mean;
-                sox.soc_min = soc.min;
-                sox.soc_max = soc.max;
-
-                NVM_Set_soc(&soc);
-                sox.state++;
-                sox.previous_timestamp = previous_timestamp;
-                sox.timestamp = timestamp;  // soc timestamp is current(I) timestamp
-                DB_WriteBlock(&sox, DATA_BLOCK_ID_SOX);
+            sox.soc_mean = soc.mean;
+            sox.soc_min = soc.min;
+            sox.soc_max = soc.max;
+            sox.throughput_discharge = (float)cc.throughput_discharge * (float)(1.0 / 3600000000.0);
+            sox.throughput_charge = (float)cc.throughput_charge * (float)(1.0 / 3600000000.0);
 
-            }
+            NVM_Set_soc(&soc);
+            sox.state++;
+            sox.previous_timestamp = sox_current_tab.previous_timestamp;
+            sox.timestamp = sox_current_tab.timestamp;  // soc timestamp is current(I) timestamp
+            DB_WriteBlock(&sox, DATA_BLOCK_ID_SOX);
         } // end check if current measurement has been updated
-        //update the variable for the next check
-        soc_previous_current_timestamp = sox_current_tab.timestamp;
+        //update the counters for the next check
+        soc_cc_previous = cc;
 
     }
     else {
@@ -326,11 +532,220 @@ void SOC_Ctrl(void) {
         }
         soc_previous_current_timestamp_cc = sox_current_tab.timestamp_cc;
     }
+#endif
+
+#if SOX_SOC_PER_CELL == TRUE
+    SOC_CellCtrl();
+#endif
+    SOC_CheckRest();
+}
+
+#if SOX_SOC_EKF == TRUE
+/**
+ * @brief   updates the extended Kalman filters with a new current measurement
+ *
+ * The filters of the cells with the minimum, mean and maximum voltage are fed with the current
+ * and the corresponding cell voltage and give soc_min, soc_mean and soc_max with their variances.
+ * The coulomb counter of the current sensor is not used.
+ *
+ * @return  void
+ */
+static void SOC_EkfCtrl(void) {
+    SOX_SOC_s soc = {50.0, 50.0, 50.0};
+    SOX_CC_s cc;
+    uint64_t timestep = 0;
+    float current = 0.0;
+    float dt = 0.0;
+    int16_t temperature = 0;
+
+    DB_ReadBlock(&sox_current_tab, DATA_BLOCK_ID_CURRENT);
+    SOC_CcGetCounters(&cc);
+
+    if (soc_cc_previous.samples != cc.samples) { // check if current measurement has been updated
+        timestep = cc.time - soc_cc_previous.time;
+        if (timestep > 0) {
+            DB_ReadBlock(&cellminmax, DATA_BLOCK_ID_MINMAX);
+
+            // the filters expect the current in A, positive when discharging: the mean current of
+            // all samples since the last update is the charge in uAs divided by the time in us
+            current = (float)(cc.charge - soc_cc_previous.charge) / (float)timestep;
+            dt = 0.000001 * timestep;
+            temperature = (int16_t)cellminmax.temperature_mean;
+
+            SOC_EkfUpdate(&soc_ekf_min, current, 0.001 * cellminmax.voltage_min, temperature, dt);
+            SOC_EkfUpdate(&soc_ekf_mean, current, 0.001 * cellminmax.voltage_mean, temperature, dt);
+            SOC_EkfUpdate(&soc_ekf_max, current, 0.001 * cellminmax.voltage_max, temperature, dt);
+
+            soc.min = SOC_EkfGetSoc(&soc_ekf_min);
+            soc.mean = SOC_EkfGetSoc(&soc_ekf_mean);
+            soc.max = SOC_EkfGetSoc(&soc_ekf_max);
+            NVM_Set_soc(&soc);
+
+            sox.soc_min = soc.min;
+            sox.soc_mean = soc.mean;
+            sox.soc_max = soc.max;
+            sox.soc_variance_min = SOC_EkfGetVariance(&soc_ekf_min);
+            sox.soc_variance_mean = SOC_EkfGetVariance(&soc_ekf_mean);
+            sox.soc_variance_max = SOC_EkfGetVariance(&soc_ekf_max);
+            sox.throughput_discharge = (float)cc.throughput_discharge * (float)(1.0 / 3600000000.0);
+            sox.throughput_charge = (float)cc.throughput_charge * (float)(1.0 / 3600000000.0);
+            sox.state++;
+            sox.previous_timestamp = sox_current_tab.previous_timestamp;
+            sox.timestamp = sox_current_tab.timestamp;  // soc timestamp is current(I) timestamp
+            DB_WriteBlock(&sox, DATA_BLOCK_ID_SOX);
+        }
+        soc_cc_previous = cc;
+    }
+}
+
+/**
+ * @brief   resets the extended Kalman filters to new SOC values
+ *
+ * @param   soc_value_min   SOC min value to set
+ * @param   soc_value_max   SOC max value to set
+ * @param   soc_value_mean  SOC mean value to set
+ *
+ * @return  void
+ */
+static void SOC_EkfSetValue(float soc_value_min, float soc_value_max, float soc_value_mean) {
+    SOC_EkfInit(&soc_ekf_min, soc_value_min);
+    SOC_EkfInit(&soc_ekf_mean, soc_value_mean);
+    SOC_EkfInit(&soc_ekf_max, soc_value_max);
+
+    sox.soc_variance_min = SOC_EkfGetVariance(&soc_ekf_min);
+    sox.soc_variance_mean = SOC_EkfGetVariance(&soc_ekf_mean);
+    sox.soc_variance_max = SOC_EkfGetVariance(&soc_ekf_max);
+}
+#endif
+
+#if SOX_SOC_PER_CELL == TRUE
+void SOC_SetCellCapacity(uint16_t cell, float capacity) {
+    if (cell < BS_NR_OF_BAT_CELLS && capacity > 0.0) {
+        soc_cell_inv_capacity[cell] = 1.0 / capacity;
+    }
+}
+
+/**
+ * @brief   sets the SOC offsets of the cells from their open circuit voltages
+ *
+ * The offset of each cell is the difference between the SOC looked up with its voltage and the
+ * SOC looked up with the mean cell voltage, both at the mean cell temperature.
+ *
+ * @return  void
+ */
+static void SOC_CellCalibrate(void) {
+    int16_t temperature = 0;
+    float soc_mean = 0.0;
+    uint16_t i = 0;
+
+    DB_ReadBlock(&cellvoltage, DATA_BLOCK_ID_CELLVOLTAGE);
+    DB_ReadBlock(&cellminmax, DATA_BLOCK_ID_MINMAX);
+
+    temperature = (int16_t)cellminmax.temperature_mean;
+    soc_mean = SOC_GetFromVoltage((uint16_t)(cellminmax.voltage_mean), temperature);
+    for (i = 0; i < BS_NR_OF_BAT_CELLS; i++) {
+        soc_cell_offset[i] = SOC_GetFromVoltage(cellvoltage.voltage[i], temperature) - soc_mean;
+    }
+    soc_cell.calibrations++;
+}
+
+/**
+ * @brief   updates the SOC of each cell with a new current measurement
+ *
+ * The SOC of each cell is soc_mean plus an offset. The offsets change with the common current
+ * through the difference of the cell capacity to SOX_CELL_CAPACITY and are corrected towards the
+ * deviation of the cell voltage from the mean cell voltage, converted with the slope of the open
+ * circuit voltage. The mean of the offsets is kept at zero. soc_min and soc_max of the SOX data
+ * block are set to the weakest and the strongest cell.
+ *
+ * @return  void
+ */
+static void SOC_CellCtrl(void) {
+    SOX_CC_s cc;
+    uint64_t timestep = 0;
+    float charge = 0.0;
+    float dt = 0.0;
+    float slope = 0.0;
+    float kcapacity = 0.0;
+    float kvoltage = 0.0;
+    float invslope = 0.0;
+    float vmean = 0.0;
+    float mean = 0.0;
+    float soc = 0.0;
+    uint16_t i = 0;
+
+    SOC_CcGetCounters(&cc);
+    if (soc_cell_cc_previous.samples == cc.samples) { // check if current measurement has been updated
+        return;
+    }
+    timestep = cc.time - soc_cell_cc_previous.time;
+    charge = (float)(cc.charge - soc_cell_cc_previous.charge);
+    soc_cell_cc_previous = cc;
+    if (timestep == 0) {
+        return;
+    }
 
+    DB_ReadBlock(&cellvoltage, DATA_BLOCK_ID_CELLVOLTAGE);
+    DB_ReadBlock(&cellminmax, DATA_BLOCK_ID_MINMAX);
 
+    // charge in uAs, positive when discharging
+    dt = 0.000001 * timestep;
+
+    // change of the SOC in % is kcapacity / capacity in mAh
+    kcapacity = -(100.0 / 3600000.0) * charge;
+    if (sox_current_tab.current < SOX_CELL_SOC_CORRECTION_CURRENT && sox_current_tab.current > -SOX_CELL_SOC_CORRECTION_CURRENT) {
+        // convert the slope from V per unit SOC to mV/%, the unit of SOX_CELL_SOC_MIN_SLOPE
+        (void)SOC_GetOcv(0.01 * sox.soc_mean, (int16_t)cellminmax.temperature_mean, &slope);
+        slope *= 10.0;
+        if (slope >= SOX_CELL_SOC_MIN_SLOPE) {
+            kvoltage = SOX_CELL_SOC_GAIN * dt;
+            if (kvoltage > 1.0) {
+                kvoltage = 1.0;
+            }
+            invslope = 1.0 / slope;
+        }
+    }
+    vmean = (float)cellminmax.voltage_mean;
+
+    // the loop has no branches and only loop-invariant coefficients, so that it is pipelined on the FPU
+    for (i = 0; i < BS_NR_OF_BAT_CELLS; i++) {
+        soc_cell_offset[i] += kcapacity * (soc_cell_inv_capacity[i] - (float)(1.0 / SOX_CELL_CAPACITY))
+                + kvoltage * (((float)cellvoltage.voltage[i] - vmean) * invslope - soc_cell_offset[i]);
+        mean += soc_cell_offset[i];
+    }
+    mean *= 1.0 / BS_NR_OF_BAT_CELLS;
+
+    soc_cell.soc_min = 100.0;
+    soc_cell.soc_max = 0.0;
+    for (i = 0; i < BS_NR_OF_BAT_CELLS; i++) {
+        soc_cell_offset[i] -= mean;
+        soc = sox.soc_mean + soc_cell_offset[i];
+        if (soc > 100.0) { soc = 100.0; }
+        if (soc < 0.0)   { soc = 0.0;   }
+        soc_cell.soc[i] = soc;
+        if (soc <= soc_cell.soc_min) {
+            soc_cell.soc_min = soc;
+            soc_cell.cell_number_min = i;
+        }
+        if (soc >= soc_cell.soc_max) {
+            soc_cell.soc_max = soc;
+            soc_cell.cell_number_max = i;
+        }
+    }
+    soc_cell.state++;
+    soc_cell.previous_timestamp = sox_current_tab.previous_timestamp;
+    soc_cell.timestamp = sox_current_tab.timestamp;
+    DB_WriteBlock(&soc_cell, DATA_BLOCK_ID_CELLSOC);
+
+    sox.soc_min = soc_cell.soc_min;
+    sox.soc_max = soc_cell.soc_max;
+    DB_WriteBlock(&sox, DATA_BLOCK_ID_SOX);
 }
+#endif
 
 void SOF_Init(void) {
+    uint8_t i = 0;
+
     Slope_TLowDischa = (sox_sof_config.I_DischaMax_Cont - sox_sof_config.I_Limphome) / (sox_sof_config.Cutoff_TLow_Discha - sox_sof_config.Limit_TLow_Discha);
     Offset_TLowDischa = sox_sof_config.I_Limphome - (Slope_TLowDischa * sox_sof_config.Limit_TLow_Discha);
     Slope_THighDischa = (0 - sox_sof_config.I_DischaMax_Cont) / (sox_sof_config.Limit_THigh_Discha - sox_sof_config.Cutoff_THigh_Discha);
@@ -352,9 +767,36 @@ void SOF_Init(void) {
 
     Slope_VoltageCharge = (sox_sof_config.I_ChargeMax_Cont - 0) / (sox_sof_config.Cutoff_Voltage_Charge - sox_sof_config.Limit_Voltage_Charge);
     Offset_VoltageCharge = 0 - Slope_VoltageCharge * sox_sof_config.Limit_Soc_Discha;
+
+    SOF_MapInitAxis(sox_sof_map.temperature, sox_sof_map.nr_temperature, sof_map_temperature_inv);
+    SOF_MapInitAxis(sox_sof_map.soc, sox_sof_map.nr_soc, sof_map_soc_inv);
+
+    SOF_RampInit(SOF_RAMP_VOLTAGE_DISCHA, sox_sof_config.Limit_Voltage_Discha, sox_sof_config.Cutoff_Voltage_Discha, 0.0, sox_sof_config.I_DischaMax_Cont);
+    SOF_RampInit(SOF_RAMP_VOLTAGE_CHARGE, sox_sof_config.Limit_Voltage_Charge, sox_sof_config.Cutoff_Voltage_Charge, 0.0, sox_sof_config.I_ChargeMax_Cont);
+    SOF_RampInit(SOF_RAMP_SOC_DISCHA, sox_sof_config.Limit_Soc_Discha, sox_sof_config.Cutoff_Soc_Discha, sox_sof_config.I_Limphome, sox_sof_config.I_DischaMax_Cont);
+    SOF_RampInit(SOF_RAMP_SOC_CHARGE, sox_sof_config.Limit_Soc_Charge, sox_sof_config.Cutoff_Soc_Charge, 0.0, sox_sof_config.I_ChargeMax_Cont);
+    SOF_RampInit(SOF_RAMP_TLOW_DISCHA, sox_sof_config.Limit_TLow_Discha, sox_sof_config.Cutoff_TLow_Discha, sox_sof_config.I_Limphome, sox_sof_config.I_DischaMax_Cont);
+    SOF_RampInit(SOF_RAMP_TLOW_CHARGE, sox_sof_config.Limit_TLow_Charge, sox_sof_config.Cutoff_TLow_Charge, 0.0, sox_sof_config.I_ChargeMax_Cont);
+    SOF_RampInit(SOF_RAMP_THIGH_DISCHA, sox_sof_config.Limit_THigh_Discha, sox_sof_config.Cutoff_THigh_Discha, 0.0, sox_sof_config.I_DischaMax_Cont);
+    SOF_RampInit(SOF_RAMP_THIGH_CHARGE, sox_sof_config.Limit_THigh_Charge, sox_sof_config.Cutoff_THigh_Charge, 0.0, sox_sof_config.I_ChargeMax_Cont);
+
+    for (i = 0; i < SOX_SOP_NR_OF_HORIZONS; i++) {
+        sop_decay1[i] = SOC_EkfDecay(sop_horizon[i] / SOX_EKF_TAU1);
+        sop_decay2[i] = SOC_EkfDecay(sop_horizon[i] / SOX_EKF_TAU2);
+    }
+
+#if SOX_SOF_BENCHMARK == TRUE
+    SOF_Benchmark(&sof_benchmark);
+#endif
+#if SOX_SOF_FIXED_POINT_CHECK == TRUE
+    SOF_FixedPointCheck(&sof_fixed_check);
+#endif
 }
 
 void SOF_Ctrl(void) {
+    float factor_charge = 1.0;
+    float factor_discharge = 1.0;
+
     DB_ReadBlock(&cellvoltage, DATA_BLOCK_ID_CELLVOLTAGE);
     DB_ReadBlock(&celltemperature, DATA_BLOCK_ID_CELLTEMPERATURE);
     DB_ReadBlock(&cellminmax, DATA_BLOCK_ID_MINMAX);
@@ -376,25 +818,527 @@ void SOF_Ctrl(void) {
         sox.sof_continuous_discharge = values_sof.current_Discha_cont_max;
         sox.sof_peak_charge = values_sof.current_Charge_peak_max;
         sox.sof_peak_discharge = values_sof.current_Discha_peak_max;
+
+        DRT_GetFactors(&factor_charge, &factor_discharge);
+        factor_charge *= BAL_GetChargeFactor();
+        sox.sof_continuous_charge *= factor_charge;
+        sox.sof_peak_charge *= factor_charge;
+        sox.sof_continuous_discharge *= factor_discharge;
+        sox.sof_peak_discharge *= factor_discharge;
     }
+    SOP_Calculate();
     DB_WriteBlock(&sox, DATA_BLOCK_ID_SOX);
 }
 
 /**
- * @brief   look-up table for SOC initialization (mean, min and max).
+ * @brief   predicts the maximum constant currents and powers over the horizons of the SOP
+ *
+ * A constant current I (positive when discharging) applied for the time t changes the voltage
+ * of a cell of the RC model to
  *
- * @param   voltage: voltage of battery cell
+ *  V(t) = OCV - v1 * e1 - v2 * e2 - I * (R0 + R1 * (1 - e1) + R2 * (1 - e2) + dOCV/dSOC * t / C)
  *
- * @return  SOC value
+ * with ek = exp(-t / TAUk) and the voltages vk over the RC elements at t = 0. V(t) is linear in I,
+ * so the current that brings the cell to BC_VOLTMIN (BC_VOLTMAX) has a closed form. The limit is
+ * checked at the start and at the end of the horizon. The discharge is limited by the cell with
+ * the lowest SOC, the charge by the cell with the highest SOC, and the resistances are scaled with
+ * the resistance growth from the SOH and the temperature factor at the lowest cell temperature.
+ * The currents are limited to the derated peak currents of the SOF. The power is the current
+ * times the pack voltage predicted with the mean cell at the end of the horizon.
+ *
+ * @return  void
  */
+static void SOP_Calculate(void) {
+    float ocv[3] = { 0.0, 0.0, 0.0 };
+    float slope[3] = { 0.0, 0.0, 0.0 };
+    float v1[3] = { 0.0, 0.0, 0.0 };
+    float v2[3] = { 0.0, 0.0, 0.0 };
+    float factor = 0.0;
+    float factor_mean = 0.0;
+    float capacity = 0.0;
+    float vstart = 0.0;
+    float vend = 0.0;
+    float resistance = 0.0;
+    float limit = 0.0;
+    float current = 0.0;
+    uint8_t i = 0;
+
+    DB_ReadBlock(&sox_soh, DATA_BLOCK_ID_SOH);
+    if (sox_soh.capacity_min <= 0.0) {
+        return;     // SOH not initialized
+    }
+    capacity = 3.6 * sox_soh.capacity_min;      // As
+    factor = SOE_ResistanceFactor((int16_t)cellminmax.temperature_min);
+    factor_mean = factor * sox_soh.resistance_mean / SOH_RESISTANCE_BOL;
+    factor *= sox_soh.resistance_max / SOH_RESISTANCE_BOL;
+
+    // index 0: lowest SOC, 1: highest SOC, 2: mean SOC
+#if SOX_SOC_EKF == TRUE
+    ocv[0] = SOC_GetOcv(soc_ekf_min.x[0], (int16_t)cellminmax.temperature_mean, &slope[0]);
+    ocv[1] = SOC_GetOcv(soc_ekf_max.x[0], (int16_t)cellminmax.temperature_mean, &slope[1]);
+    ocv[2] = SOC_GetOcv(soc_ekf_mean.x[0], (int16_t)cellminmax.temperature_mean, &slope[2]);
+    v1[0] = soc_ekf_min.x[1];
+    v2[0] = soc_ekf_min.x[2];
+    v1[1] = soc_ekf_max.x[1];
+    v2[1] = soc_ekf_max.x[2];
+    v1[2] = soc_ekf_mean.x[1];
+    v2[2] = soc_ekf_mean.x[2];
+#else
+    // without the filter states, the RC elements are assumed to be relaxed
+    ocv[0] = SOC_GetOcv(0.01 * sox.soc_min, (int16_t)cellminmax.temperature_mean, &slope[0]);
+    ocv[1] = SOC_GetOcv(0.01 * sox.soc_max, (int16_t)cellminmax.temperature_mean, &slope[1]);
+    ocv[2] = SOC_GetOcv(0.01 * sox.soc_mean, (int16_t)cellminmax.temperature_mean, &slope[2]);
+#endif
+
+    for (i = 0; i < SOX_SOP_NR_OF_HORIZONS; i++) {
+        // discharge, cell with the lowest SOC at the start and at the end of the horizon
+        vstart = ocv[0] - v1[0] - v2[0] - 0.001 * BC_VOLTMIN;
+        vend = ocv[0] - v1[0] * sop_decay1[i] - v2[0] * sop_decay2[i] - 0.001 * BC_VOLTMIN;
+        resistance = factor * (SOX_EKF_R1 * (1.0 - sop_decay1[i]) + SOX_EKF_R2 * (1.0 - sop_decay2[i]));
+        limit = vstart / (factor * SOX_EKF_R0);
+        current = vend / (factor * SOX_EKF_R0 + resistance + slope[0] * sop_horizon[i] / capacity);
+        if (limit < current) { current = limit; }
+        if (current > sox.sof_peak_discharge) { current = sox.sof_peak_discharge; }
+        if (current < 0.0) { current = 0.0; }
+        sox.sop_current_discharge[i] = current;
+
+        // charge, cell with the highest SOC
+        vstart = 0.001 * BC_VOLTMAX - (ocv[1] - v1[1] - v2[1]);
+        vend = 0.001 * BC_VOLTMAX - (ocv[1] - v1[1] * sop_decay1[i] - v2[1] * sop_decay2[i]);
+        limit = vstart / (factor * SOX_EKF_R0);
+        current = vend / (factor * SOX_EKF_R0 + resistance + slope[1] * sop_horizon[i] / capacity);
+        if (limit < current) { current = limit; }
+        if (current > sox.sof_peak_charge) { current = sox.sof_peak_charge; }
+        if (current < 0.0) { current = 0.0; }
+        sox.sop_current_charge[i] = current;
+
+        // pack voltage with the mean cell at the end of the horizon
+        resistance = factor_mean * (SOX_EKF_R0 + SOX_EKF_R1 * (1.0 - sop_decay1[i]) + SOX_EKF_R2 * (1.0 - sop_decay2[i]))
+                + slope[2] * sop_horizon[i] / capacity;
+        vend = ocv[2] - v1[2] * sop_decay1[i] - v2[2] * sop_decay2[i];
+        current = sox.sop_current_discharge[i];
+        vstart = vend - current * resistance;
+        sox.sop_power_discharge[i] = (vstart > 0.0) ? (current * BS_NR_OF_BAT_CELLS * vstart) : 0.0;
+        current = sox.sop_current_charge[i];
+        sox.sop_power_charge[i] = current * BS_NR_OF_BAT_CELLS * (vend + current * resistance);
+    }
+}
+
+void SOE_Init(void) {
+    const int16_t *axis = sox_ocv_table.soc;
+    uint8_t nr = sox_ocv_table.nr_soc;
+    const uint16_t *row = NULL_PTR;
+    float *energy = NULL_PTR;
+    uint8_t i = 0;
+    uint8_t j = 0;
+
+    soe_nr_temperature = sox_ocv_table.nr_temperature;
+    if (soe_nr_temperature * nr > SOX_OCV_MAX_POINTS) {
+        soe_nr_temperature = SOX_OCV_MAX_POINTS / nr;
+    }
+
+    // trapezoidal rule, exact for the piecewise-linear table; mV times 0.01% gives Wh/Ah * 1e-7
+    for (i = 0; i < soe_nr_temperature; i++) {
+        row = &sox_ocv_table.voltage[i * nr];
+        energy = &soe_ocv_energy[i * nr];
+        energy[0] = 0.0;
+        for (j = 1; j < nr; j++) {
+            energy[j] = energy[j - 1] + 0.5e-7 * (float)(row[j - 1] + row[j]) * (float)(axis[j] - axis[j - 1]);
+        }
+    }
+
+    soe_current = 0.0;
+    soe_timestamp = MCU_GetTimeStamp() - SOX_SOE_PERIOD_MS;
+}
+
+void SOE_Ctrl(void) {
+    uint32_t timestamp = MCU_GetTimeStamp();
+    int16_t temperature = 0;
+    float filter = 0.0;
+    float current = 0.0;
+    float current_discharge = 0.0;
+    float current_charge = 0.0;
+    float charge_discharge = 0.0;
+    float charge_charge = 0.0;
+    float energy_discharge = 0.0;
+    float energy_charge = 0.0;
+    float resistance = 0.0;
+    float capacity = 0.0;
+    float soc = 0.0;
+    float energy = 0.0;
+    float losses = 0.0;
+    uint16_t i = 0;
+
+    if (soe_nr_temperature == 0 || (timestamp - soe_timestamp) < SOX_SOE_PERIOD_MS) {
+        return;
+    }
+    filter = 0.001 * (float)(timestamp - soe_timestamp) / SOX_SOE_CURRENT_FILTER_S;
+    if (filter > 1.0) {
+        filter = 1.0;
+    }
+    soe_timestamp = timestamp;
+
+    DB_ReadBlock(&sox_soh, DATA_BLOCK_ID_SOH);
+    DB_ReadBlock(&cellminmax, DATA_BLOCK_ID_MINMAX);
+    temperature = (int16_t)cellminmax.temperature_mean;
 
-static float SOC_GetFromVoltage(float voltage) {
+    // current in mA, positive when discharging
+    if (POSITIVE_DISCHARGE_CURRENT == TRUE) {
+        current = sox_current_tab.current;
+    } else {
+        current = -sox_current_tab.current;
+    }
+    soe_current += filter * (current - soe_current);
+    current_discharge = (soe_current > SOX_SOE_DISCHARGE_CURRENT) ? soe_current : SOX_SOE_DISCHARGE_CURRENT;
+    current_charge = (-soe_current > SOX_SOE_CHARGE_CURRENT) ? -soe_current : SOX_SOE_CHARGE_CURRENT;
+
+    // charge in mAh until the first cell reaches the limits of the SOC window
+    charge_discharge = FLT_MAX;
+    charge_charge = FLT_MAX;
+    for (i = 0; i < BS_NR_OF_BAT_CELLS; i++) {
+        capacity = sox_soh.capacity[i];
+        if (capacity <= 0.0) {
+            return;     // SOH not initialized
+        }
+        soc = SOE_CELL_SOC(i);
+        if (0.01 * capacity * (soc - SOX_SOE_SOC_MIN) < charge_discharge) {
+            charge_discharge = 0.01 * capacity * (soc - SOX_SOE_SOC_MIN);
+        }
+        if (0.01 * capacity * (SOX_SOE_SOC_MAX - soc) < charge_charge) {
+            charge_charge = 0.01 * capacity * (SOX_SOE_SOC_MAX - soc);
+        }
+    }
+    if (charge_discharge < 0.0) {
+        charge_discharge = 0.0;
+    }
+    if (charge_charge < 0.0) {
+        charge_charge = 0.0;
+    }
+
+    // the energy of each cell is its capacity (mAh) times the integral of the OCV (Wh/Ah)
+    for (i = 0; i < BS_NR_OF_BAT_CELLS; i++) {
+        capacity = sox_soh.capacity[i];
+        soc = SOE_CELL_SOC(i);
+        energy = SOE_Energy(soc, temperature);
+        energy_discharge += capacity * (energy - SOE_Energy(soc - 100.0 * charge_discharge / capacity, temperature));
+        energy_charge += capacity * (SOE_Energy(soc + 100.0 * charge_charge / capacity, temperature) - energy);
+        resistance += sox_soh.resistance[i];
+    }
+    energy_discharge *= 0.001;
+    energy_charge *= 0.001;
+    resistance *= SOE_ResistanceFactor(temperature);
 
-    float SOC = 0;
+    sox.energy_remaining = energy_discharge;
+    if ((energy_discharge + energy_charge) > 0.0) {
+        sox.soe = 100.0 * energy_discharge / (energy_discharge + energy_charge);
+    } else {
+        sox.soe = 0.0;
+    }
 
-    SOC = 50.0;
+    // losses in Wh: mA * mOhm * mAh * 1e-9
+    losses = 1e-9 * current_discharge * resistance * charge_discharge;
+    sox.energy_discharge = (energy_discharge > losses) ? (energy_discharge - losses) : 0.0;
+    losses = 1e-9 * current_charge * resistance * charge_charge;
+    sox.energy_charge = energy_charge + losses;
 
-    return SOC;
+    DB_WriteBlock(&sox, DATA_BLOCK_ID_SOX);
+}
+
+/**
+ * @brief   energy per capacity from 0% SOC up to a SOC in one temperature row
+ *
+ * The SOC interval is searched with a binary search. Within the interval the OCV is linear, so
+ * the energy is the trapezoid from the lower breakpoint to the SOC.
+ *
+ * @param   row     index of the temperature row
+ * @param   soc     SOC in %, clamped to the table
+ *
+ * @return  energy per capacity in Wh/Ah
+ */
+static float SOE_EnergyRow(uint8_t row, float soc) {
+    const int16_t *axis = sox_ocv_table.soc;
+    uint8_t nr = sox_ocv_table.nr_soc;
+    const uint16_t *voltage = &sox_ocv_table.voltage[row * nr];
+    const float *energy = &soe_ocv_energy[row * nr];
+    float x = 100.0 * soc;
+    float v = 0.0;
+    uint8_t low = 0;
+    uint8_t high = nr - 1;
+    uint8_t mid = 0;
+
+    if (x <= axis[0]) {
+        return energy[0];
+    }
+    if (x >= axis[nr - 1]) {
+        return energy[nr - 1];
+    }
+    while ((high - low) > 1) {
+        mid = (low + high) / 2;
+        if (axis[mid] <= x) {
+            low = mid;
+        } else {
+            high = mid;
+        }
+    }
+    x -= axis[low];
+    v = voltage[low] + x * (float)(voltage[high] - voltage[low]) / (float)(axis[high] - axis[low]);
+    return energy[low] + 0.5e-7 * x * (voltage[low] + v);
+}
+
+/**
+ * @brief   energy per capacity from 0% SOC up to a SOC
+ *
+ * Interpolates linearly between the two temperature rows next to the temperature. Temperatures
+ * outside of the table are clamped.
+ *
+ * @param   soc             SOC in %
+ * @param   temperature     cell temperature in degC
+ *
+ * @return  energy per capacity in Wh/Ah
+ */
+static float SOE_Energy(float soc, int16_t temperature) {
+    const int16_t *axis = sox_ocv_table.temperature;
+    uint8_t nr = soe_nr_temperature;
+    float weight = 0.0;
+    uint8_t i = 0;
+
+    if (temperature <= axis[0]) {
+        return SOE_EnergyRow(0, soc);
+    }
+    if (temperature >= axis[nr - 1]) {
+        return SOE_EnergyRow(nr - 1, soc);
+    }
+    while (temperature >= axis[i + 1]) {
+        i++;
+    }
+    weight = (float)(temperature - axis[i]) / (float)(axis[i + 1] - axis[i]);
+    return (1.0 - weight) * SOE_EnergyRow(i, soc) + weight * SOE_EnergyRow(i + 1, soc);
+}
+
+/**
+ * @brief   temperature factor of the cell resistance
+ *
+ * @param   temperature     cell temperature in degC
+ *
+ * @return  factor interpolated from sox_soe_resistance_factor, 1.0 at 25degC
+ */
+static float SOE_ResistanceFactor(int16_t temperature) {
+    const int16_t *axis = sox_soe_resistance_temperature;
+    const uint16_t *factor = sox_soe_resistance_factor;
+    uint8_t i = 0;
+
+    if (temperature <= axis[0]) {
+        return 0.01 * factor[0];
+    }
+    if (temperature >= axis[SOX_SOE_RESISTANCE_POINTS - 1]) {
+        return 0.01 * factor[SOX_SOE_RESISTANCE_POINTS - 1];
+    }
+    while (temperature >= axis[i + 1]) {
+        i++;
+    }
+    return 0.01 * (factor[i] + (float)(temperature - axis[i]) * (float)(factor[i + 1] - factor[i]) / (float)(axis[i + 1] - axis[i]));
+}
+
+float SOC_GetFromVoltage(uint16_t voltage, int16_t temperature) {
+    const int16_t *axis = sox_ocv_table.temperature;
+    uint8_t nr = sox_ocv_table.nr_temperature;
+    uint8_t i = 0;
+    uint32_t weight = 0;
+    uint32_t soclow = 0;
+    uint32_t sochigh = 0;
+
+    if (temperature <= axis[0]) {
+        return 0.01 * SOC_OcvSearch(&sox_ocv_table.voltage[0], voltage);
+    }
+    if (temperature >= axis[nr - 1]) {
+        return 0.01 * SOC_OcvSearch(&sox_ocv_table.voltage[(nr - 1) * sox_ocv_table.nr_soc], voltage);
+    }
+    while (temperature >= axis[i + 1]) {
+        i++;
+    }
+    weight = ((uint32_t)(temperature - axis[i]) << 15) / (uint32_t)(axis[i + 1] - axis[i]);
+    soclow = SOC_OcvSearch(&sox_ocv_table.voltage[i * sox_ocv_table.nr_soc], voltage);
+    sochigh = SOC_OcvSearch(&sox_ocv_table.voltage[(i + 1) * sox_ocv_table.nr_soc], voltage);
+
+    return 0.01 * ((soclow * ((1uL << 15) - weight) + sochigh * weight + (1uL << 14)) >> 15);
+}
+
+/**
+ * @brief   binary search and linear interpolation of the SOC in one row of the open circuit voltage table
+ *
+ * Voltages outside of the row are clamped to the first or last SOC breakpoint.
+ *
+ * @param   row         open circuit voltages of one temperature breakpoint, strictly increasing
+ * @param   voltage     open circuit voltage in mV
+ *
+ * @return  SOC with resolution 0.01% (0..10000)
+ */
+static uint32_t SOC_OcvSearch(const uint16_t *row, uint16_t voltage) {
+    const int16_t *soc = sox_ocv_table.soc;
+    uint8_t low = 0;
+    uint8_t high = sox_ocv_table.nr_soc - 1;
+    uint8_t mid = 0;
+
+    if (voltage <= row[low]) {
+        return soc[low];
+    }
+    if (voltage >= row[high]) {
+        return soc[high];
+    }
+    // row[low] < voltage < row[high]
+    while ((high - low) > 1) {
+        mid = (low + high) / 2;
+        if (voltage < row[mid]) {
+            high = mid;
+        } else {
+            low = mid;
+        }
+    }
+    return soc[low] + ((uint32_t)(voltage - row[low]) * (uint32_t)(soc[high] - soc[low]) + (uint32_t)(row[high] - row[low]) / 2) / (uint32_t)(row[high] - row[low]);
+}
+
+/**
+ * @brief   reference implementation of SOC_GetFromVoltage() with a linear search in floating point
+ *
+ * Only used by SOC_OcvBenchmark().
+ *
+ * @param   voltage         open circuit voltage of battery cell in mV
+ * @param   temperature     temperature of battery cell in degC
+ *
+ * @return  SOC value between 0.0 and 100.0
+ */
+static float SOC_OcvLinearSearch(uint16_t voltage, int16_t temperature) {
+    const int16_t *axis = sox_ocv_table.temperature;
+    uint8_t nr = sox_ocv_table.nr_temperature;
+    float soc[2] = {0.0, 0.0};
+    float weight = 0.0;
+    const uint16_t *row = NULL_PTR;
+    uint8_t i = 0;
+    uint8_t k = 0;
+    uint8_t j = 0;
+
+    if (temperature <= axis[0]) {
+        temperature = axis[0];
+    } else if (temperature >= axis[nr - 1]) {
+        temperature = axis[nr - 1];
+    }
+    while ((i + 2) < nr && temperature >= axis[i + 1]) {
+        i++;
+    }
+    if (nr > 1) {
+        weight = (float)(temperature - axis[i]) / (float)(axis[i + 1] - axis[i]);
+    }
+
+    for (k = 0; k < 2 && (i + k) < nr; k++) {
+        row = &sox_ocv_table.voltage[(i + k) * sox_ocv_table.nr_soc];
+        if (voltage <= row[0]) {
+            soc[k] = sox_ocv_table.soc[0];
+        } else if (voltage >= row[sox_ocv_table.nr_soc - 1]) {
+            soc[k] = sox_ocv_table.soc[sox_ocv_table.nr_soc - 1];
+        } else {
+            for (j = 0; voltage >= row[j + 1]; j++) {
+            }
+            soc[k] = sox_ocv_table.soc[j] + (float)(voltage - row[j]) * (float)(sox_ocv_table.soc[j + 1] - sox_ocv_table.soc[j]) / (float)(row[j + 1] - row[j]);
+        }
+    }
+    return 0.01 * (soc[0] * (1.0 - weight) + soc[1] * weight);
+}
+
+/**
+ * @brief   sets the SOC from which the coulomb counter continues
+ *
+ * @param   soc_min     SOC min value in %
+ * @param   soc_max     SOC max value in %
+ * @param   soc_mean    SOC mean value in %
+ *
+ * @return  void
+ */
+static void SOC_CcSetReference(float soc_min, float soc_max, float soc_mean) {
+    SOX_CC_s cc;
+
+    SOC_CcGetCounters(&cc);
+    soc_cc_reference.min = soc_min;
+    soc_cc_reference.max = soc_max;
+    soc_cc_reference.mean = soc_mean;
+    soc_cc_reference_charge = cc.charge;
+}
+
+/**
+ * @brief   recalibrates the SOC from the open circuit voltage after a rest period
+ *
+ * The rest period starts when the current falls below SOX_SOC_INIT_CURRENT_LIMIT. After
+ * SOX_SOC_REST_TIME_MS, the cells are considered relaxed and the SOC is set once with
+ * SOC_Set_Lookup_Table().
+ *
+ * @return  void
+ */
+static void SOC_CheckRest(void) {
+    uint32_t timestamp = MCU_GetTimeStamp();
+    float current = sox_current_tab.current;
+
+    if (current < 0.0) {
+        current = -current;
+    }
+    if (current >= SOX_SOC_INIT_CURRENT_LIMIT) {
+        soc_rest_timestamp = timestamp;
+        soc_rest_recalibrated = FALSE;
+    } else if (soc_rest_recalibrated == FALSE && (timestamp - soc_rest_timestamp) >= SOX_SOC_REST_TIME_MS) {
+        SOC_Set_Lookup_Table();
+        soc_rest_recalibrated = TRUE;
+    }
+}
+
+void SOC_OcvBenchmark(SOX_OCV_BENCHMARK_s *result) {
+    const uint16_t *row = sox_ocv_table.voltage;
+    uint16_t vmin = row[0];
+    uint16_t vmax = row[sox_ocv_table.nr_soc - 1];
+    uint16_t voltage = 0;
+    int16_t temp = 0;
+    float soclinear = 0.0;
+    float socbinary = 0.0;
+    float deviation = 0.0;
+    uint32_t start = 0;
+    uint8_t i = 0;
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    // the voltage range covers all rows of the table
+    for (i = 1; i < sox_ocv_table.nr_temperature; i++) {
+        row = &sox_ocv_table.voltage[i * sox_ocv_table.nr_soc];
+        if (row[0] < vmin) {
+            vmin = row[0];
+        }
+        if (row[sox_ocv_table.nr_soc - 1] > vmax) {
+            vmax = row[sox_ocv_table.nr_soc - 1];
+        }
+    }
+
+    result->points = 0;
+    result->cycles_linear = 0;
+    result->cycles_binary = 0;
+    result->max_deviation = 0.0;
+
+    for (temp = -20; temp <= 60; temp += 5) {
+        for (voltage = vmin - 50; voltage <= vmax + 50; voltage += 5) {
+            start = DWT->CYCCNT;
+            soclinear = SOC_OcvLinearSearch(voltage, temp);
+            result->cycles_linear += DWT->CYCCNT - start;
+
+            start = DWT->CYCCNT;
+            socbinary = SOC_GetFromVoltage(voltage, temp);
+            result->cycles_binary += DWT->CYCCNT - start;
+
+            deviation = soclinear - socbinary;
+            if (deviation < 0.0) {
+                deviation = -deviation;
+            }
+            if (deviation > result->max_deviation) {
+                result->max_deviation = deviation;
+            }
+            result->points++;
+        }
+    }
 }
 
 
@@ -411,13 +1355,30 @@ static float SOC_GetFromVoltage(float voltage) {
  * @return  void
  */
 static void SOF_Calculate(int16_t maxtemp, int16_t mintemp, uint16_t maxvolt, uint16_t minvolt, uint16_t maxsoc, uint16_t minsoc) {
+#if SOX_SOF_FIXED_POINT == TRUE
+    SOF_FIXED_s fixed;
+    SOF_CalculateFixed(maxtemp, mintemp, maxvolt, minvolt, maxsoc, minsoc, &fixed);
+    values_sof.current_Charge_cont_max = 0.001 * fixed.charge_cont;
+    values_sof.current_Charge_peak_max = 0.001 * fixed.charge_peak;
+    values_sof.current_Discha_cont_max = 0.001 * fixed.discha_cont;
+    values_sof.current_Discha_peak_max = 0.001 * fixed.discha_peak;
+#else
     static SOX_SOF_s UbasedSof = {0.0, 0.0, 0.0};
+#if SOX_SOF_USE_MAPS == TRUE
+    static SOX_SOF_s MbasedSof = {0.0, 0.0, 0.0};
+    SOF_CalculateVoltageBased((float)minvolt,(float)maxvolt,&UbasedSof );
+    SOF_CalculateMapBased(mintemp, maxtemp, minsoc, maxsoc, &MbasedSof);
+    // the maps cover both SOC and temperature
+    SOF_MinimumOfThreeSofValues(&UbasedSof, &MbasedSof, &MbasedSof, &values_sof);
+#else
     static SOX_SOF_s SbasedSof = {0.0, 0.0, 0.0};
     static SOX_SOF_s TbasedSof = {0.0, 0.0, 0.0};
     SOF_CalculateVoltageBased((float)minvolt,(float)maxvolt,&UbasedSof );
     SOF_CalculateSocBased((float)minsoc,(float)maxsoc,&SbasedSof);
     SOF_CalculateTemperatureBased((float)mintemp,(float)maxtemp,&TbasedSof);
-    SOF_MinimumOfThreeSofValues(UbasedSof, SbasedSof, TbasedSof, &values_sof);
+    SOF_MinimumOfThreeSofValues(&UbasedSof, &SbasedSof, &TbasedSof, &values_sof);
+#endif
+#endif
 }
 
 /**
@@ -596,6 +1557,295 @@ static void  SOF_CalculateTemperatureBased (float MinTemp,float MaxTemp, SOX_SOF
     }
 }
 
+/**
+ * @brief   calculates the SoF from the temperature x SOC current limit maps
+ *
+ * The charge currents are taken at the maximum SOC, the discharge currents at the minimum SOC.
+ * As the maps derate at low and at high temperatures, both the minimum and the maximum
+ * temperature are looked up and the smaller current is used.
+ *
+ * @param   mintemp         minimum temperature of cells in degC
+ * @param   maxtemp         maximum temperature of cells in degC
+ * @param   minsoc          minimum SOC with resolution 0.01%
+ * @param   maxsoc          maximum SOC with resolution 0.01%
+ * @param   ResultValues    pointer where to store the results
+ *
+ * @return  void
+ */
+static void SOF_CalculateMapBased(int16_t mintemp, int16_t maxtemp, uint16_t minsoc, uint16_t maxsoc, SOX_SOF_s *ResultValues) {
+    uint16_t current[SOX_SOF_MAP_NR_OF];
+
+    SOF_MapCurrents(mintemp, maxtemp, minsoc, maxsoc, current);
+
+    ResultValues->current_Charge_cont_max = 0.1 * current[SOX_SOF_MAP_CHARGE_CONT];
+    ResultValues->current_Charge_peak_max = 0.1 * current[SOX_SOF_MAP_CHARGE_PEAK];
+    ResultValues->current_Discha_cont_max = 0.1 * current[SOX_SOF_MAP_DISCHA_CONT];
+    ResultValues->current_Discha_peak_max = 0.1 * current[SOX_SOF_MAP_DISCHA_PEAK];
+}
+
+/**
+ * @brief   looks up the currents of all current limit maps
+ *
+ * @param   mintemp     minimum temperature of cells in degC
+ * @param   maxtemp     maximum temperature of cells in degC
+ * @param   minsoc      minimum SOC with resolution 0.01%
+ * @param   maxsoc      maximum SOC with resolution 0.01%
+ * @param   current     pointer where to store the SOX_SOF_MAP_NR_OF currents in 0.1A
+ *
+ * @return  void
+ */
+static void SOF_MapCurrents(int16_t mintemp, int16_t maxtemp, uint16_t minsoc, uint16_t maxsoc, uint16_t *current) {
+    uint8_t itmin = 0;
+    uint8_t itmax = 0;
+    uint8_t ischarge = 0;
+    uint8_t isdischa = 0;
+    uint32_t wtmin = SOF_MapWeight(sox_sof_map.temperature, sox_sof_map.nr_temperature, sof_map_temperature_inv, mintemp, &itmin);
+    uint32_t wtmax = SOF_MapWeight(sox_sof_map.temperature, sox_sof_map.nr_temperature, sof_map_temperature_inv, maxtemp, &itmax);
+    uint32_t wscharge = SOF_MapWeight(sox_sof_map.soc, sox_sof_map.nr_soc, sof_map_soc_inv, maxsoc, &ischarge);
+    uint32_t wsdischa = SOF_MapWeight(sox_sof_map.soc, sox_sof_map.nr_soc, sof_map_soc_inv, minsoc, &isdischa);
+    uint16_t other = 0;
+    uint8_t map = 0;
+
+    for (map = 0; map < SOX_SOF_MAP_NR_OF; map++) {
+        if (map == SOX_SOF_MAP_CHARGE_CONT || map == SOX_SOF_MAP_CHARGE_PEAK) {
+            current[map] = SOF_MapInterpolate(map, itmin, wtmin, ischarge, wscharge);
+            other = SOF_MapInterpolate(map, itmax, wtmax, ischarge, wscharge);
+        } else {
+            current[map] = SOF_MapInterpolate(map, itmin, wtmin, isdischa, wsdischa);
+            other = SOF_MapInterpolate(map, itmax, wtmax, isdischa, wsdischa);
+        }
+        if (other < current[map]) {
+            current[map] = other;
+        }
+    }
+}
+
+/**
+ * @brief   calculates the reciprocals of the breakpoint distances of one axis of the current limit maps
+ *
+ * @param   axis    breakpoints, strictly increasing
+ * @param   nr      number of breakpoints
+ * @param   inv     pointer where to store the reciprocals in 2^31/distance
+ *
+ * @return  void
+ */
+static void SOF_MapInitAxis(const int16_t *axis, uint8_t nr, uint32_t *inv) {
+    uint8_t i = 0;
+    uint32_t distance = 0;
+
+    for (i = 0; (i + 1) < nr && i < SOX_SOF_MAP_MAX_POINTS; i++) {
+        if (axis[i + 1] > axis[i]) {
+            distance = (uint32_t)(axis[i + 1] - axis[i]);
+            inv[i] = (uint32_t)((((uint64_t)1uL << 31) + (distance / 2)) / distance);
+        } else {
+            inv[i] = 0;     // invalid axis, the lower breakpoint is used
+        }
+    }
+}
+
+/**
+ * @brief   looks up the interval of a value on one axis of the current limit maps
+ *
+ * Values outside of the axis are clamped to the first or last breakpoint.
+ *
+ * @param   axis    breakpoints, strictly increasing
+ * @param   nr      number of breakpoints
+ * @param   inv     reciprocals of the breakpoint distances (see SOF_MapInitAxis())
+ * @param   x       value to look up
+ * @param   index   pointer where to store the index of the lower breakpoint
+ *
+ * @return  weight of the upper breakpoint in Q15 (0..SOF_MAP_ONE)
+ */
+static uint32_t SOF_MapWeight(const int16_t *axis, uint8_t nr, const uint32_t *inv, int32_t x, uint8_t *index) {
+    uint8_t i = 0;
+    uint32_t weight = 0;
+
+    if (x <= axis[0]) {
+        *index = 0;
+        return 0;
+    }
+    if (x >= axis[nr - 1]) {
+        *index = nr - 2;
+        return SOF_MAP_ONE;
+    }
+    while (x >= axis[i + 1]) {
+        i++;
+    }
+    *index = i;
+    weight = ((uint32_t)(x - axis[i]) * inv[i]) >> 16;
+    if (weight > SOF_MAP_ONE) {
+        weight = SOF_MAP_ONE;
+    }
+    return weight;
+}
+
+/**
+ * @brief   bilinear interpolation in one of the current limit maps
+ *
+ * @param   map     current limit map
+ * @param   itemp   index of the lower temperature breakpoint
+ * @param   wtemp   weight of the upper temperature breakpoint in Q15
+ * @param   isoc    index of the lower SOC breakpoint
+ * @param   wsoc    weight of the upper SOC breakpoint in Q15
+ *
+ * @return  current in 0.1A
+ */
+static uint16_t SOF_MapInterpolate(SOX_SOF_MAP_e map, uint8_t itemp, uint32_t wtemp, uint8_t isoc, uint32_t wsoc) {
+    const uint16_t *low = &sox_sof_map.current[map][itemp * sox_sof_map.nr_soc + isoc];
+    const uint16_t *high = low + sox_sof_map.nr_soc;
+    uint32_t currentlow = (low[0] * (SOF_MAP_ONE - wsoc) + low[1] * wsoc + (SOF_MAP_ONE / 2)) >> 15;
+    uint32_t currenthigh = (high[0] * (SOF_MAP_ONE - wsoc) + high[1] * wsoc + (SOF_MAP_ONE / 2)) >> 15;
+
+    return (uint16_t)((currentlow * (SOF_MAP_ONE - wtemp) + currenthigh * wtemp + (SOF_MAP_ONE / 2)) >> 15);
+}
+
+/**
+ * @brief   calculates the SoF in fixed point
+ *
+ * Same limits as the floating-point SoF: the voltage ramps, and either the current limit maps
+ * or the SOC and temperature ramps.
+ *
+ * @param   maxtemp     maximum temperature of cells in degC
+ * @param   mintemp     minimum temperature of cells in degC
+ * @param   maxvolt     maximum cell voltage in mV
+ * @param   minvolt     minimum cell voltage in mV
+ * @param   maxsoc      maximum SOC with resolution 0.01%
+ * @param   minsoc      minimum SOC with resolution 0.01%
+ * @param   result      pointer where to store the currents in mA
+ *
+ * @return  void
+ */
+static void SOF_CalculateFixed(int16_t maxtemp, int16_t mintemp, uint16_t maxvolt, uint16_t minvolt, uint16_t maxsoc, uint16_t minsoc, SOF_FIXED_s *result) {
+    int32_t charge = SOF_Ramp(SOF_RAMP_VOLTAGE_CHARGE, maxvolt);
+    int32_t discha = SOF_Ramp(SOF_RAMP_VOLTAGE_DISCHA, minvolt);
+#if SOX_SOF_USE_MAPS == TRUE
+    uint16_t current[SOX_SOF_MAP_NR_OF];
+
+    SOF_MapCurrents(mintemp, maxtemp, minsoc, maxsoc, current);
+    result->charge_cont = SOF_MinimumFixed(charge, 100 * current[SOX_SOF_MAP_CHARGE_CONT]);
+    result->charge_peak = SOF_MinimumFixed(charge, 100 * current[SOX_SOF_MAP_CHARGE_PEAK]);
+    result->discha_cont = SOF_MinimumFixed(discha, 100 * current[SOX_SOF_MAP_DISCHA_CONT]);
+    result->discha_peak = SOF_MinimumFixed(discha, 100 * current[SOX_SOF_MAP_DISCHA_PEAK]);
+#else
+    charge = SOF_MinimumFixed(charge, SOF_Ramp(SOF_RAMP_SOC_CHARGE, maxsoc));
+    charge = SOF_MinimumFixed(charge, SOF_TemperatureFixed(SOF_RAMP_TLOW_CHARGE, SOF_RAMP_THIGH_CHARGE, mintemp, maxtemp));
+    discha = SOF_MinimumFixed(discha, SOF_Ramp(SOF_RAMP_SOC_DISCHA, minsoc));
+    discha = SOF_MinimumFixed(discha, SOF_TemperatureFixed(SOF_RAMP_TLOW_DISCHA, SOF_RAMP_THIGH_DISCHA, mintemp, maxtemp));
+    result->charge_cont = charge;
+    result->charge_peak = charge;
+    result->discha_cont = discha;
+    result->discha_peak = discha;
+#endif
+}
+
+/**
+ * @brief   converts one ramp of the SoF configuration to fixed point
+ *
+ * @param   ramp        ramp to initialize
+ * @param   limit       input where the current is at_limit
+ * @param   cutoff      input where the current reaches max
+ * @param   at_limit    current at the limit in A
+ * @param   max         current beyond the cutoff in A
+ *
+ * @return  void
+ */
+static void SOF_RampInit(SOF_RAMP_e ramp, float limit, float cutoff, float at_limit, float max) {
+    SOF_RAMP_s *r = &sof_ramp[ramp];
+
+    r->limit = (int32_t)limit;
+    r->cutoff = (int32_t)cutoff;
+    r->at_limit = (int32_t)(1000.0 * at_limit + 0.5);
+    r->max = (int32_t)(1000.0 * max + 0.5);
+    if (r->cutoff != r->limit) {
+        r->slope = ((int64_t)(r->max - r->at_limit) << 16) / (r->cutoff - r->limit);
+    } else {
+        r->slope = 0;
+    }
+}
+
+/**
+ * @brief   evaluates one ramp of the fixed-point SoF
+ *
+ * The ramp rises from the limit towards the cutoff, which lies above the limit for the lower
+ * limits (minimum voltage, SOC and temperature) and below it for the upper limits.
+ *
+ * @param   ramp    ramp to evaluate
+ * @param   x       input in mV, 0.01% SOC or degC
+ *
+ * @return  current in mA
+ */
+static int32_t SOF_Ramp(SOF_RAMP_e ramp, int32_t x) {
+    const SOF_RAMP_s *r = &sof_ramp[ramp];
+
+    if (r->cutoff > r->limit) {
+        if (x <= r->limit) {
+            return r->at_limit;
+        }
+        if (x > r->cutoff) {
+            return r->max;
+        }
+    } else {
+        if (x >= r->limit) {
+            return r->at_limit;
+        }
+        if (x < r->cutoff) {
+            return r->max;
+        }
+    }
+    return r->at_limit + (int32_t)((r->slope * (x - r->limit) + (1 << 15)) >> 16);
+}
+
+/**
+ * @brief   evaluates the temperature ramps of one direction of the fixed-point SoF
+ *
+ * Same result as the minimum of SOF_Ramp() over both ramps, but the orientation of the ramps
+ * is known: the cutoff of the low ramp lies above its limit and the cutoff of the high ramp
+ * below its limit. Both ramps end in the same maximum current, so between the cutoffs, i.e.,
+ * in normal operation, only two comparisons are evaluated.
+ *
+ * @param   low         ramp over the minimum temperature
+ * @param   high        ramp over the maximum temperature
+ * @param   mintemp     minimum temperature of cells in degC
+ * @param   maxtemp     maximum temperature of cells in degC
+ *
+ * @return  current in mA
+ */
+static int32_t SOF_TemperatureFixed(SOF_RAMP_e low, SOF_RAMP_e high, int32_t mintemp, int32_t maxtemp) {
+    const SOF_RAMP_s *l = &sof_ramp[low];
+    const SOF_RAMP_s *h = &sof_ramp[high];
+    int32_t current = l->max;
+    int32_t current_high = 0;
+
+    if (mintemp <= l->cutoff) {
+        if (mintemp <= l->limit) {
+            current = l->at_limit;
+        } else {
+            current = l->at_limit + (int32_t)((l->slope * (mintemp - l->limit) + (1 << 15)) >> 16);
+        }
+    }
+    if (maxtemp >= h->cutoff) {
+        if (maxtemp >= h->limit) {
+            current_high = h->at_limit;
+        } else {
+            current_high = h->at_limit + (int32_t)((h->slope * (maxtemp - h->limit) + (1 << 15)) >> 16);
+        }
+        current = SOF_MinimumFixed(current, current_high);
+    }
+    return current;
+}
+
+/**
+ * @brief   calculates the minimum of two fixed-point currents
+ *
+ * @param   value1
+ * @param   value2
+ *
+ * @return  minimum of the 2 parameters
+ */
+static int32_t SOF_MinimumFixed(int32_t value1, int32_t value2) {
+    return (value1 < value2) ? value1 : value2;
+}
+
 /**
  * @brief   get the minimum current values of all variants of SoF calculation
  *
@@ -606,11 +1856,11 @@ static void  SOF_CalculateTemperatureBased (float MinTemp,float MaxTemp, SOX_SOF
  *
  * @return  void
  */
-static void SOF_MinimumOfThreeSofValues(SOX_SOF_s Ubased, SOX_SOF_s Sbased, SOX_SOF_s Tbased, SOX_SOF_s *resultValues) {
-    resultValues->current_Charge_cont_max = SOF_MinimumOfThreeValues(Ubased.current_Charge_cont_max, Tbased.current_Charge_cont_max, Sbased.current_Charge_cont_max);
-    resultValues->current_Charge_peak_max = SOF_MinimumOfThreeValues(Ubased.current_Charge_peak_max, Tbased.current_Charge_peak_max, Sbased.current_Charge_peak_max);
-    resultValues->current_Discha_cont_max = SOF_MinimumOfThreeValues(Ubased.current_Discha_cont_max, Tbased.current_Discha_cont_max, Sbased.current_Discha_cont_max);
-    resultValues->current_Discha_peak_max = SOF_MinimumOfThreeValues(Ubased.current_Discha_peak_max, Tbased.current_Discha_peak_max, Sbased.current_Discha_peak_max);
+static void SOF_MinimumOfThreeSofValues(const SOX_SOF_s *Ubased, const SOX_SOF_s *Sbased, const SOX_SOF_s *Tbased, SOX_SOF_s *resultValues) {
+    resultValues->current_Charge_cont_max = SOF_MinimumOfThreeValues(Ubased->current_Charge_cont_max, Tbased->current_Charge_cont_max, Sbased->current_Charge_cont_max);
+    resultValues->current_Charge_peak_max = SOF_MinimumOfThreeValues(Ubased->current_Charge_peak_max, Tbased->current_Charge_peak_max, Sbased->current_Charge_peak_max);
+    resultValues->current_Discha_cont_max = SOF_MinimumOfThreeValues(Ubased->current_Discha_cont_max, Tbased->current_Discha_cont_max, Sbased->current_Discha_cont_max);
+    resultValues->current_Discha_peak_max = SOF_MinimumOfThreeValues(Ubased->current_Discha_peak_max, Tbased->current_Discha_peak_max, Sbased->current_Discha_peak_max);
 }
 
 /**
@@ -643,3 +1893,140 @@ static float SOF_MinimumOfThreeValues (float value1,float value2, float value3)
     return result;
 }
 
+
+void SOF_Benchmark(SOX_SOF_BENCHMARK_s *result) {
+    SOX_SOF_s SbasedSof = {0.0, 0.0, 0.0};
+    SOX_SOF_s TbasedSof = {0.0, 0.0, 0.0};
+    SOX_SOF_s RbasedSof = {0.0, 0.0, 0.0};
+    SOX_SOF_s MbasedSof = {0.0, 0.0, 0.0};
+    float deviation[4] = {0.0, 0.0, 0.0, 0.0};
+    uint32_t start = 0;
+    int16_t temp = 0;
+    uint16_t soc = 0;
+    uint8_t i = 0;
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    result->points = 0;
+    result->cycles_ramps = 0;
+    result->cycles_maps = 0;
+    result->max_deviation = 0.0;
+
+    for (temp = -20; temp <= 60; temp += 5) {
+        for (soc = 0; soc <= 10000; soc += 250) {
+            start = DWT->CYCCNT;
+            SOF_CalculateSocBased((float)soc, (float)soc, &SbasedSof);
+            SOF_CalculateTemperatureBased((float)temp, (float)temp, &TbasedSof);
+            SOF_MinimumOfThreeSofValues(&SbasedSof, &SbasedSof, &TbasedSof, &RbasedSof);
+            result->cycles_ramps += DWT->CYCCNT - start;
+
+            start = DWT->CYCCNT;
+            SOF_CalculateMapBased(temp, temp, soc, soc, &MbasedSof);
+            result->cycles_maps += DWT->CYCCNT - start;
+
+            deviation[0] = RbasedSof.current_Charge_cont_max - MbasedSof.current_Charge_cont_max;
+            deviation[1] = RbasedSof.current_Charge_peak_max - MbasedSof.current_Charge_peak_max;
+            deviation[2] = RbasedSof.current_Discha_cont_max - MbasedSof.current_Discha_cont_max;
+            deviation[3] = RbasedSof.current_Discha_peak_max - MbasedSof.current_Discha_peak_max;
+            for (i = 0; i < 4; i++) {
+                if (deviation[i] < 0.0) {
+                    deviation[i] = -deviation[i];
+                }
+                if (deviation[i] > result->max_deviation) {
+                    result->max_deviation = deviation[i];
+                }
+            }
+            result->points++;
+        }
+    }
+}
+
+
+void SOF_FixedPointCheck(SOX_SOF_FIXED_CHECK_s *result) {
+    SOX_SOF_s reference = {0.0, 0.0, 0.0};
+    int32_t charge = 0;
+    int32_t discha = 0;
+    uint32_t start = 0;
+    int16_t temp = 0;
+    uint16_t x = 0;
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    result->points = 0;
+    result->cycles_float = 0;
+    result->cycles_fixed = 0;
+    result->violations = 0;
+    result->max_deviation = 0.0;
+
+    for (x = 0; x <= 5000; x++) {
+        start = DWT->CYCCNT;
+        SOF_CalculateVoltageBased((float)x, (float)x, &reference);
+        result->cycles_float += DWT->CYCCNT - start;
+
+        start = DWT->CYCCNT;
+        charge = SOF_Ramp(SOF_RAMP_VOLTAGE_CHARGE, x);
+        discha = SOF_Ramp(SOF_RAMP_VOLTAGE_DISCHA, x);
+        result->cycles_fixed += DWT->CYCCNT - start;
+
+        SOF_FixedPointCompare(&reference, charge, discha, result);
+    }
+
+    for (x = 0; x <= 10000; x++) {
+        start = DWT->CYCCNT;
+        SOF_CalculateSocBased((float)x, (float)x, &reference);
+        result->cycles_float += DWT->CYCCNT - start;
+
+        start = DWT->CYCCNT;
+        charge = SOF_Ramp(SOF_RAMP_SOC_CHARGE, x);
+        discha = SOF_Ramp(SOF_RAMP_SOC_DISCHA, x);
+        result->cycles_fixed += DWT->CYCCNT - start;
+
+        SOF_FixedPointCompare(&reference, charge, discha, result);
+    }
+
+    for (temp = -128; temp <= 127; temp++) {
+        start = DWT->CYCCNT;
+        SOF_CalculateTemperatureBased((float)temp, (float)temp, &reference);
+        result->cycles_float += DWT->CYCCNT - start;
+
+        start = DWT->CYCCNT;
+        charge = SOF_TemperatureFixed(SOF_RAMP_TLOW_CHARGE, SOF_RAMP_THIGH_CHARGE, temp, temp);
+        discha = SOF_TemperatureFixed(SOF_RAMP_TLOW_DISCHA, SOF_RAMP_THIGH_DISCHA, temp, temp);
+        result->cycles_fixed += DWT->CYCCNT - start;
+
+        SOF_FixedPointCompare(&reference, charge, discha, result);
+    }
+}
+
+
+/**
+ * @brief   compares the fixed-point currents of one input value with the floating-point reference
+ *
+ * @param   reference   floating-point SoF, the continuous currents are compared
+ * @param   charge      fixed-point charge current in mA
+ * @param   discha      fixed-point discharge current in mA
+ * @param   result      check result to update
+ *
+ * @return  void
+ */
+static void SOF_FixedPointCompare(const SOX_SOF_s *reference, int32_t charge, int32_t discha, SOX_SOF_FIXED_CHECK_s *result) {
+    float deviation[2] = {0.0, 0.0};
+    uint8_t i = 0;
+
+    deviation[0] = reference->current_Charge_cont_max - 0.001 * charge;
+    deviation[1] = reference->current_Discha_cont_max - 0.001 * discha;
+    for (i = 0; i < 2; i++) {
+        if (deviation[i] < 0.0) {
+            deviation[i] = -deviation[i];
+        }
+        if (deviation[i] > result->max_deviation) {
+            result->max_deviation = deviation[i];
+        }
+        if (deviation[i] > SOX_SOF_FIXED_POINT_TOLERANCE) {
+            result->violations++;
+        }
+    }
+    result->points++;
+}
@@ -59,6 +59,40 @@ typedef struct {
     float current_Discha_peak_max;  /*!< maximum current for peak discharging       */
 } SOX_SOF_s;
 
+/**
+ * result of SOF_Benchmark(): execution time and deviation of the current limit maps compared to
+ * the piecewise-linear SOC and temperature ramps
+ */
+typedef struct {
+    uint32_t points;            /*!< number of evaluated operating points                       */
+    uint32_t cycles_ramps;      /*!< core clock cycles of the float ramps for all points        */
+    uint32_t cycles_maps;       /*!< core clock cycles of the fixed-point maps for all points   */
+    float max_deviation;        /*!< largest difference of the two results in A                 */
+} SOX_SOF_BENCHMARK_s;
+
+/**
+ * result of SOF_FixedPointCheck(): execution time and deviation of the fixed-point SOF compared
+ * to the floating-point SOF
+ */
+typedef struct {
+    uint32_t points;            /*!< number of evaluated input values                           */
+    uint32_t cycles_float;      /*!< core clock cycles of the floating-point SOF for all points */
+    uint32_t cycles_fixed;      /*!< core clock cycles of the fixed-point SOF for all points    */
+    uint32_t violations;        /*!< points deviating more than SOX_SOF_FIXED_POINT_TOLERANCE   */
+    float max_deviation;        /*!< largest difference of the two results in A                 */
+} SOX_SOF_FIXED_CHECK_s;
+
+/**
+ * result of SOC_OcvBenchmark(): execution time and deviation of the binary search in the open
+ * circuit voltage table compared to a linear search in floating point
+ */
+typedef struct {
+    uint32_t points;            /*!< number of evaluated operating points                       */
+    uint32_t cycles_linear;     /*!< core clock cycles of the linear search for all points      */
+    uint32_t cycles_binary;     /*!< core clock cycles of the binary search for all points      */
+    float max_deviation;        /*!< largest difference of the two results in %                 */
+} SOX_OCV_BENCHMARK_s;
+
 /**
  * state of charge (SOC). Since SOC is voltage dependent, three different values are used, min, max and mean
  * SOC defined as a float number between 0.0 and 100.0 (0% and 100%)
@@ -101,6 +135,10 @@ extern void SOC_SetValue(float soc_value_min, float soc_value_max, float soc_val
 /**
  * @brief   initializes the SOC values with lookup table (mean, min and max).
  *
+ * The open circuit voltage table of the cell chemistry (see sox_ocv_cfg.c) is looked up with the
+ * minimum, maximum and mean cell voltage at the mean cell temperature. Called by SOC_Init() if no
+ * valid SOC is stored and by SOC_Ctrl() after a rest period of SOX_SOC_REST_TIME_MS.
+ *
  * @return  void
  */
 extern void SOC_Set_Lookup_Table(void);
@@ -108,10 +146,41 @@ extern void SOC_Set_Lookup_Table(void);
 /**
  * @brief   integrates current over time to calculate SOC.
  *
+ * With SOX_SOC_EKF, the SOC is estimated with extended Kalman filters (see sox_ekf.h) instead and
+ * the variances of the estimates are published in DATA_BLOCK_SOX_s.
+ *
+ * After the current has been below SOX_SOC_INIT_CURRENT_LIMIT for SOX_SOC_REST_TIME_MS, the SOC is
+ * recalibrated once from the open circuit voltage.
+ *
  * @return  void
  */
 extern void SOC_Ctrl(void);
 
+/**
+ * @brief   sets the capacity of a cell used for the SOC of each cell
+ *
+ * All cells start with SOX_CELL_CAPACITY. Only available with SOX_SOC_PER_CELL.
+ *
+ * @param   cell        index of the cell
+ * @param   capacity    capacity of the cell in mAh
+ *
+ * @return  void
+ */
+extern void SOC_SetCellCapacity(uint16_t cell, float capacity);
+
+/**
+ * @brief   look-up table for SOC initialization (mean, min and max).
+ *
+ * The SOC is searched in the two rows of the open circuit voltage table next to the temperature
+ * and interpolated linearly between them. Temperatures outside of the table are clamped.
+ *
+ * @param   voltage         open circuit voltage of battery cell in mV
+ * @param   temperature     temperature of battery cell in degC
+ *
+ * @return  SOC value between 0.0 and 100.0
+ */
+extern float SOC_GetFromVoltage(uint16_t voltage, int16_t temperature);
+
 /**
  * @brief   initializes the area for SOF (where derating starts and is fully active).
  *
@@ -127,12 +196,75 @@ extern void SOF_Init(void);
 /**
  * @brief   triggers SOF calculation
  *
- * Calculation made with the function SOF_Calculate().
+ * Calculation made with the function SOF_Calculate(). The resulting current
+ * limits are scaled with the factors of the derating manager.
  *
  * @return  void
  */
 extern void SOF_Ctrl(void);
 
+/**
+ * @brief   integrates the open circuit voltage table for the SOE
+ *
+ * The energy per capacity from 0% SOC up to each SOC breakpoint is calculated once for every
+ * temperature row, so that SOE_Ctrl() only has to interpolate in this table.
+ *
+ * @return  void
+ */
+extern void SOE_Init(void);
+
+/**
+ * @brief   calculates the SOE and the available energies, every SOX_SOE_PERIOD_MS
+ *
+ * The cells are connected in series, so the charge that can be discharged (charged) is limited by
+ * the cell that reaches SOX_SOE_SOC_MIN (SOX_SOE_SOC_MAX) first. For each cell, the open circuit
+ * voltage is integrated over the SOC window this charge moves it through, using its capacity from
+ * the SOH. The available energies at the terminals subtract (add) the losses in the cell
+ * resistances at the filtered current, at least SOX_SOE_DISCHARGE_CURRENT
+ * (SOX_SOE_CHARGE_CURRENT). Must be called after SOC_Ctrl().
+ *
+ * @return  void
+ */
+extern void SOE_Ctrl(void);
+
+/**
+ * @brief   compares the current limit maps with the piecewise-linear SOC and temperature ramps
+ *
+ * Both variants are evaluated on a grid of operating points from -20degC to 60degC and 0% to 100%
+ * SOC. The execution time is measured with the cycle counter of the core.
+ *
+ * @param   result  pointer where to store the benchmark result
+ *
+ * @return  void
+ */
+extern void SOF_Benchmark(SOX_SOF_BENCHMARK_s *result);
+
+/**
+ * @brief   compares the fixed-point SOF with the floating-point SOF
+ *
+ * Every voltage from 0mV to 5000mV, every SOC from 0% to 100% in steps of 0.01% and every
+ * temperature from -128degC to 127degC is evaluated. The SOF is the minimum of independent ramps
+ * of these inputs, so this covers the complete input space of each ramp. The execution time is
+ * measured with the cycle counter of the core.
+ *
+ * @param   result  pointer where to store the check result
+ *
+ * @return  void
+ */
+extern void SOF_FixedPointCheck(SOX_SOF_FIXED_CHECK_s *result);
+
+/**
+ * @brief   compares the binary search in the open circuit voltage table with a linear search
+ *
+ * Both variants are evaluated on a grid of operating points from -20degC to 60degC and over the
+ * voltage range of the table. The execution time is measured with the cycle counter of the core.
+ *
+ * @param   result  pointer where to store the benchmark result
+ *
+ * @return  void
+ */
+extern void SOC_OcvBenchmark(SOX_OCV_BENCHMARK_s *result);
+
 /*================== Function Implementations =============================*/
 
 #endif /* SOX_H_ */
@@ -0,0 +1,115 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    sox_cc.c
+ * @author  foxBMS Team
+ * @date    18.10.2026 (date of creation)
+ * @ingroup APPLICATION
+ * @prefix  SOC
+ *
+ * @brief   Coulomb counter of the current sensor samples
+ *
+ */
+
+/*================== Includes =============================================*/
+#include "general.h"
+#include "sox_cc.h"
+
+#include "batterysystem_cfg.h"
+#include "mcu_cfg.h"
+#include "os.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/**
+ * state of the coulomb counter
+ */
+typedef struct {
+    uint8_t started;                /*!< TRUE after the first sample                                        */
+    int32_t previous_current;       /*!< current of the last sample in mA, positive when discharging        */
+    uint32_t previous_cycles;       /*!< cycle counter at the last sample                                   */
+    int64_t remainder_charge;       /*!< charge not yet counted in 2*mA*cycles                              */
+    uint32_t remainder_time;        /*!< time not yet counted in cycles                                     */
+    SOX_CC_s counters;              /*!< published counters                                                 */
+} SOX_CC_STATE_s;
+
+/*================== Constant and Variable Definitions ====================*/
+static SOX_CC_STATE_s soc_cc = {
+    .started            = FALSE,
+    .previous_current   = 0,
+    .previous_cycles    = 0,
+    .remainder_charge   = 0,
+    .remainder_time     = 0,
+};
+
+/*================== Function Prototypes ==================================*/
+
+/*================== Function Implementations =============================*/
+
+void SOC_CcAddSample(int32_t current) {
+    uint32_t cycles = DWT->CYCCNT;
+    uint32_t cycles_per_us = SystemCoreClock / 1000000;
+    uint32_t elapsed = 0;
+    int64_t area = 0;
+    int64_t charge = 0;
+
+    if (POSITIVE_DISCHARGE_CURRENT == FALSE) {
+        current = -current;
+    }
+
+    OS_TaskEnter_Critical();
+    // the unsigned difference is correct across one wrap around of the cycle counter
+    elapsed = cycles - soc_cc.previous_cycles;
+    if (soc_cc.started == FALSE) {
+        soc_cc.started = TRUE;
+    } else if (elapsed > SOX_CC_MAX_SAMPLE_GAP_MS * 1000uL * cycles_per_us) {
+        soc_cc.counters.gaps++;
+    } else {
+        // trapezoidal rule: (I1 + I2) * elapsed is twice the charge in mA*cycles, 2000 * cycles_per_us of it are 1 uAs
+        area = ((int64_t)soc_cc.previous_current + current) * elapsed + soc_cc.remainder_charge;
+        charge = area / (2000 * (int64_t)cycles_per_us);
+        soc_cc.remainder_charge = area - charge * (2000 * (int64_t)cycles_per_us);
+
+        soc_cc.counters.charge += charge;
+        if (charge >= 0) {
+            soc_cc.counters.throughput_discharge += (uint64_t)charge;
+        } else {
+            soc_cc.counters.throughput_charge += (uint64_t)(-charge);
+        }
+
+        soc_cc.remainder_time += elapsed;
+        soc_cc.counters.time += soc_cc.remainder_time / cycles_per_us;
+        soc_cc.remainder_time %= cycles_per_us;
+    }
+    soc_cc.previous_cycles = cycles;
+    soc_cc.previous_current = current;
+    soc_cc.counters.samples++;
+    OS_TaskExit_Critical();
+}
+
+
+void SOC_CcGetCounters(SOX_CC_s *counters) {
+    OS_TaskEnter_Critical();
+    *counters = soc_cc.counters;
+    OS_TaskExit_Critical();
+}
@@ -0,0 +1,85 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    sox_cc.h
+ * @author  foxBMS Team
+ * @date    18.10.2026 (date of creation)
+ * @ingroup APPLICATION
+ * @prefix  SOC
+ *
+ * @brief   Coulomb counter of the current sensor samples
+ *
+ * Every current sample is integrated in the context that receives it, so no
+ * sample is lost between two calls of SOC_Ctrl(). The charge is accumulated
+ * in 64-bit fixed point in uAs (= mA*ms) with the trapezoidal rule. The time
+ * base is the cycle counter of the core, the remainders of all divisions are
+ * carried to the next sample, so neither the charge nor the time drift.
+ */
+
+#ifndef SOX_CC_H_
+#define SOX_CC_H_
+
+/*================== Includes =============================================*/
+#include "sox_cfg.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/**
+ * counters of the coulomb counter, all charges positive when discharging
+ */
+typedef struct {
+    int64_t charge;                     /*!< net charge since startup, unit: uAs                        */
+    uint64_t throughput_discharge;      /*!< discharged charge since startup, unit: uAs                 */
+    uint64_t throughput_charge;         /*!< charged charge since startup, unit: uAs                    */
+    uint64_t time;                      /*!< integrated time since startup, gaps excluded, unit: us     */
+    uint32_t samples;                   /*!< number of current samples                                  */
+    uint32_t gaps;                      /*!< gaps longer than SOX_CC_MAX_SAMPLE_GAP_MS                  */
+} SOX_CC_s;
+
+/*================== Constant and Variable Definitions ====================*/
+
+/*================== Function Prototypes ==================================*/
+
+/**
+ * @brief   integrates a new current sample
+ *
+ * @details Must be called in the context that receives the current sample, e.g., the CAN RX
+ *          processing of the current sensor. The cycle counter is started by FFR_Init().
+ *
+ * @param   current     current in mA, sign as delivered by the current sensor
+ */
+extern void SOC_CcAddSample(int32_t current);
+
+/**
+ * @brief   copies the counters of the coulomb counter
+ *
+ * @details Charge and time of an interval are the differences of two copies, the mean current
+ *          in A is the charge divided by the time.
+ *
+ * @param   counters    pointer where the counters are copied to
+ */
+extern void SOC_CcGetCounters(SOX_CC_s *counters);
+
+/*================== Function Implementations =============================*/
+
+#endif /* SOX_CC_H_ */
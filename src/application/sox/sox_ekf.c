@@ -0,0 +1,230 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    sox_ekf.c
+ * @author  foxBMS Team
+ * @date    18.10.2026 (date of creation)
+ * @ingroup APPLICATION
+ * @prefix  SOC
+ *
+ * @brief   Extended Kalman filter for the SOC estimation
+ *
+ */
+
+/*================== Includes =============================================*/
+#include "general.h"
+#include "sox_ekf.h"
+
+/*================== Macros and Definitions ===============================*/
+/**
+ * change of the SOC (0.0..1.0) per A and s
+ */
+#define SOX_EKF_SOC_PER_AS      (1.0f / (3.6f * (float)SOX_CELL_CAPACITY))
+
+/*================== Constant and Variable Definitions ====================*/
+/**
+ * process noise of the states per second
+ */
+static const float sox_ekf_q[SOX_EKF_NR_OF_STATES] = { SOX_EKF_Q_SOC, SOX_EKF_Q_RC, SOX_EKF_Q_RC };
+
+/**
+ * resistances of the RC elements in Ohm, the SOC has none
+ */
+static const float sox_ekf_r[SOX_EKF_NR_OF_STATES] = { 0.0f, SOX_EKF_R1, SOX_EKF_R2 };
+
+/*================== Function Prototypes ==================================*/
+static float SOC_EkfOcvRow(const uint16_t *row, uint8_t index, float x, float *slope);
+
+/*================== Function Implementations =============================*/
+
+void SOC_EkfInit(SOX_EKF_s *ekf, float soc) {
+    uint8_t i = 0;
+    uint8_t j = 0;
+
+    if (soc < 0.0f) {
+        soc = 0.0f;
+    } else if (soc > 100.0f) {
+        soc = 100.0f;
+    }
+
+    for (i = 0; i < SOX_EKF_NR_OF_STATES; i++) {
+        ekf->x[i] = 0.0f;
+        ekf->decay[i] = 1.0f;
+        for (j = 0; j < SOX_EKF_NR_OF_STATES; j++) {
+            ekf->P[i][j] = 0.0f;
+        }
+    }
+    ekf->x[0] = 0.01f * soc;
+    ekf->P[0][0] = SOX_EKF_P0_SOC;
+    ekf->P[1][1] = SOX_EKF_Q_RC;
+    ekf->P[2][2] = SOX_EKF_Q_RC;
+    ekf->dt = 0.0f;
+}
+
+void SOC_EkfUpdate(SOX_EKF_s *ekf, float current, float voltage, int16_t temperature, float dt) {
+    float H[SOX_EKF_NR_OF_STATES] = { 0.0f, -1.0f, -1.0f };
+    float PHt[SOX_EKF_NR_OF_STATES];
+    float innovation = 0.0f;
+    float S = SOX_EKF_R_VOLTAGE;
+    float K = 0.0f;
+    uint8_t i = 0;
+    uint8_t j = 0;
+
+    if (dt <= 0.0f) {
+        return;
+    }
+    // the decay factors only change with the time step, the measurement period is usually constant
+    if (dt != ekf->dt) {
+        ekf->decay[0] = 1.0f;
+        ekf->decay[1] = SOC_EkfDecay(dt / SOX_EKF_TAU1);
+        ekf->decay[2] = SOC_EkfDecay(dt / SOX_EKF_TAU2);
+        ekf->dt = dt;
+    }
+
+    // prediction, the Jacobian of the state transition is diagonal
+    ekf->x[0] -= SOX_EKF_SOC_PER_AS * current * dt;
+    for (i = 1; i < SOX_EKF_NR_OF_STATES; i++) {
+        ekf->x[i] = ekf->decay[i] * ekf->x[i] + sox_ekf_r[i] * (1.0f - ekf->decay[i]) * current;
+    }
+    for (i = 0; i < SOX_EKF_NR_OF_STATES; i++) {
+        for (j = i; j < SOX_EKF_NR_OF_STATES; j++) {
+            ekf->P[i][j] *= ekf->decay[i] * ekf->decay[j];
+        }
+        ekf->P[i][i] += sox_ekf_q[i] * dt;
+    }
+
+    // correction with the cell voltage, H = [dOCV/dSOC, -1, -1]
+    innovation = voltage - (SOC_GetOcv(ekf->x[0], temperature, &H[0]) - ekf->x[1] - ekf->x[2] - SOX_EKF_R0 * current);
+    for (i = 0; i < SOX_EKF_NR_OF_STATES; i++) {
+        PHt[i] = 0.0f;
+        for (j = 0; j < SOX_EKF_NR_OF_STATES; j++) {
+            // only the upper triangle of the symmetric covariance is kept up to date
+            PHt[i] += ((i <= j) ? ekf->P[i][j] : ekf->P[j][i]) * H[j];
+        }
+        S += H[i] * PHt[i];
+    }
+    S = 1.0f / S;
+    for (i = 0; i < SOX_EKF_NR_OF_STATES; i++) {
+        K = PHt[i] * S;
+        ekf->x[i] += K * innovation;
+        for (j = i; j < SOX_EKF_NR_OF_STATES; j++) {
+            ekf->P[i][j] -= K * PHt[j];
+        }
+    }
+    for (i = 1; i < SOX_EKF_NR_OF_STATES; i++) {
+        for (j = 0; j < i; j++) {
+            ekf->P[i][j] = ekf->P[j][i];
+        }
+    }
+
+    if (ekf->x[0] < 0.0f) {
+        ekf->x[0] = 0.0f;
+    } else if (ekf->x[0] > 1.0f) {
+        ekf->x[0] = 1.0f;
+    }
+}
+
+float SOC_EkfGetSoc(const SOX_EKF_s *ekf) {
+    return 100.0f * ekf->x[0];
+}
+
+float SOC_EkfGetVariance(const SOX_EKF_s *ekf) {
+    return 10000.0f * ekf->P[0][0];
+}
+
+float SOC_EkfDecay(float x) {
+    float decay = 0.0f;
+    uint8_t n = 0;
+
+    if (x > 50.0f) {
+        return 0.0f;
+    }
+    while (x > 0.0625f) {
+        x *= 0.5f;
+        n++;
+    }
+    // (2,2) Pade approximation
+    decay = (12.0f - 6.0f * x + x * x) / (12.0f + 6.0f * x + x * x);
+    while (n > 0) {
+        decay *= decay;
+        n--;
+    }
+    return decay;
+}
+
+float SOC_GetOcv(float soc, int16_t temperature, float *slope) {
+    const int16_t *axis = sox_ocv_table.temperature;
+    uint8_t nr = sox_ocv_table.nr_temperature;
+    float x = 10000.0f * soc;
+    float weight = 0.0f;
+    float voltage = 0.0f;
+    float slopehigh = 0.0f;
+    uint8_t low = 0;
+    uint8_t high = sox_ocv_table.nr_soc - 1;
+    uint8_t mid = 0;
+    uint8_t i = 0;
+
+    while ((high - low) > 1) {
+        mid = (low + high) / 2;
+        if (x < sox_ocv_table.soc[mid]) {
+            high = mid;
+        } else {
+            low = mid;
+        }
+    }
+
+    if (temperature <= axis[0]) {
+        return SOC_EkfOcvRow(&sox_ocv_table.voltage[0], low, x, slope);
+    }
+    if (temperature >= axis[nr - 1]) {
+        return SOC_EkfOcvRow(&sox_ocv_table.voltage[(nr - 1) * sox_ocv_table.nr_soc], low, x, slope);
+    }
+    while (temperature >= axis[i + 1]) {
+        i++;
+    }
+    weight = (float)(temperature - axis[i]) / (float)(axis[i + 1] - axis[i]);
+    voltage = SOC_EkfOcvRow(&sox_ocv_table.voltage[i * sox_ocv_table.nr_soc], low, x, slope);
+    voltage += weight * (SOC_EkfOcvRow(&sox_ocv_table.voltage[(i + 1) * sox_ocv_table.nr_soc], low, x, &slopehigh) - voltage);
+    *slope += weight * (slopehigh - *slope);
+
+    return voltage;
+}
+
+/**
+ * @brief   linear interpolation of the open circuit voltage in one row of sox_ocv_table
+ *
+ * @param   row     open circuit voltages of one temperature breakpoint in mV
+ * @param   index   index of the lower SOC breakpoint of the interval
+ * @param   x       SOC with resolution 0.01%
+ * @param   slope   pointer where to store dOCV/dSOC in V
+ *
+ * @return  open circuit voltage in V
+ */
+static float SOC_EkfOcvRow(const uint16_t *row, uint8_t index, float x, float *slope) {
+    const int16_t *soc = &sox_ocv_table.soc[index];
+
+    // mV per 0.01% is 10V per SOC of 1.0
+    *slope = 10.0f * (float)(row[index + 1] - row[index]) / (float)(soc[1] - soc[0]);
+
+    return 0.001f * (float)row[index] + 0.0001f * (*slope) * (x - (float)soc[0]);
+}
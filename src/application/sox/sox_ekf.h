@@ -0,0 +1,132 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    sox_ekf.h
+ * @author  foxBMS Team
+ * @date    18.10.2026 (date of creation)
+ * @ingroup APPLICATION
+ * @prefix  SOC
+ *
+ * @brief   Extended Kalman filter for the SOC estimation
+ *
+ * The cell is modelled as a Thevenin equivalent circuit: the open circuit
+ * voltage of sox_ocv_table, the ohmic resistance SOX_EKF_R0 and two RC
+ * elements (SOX_EKF_R1/SOX_EKF_TAU1, SOX_EKF_R2/SOX_EKF_TAU2). The state is
+ * the SOC and the voltages over the RC elements, the measurement is the cell
+ * voltage. The filter is implemented in single precision for the FPU of the
+ * Cortex-M4, a single update takes no matrix inversion.
+ */
+
+#ifndef SOX_EKF_H_
+#define SOX_EKF_H_
+
+/*================== Includes =============================================*/
+#include "sox_cfg.h"
+
+/*================== Macros and Definitions ===============================*/
+/**
+ * number of states of the filter: SOC and the voltages over the two RC elements
+ */
+#define SOX_EKF_NR_OF_STATES    3
+
+/**
+ * state of one extended Kalman filter
+ */
+typedef struct {
+    float x[SOX_EKF_NR_OF_STATES];                          /*!< SOC (0.0..1.0) and voltages over the RC elements in V  */
+    float P[SOX_EKF_NR_OF_STATES][SOX_EKF_NR_OF_STATES];    /*!< covariance of the state                                */
+    float dt;                                               /*!< time step the decay factors were calculated for in s   */
+    float decay[SOX_EKF_NR_OF_STATES];                      /*!< decay factors of the states over dt                    */
+} SOX_EKF_s;
+
+/*================== Constant and Variable Definitions ====================*/
+
+/*================== Function Prototypes ==================================*/
+
+/**
+ * @brief   sets the SOC of a filter and resets the voltages over the RC elements and the covariance
+ *
+ * @param   ekf     filter to initialize
+ * @param   soc     SOC between 0.0 and 100.0
+ */
+extern void SOC_EkfInit(SOX_EKF_s *ekf, float soc);
+
+/**
+ * @brief   predicts the state over one time step and corrects it with the measured cell voltage
+ *
+ * @param   ekf             filter to update
+ * @param   current         cell current in A, positive when discharging
+ * @param   voltage         measured cell voltage in V
+ * @param   temperature     cell temperature in degC
+ * @param   dt              time since the last update in s
+ */
+extern void SOC_EkfUpdate(SOX_EKF_s *ekf, float current, float voltage, int16_t temperature, float dt);
+
+/**
+ * @brief   gets the SOC estimated by a filter
+ *
+ * @param   ekf     filter
+ *
+ * @return  SOC between 0.0 and 100.0
+ */
+extern float SOC_EkfGetSoc(const SOX_EKF_s *ekf);
+
+/**
+ * @brief   gets the variance of the SOC estimated by a filter
+ *
+ * @param   ekf     filter
+ *
+ * @return  variance of the SOC in %^2
+ */
+extern float SOC_EkfGetVariance(const SOX_EKF_s *ekf);
+
+/**
+ * @brief   open circuit voltage and its derivative with respect to the SOC
+ *
+ * Inverse of the SOC lookup in sox.c: the SOC interval is searched with a binary search and the
+ * voltage is interpolated linearly between the SOC and temperature breakpoints of sox_ocv_table.
+ * Outside of the table, the slope of the first or last interval is used.
+ *
+ * @param   soc             SOC between 0.0 and 1.0
+ * @param   temperature     cell temperature in degC
+ * @param   slope           pointer where to store dOCV/dSOC in V
+ *
+ * @return  open circuit voltage in V
+ */
+extern float SOC_GetOcv(float soc, int16_t temperature, float *slope);
+
+/**
+ * @brief   calculates exp(-x) for the decay of the RC elements
+ *
+ * x is halved until it is small, the Pade approximation of exp(-x) is squared back. The relative
+ * error is below 1e-5 for x <= 5 and below 1e-3 up to x = 50, no math library is needed.
+ *
+ * @param   x   time step divided by the time constant, x >= 0
+ *
+ * @return  exp(-x)
+ */
+extern float SOC_EkfDecay(float x);
+
+/*================== Function Implementations =============================*/
+
+#endif /* SOX_EKF_H_ */
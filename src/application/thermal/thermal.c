@@ -0,0 +1,341 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    thermal.c
+ * @author  foxBMS Team
+ * @date    18.10.2026 (date of creation)
+ * @ingroup APPLICATION
+ * @prefix  THM
+ *
+ * @brief   Lumped thermal model of the modules
+ *
+ * The module temperatures are integrated with an explicit Euler step. The
+ * conductances are small compared to THM_MODULE_HEAT_CAPACITY / time step, so
+ * the step is stable. The prediction assumes that the filtered losses and the
+ * neighbour temperatures stay constant over the horizon, the module then
+ * approaches its steady state temperature exponentially. The decay factor of
+ * this exponential only depends on the configuration and is calculated once in
+ * THM_Init().
+ */
+
+/*================== Includes =============================================*/
+#include "general.h"
+#include "thermal.h"
+
+#include "database.h"
+#include "batterysystem_cfg.h"
+#include "soh_cfg.h"
+#include "sox_ekf.h"
+#include "mcu_cfg.h"
+#include "os.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/**
+ * time step of the model in s
+ */
+#define THM_DT                  ((float)THM_CYCLE_TIME_MS / 1000.0f)
+
+/**
+ * temperature rise from the surface to the core of a cell per W of module losses in K/W
+ */
+#define THM_CORE_FACTOR         (THM_CELL_CORE_RESISTANCE / BS_NR_OF_BAT_CELLS_PER_MODULE)
+
+/*================== Constant and Variable Definitions ====================*/
+static float thm_temperature[BS_NR_OF_MODULES];     /* modelled surface temperature in degC */
+static float thm_resistance[BS_NR_OF_MODULES];      /* resistance of the cells of each module in Ohm */
+static float thm_inv_conductance[BS_NR_OF_MODULES]; /* 1 / total conductance of each module in K/W */
+static float thm_decay[BS_NR_OF_MODULES];           /* decay towards steady state over the horizon */
+static uint8_t thm_debounce[BS_NR_OF_TEMP_SENSORS];
+static uint16_t thm_implausible[BS_NR_OF_MODULES];
+static float thm_current_squared = 0.0f;            /* filtered squared current in A^2 */
+static float thm_coolant = THM_COOLANT_TEMPERATURE;
+static uint32_t thm_soh_timestamp = 0;
+static uint32_t thm_runtime_max_us = 0;
+static uint32_t thm_budget_violations = 0;
+static uint8_t thm_started = FALSE;
+
+/*================== Function Prototypes ==================================*/
+static void THM_UpdateResistance(void);
+static void THM_Start(const DATA_BLOCK_CELLTEMPERATURE_s *celltemp);
+static float THM_CorrectModule(uint16_t module, float temperature, const DATA_BLOCK_CELLTEMPERATURE_s *celltemp);
+
+/*================== Function Implementations =============================*/
+
+void THM_Init(void) {
+    float conductance = 0.0f;
+    uint16_t m = 0;
+    uint16_t s = 0;
+
+    for (m = 0; m < BS_NR_OF_MODULES; m++) {
+        conductance = THM_CONDUCTANCE_COOLANT;
+        if (m > 0) {
+            conductance += THM_CONDUCTANCE_NEIGHBOUR;
+        }
+        if ((m + 1) < BS_NR_OF_MODULES) {
+            conductance += THM_CONDUCTANCE_NEIGHBOUR;
+        }
+        thm_inv_conductance[m] = 1.0f / conductance;
+        thm_decay[m] = SOC_EkfDecay(THM_PREDICTION_HORIZON_S * conductance / THM_MODULE_HEAT_CAPACITY);
+        thm_resistance[m] = BS_NR_OF_BAT_CELLS_PER_MODULE * SOH_RESISTANCE_BOL / 1000.0f;
+        thm_temperature[m] = thm_coolant;
+        thm_implausible[m] = 0;
+    }
+    for (s = 0; s < BS_NR_OF_TEMP_SENSORS; s++) {
+        thm_debounce[s] = 0;
+    }
+    thm_current_squared = 0.0f;
+    thm_soh_timestamp = 0;
+    thm_runtime_max_us = 0;
+    thm_budget_violations = 0;
+    thm_started = FALSE;
+}
+
+
+void THM_Trigger(void) {
+    static DATA_BLOCK_CELLTEMPERATURE_s celltemp_tab;
+    static DATA_BLOCK_THERMAL_s thermal_tab;
+    DATA_BLOCK_CURRENT_s curr_tab;
+    float previous[BS_NR_OF_MODULES];
+    float current = 0.0f;
+    float current_squared = 0.0f;
+    float losses = 0.0f;
+    float flux = 0.0f;
+    float neighbours = 0.0f;
+    float steady = 0.0f;
+    uint32_t start = DWT->CYCCNT;
+    uint32_t runtime = 0;
+    uint16_t implausible = 0;
+    uint16_t m = 0;
+
+    DB_ReadBlock(&curr_tab, DATA_BLOCK_ID_CURRENT);
+    DB_ReadBlock(&celltemp_tab, DATA_BLOCK_ID_CELLTEMPERATURE);
+
+    if (celltemp_tab.timestamp == 0) {
+        return;     // no measurement yet
+    }
+    if (thm_started == FALSE) {
+        THM_Start(&celltemp_tab);
+    }
+    THM_UpdateResistance();
+
+    current = curr_tab.current / 1000.0f;       // mA -> A
+    current_squared = current * current;
+    thm_current_squared += (current_squared - thm_current_squared) * (THM_DT / THM_CURRENT_FILTER_S);
+
+    for (m = 0; m < BS_NR_OF_MODULES; m++) {
+        previous[m] = thm_temperature[m];
+    }
+
+    thermal_tab.temperature_core_max = -1000.0f;
+    thermal_tab.temperature_predicted_max = -1000.0f;
+    thermal_tab.module_number_max = 0;
+    thermal_tab.nr_implausible_sensors = 0;
+
+    for (m = 0; m < BS_NR_OF_MODULES; m++) {
+        // heat balance over one time step
+        losses = current_squared * thm_resistance[m];
+        flux = losses + THM_CONDUCTANCE_COOLANT * (thm_coolant - previous[m]);
+        neighbours = 0.0f;
+        if (m > 0) {
+            flux += THM_CONDUCTANCE_NEIGHBOUR * (previous[m - 1] - previous[m]);
+            neighbours += previous[m - 1];
+        }
+        if ((m + 1) < BS_NR_OF_MODULES) {
+            flux += THM_CONDUCTANCE_NEIGHBOUR * (previous[m + 1] - previous[m]);
+            neighbours += previous[m + 1];
+        }
+        thm_temperature[m] = THM_CorrectModule(m, previous[m] + flux * (THM_DT / THM_MODULE_HEAT_CAPACITY), &celltemp_tab);
+
+        thermal_tab.temperature[m] = thm_temperature[m];
+        thermal_tab.temperature_core[m] = thm_temperature[m] + losses * THM_CORE_FACTOR;
+
+        // constant filtered losses and neighbour temperatures over the horizon
+        losses = thm_current_squared * thm_resistance[m];
+        steady = (losses + THM_CONDUCTANCE_COOLANT * thm_coolant + THM_CONDUCTANCE_NEIGHBOUR * neighbours) *
+                 thm_inv_conductance[m];
+        thermal_tab.temperature_predicted[m] = steady + (thm_temperature[m] - steady) * thm_decay[m] +
+                                               losses * THM_CORE_FACTOR;
+
+        thermal_tab.implausible_sensors[m] = thm_implausible[m];
+        for (implausible = thm_implausible[m]; implausible != 0; implausible &= implausible - 1) {
+            thermal_tab.nr_implausible_sensors++;
+        }
+        if (thermal_tab.temperature_core[m] > thermal_tab.temperature_core_max) {
+            thermal_tab.temperature_core_max = thermal_tab.temperature_core[m];
+        }
+        if (thermal_tab.temperature_predicted[m] > thermal_tab.temperature_predicted_max) {
+            thermal_tab.temperature_predicted_max = thermal_tab.temperature_predicted[m];
+            thermal_tab.module_number_max = m;
+        }
+    }
+
+    runtime = (DWT->CYCCNT - start) / (SystemCoreClock / 1000000);
+    if (runtime > thm_runtime_max_us) {
+        thm_runtime_max_us = runtime;
+    }
+    if (runtime > THM_CYCLE_BUDGET_US) {
+        thm_budget_violations++;
+    }
+    thermal_tab.runtime_max_us = thm_runtime_max_us;
+    thermal_tab.budget_violations = thm_budget_violations;
+
+    DB_WriteBlock(&thermal_tab, DATA_BLOCK_ID_THERMAL);
+}
+
+
+void THM_SetCoolantTemperature(float temperature) {
+    OS_TaskEnter_Critical();
+    thm_coolant = temperature;
+    OS_TaskExit_Critical();
+}
+
+
+/**
+ * @brief   sums up the cell resistances of each module when the SOH has a new estimation
+ */
+static void THM_UpdateResistance(void) {
+    static DATA_BLOCK_SOH_s soh_tab;
+    float resistance = 0.0f;
+    uint16_t m = 0;
+    uint16_t c = 0;
+
+    DB_ReadBlock(&soh_tab, DATA_BLOCK_ID_SOH);
+    if (soh_tab.timestamp == 0 || soh_tab.timestamp == thm_soh_timestamp) {
+        return;
+    }
+    thm_soh_timestamp = soh_tab.timestamp;
+
+    for (m = 0; m < BS_NR_OF_MODULES; m++) {
+        resistance = 0.0f;
+        for (c = 0; c < BS_NR_OF_BAT_CELLS_PER_MODULE; c++) {
+            if (soh_tab.resistance[m * BS_NR_OF_BAT_CELLS_PER_MODULE + c] > 0.0f) {
+                resistance += soh_tab.resistance[m * BS_NR_OF_BAT_CELLS_PER_MODULE + c];
+            } else {
+                resistance += SOH_RESISTANCE_BOL;
+            }
+        }
+        thm_resistance[m] = resistance / 1000.0f;       // mOhm -> Ohm
+    }
+}
+
+
+/**
+ * @brief   starts the model from the mean of the valid sensors of each module
+ *
+ * @param   celltemp    cell temperature measurement
+ */
+static void THM_Start(const DATA_BLOCK_CELLTEMPERATURE_s *celltemp) {
+    float sum = 0.0f;
+    uint16_t m = 0;
+    uint8_t s = 0;
+    uint8_t n = 0;
+
+    for (m = 0; m < BS_NR_OF_MODULES; m++) {
+        sum = 0.0f;
+        n = 0;
+        for (s = 0; s < BS_NR_OF_TEMP_SENSORS_PER_MODULE; s++) {
+            if ((celltemp->valid_temperaturePECs[m] & (1 << s)) == 0) {
+                sum += celltemp->temperature[m * BS_NR_OF_TEMP_SENSORS_PER_MODULE + s];
+                n++;
+            }
+        }
+        thm_temperature[m] = (n > 0) ? (sum / n) : thm_coolant;
+    }
+    thm_started = TRUE;
+}
+
+
+/**
+ * @brief   corrects the modelled temperature of a module towards its plausible sensors
+ *
+ * @details A sensor is plausible if it is within THM_SENSOR_TOLERANCE of the model.
+ *          Sensors outside the tolerance are flagged as implausible after
+ *          THM_SENSOR_DEBOUNCE cycles, as long as at least one other sensor of the
+ *          module agrees with the model. If no sensor agrees, the model is the one
+ *          that is wrong and is set to the mean of the sensors.
+ *
+ * @param   module          index of the module
+ * @param   temperature     modelled temperature in degC
+ * @param   celltemp        cell temperature measurement
+ *
+ * @return  corrected temperature in degC
+ */
+static float THM_CorrectModule(uint16_t module, float temperature, const DATA_BLOCK_CELLTEMPERATURE_s *celltemp) {
+    float measured = 0.0f;
+    float deviation = 0.0f;
+    float sum_ok = 0.0f;
+    float sum_all = 0.0f;
+    uint16_t valid = 0;         // bitmask of the sensors with a valid measurement
+    uint16_t outside = 0;       // bitmask of the valid sensors outside the tolerance
+    uint16_t sensor = module * BS_NR_OF_TEMP_SENSORS_PER_MODULE;
+    uint8_t n_ok = 0;
+    uint8_t n_all = 0;
+    uint8_t s = 0;
+
+    for (s = 0; s < BS_NR_OF_TEMP_SENSORS_PER_MODULE; s++) {
+        if ((celltemp->valid_temperaturePECs[module] & (1 << s)) != 0) {
+            continue;       // no valid measurement, keep the debounce state
+        }
+        valid |= (1 << s);
+        measured = celltemp->temperature[sensor + s];
+        deviation = measured - temperature;
+        sum_all += measured;
+        n_all++;
+        if (deviation <= THM_SENSOR_TOLERANCE && deviation >= -THM_SENSOR_TOLERANCE) {
+            sum_ok += measured;
+            n_ok++;
+        } else {
+            outside |= (1 << s);
+        }
+    }
+
+    if (n_all == 0) {
+        return temperature;
+    }
+
+    if (n_ok == 0) {
+        // all sensors agree against the model
+        for (s = 0; s < BS_NR_OF_TEMP_SENSORS_PER_MODULE; s++) {
+            thm_debounce[sensor + s] = 0;
+        }
+        thm_implausible[module] = 0;
+        return sum_all / n_all;
+    }
+
+    for (s = 0; s < BS_NR_OF_TEMP_SENSORS_PER_MODULE; s++) {
+        if ((valid & (1 << s)) == 0) {
+            continue;
+        }
+        if ((outside & (1 << s)) == 0) {
+            thm_debounce[sensor + s] = 0;
+            thm_implausible[module] &= ~(1 << s);
+        } else if (thm_debounce[sensor + s] < THM_SENSOR_DEBOUNCE) {
+            thm_debounce[sensor + s]++;
+        } else {
+            thm_implausible[module] |= (1 << s);
+        }
+    }
+
+    return temperature + (sum_ok / n_ok - temperature) * (THM_OBSERVER_GAIN * THM_DT);
+}
@@ -0,0 +1,81 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    thermal.h
+ * @author  foxBMS Team
+ * @date    18.10.2026 (date of creation)
+ * @ingroup APPLICATION
+ * @prefix  THM
+ *
+ * @brief   Lumped thermal model of the modules
+ *
+ * Each module is one thermal node with the heat capacity
+ * THM_MODULE_HEAT_CAPACITY. It is heated by I^2*R of its cells, with the
+ * resistances estimated by the SOH, and cooled through conductances to the
+ * coolant and to its neighbouring modules. The model is corrected towards the
+ * plausible temperature sensors of the module, gives the unmeasured core
+ * temperature of the cells and predicts the core temperature
+ * THM_PREDICTION_HORIZON_S ahead for an early derating. Sensors that disagree
+ * with the model while the other sensors of the module agree are flagged as
+ * implausible.
+ */
+
+#ifndef THERMAL_H_
+#define THERMAL_H_
+
+/*================== Includes =============================================*/
+#include "thermal_cfg.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/*================== Constant and Variable Definitions ====================*/
+
+/*================== Function Prototypes ==================================*/
+
+/**
+ * @brief   calculates the constant coefficients of the model
+ *
+ * @details The model starts from the first cell temperature measurement.
+ */
+extern void THM_Init(void);
+
+/**
+ * @brief   integrates the model over one time step and writes DATA_BLOCK_ID_THERMAL
+ *
+ * @details Must be called every THM_CYCLE_TIME_MS. The loops over the modules take
+ *          no divisions and no exponential functions, the execution time only depends
+ *          on the number of modules and sensors and is checked against
+ *          THM_CYCLE_BUDGET_US.
+ */
+extern void THM_Trigger(void);
+
+/**
+ * @brief   sets the coolant temperature the modules are cooled to
+ *
+ * @param   temperature     coolant temperature in degC
+ */
+extern void THM_SetCoolantTemperature(float temperature);
+
+/*================== Function Implementations =============================*/
+
+#endif /* THERMAL_H_ */
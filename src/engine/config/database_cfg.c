@@ -56,6 +56,21 @@ DATA_BLOCK_CELLTEMPERATURE_s data_block_celltemperature[DOUBLE_BUFFERING];
  */
 DATA_BLOCK_SOX_s data_block_sox[SINGLE_BUFFERING];
 
+/**
+ * data block: SOC of each cell
+ */
+DATA_BLOCK_CELLSOC_s data_block_cellsoc[SINGLE_BUFFERING];
+
+/**
+ * data block: state of health
+ */
+DATA_BLOCK_SOH_s data_block_soh[SINGLE_BUFFERING];
+
+/**
+ * data block: thermal model
+ */
+DATA_BLOCK_THERMAL_s data_block_thermal[SINGLE_BUFFERING];
+
 /**
  * data block: balancing control
  */
@@ -66,6 +81,11 @@ DATA_BLOCK_BALANCING_CONTROL_s data_block_control_balancing[DOUBLE_BUFFERING];
  */
 DATA_BLOCK_BALANCING_FEEDBACK_s data_block_feedback_balancing[DOUBLE_BUFFERING];
 
+/**
+ * data block: balancing charge accounting
+ */
+DATA_BLOCK_BALANCING_ENERGY_s data_block_balancing_energy[SINGLE_BUFFERING];
+
 /**
  * data block: current measurement
  */
@@ -238,6 +258,26 @@ DATA_BASE_HEADER_s  data_base_header[] = {
             (void*)(&data_block_systemstate[0]),
             sizeof(DATA_BLOCK_SYSTEMSTATE_s),
             SINGLE_BUFFERING,
+    },
+    {
+            (void*)(&data_block_cellsoc[0]),
+            sizeof(DATA_BLOCK_CELLSOC_s),
+            SINGLE_BUFFERING,
+    },
+    {
+            (void*)(&data_block_soh[0]),
+            sizeof(DATA_BLOCK_SOH_s),
+            SINGLE_BUFFERING,
+    },
+    {
+            (void*)(&data_block_thermal[0]),
+            sizeof(DATA_BLOCK_THERMAL_s),
+            SINGLE_BUFFERING,
+    },
+    {
+            (void*)(&data_block_balancing_energy[0]),
+            sizeof(DATA_BLOCK_BALANCING_ENERGY_s),
+            SINGLE_BUFFERING,
     }
 };
 
@@ -46,7 +46,7 @@
  *
  * this value is extendible but limitation is done due to RAM consumption and performance
  */
-#define DATA_MAX_BLOCK_NR                20        /* max 20 Blocks currently supported*/
+#define DATA_MAX_BLOCK_NR                23        /* max 23 Blocks currently supported*/
 
 /**
  * @brief data block identification number
@@ -72,6 +72,9 @@ typedef enum {
     DATA_BLOCK_18       = 17,
     DATA_BLOCK_19       = 18,
     DATA_BLOCK_20       = 19,
+    DATA_BLOCK_21       = 20,
+    DATA_BLOCK_22       = 21,
+    DATA_BLOCK_23       = 22,
     DATA_BLOCK_MAX      = DATA_MAX_BLOCK_NR,
 } DATA_BLOCK_ID_TYPE_e;
 
@@ -138,6 +141,10 @@ typedef struct {
 #define     DATA_BLOCK_ID_CONTFEEDBACK                  DATA_BLOCK_17
 #define     DATA_BLOCK_ID_ILCKFEEDBACK                  DATA_BLOCK_18
 #define     DATA_BLOCK_ID_SYSTEMSTATE                   DATA_BLOCK_19
+#define     DATA_BLOCK_ID_CELLSOC                       DATA_BLOCK_20
+#define     DATA_BLOCK_ID_SOH                           DATA_BLOCK_21
+#define     DATA_BLOCK_ID_THERMAL                       DATA_BLOCK_22
+#define     DATA_BLOCK_ID_BALANCING_ENERGY              DATA_BLOCK_23
 
 /**
  * data block struct of cell voltage
@@ -180,6 +187,11 @@ typedef struct {
     float soc_mean;                     /*!< 0.0 <= soc_mean <= 100.0           */
     float soc_min;                      /*!< 0.0 <= soc_min <= 100.0            */
     float soc_max;                      /*!< 0.0 <= soc_max <= 100.0            */
+    float soc_variance_mean;            /*!< variance of soc_mean in %^2        */
+    float soc_variance_min;             /*!< variance of soc_min in %^2         */
+    float soc_variance_max;             /*!< variance of soc_max in %^2         */
+    float throughput_discharge;         /*!< discharged charge since startup in Ah  */
+    float throughput_charge;            /*!< charged charge since startup in Ah     */
     uint32_t previous_timestamp;        /*!< timestamp of last database entry   */
     uint32_t timestamp;                 /*!< timestamp of database entry        */
     uint8_t state;                      /*!<                                    */
@@ -187,12 +199,77 @@ typedef struct {
     float sof_continuous_discharge;     /*!<                                    */
     float sof_peak_charge;              /*!<                                    */
     float sof_peak_discharge;           /*!<                                    */
+    float soe;                          /*!< 0.0 <= soe <= 100.0                */
+    float energy_remaining;             /*!< stored energy above SOC min in Wh  */
+    float energy_discharge;             /*!< available discharge energy in Wh   */
+    float energy_charge;                /*!< energy to charge to SOC max in Wh  */
+    float sop_current_discharge[3];     /*!< max. discharge current over 2s, 10s and 30s in A   */
+    float sop_current_charge[3];        /*!< max. charge current over 2s, 10s and 30s in A      */
+    float sop_power_discharge[3];       /*!< max. discharge power over 2s, 10s and 30s in W     */
+    float sop_power_charge[3];          /*!< max. charge power over 2s, 10s and 30s in W        */
 } DATA_BLOCK_SOX_s;
 
+/**
+ * data block struct of the SOC of each cell
+ */
+typedef struct {
+    float soc[BS_NR_OF_BAT_CELLS];      /*!< 0.0 <= soc <= 100.0                */
+    float soc_min;                      /*!< SOC of the weakest cell            */
+    float soc_max;                      /*!< SOC of the strongest cell          */
+    uint16_t cell_number_min;           /*!< index of the weakest cell          */
+    uint16_t cell_number_max;           /*!< index of the strongest cell        */
+    uint16_t calibrations;              /*!< number of calibrations of the cells from the open circuit voltage */
+    uint32_t previous_timestamp;        /*!< timestamp of last database entry   */
+    uint32_t timestamp;                 /*!< timestamp of database entry        */
+    uint8_t state;                      /*!<                                    */
+} DATA_BLOCK_CELLSOC_s;
+
+/**
+ * data block struct of the state of health
+ */
+typedef struct {
+    float resistance[BS_NR_OF_BAT_CELLS];   /*!< internal resistance of each cell in mOhm           */
+    float capacity[BS_NR_OF_BAT_CELLS];     /*!< capacity of each cell in mAh                       */
+    float soh_mean;                         /*!< 0.0 <= soh_mean <= 100.0                           */
+    float soh_min;                          /*!< 0.0 <= soh_min <= 100.0                            */
+    float soh_max;                          /*!< 0.0 <= soh_max <= 100.0                            */
+    float resistance_mean;                  /*!< mean internal resistance in mOhm                   */
+    float resistance_max;                   /*!< highest internal resistance in mOhm                */
+    float capacity_mean;                    /*!< mean capacity in mAh                               */
+    float capacity_min;                     /*!< lowest capacity in mAh                             */
+    uint16_t cell_number_min;               /*!< index of the cell with the lowest SOH              */
+    uint16_t cell_number_max;               /*!< index of the cell with the highest SOH             */
+    uint16_t resistance_updates;            /*!< number of current steps used since startup         */
+    uint16_t capacity_updates;              /*!< number of capacity estimations since first use     */
+    uint32_t previous_timestamp;            /*!< timestamp of last database entry                   */
+    uint32_t timestamp;                     /*!< timestamp of database entry                        */
+    uint8_t state;                          /*!<                                                    */
+} DATA_BLOCK_SOH_s;
+
+/**
+ * data block struct of the thermal model of the modules
+ */
+typedef struct {
+    float temperature[BS_NR_OF_MODULES];            /*!< modelled surface temperature of each module in degC              */
+    float temperature_core[BS_NR_OF_MODULES];       /*!< estimated core temperature of the cells of each module in degC   */
+    float temperature_predicted[BS_NR_OF_MODULES];  /*!< predicted core temperature at the end of the horizon in degC     */
+    uint16_t implausible_sensors[BS_NR_OF_MODULES]; /*!< bitmask of the sensors that disagree with the model, 1->implausible */
+    float temperature_core_max;                     /*!< highest estimated core temperature in degC                       */
+    float temperature_predicted_max;                /*!< highest predicted core temperature in degC                       */
+    uint16_t module_number_max;                     /*!< index of the module with the highest predicted temperature       */
+    uint16_t nr_implausible_sensors;                /*!< number of sensors that disagree with the model                   */
+    uint32_t runtime_max_us;                        /*!< longest execution time of the model in us                        */
+    uint32_t budget_violations;                     /*!< executions longer than THM_CYCLE_BUDGET_US                       */
+    uint32_t previous_timestamp;                    /*!< timestamp of last database entry                                 */
+    uint32_t timestamp;                             /*!< timestamp of database entry                                      */
+    uint8_t state;                                  /*!<                                                                  */
+} DATA_BLOCK_THERMAL_s;
+
 
 /*  data structure declaration of DATA_BLOCK_BALANCING_CONTROL */
 typedef struct {
-    uint16_t value[BS_NR_OF_BAT_CELLS];    /*!< */
+    uint16_t value[BS_NR_OF_BAT_CELLS];    /*!< 1 -> cell is balanced, kept in sync with module_mask */
+    uint32_t module_mask[BS_NR_OF_MODULES]; /*!< balanced cells of each module, bit n -> cell n */
     uint32_t previous_timestamp;        /*!< timestamp of last database entry           */
     uint32_t timestamp;                 /*!< timestamp of database entry                */
     uint8_t enable_balancing;           /*!< Switch for enabling/disabling balancing    */
@@ -228,6 +305,22 @@ typedef struct {
     uint8_t state;                      /*!< for future use                     */
 } DATA_BLOCK_BALANCING_FEEDBACK_s;
 
+/**
+ * data block struct of the balancing charge accounting
+ */
+typedef struct {
+    uint32_t charge[BS_NR_OF_BAT_CELLS];    /*!< charge bled from each cell, unit: mAs                              */
+    float leakage[BS_NR_OF_BAT_CELLS];      /*!< self-discharge relative to the cell bled the most, unit: uA        */
+    float charge_total;                     /*!< charge bled from all cells, unit: Ah                               */
+    float leakage_max;                      /*!< highest self-discharge, unit: uA                                   */
+    uint16_t cell_number_leakage_max;       /*!< index of the cell with the highest self-discharge                  */
+    uint32_t observation_time;              /*!< operating time the charge was counted over, unit: s                */
+    uint8_t valid;                          /*!< 1 once BAL_LEAKAGE_MIN_OBSERVATION_H have been observed            */
+    uint32_t previous_timestamp;            /*!< timestamp of last database entry                                   */
+    uint32_t timestamp;                     /*!< timestamp of database entry                                        */
+    uint8_t state;                          /*!< for future use                                                     */
+} DATA_BLOCK_BALANCING_ENERGY_s;
+
 
 /**
  * data block struct of user multiplexer values
@@ -388,6 +481,9 @@ typedef struct {
     uint8_t can_timing;                              /*!< 0 -> no error, 1 -> error         */
     uint8_t can_timing_cc;                           /*!< 0 -> no error, 1 -> error         */
     uint8_t can_cc_used;                             /*!< 0 -> not present, 1 -> present    */
+    uint8_t fast_fault_reaction;                     /*!< 0 -> no error, 1 -> error         */
+    uint8_t current_budget_charge;                   /*!< 0 -> no error, 1 -> error         */
+    uint8_t current_budget_discharge;                /*!< 0 -> no error, 1 -> error         */
     uint32_t timestamp;                              /*!< timestamp of database entry       */
     uint32_t previous_timestamp;                     /*!< timestamp of last database entry  */
 } DATA_BLOCK_ERRORSTATE_s;
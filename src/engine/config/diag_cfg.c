@@ -337,6 +337,50 @@ void DIAG_error_interlock(DIAG_CH_ID_e ch_id, DIAG_EVENT_e event)
     }
     DB_WriteBlock(&error_flags, DATA_BLOCK_ID_ERRORSTATE);
 }
+void DIAG_error_fastfaultreaction(DIAG_CH_ID_e ch_id, DIAG_EVENT_e event)
+{
+    DATA_BLOCK_ERRORSTATE_s error_flags;
+    DB_ReadBlock(&error_flags, DATA_BLOCK_ID_ERRORSTATE);
+    if(event==DIAG_EVENT_RESET){
+        error_flags.fast_fault_reaction = 0;
+    }
+    if(event==DIAG_EVENT_NOK){
+        error_flags.fast_fault_reaction = 1;
+    }
+    DB_WriteBlock(&error_flags, DATA_BLOCK_ID_ERRORSTATE);
+}
+
+/**
+ * Callback function of the charge current budget, sets the error flag of the exceeded budget
+ */
+void DIAG_error_currentbudgetcharge(DIAG_CH_ID_e ch_id, DIAG_EVENT_e event)
+{
+    DATA_BLOCK_ERRORSTATE_s error_flags;
+    DB_ReadBlock(&error_flags, DATA_BLOCK_ID_ERRORSTATE);
+    if(event==DIAG_EVENT_RESET){
+        error_flags.current_budget_charge = 0;
+    }
+    if(event==DIAG_EVENT_NOK){
+        error_flags.current_budget_charge = 1;
+    }
+    DB_WriteBlock(&error_flags, DATA_BLOCK_ID_ERRORSTATE);
+}
+
+/**
+ * Callback function of the discharge current budget, sets the error flag of the exceeded budget
+ */
+void DIAG_error_currentbudgetdischarge(DIAG_CH_ID_e ch_id, DIAG_EVENT_e event)
+{
+    DATA_BLOCK_ERRORSTATE_s error_flags;
+    DB_ReadBlock(&error_flags, DATA_BLOCK_ID_ERRORSTATE);
+    if(event==DIAG_EVENT_RESET){
+        error_flags.current_budget_discharge = 0;
+    }
+    if(event==DIAG_EVENT_NOK){
+        error_flags.current_budget_discharge = 1;
+    }
+    DB_WriteBlock(&error_flags, DATA_BLOCK_ID_ERRORSTATE);
+}
 
 /**
  * Callback function of system monitoring error events
@@ -415,6 +459,14 @@ DIAG_CH_CFG_s  diag_ch_cfg[] = {
     /* Interlock Feedback Error*/
     {DIAG_CH_INTERLOCK_FEEDBACK,                   "INTERLOCK_FEEDBACK",                  DIAG_GENERAL_TYPE,    DIAG_ERROR_INTERLOCK_SENSITIVITY,         DIAG_RECORDING_ENABLED, DIAG_ENABLED, DIAG_error_interlock},
 
+    /* Fast fault reaction */
+    {DIAG_CH_FAST_FAULT_REACTION,                  "FAST_FAULT_REACTION",                 DIAG_GENERAL_TYPE,    DIAG_ERROR_FAST_FAULT_SENSITIVITY,        DIAG_RECORDING_ENABLED, DIAG_ENABLED, DIAG_error_fastfaultreaction},
+
+    {DIAG_CH_CURRENT_BUDGET_WARNING_CHARGE,        "CURRENT_BUDGET_WARNING_CHARGE",       DIAG_GENERAL_TYPE,    DIAG_ERROR_CURRENT_BUDGET_SENSITIVITY,    DIAG_RECORDING_ENABLED, DIAG_ENABLED, dummyfu},
+    {DIAG_CH_CURRENT_BUDGET_WARNING_DISCHARGE,     "CURRENT_BUDGET_WARNING_DISCHARGE",    DIAG_GENERAL_TYPE,    DIAG_ERROR_CURRENT_BUDGET_SENSITIVITY,    DIAG_RECORDING_ENABLED, DIAG_ENABLED, dummyfu},
+    {DIAG_CH_CURRENT_BUDGET_CHARGE,                "CURRENT_BUDGET_CHARGE",               DIAG_GENERAL_TYPE,    DIAG_ERROR_CURRENT_BUDGET_SENSITIVITY,    DIAG_RECORDING_ENABLED, DIAG_ENABLED, DIAG_error_currentbudgetcharge},
+    {DIAG_CH_CURRENT_BUDGET_DISCHARGE,             "CURRENT_BUDGET_DISCHARGE",            DIAG_GENERAL_TYPE,    DIAG_ERROR_CURRENT_BUDGET_SENSITIVITY,    DIAG_RECORDING_ENABLED, DIAG_ENABLED, DIAG_error_currentbudgetdischarge},
+
 };
 
 
@@ -54,9 +54,10 @@
 #define DIAG_ERROR_SENSITIVITY_MID          (5)    // logging at fifth event
 #define DIAG_ERROR_SENSITIVITY_LOW          (10)    // logging at tenth event
 
-#define DIAG_ERROR_VOLTAGE_SENSITIVITY             (500)
-#define DIAG_ERROR_TEMPERATURE_SENSITIVITY         (500)
-#define DIAG_ERROR_CURRENT_SENSITIVITY             (500)
+// debounced by the limit monitors (LMON), which report level changes only
+#define DIAG_ERROR_VOLTAGE_SENSITIVITY             (1)
+#define DIAG_ERROR_TEMPERATURE_SENSITIVITY         (1)
+#define DIAG_ERROR_CURRENT_SENSITIVITY             (1)
 
 #define DIAG_ERROR_LTC_PEC_SENSITIVITY             (5)
 #define DIAG_ERROR_LTC_MUX_SENSITIVITY             (5)
@@ -66,12 +67,17 @@
 #define DIAG_ERROR_CAN_TIMING_CC_SENSITIVITY       (100)
 #define DIAG_ERROR_CAN_SENSOR_SENSITIVITY          (100)
 
-#define DIAG_ERROR_MAIN_PLUS_SENSITIVITY           (500)
-#define DIAG_ERROR_MAIN_MINUS_SENSITIVITY          (500)
-#define DIAG_ERROR_PRECHARGE_SENSITIVITY           (500)
+// debounced by the limit monitors (LMON), which report level changes only
+#define DIAG_ERROR_MAIN_PLUS_SENSITIVITY           (1)
+#define DIAG_ERROR_MAIN_MINUS_SENSITIVITY          (1)
+#define DIAG_ERROR_PRECHARGE_SENSITIVITY           (1)
 
 #define DIAG_ERROR_INTERLOCK_SENSITIVITY           (10)
 
+#define DIAG_ERROR_FAST_FAULT_SENSITIVITY          (1)
+
+#define DIAG_ERROR_CURRENT_BUDGET_SENSITIVITY      (10)
+
 /**
  * Number of errors that can be logged
  */
@@ -209,6 +215,23 @@
  */
 #define DIAG_CH_INTERLOCK_FEEDBACK                         DIAG_ID_73
 
+/**
+ * @brief   Contactors opened by the fast fault reaction
+ */
+#define DIAG_CH_FAST_FAULT_REACTION                        DIAG_ID_74
+
+/**
+ * @brief   Current budget of a peak window or the continuous limit almost used up (warning only)
+ */
+#define DIAG_CH_CURRENT_BUDGET_WARNING_CHARGE              DIAG_ID_75
+#define DIAG_CH_CURRENT_BUDGET_WARNING_DISCHARGE           DIAG_ID_76
+
+/**
+ * @brief   Current budget of a peak window or the continuous limit exceeded
+ */
+#define DIAG_CH_CURRENT_BUDGET_CHARGE                      DIAG_ID_77
+#define DIAG_CH_CURRENT_BUDGET_DISCHARGE                   DIAG_ID_78
+
 
 /**
  * enable state of diagnosis entry
@@ -56,6 +56,7 @@
 #include "bal.h"
 #include "intermcu.h"
 #include "adc_ex.h"
+#include "ffr.h"
 /*================== Macros and Definitions ===============================*/
 
 /*================== Constant and Variable Definitions ====================*/
@@ -107,8 +108,14 @@ void ENG_Init(void) {
 
     error_flags.can_cc_used                 = 1;
 
+    error_flags.fast_fault_reaction         = 0;
+    error_flags.current_budget_charge       = 0;
+    error_flags.current_budget_discharge    = 0;
+
     DB_WriteBlock(&error_flags, DATA_BLOCK_ID_ERRORSTATE);
 
+    FFR_Init();
+
     // Init Sys
     sys_retVal = SYS_SetStateRequest(SYS_STATE_INIT_REQUEST);
 
@@ -120,6 +127,7 @@ void ENG_Init(void) {
 void ENG_Cyclic_1ms(void) {
     MEAS_Ctrl();
     LTC_Trigger();
+    FFR_Trigger();
     EEPR_Trigger();
 
 
@@ -157,6 +165,7 @@ void ENG_Cyclic_100ms(void) {
     if (counter == 255) {
         NVM_SetOperatingHours();
     }
+    NVM_PolicyTrigger();
     counter++;
 }
 
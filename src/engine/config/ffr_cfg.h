@@ -0,0 +1,127 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    ffr_cfg.h
+ * @author  foxBMS Team
+ * @date    18.10.2026 (date of creation)
+ * @ingroup ENGINE_CONF
+ * @prefix  FFR
+ *
+ * @brief   Configuration header of the fast fault reaction
+ *
+ * The hard limits are checked directly where a new sample becomes available,
+ * so they must be set outside of the safe operating area that is supervised
+ * by the BMS state machine through the debounced DIAG channels.
+ */
+
+#ifndef FFR_CFG_H_
+#define FFR_CFG_H_
+
+/*================== Includes =============================================*/
+#include "general.h"
+#include "batterycell_cfg.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/**
+ * enables the fast fault reaction path
+ *
+ * \par Type:
+ * toggle
+ * \par Default:
+ * TRUE
+*/
+#define FFR_FAST_FAULT_REACTION_ENABLED     TRUE
+
+/**
+ * hard limit of the charge current in mA
+ *
+ * \par Type:
+ * int
+ * \par Default:
+ * BC_CURRENTMAX_CHARGE + 20%
+*/
+#define FFR_CURRENTMAX_CHARGE_MA            (BC_CURRENTMAX_CHARGE + (BC_CURRENTMAX_CHARGE/5))
+
+/**
+ * hard limit of the discharge current in mA
+ *
+ * \par Type:
+ * int
+ * \par Default:
+ * BC_CURRENTMAX_DISCHARGE + 20%
+*/
+#define FFR_CURRENTMAX_DISCHARGE_MA         (BC_CURRENTMAX_DISCHARGE + (BC_CURRENTMAX_DISCHARGE/5))
+
+/**
+ * hard limit of the maximum cell voltage in mV
+ *
+ * \par Type:
+ * int
+ * \par Default:
+ * BC_VOLTMAX + 100
+*/
+#define FFR_VOLTMAX_MV                      (BC_VOLTMAX + 100)
+
+/**
+ * hard limit of the minimum cell voltage in mV
+ *
+ * \par Type:
+ * int
+ * \par Default:
+ * BC_VOLTMIN - 100
+*/
+#define FFR_VOLTMIN_MV                      (BC_VOLTMIN - 100)
+
+/**
+ * number of consecutive samples beyond a hard limit that trigger the
+ * fast fault reaction, filters single corrupted samples
+ *
+ * \par Type:
+ * int
+ * \par Default:
+ * 2
+ * \par Range:
+ * [1,255]
+*/
+#define FFR_DEBOUNCE_SAMPLES                (2)
+
+/**
+ * maximum allowed time in us between the sample and the confirmed opening
+ * of all contactors. Reactions that take longer are counted as budget
+ * violations.
+ *
+ * \par Type:
+ * int
+ * \par Default:
+ * 50000
+*/
+#define FFR_REACTION_TIME_BUDGET_US         (50000)
+
+/*================== Constant and Variable Definitions ====================*/
+
+/*================== Function Prototypes ==================================*/
+
+/*================== Function Implementations =============================*/
+
+#endif /* FFR_CFG_H_ */
@@ -68,6 +68,13 @@
 
 #define SYS_STATEMACH_LONGTIME_MS       ((10) * (SYS_TASK_CYCLE_CONTEXT_MS))
 
+/**
+ * SYS statemachine timeout for the initialization of the other state machines,
+ * in the same unit as the statemachine timer (100 polls, one every short time)
+ */
+
+#define SYS_STATEMACH_INITIALIZATION_TIMEOUT    ((1000/SYS_TASK_CYCLE_CONTEXT_MS) * (SYS_STATEMACH_SHORTTIME_MS))
+
 
 /*================== Function Prototypes ==================================*/
 
@@ -52,6 +52,7 @@
 #include "bms.h"
 #include "misc.h"
 #include "uart.h"
+#include <string.h>
 
 /*================== Macros and Definitions ===============================*/
 
@@ -273,6 +274,37 @@ void DIAG_PrintErrors(void) {
 
 }
 
+uint16_t DIAG_GetErrorEntries(uint8_t *dest, uint16_t max_entries) {
+    DIAG_ERROR_ENTRY_s *entry = diag_entry_wrptr;
+    uint16_t nr_of_entries = 0;
+    uint16_t i = 0;
+    uint16_t j = 0;
+    uint8_t *u8ptr;
+    uint8_t used;
+
+    OS_TaskEnter_Critical();
+    // the entry at the write pointer is the oldest one if the memory has wrapped around
+    for (i = 0; (i < DIAG_FAIL_ENTRY_LENGTH) && (nr_of_entries < max_entries); i++) {
+        if ((entry < &diag_memory[0]) || (entry >= &diag_memory[DIAG_FAIL_ENTRY_LENGTH])) {
+            entry = &diag_memory[0];
+        }
+        // entries not written yet are still zero since DIAG_Reset()
+        used = 0;
+        u8ptr = (uint8_t*)entry;
+        for (j = 0; j < sizeof(DIAG_ERROR_ENTRY_s); j++) {
+            used |= u8ptr[j];
+        }
+        if (used != 0) {
+            memcpy(&dest[nr_of_entries * sizeof(DIAG_ERROR_ENTRY_s)], entry, sizeof(DIAG_ERROR_ENTRY_s));
+            nr_of_entries++;
+        }
+        entry++;
+    }
+    OS_TaskExit_Critical();
+
+    return nr_of_entries;
+}
+
 void DIAG_PrintContactorInfo(void)
 {
     /* FIXME if read once, rdptr is on writeptr, therefore in the next call the errors aren't
@@ -223,6 +223,20 @@ extern void DIAG_PrintErrors(void);
  */
 extern void DIAG_PrintContactorInfo(void);
 
+/**
+ * @brief   DIAG_GetErrorEntries copies the error entries into a buffer, oldest entry first.
+ *
+ * In contrast to DIAG_PrintErrors(), the read pointer of the error buffer is
+ * not changed, so the entries can be read out again. The entries are copied
+ * byte-wise as DIAG_ERROR_ENTRY_s, so the buffer needs no alignment.
+ *
+ * @param   dest:           buffer for the entries
+ * @param   max_entries:    size of the buffer in entries, at most DIAG_FAIL_ENTRY_LENGTH are copied
+ *
+ * @return  number of copied entries
+ */
+extern uint16_t DIAG_GetErrorEntries(uint8_t *dest, uint16_t max_entries);
+
 /**
  * @brief   DIAG_SysMonNotify has to be called in every function using the system monitoring.
  *
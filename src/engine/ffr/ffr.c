@@ -0,0 +1,308 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    ffr.c
+ * @author  foxBMS Team
+ * @date    18.10.2026 (date of creation)
+ * @ingroup ENGINE
+ * @prefix  FFR
+ *
+ * @brief   Fast fault reaction
+ *
+ * The regular path of a limit violation is sample -> database -> BMS check
+ * (next 1ms tick) -> DIAG debouncing -> BMS error state -> CONT error state,
+ * which takes several hundred milliseconds. The fast fault reaction checks
+ * hard limits directly where the sample is processed and opens the contactors
+ * in the same context. The regular path still runs afterwards and puts the
+ * BMS into its error state through the error flag set by the DIAG channel.
+ *
+ * The latency of each stage is measured with the cycle counter of the core
+ * (DWT), so it is independent of the tick rate of the operating system.
+ */
+
+/*================== Includes =============================================*/
+#include "general.h"
+#include "ffr.h"
+
+#include "mcu_cfg.h"
+#include "os.h"
+#include "diag.h"
+#include "database.h"
+#include "contactor.h"
+#include "batterysystem_cfg.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/**
+ * state of the fast fault reaction
+ */
+typedef struct {
+    uint8_t debounce_current;                   /*!< consecutive samples beyond the current limits     */
+    uint8_t debounce_voltage;                   /*!< consecutive samples beyond the voltage limits     */
+    uint8_t active;                             /*!< TRUE while a reaction is in progress              */
+    uint8_t confirmed;                          /*!< TRUE when all contactor feedbacks read open       */
+    uint8_t reported;                           /*!< TRUE when the reaction was reported to DIAG       */
+    uint8_t budget_exceeded;                    /*!< TRUE when the reaction exceeded the time budget   */
+    FFR_CAUSE_e cause;                          /*!< cause of the current reaction                     */
+    uint32_t stage_cycles[FFR_STAGE_MAX];       /*!< cycle counter value of each stage                 */
+    uint32_t minmax_timestamp;                  /*!< timestamp of the last checked cell voltages       */
+} FFR_STATE_s;
+
+/*================== Constant and Variable Definitions ====================*/
+static FFR_STATE_s ffr_state = {
+    .debounce_current       = 0,
+    .debounce_voltage       = 0,
+    .active                 = FALSE,
+    .confirmed              = FALSE,
+    .reported               = FALSE,
+    .budget_exceeded        = FALSE,
+    .cause                  = FFR_CAUSE_NONE,
+    .minmax_timestamp       = 0,
+};
+
+static FFR_LATENCY_s ffr_latency;
+
+/*================== Function Prototypes ==================================*/
+static uint32_t FFR_GetCycles(void);
+static uint32_t FFR_CyclesToUs(uint32_t cycles);
+static void FFR_Trip(FFR_CAUSE_e cause, uint32_t sample);
+static uint8_t FFR_AllContactorsOpen(void);
+static void FFR_UpdateLatency(void);
+
+/*================== Function Implementations =============================*/
+
+void FFR_Init(void) {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+#ifdef STM32F7
+    DWT->LAR = 0xC5ACCE55;      /* unlock the DWT registers */
+#endif
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+
+void FFR_CheckCurrent(float current) {
+#if FFR_FAST_FAULT_REACTION_ENABLED == TRUE
+    uint32_t sample = FFR_GetCycles();
+    FFR_CAUSE_e cause = FFR_CAUSE_NONE;
+
+    if (BS_CheckCurrentValue_Direction(current) == BS_CURRENT_CHARGE) {
+        if (current < 0.0) {
+            current = -current;
+        }
+        if (current > FFR_CURRENTMAX_CHARGE_MA) {
+            cause = FFR_CAUSE_OVERCURRENT_CHARGE;
+        }
+    } else {
+        if (current < 0.0) {
+            current = -current;
+        }
+        if (current > FFR_CURRENTMAX_DISCHARGE_MA) {
+            cause = FFR_CAUSE_OVERCURRENT_DISCHARGE;
+        }
+    }
+
+    if (cause == FFR_CAUSE_NONE) {
+        ffr_state.debounce_current = 0;
+    } else if (++ffr_state.debounce_current >= FFR_DEBOUNCE_SAMPLES) {
+        ffr_state.debounce_current = FFR_DEBOUNCE_SAMPLES;
+        FFR_Trip(cause, sample);
+    }
+#endif
+}
+
+
+void FFR_CheckCellVoltages(uint16_t voltage_min, uint16_t voltage_max) {
+#if FFR_FAST_FAULT_REACTION_ENABLED == TRUE
+    uint32_t sample = FFR_GetCycles();
+    FFR_CAUSE_e cause = FFR_CAUSE_NONE;
+
+    if (voltage_max > FFR_VOLTMAX_MV) {
+        cause = FFR_CAUSE_OVERVOLTAGE;
+    } else if (voltage_min < FFR_VOLTMIN_MV) {
+        cause = FFR_CAUSE_UNDERVOLTAGE;
+    }
+
+    if (cause == FFR_CAUSE_NONE) {
+        ffr_state.debounce_voltage = 0;
+    } else if (++ffr_state.debounce_voltage >= FFR_DEBOUNCE_SAMPLES) {
+        ffr_state.debounce_voltage = FFR_DEBOUNCE_SAMPLES;
+        FFR_Trip(cause, sample);
+    }
+#endif
+}
+
+
+void FFR_Trigger(void) {
+#if FFR_FAST_FAULT_REACTION_ENABLED == TRUE
+    DATA_BLOCK_MINMAX_s minmax;
+
+    DB_ReadBlock(&minmax, DATA_BLOCK_ID_MINMAX);
+    if (minmax.timestamp != ffr_state.minmax_timestamp) {
+        ffr_state.minmax_timestamp = minmax.timestamp;
+        FFR_CheckCellVoltages(minmax.voltage_min, minmax.voltage_max);
+    }
+
+    if (ffr_state.active == FALSE) {
+        return;
+    }
+
+    if (ffr_state.reported == FALSE) {
+        ffr_state.reported = TRUE;
+        DIAG_Handler(DIAG_CH_FAST_FAULT_REACTION, DIAG_EVENT_NOK, (uint8_t)ffr_state.cause, NULL_PTR);
+    }
+
+    if (ffr_state.confirmed == FALSE) {
+        if (FFR_AllContactorsOpen() == TRUE) {
+            ffr_state.stage_cycles[FFR_STAGE_CONFIRMED] = FFR_GetCycles();
+            ffr_state.confirmed = TRUE;
+            FFR_UpdateLatency();
+        } else if ((ffr_state.budget_exceeded == FALSE) &&
+                   (FFR_CyclesToUs(FFR_GetCycles() - ffr_state.stage_cycles[FFR_STAGE_SAMPLE]) > FFR_REACTION_TIME_BUDGET_US)) {
+            // contactors did not open in time, e.g., welded, count it once
+            ffr_state.budget_exceeded = TRUE;
+            ffr_latency.budget_violations++;
+        }
+        return;
+    }
+
+    // re-arm when the limit violations are gone, this resets the DIAG channel
+    if ((ffr_state.debounce_current == 0) && (ffr_state.debounce_voltage == 0)) {
+        DIAG_Handler(DIAG_CH_FAST_FAULT_REACTION, DIAG_EVENT_OK, (uint8_t)ffr_state.cause, NULL_PTR);
+        OS_TaskEnter_Critical();
+        ffr_state.active = FALSE;
+        OS_TaskExit_Critical();
+    }
+#endif
+}
+
+
+uint8_t FFR_IsTripped(void) {
+    uint8_t retval = FALSE;
+
+    OS_TaskEnter_Critical();
+    retval = ffr_state.active;
+    OS_TaskExit_Critical();
+
+    return retval;
+}
+
+
+void FFR_GetLatency(FFR_LATENCY_s *latency) {
+    OS_TaskEnter_Critical();
+    *latency = ffr_latency;
+    OS_TaskExit_Critical();
+}
+
+
+/**
+ * @brief   returns the cycle counter of the core
+ *
+ * @return  core clock cycles since FFR_Init(), wraps around
+ */
+static uint32_t FFR_GetCycles(void) {
+    return (DWT->CYCCNT);
+}
+
+
+/**
+ * @brief   converts a difference of the cycle counter to microseconds
+ *
+ * @param   cycles  number of core clock cycles
+ *
+ * @return  time in us
+ */
+static uint32_t FFR_CyclesToUs(uint32_t cycles) {
+    return (cycles / (SystemCoreClock / 1000000));
+}
+
+
+/**
+ * @brief   opens all contactors, unless a reaction is already in progress
+ *
+ * @param   cause   cause of the reaction
+ * @param   sample  cycle counter value when the sample was handed to the fast path
+ */
+static void FFR_Trip(FFR_CAUSE_e cause, uint32_t sample) {
+    uint8_t start = FALSE;
+
+    OS_TaskEnter_Critical();
+    if (ffr_state.active == FALSE) {
+        ffr_state.active = TRUE;
+        ffr_state.confirmed = FALSE;
+        ffr_state.reported = FALSE;
+        ffr_state.budget_exceeded = FALSE;
+        ffr_state.cause = cause;
+        ffr_state.stage_cycles[FFR_STAGE_SAMPLE] = sample;
+        ffr_state.stage_cycles[FFR_STAGE_DETECTED] = FFR_GetCycles();
+        start = TRUE;
+    }
+    OS_TaskExit_Critical();
+
+    if (start == TRUE) {
+        CONT_SwitchAllContactorsOff();
+        ffr_state.stage_cycles[FFR_STAGE_COMMANDED] = FFR_GetCycles();
+        // keeps a running precharge or closing sequence from closing the contactors again
+        CONT_SetStateRequest(CONT_STATE_ERROR_REQUEST);
+    }
+}
+
+
+/**
+ * @brief   checks the feedback of all contactors
+ *
+ * @return  TRUE if all contactors read open, FALSE otherwise
+ */
+static uint8_t FFR_AllContactorsOpen(void) {
+    for (CONT_NAMES_e i = 0; i < (CONT_NAMES_e) BS_NR_OF_CONTACTORS; i++) {
+        if (CONT_GetContactorFeedback(i) != CONT_SWITCH_OFF) {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+
+/**
+ * @brief   updates the latency statistics after a confirmed reaction
+ */
+static void FFR_UpdateLatency(void) {
+    uint32_t us = 0;
+
+    OS_TaskEnter_Critical();
+    ffr_latency.cause = ffr_state.cause;
+    ffr_latency.trips++;
+    for (uint8_t i = 0; i < FFR_STAGE_MAX; i++) {
+        us = FFR_CyclesToUs(ffr_state.stage_cycles[i] - ffr_state.stage_cycles[FFR_STAGE_SAMPLE]);
+        ffr_latency.last_us[i] = us;
+        if (us > ffr_latency.worst_us[i]) {
+            ffr_latency.worst_us[i] = us;
+        }
+    }
+    if ((ffr_latency.last_us[FFR_STAGE_CONFIRMED] > FFR_REACTION_TIME_BUDGET_US) &&
+        (ffr_state.budget_exceeded == FALSE)) {
+        ffr_state.budget_exceeded = TRUE;
+        ffr_latency.budget_violations++;
+    }
+    OS_TaskExit_Critical();
+}
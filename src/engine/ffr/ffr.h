@@ -0,0 +1,138 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    ffr.h
+ * @author  foxBMS Team
+ * @date    18.10.2026 (date of creation)
+ * @ingroup ENGINE
+ * @prefix  FFR
+ *
+ * @brief   Header of the fast fault reaction
+ *
+ * The fast fault reaction opens all contactors directly from the context in
+ * which a hard limit violation is detected, without waiting for the DIAG
+ * debouncing and the BMS and CONT state machines. Each reaction is
+ * timestamped stage by stage to measure the sensor-to-contactor latency.
+ */
+
+#ifndef FFR_H_
+#define FFR_H_
+
+/*================== Includes =============================================*/
+#include "ffr_cfg.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/**
+ * causes of a fast fault reaction
+ */
+typedef enum {
+    FFR_CAUSE_NONE                  = 0,    /*!< no fast fault reaction happened    */
+    FFR_CAUSE_OVERCURRENT_CHARGE    = 1,    /*!< charge current hard limit          */
+    FFR_CAUSE_OVERCURRENT_DISCHARGE = 2,    /*!< discharge current hard limit       */
+    FFR_CAUSE_OVERVOLTAGE           = 3,    /*!< maximum cell voltage hard limit    */
+    FFR_CAUSE_UNDERVOLTAGE          = 4,    /*!< minimum cell voltage hard limit    */
+} FFR_CAUSE_e;
+
+/**
+ * stages of a fast fault reaction, timestamped relative to the sample
+ */
+typedef enum {
+    FFR_STAGE_SAMPLE        = 0,    /*!< sample handed to the fast path             */
+    FFR_STAGE_DETECTED      = 1,    /*!< hard limit violation confirmed (debounced) */
+    FFR_STAGE_COMMANDED     = 2,    /*!< all contactor outputs switched off         */
+    FFR_STAGE_CONFIRMED     = 3,    /*!< all contactor feedbacks read open          */
+    FFR_STAGE_MAX           = 4,    /*!< number of stages                           */
+} FFR_STAGE_e;
+
+/**
+ * latency statistics of the fast fault reaction
+ */
+typedef struct {
+    FFR_CAUSE_e cause;                      /*!< cause of the last reaction                                 */
+    uint32_t trips;                         /*!< number of reactions since startup                          */
+    uint32_t budget_violations;             /*!< reactions slower than FFR_REACTION_TIME_BUDGET_US          */
+    uint32_t last_us[FFR_STAGE_MAX];        /*!< time of each stage after the sample, last reaction, in us  */
+    uint32_t worst_us[FFR_STAGE_MAX];       /*!< worst-case time of each stage after the sample, in us      */
+} FFR_LATENCY_s;
+
+/*================== Constant and Variable Definitions ====================*/
+
+/*================== Function Prototypes ==================================*/
+
+/**
+ * @brief   initializes the fast fault reaction and its time base
+ */
+extern void FFR_Init(void);
+
+/**
+ * @brief   checks a new current sample against the hard current limits
+ *
+ * @details Must be called in the context that receives the current sample,
+ *          e.g., the CAN RX processing of the current sensor. Opens all
+ *          contactors immediately if the limit is violated for
+ *          FFR_DEBOUNCE_SAMPLES consecutive samples.
+ *
+ * @param   current     current in mA, sign as delivered by the current sensor
+ */
+extern void FFR_CheckCurrent(float current);
+
+/**
+ * @brief   checks new cell voltage extrema against the hard voltage limits
+ *
+ * @details Same as FFR_CheckCurrent(), for the end of a cell voltage measurement.
+ *
+ * @param   voltage_min     minimum cell voltage in mV
+ * @param   voltage_max     maximum cell voltage in mV
+ */
+extern void FFR_CheckCellVoltages(uint16_t voltage_min, uint16_t voltage_max);
+
+/**
+ * @brief   cyclic part of the fast fault reaction, must be called every 1ms
+ *
+ * @details Picks up new cell voltage measurements, timestamps the confirmed
+ *          opening of the contactors and reports a reaction to the DIAG module.
+ */
+extern void FFR_Trigger(void);
+
+/**
+ * @brief   returns if a fast fault reaction is in progress
+ *
+ * @details The reaction stays active from opening the contactors until the
+ *          limit violations are gone and the DIAG channel is reset. The
+ *          contactors must not be closed in the meantime.
+ *
+ * @return  TRUE while a reaction is active, FALSE otherwise
+ */
+extern uint8_t FFR_IsTripped(void);
+
+/**
+ * @brief   copies the latency statistics of the fast fault reaction
+ *
+ * @param   latency     pointer where the statistics are copied to
+ */
+extern void FFR_GetLatency(FFR_LATENCY_s *latency);
+
+/*================== Function Implementations =============================*/
+
+#endif /* FFR_H_ */
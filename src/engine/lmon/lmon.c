@@ -0,0 +1,216 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    lmon.c
+ * @author  foxBMS Team
+ * @date    18.10.2026 (date of creation)
+ * @ingroup ENGINE
+ * @prefix  LMON
+ *
+ * @brief   Generic limit monitor with hysteresis and debouncing
+ *
+ * Replaces the raw OK/NOK toggling of the DIAG channels on every check by a
+ * debounced level per monitor. DIAG events are only generated on level
+ * changes.
+ */
+
+/*================== Includes =============================================*/
+#include "general.h"
+#include "lmon.h"
+
+#include "diag.h"
+#include "mcu.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/*================== Constant and Variable Definitions ====================*/
+
+/*================== Function Prototypes ==================================*/
+
+static uint8_t LMON_IsBeyond(LMON_DIRECTION_e direction, int32_t value, int32_t threshold);
+static LMON_LEVEL_e LMON_GetRawLevel(const LMON_MONITOR_s *monitor, int32_t value);
+static void LMON_Report(LMON_MONITOR_s *monitor);
+
+/*================== Function Implementations =============================*/
+
+/**
+ * @brief   checks if a value is beyond a threshold in the direction of the monitor
+ *
+ * @return  TRUE if value > threshold (upper limit) or value < threshold (lower limit)
+ */
+static uint8_t LMON_IsBeyond(LMON_DIRECTION_e direction, int32_t value, int32_t threshold) {
+    if (direction == LMON_UPPER_LIMIT) {
+        return (value > threshold);
+    }
+    return (value < threshold);
+}
+
+
+/**
+ * @brief   computes the level of a value without debouncing
+ *
+ * @details Levels up to the current level of the monitor are kept as long as
+ *          the value has not crossed their reset threshold, higher levels
+ *          are entered when the value crosses their set threshold.
+ *
+ * @return  highest level that is active for value
+ */
+static LMON_LEVEL_e LMON_GetRawLevel(const LMON_MONITOR_s *monitor, int32_t value) {
+    const LMON_CONFIG_s *cfg = monitor->cfg;
+    const LMON_THRESHOLD_s *threshold = NULL_PTR;
+    uint8_t level = LMON_NR_OF_LEVELS;
+    int32_t limit = 0;
+
+    while (level > LMON_LEVEL_OK) {
+        threshold = &cfg->level[level - 1];
+        if (threshold->enabled == TRUE) {
+            if (level <= monitor->level) {
+                /* level active, wait for the reset threshold: leave if not beyond reset anymore */
+                limit = threshold->reset;
+            } else {
+                limit = threshold->set;
+            }
+            if (LMON_IsBeyond(cfg->direction, value, limit) == TRUE) {
+                return (LMON_LEVEL_e)level;
+            }
+        }
+        level--;
+    }
+
+    return LMON_LEVEL_OK;
+}
+
+
+/**
+ * @brief   reports level changes of a monitor to the DIAG module
+ *
+ * @details A level is reported as NOK while the monitor is at or above it.
+ *          If the DIAG module is not ready yet, the event is repeated on the
+ *          next evaluation.
+ */
+static void LMON_Report(LMON_MONITOR_s *monitor) {
+    const LMON_THRESHOLD_s *threshold = NULL_PTR;
+    DIAG_EVENT_e event = DIAG_EVENT_OK;
+    uint8_t active = 0;
+    uint8_t i = 0;
+
+    for (i = 0; i < LMON_NR_OF_LEVELS; i++) {
+        threshold = &monitor->cfg->level[i];
+        if (threshold->diag_ch == LMON_NO_DIAG_CH) {
+            continue;
+        }
+        active = (monitor->level > i) ? 1 : 0;
+        if (active != ((monitor->reported >> i) & 1u)) {
+            event = (active == 1) ? DIAG_EVENT_NOK : DIAG_EVENT_OK;
+            if (DIAG_Handler(threshold->diag_ch, event, 0, NULL_PTR) != DIAG_HANDLER_RETURN_NOT_READY) {
+                monitor->reported ^= (uint8_t)(1u << i);
+            }
+        }
+    }
+}
+
+
+void LMON_Init(LMON_MONITOR_s *monitors, const LMON_CONFIG_s *cfg, uint16_t nr) {
+    uint16_t i = 0;
+    uint8_t j = 0;
+
+    for (i = 0; i < nr; i++) {
+        monitors[i].cfg = &cfg[i];
+        monitors[i].channels = 0;
+        for (j = 0; j < LMON_NR_OF_LEVELS; j++) {
+            if (cfg[i].level[j].diag_ch != LMON_NO_DIAG_CH) {
+                monitors[i].channels |= (uint8_t)(1u << j);
+            }
+        }
+        monitors[i].level = LMON_LEVEL_OK;
+        monitors[i].pending = LMON_LEVEL_OK;
+        monitors[i].since = 0;
+        monitors[i].reported = 0;
+        monitors[i].held = FALSE;
+        monitors[i].value = 0;
+    }
+}
+
+
+void LMON_Evaluate(LMON_MONITOR_s *monitors, const int32_t *values, uint16_t nr) {
+    LMON_MONITOR_s *monitor = NULL_PTR;
+    LMON_LEVEL_e raw = LMON_LEVEL_OK;
+    uint32_t now = MCU_GetTimeStamp();
+    uint32_t delay = 0;
+    uint16_t i = 0;
+
+    for (i = 0; i < nr; i++) {
+        monitor = &monitors[i];
+        if (values[i] != LMON_VALUE_HOLD) {
+            monitor->value = values[i];
+            raw = LMON_GetRawLevel(monitor, values[i]);
+
+            // the value was not watched while held, so the delay of a pending level restarts
+            if (monitor->held == TRUE) {
+                monitor->held = FALSE;
+                monitor->since = now;
+            }
+            if (raw == monitor->level) {
+                monitor->pending = raw;
+            } else {
+                if (raw != monitor->pending) {
+                    monitor->pending = raw;
+                    monitor->since = now;
+                }
+                if (raw > monitor->level) {
+                    delay = monitor->cfg->level[raw - 1].on_delay_ms;
+                } else {
+                    delay = monitor->cfg->level[monitor->level - 1].off_delay_ms;
+                }
+                if ((uint32_t)(now - monitor->since) >= delay) {
+                    monitor->level = raw;
+                }
+            }
+        } else {
+            monitor->held = TRUE;
+        }
+
+        if (monitor->reported != (((1u << monitor->level) - 1u) & monitor->channels)) {
+            LMON_Report(monitor);
+        }
+    }
+}
+
+
+LMON_LEVEL_e LMON_GetLevel(const LMON_MONITOR_s *monitor) {
+    return monitor->level;
+}
+
+
+LMON_LEVEL_e LMON_GetHighestLevel(const LMON_MONITOR_s *monitors, uint16_t nr) {
+    LMON_LEVEL_e level = LMON_LEVEL_OK;
+    uint16_t i = 0;
+
+    for (i = 0; i < nr; i++) {
+        if (monitors[i].level > level) {
+            level = monitors[i].level;
+        }
+    }
+
+    return level;
+}
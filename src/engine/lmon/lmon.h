@@ -0,0 +1,173 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    lmon.h
+ * @author  foxBMS Team
+ * @date    18.10.2026 (date of creation)
+ * @ingroup ENGINE
+ * @prefix  LMON
+ *
+ * @brief   Generic limit monitor with hysteresis and debouncing
+ *
+ * A limit monitor compares a measured value against up to three levels
+ * (warning, error, critical). Each level has a set and a reset threshold
+ * (hysteresis) and an on and off delay in ms (debouncing). The DIAG module
+ * is only called when the reported state of a level changes, so the DIAG
+ * channels driven by limit monitors are configured with a threshold of 1.
+ */
+
+#ifndef LMON_H_
+#define LMON_H_
+
+/*================== Includes =============================================*/
+#include "general.h"
+#include "diag_cfg.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/**
+ * Value passed to LMON_Evaluate() for monitors that are not evaluated in
+ * this call, e.g. the charge limits while discharging. The level of the
+ * monitor is kept, the delay of a pending level restarts when the monitor
+ * is evaluated again.
+ */
+#define LMON_VALUE_HOLD     (INT32_MIN)
+
+/**
+ * DIAG channel of a level that is not reported to the DIAG module
+ */
+#define LMON_NO_DIAG_CH     (DIAG_ID_MAX)
+
+/**
+ * Threshold entry of a level that is not used
+ */
+#define LMON_LEVEL_UNUSED   { FALSE, 0, 0, 0, 0, LMON_NO_DIAG_CH }
+
+/**
+ * Levels of a limit monitor, ordered by severity
+ */
+typedef enum {
+    LMON_LEVEL_OK           = 0,    /*!< value within all limits                        */
+    LMON_LEVEL_WARNING      = 1,    /*!< warning limit violated, e.g. to start derating */
+    LMON_LEVEL_ERROR        = 2,    /*!< error limit violated                           */
+    LMON_LEVEL_CRITICAL     = 3,    /*!< critical limit violated                        */
+} LMON_LEVEL_e;
+
+/**
+ * Number of configurable levels (warning, error, critical)
+ */
+#define LMON_NR_OF_LEVELS   (3)
+
+/**
+ * Direction of the limits of a monitor
+ */
+typedef enum {
+    LMON_UPPER_LIMIT    = 0,    /*!< level entered if value > set, left if value <= reset  */
+    LMON_LOWER_LIMIT    = 1,    /*!< level entered if value < set, left if value >= reset  */
+} LMON_DIRECTION_e;
+
+/**
+ * Thresholds and delays of one level
+ */
+typedef struct {
+    uint8_t enabled;            /*!< FALSE if the level is not used                                     */
+    int32_t set;                /*!< threshold to enter the level                                       */
+    int32_t reset;              /*!< threshold to leave the level, on the safe side of set              */
+    uint16_t on_delay_ms;       /*!< time the value has to be beyond set before the level is entered   */
+    uint16_t off_delay_ms;      /*!< time the value has to be back beyond reset before it is left       */
+    DIAG_CH_ID_e diag_ch;       /*!< DIAG channel reporting the level, LMON_NO_DIAG_CH if none          */
+} LMON_THRESHOLD_s;
+
+/**
+ * Constant description of a limit monitor
+ */
+typedef struct {
+    LMON_DIRECTION_e direction;                     /*!< direction of the limits                            */
+    LMON_THRESHOLD_s level[LMON_NR_OF_LEVELS];      /*!< warning, error and critical level, in this order   */
+} LMON_CONFIG_s;
+
+/**
+ * Run time data of a limit monitor
+ */
+typedef struct {
+    const LMON_CONFIG_s *cfg;   /*!< constant description of the monitor                        */
+    LMON_LEVEL_e level;         /*!< debounced level                                            */
+    LMON_LEVEL_e pending;       /*!< level the monitor is about to change to                    */
+    uint32_t since;             /*!< MCU timestamp in ms at which pending was first detected    */
+    uint8_t channels;           /*!< bit n set: level n+1 is reported to a DIAG channel         */
+    uint8_t reported;           /*!< bit n set: level n+1 reported as NOK to the DIAG module    */
+    uint8_t held;               /*!< TRUE if the monitor was held in the last evaluation        */
+    int32_t value;              /*!< last evaluated value                                       */
+} LMON_MONITOR_s;
+
+/*================== Constant and Variable Definitions ====================*/
+
+/*================== Function Prototypes ==================================*/
+
+/**
+ * @brief   initializes a set of limit monitors
+ *
+ * @details Monitor i is bound to cfg[i] and starts at LMON_LEVEL_OK.
+ *
+ * @param   monitors    monitors to initialize
+ * @param   cfg         constant descriptions, one per monitor
+ * @param   nr          number of monitors
+ */
+extern void LMON_Init(LMON_MONITOR_s *monitors, const LMON_CONFIG_s *cfg, uint16_t nr);
+
+/**
+ * @brief   evaluates a set of limit monitors
+ *
+ * @details Monitor i is evaluated with values[i], monitors with value
+ *          LMON_VALUE_HOLD are skipped. The timestamp is read once for the
+ *          whole set. The DIAG module is called only for levels whose
+ *          reported state changes.
+ *
+ * @param   monitors    monitors to evaluate
+ * @param   values      values to check, one per monitor
+ * @param   nr          number of monitors
+ */
+extern void LMON_Evaluate(LMON_MONITOR_s *monitors, const int32_t *values, uint16_t nr);
+
+/**
+ * @brief   gets the debounced level of a monitor
+ *
+ * @param   monitor     limit monitor
+ *
+ * @return  current level
+ */
+extern LMON_LEVEL_e LMON_GetLevel(const LMON_MONITOR_s *monitor);
+
+/**
+ * @brief   gets the highest debounced level of a set of monitors
+ *
+ * @param   monitors    limit monitors
+ * @param   nr          number of monitors
+ *
+ * @return  highest level
+ */
+extern LMON_LEVEL_e LMON_GetHighestLevel(const LMON_MONITOR_s *monitors, uint16_t nr);
+
+/*================== Function Implementations =============================*/
+
+#endif /* LMON_H_ */
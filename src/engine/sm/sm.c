@@ -0,0 +1,307 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    sm.c
+ * @author  foxBMS Team
+ * @date    18.10.2026 (date of creation)
+ * @ingroup ENGINE
+ * @prefix  SM
+ *
+ * @brief   Generic table-driven state machine engine
+ *
+ * Implements the boilerplate that was formerly copied into every state
+ * machine (re-entrance check, wait timer, state request handling) and
+ * dispatches the current state through its state table.
+ */
+
+/*================== Includes =============================================*/
+#include "general.h"
+#include "sm.h"
+
+#include "os.h"
+#include "mcu.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/*================== Constant and Variable Definitions ====================*/
+
+/*================== Function Prototypes ==================================*/
+static uint8_t SM_CheckReEntrance(SM_MACHINE_s *sm);
+static uint8_t SM_GetIndex(SM_MACHINE_s *sm, uint8_t id);
+static uint8_t SM_CheckTransitions(SM_MACHINE_s *sm, const SM_STATE_s *state);
+
+/*================== Function Implementations =============================*/
+
+/**
+ * @brief   re-entrance check of the state machine trigger function
+ *
+ * @details The trigger function of a state machine must never be called by two
+ *          different processes, so triggerentry should never be higher than 0
+ *          when this function is called.
+ *
+ * @param   sm  state machine
+ *
+ * @return  0 if no further instance of the function is active, 0xff else
+ */
+static uint8_t SM_CheckReEntrance(SM_MACHINE_s *sm) {
+    uint8_t retval = 0;
+
+    OS_TaskEnter_Critical();
+    if (!sm->triggerentry) {
+        sm->triggerentry++;
+    } else {
+        retval = 0xFF;  // multiple calls of function
+    }
+    OS_TaskExit_Critical();
+
+    return retval;
+}
+
+
+/**
+ * @brief   searches the state table for a state id
+ *
+ * @details Only called when a transition is taken, the cyclic dispatch uses
+ *          the stored index directly.
+ *
+ * @param   sm  state machine
+ * @param   id  state id to search for
+ *
+ * @return  index of the state, index of the current state if id is unknown
+ */
+static uint8_t SM_GetIndex(SM_MACHINE_s *sm, uint8_t id) {
+    uint8_t i = 0;
+
+    for (i = 0; i < sm->cfg->nr_states; i++) {
+        if (sm->cfg->states[i].id == id) {
+            return i;
+        }
+    }
+    return sm->index;
+}
+
+
+/**
+ * @brief   evaluates the transitions of the current state in table order
+ *
+ * @details A transition bound to a state request consumes the request when it
+ *          is taken. Requests accepted with SM_STATE_STAY or dropped with
+ *          SM_STATE_REJECT do not leave the state, so the run action is
+ *          still called.
+ *
+ * @param   sm      state machine
+ * @param   state   current state
+ *
+ * @return  TRUE if the state was left, FALSE otherwise
+ */
+static uint8_t SM_CheckTransitions(SM_MACHINE_s *sm, const SM_STATE_s *state) {
+    const SM_TRANSITION_s *transition = NULL_PTR;
+    uint8_t statereq = SM_GetStateRequest(sm);
+    uint8_t i = 0;
+
+    for (i = 0; i < state->nr_transitions; i++) {
+        transition = &state->transitions[i];
+
+        if (transition->request == SM_REQ_ANY) {
+            if (statereq == sm->cfg->noreq) {
+                continue;
+            }
+        } else if (transition->request != SM_REQ_NONE) {
+            if (transition->request != statereq) {
+                continue;
+            }
+        }
+
+        if (transition->guard != NULL_PTR && transition->guard() == FALSE) {
+            continue;
+        }
+
+        if (transition->request != SM_REQ_NONE) {
+            // an error request may have overwritten the request in the meantime, keep it pending then
+            OS_TaskEnter_Critical();
+            if (sm->statereq == statereq) {
+                sm->statereq = sm->cfg->noreq;
+            }
+            OS_TaskExit_Critical();
+        }
+
+        if (transition->target == SM_STATE_STAY) {
+            return FALSE;
+        } else if (transition->target == SM_STATE_REJECT) {
+            sm->ErrRequestCounter++;  // illegal request pending
+            return FALSE;
+        }
+
+        SM_Transition(sm, transition->target, transition->timer);
+        return TRUE;
+    }
+
+    return FALSE;
+}
+
+
+void SM_Trigger(SM_MACHINE_s *sm) {
+    const SM_STATE_s *state = NULL_PTR;
+
+    // Check re-entrance of function
+    if (SM_CheckReEntrance(sm)) {
+        return;
+    }
+
+    if (sm->cfg->cyclic != NULL_PTR) {
+        sm->cfg->cyclic();
+    }
+
+    if (sm->statetime < (UINT32_MAX - sm->cfg->cycletime)) {
+        sm->statetime += sm->cfg->cycletime;
+    }
+
+    if (sm->timer) {
+        if (sm->timer > sm->cfg->cycletime) {
+            sm->timer -= sm->cfg->cycletime;
+        } else {
+            sm->timer = 0;
+        }
+        if (sm->timer) {
+            sm->triggerentry--;
+            return;    // handle state machine only if timer has elapsed
+        }
+    }
+
+    state = &sm->cfg->states[sm->index];
+
+    if (sm->entrypending == TRUE) {
+        sm->entrypending = FALSE;
+        if (state->entry != NULL_PTR) {
+            state->entry();
+            sm->counter++;
+            sm->triggerentry--;
+            return;
+        }
+    }
+
+    if (SM_CheckTransitions(sm, state) == FALSE) {
+        if (state->timeout != 0 && sm->statetime >= state->timeout) {
+            SM_Transition(sm, state->timeoutstate, 0);
+            sm->substate = state->timeoutsubstate;
+        } else if (state->run != NULL_PTR) {
+            state->run();
+        }
+    }
+
+    sm->counter++;
+    sm->triggerentry--;
+}
+
+
+void SM_Transition(SM_MACHINE_s *sm, uint8_t target, uint16_t timer) {
+    const SM_STATE_s *state = &sm->cfg->states[sm->index];
+    SM_TRACE_ENTRY_s *entry = &sm->trace[sm->traceidx];
+
+    if (state->exit != NULL_PTR) {
+        state->exit();
+    }
+
+    entry->timestamp = MCU_GetTimeStamp();
+    entry->from = state->id;
+    entry->fromsubstate = sm->substate;
+    entry->to = target;
+    sm->traceidx = (sm->traceidx + 1) % SM_TRACE_LENGTH;
+    if (sm->tracecount < SM_TRACE_LENGTH) {
+        sm->tracecount++;
+    }
+
+    sm->laststate = state->id;
+    sm->lastsubstate = sm->substate;
+    sm->index = SM_GetIndex(sm, target);
+    sm->substate = SM_ENTRY;
+    sm->timer = timer;
+    sm->statetime = 0;
+    sm->entrypending = TRUE;
+}
+
+
+void SM_SetSubstate(SM_MACHINE_s *sm, uint8_t substate, uint16_t timer) {
+    sm->substate = substate;
+    sm->timer = timer;
+}
+
+
+uint8_t SM_SetStateRequest(SM_MACHINE_s *sm, uint8_t statereq, SM_CHECKREQUEST_f check) {
+    uint8_t retVal = 0;
+
+    OS_TaskEnter_Critical();
+    retVal = check(statereq);
+
+    if (retVal == 0) {
+        sm->statereq = statereq;
+    }
+    OS_TaskExit_Critical();
+
+    return retVal;
+}
+
+
+uint8_t SM_GetStateRequest(SM_MACHINE_s *sm) {
+    uint8_t retval = 0;
+
+    OS_TaskEnter_Critical();
+    retval = sm->statereq;
+    OS_TaskExit_Critical();
+
+    return retval;
+}
+
+
+uint8_t SM_TransferStateRequest(SM_MACHINE_s *sm) {
+    uint8_t retval = 0;
+
+    OS_TaskEnter_Critical();
+    retval = sm->statereq;
+    sm->statereq = sm->cfg->noreq;
+    OS_TaskExit_Critical();
+
+    return retval;
+}
+
+
+uint8_t SM_GetState(SM_MACHINE_s *sm) {
+    return sm->cfg->states[sm->index].id;
+}
+
+
+uint8_t SM_GetTrace(SM_MACHINE_s *sm, SM_TRACE_ENTRY_s *dest, uint8_t length) {
+    uint8_t nr_entries = 0;
+    uint8_t start = 0;
+    uint8_t i = 0;
+
+    OS_TaskEnter_Critical();
+    nr_entries = (sm->tracecount < length) ? sm->tracecount : length;
+    start = (sm->traceidx + SM_TRACE_LENGTH - nr_entries) % SM_TRACE_LENGTH;
+    for (i = 0; i < nr_entries; i++) {
+        dest[i] = sm->trace[(start + i) % SM_TRACE_LENGTH];
+    }
+    OS_TaskExit_Critical();
+
+    return nr_entries;
+}
@@ -0,0 +1,263 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    sm.h
+ * @author  foxBMS Team
+ * @date    18.10.2026 (date of creation)
+ * @ingroup ENGINE
+ * @prefix  SM
+ *
+ * @brief   Header of the generic table-driven state machine engine
+ *
+ * A state machine is described by a constant table of states. Each state has
+ * optional entry, run (do) and exit actions, an optional timeout and a list of
+ * guarded transitions. The current state is kept as index into that table, so
+ * the dispatch in SM_Trigger() does not depend on the number of states.
+ * State requests, re-entrance protection, the wait timer and a transition
+ * trace are handled by the engine for all state machines alike.
+ */
+
+#ifndef SM_H_
+#define SM_H_
+
+/*================== Includes =============================================*/
+#include "sm_cfg.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/**
+ * Request field of a transition: the transition is not bound to a state
+ * request and is taken as soon as its guard returns TRUE
+ */
+#define SM_REQ_NONE         (0xFEu)
+
+/**
+ * Request field of a transition: the transition matches any pending state
+ * request (used as catch-all at the end of a transition list)
+ */
+#define SM_REQ_ANY          (0xFFu)
+
+/**
+ * Target of a transition: the state request is accepted, but the state
+ * machine stays in the current state
+ */
+#define SM_STATE_STAY       (0xFEu)
+
+/**
+ * Target of a transition: the state request is dropped and counted as
+ * illegal request
+ */
+#define SM_STATE_REJECT     (0xFDu)
+
+/**
+ * Substate every state starts with after a transition
+ */
+#define SM_ENTRY            (0u)
+
+/**
+ * Counts the number of elements of a constant table, used to fill in the
+ * transition and state counts
+ */
+#define SM_NR_OF(table)     ((uint8_t)(sizeof(table)/sizeof((table)[0])))
+
+/**
+ * Action function of a state (entry, run and exit)
+ */
+typedef void (*SM_ACTION_f)(void);
+
+/**
+ * Guard function of a transition, returns TRUE if the transition may be taken
+ */
+typedef uint8_t (*SM_GUARD_f)(void);
+
+/**
+ * Validation function for state requests, returns 0 if the request is
+ * accepted, otherwise a module specific error code
+ */
+typedef uint8_t (*SM_CHECKREQUEST_f)(uint8_t statereq);
+
+/**
+ * Guarded transition leaving a state
+ */
+typedef struct {
+    uint8_t request;                        /*!< state request that triggers the transition, SM_REQ_NONE or SM_REQ_ANY     */
+    SM_GUARD_f guard;                       /*!< additional condition, NULL_PTR if the transition is unconditional          */
+    uint8_t target;                         /*!< target state id, SM_STATE_STAY or SM_STATE_REJECT                          */
+    uint16_t timer;                         /*!< wait time set when the transition is taken                                 */
+} SM_TRANSITION_s;
+
+/**
+ * Entry of the state table of a state machine
+ */
+typedef struct {
+    uint8_t id;                             /*!< state id as published by the module, e.g. BMS_STATEMACH_NORMAL             */
+    SM_ACTION_f entry;                      /*!< called once on the first processed trigger after entering the state       */
+    SM_ACTION_f run;                        /*!< called on every processed trigger if no transition was taken              */
+    SM_ACTION_f exit;                       /*!< called when the state is left                                              */
+    uint32_t timeout;                       /*!< maximum time in the state in timer units, 0 if there is no timeout         */
+    uint8_t timeoutstate;                   /*!< state id entered when the timeout elapsed                                  */
+    uint8_t timeoutsubstate;                /*!< substate set in timeoutstate, e.g. to record the cause                     */
+    const SM_TRANSITION_s *transitions;     /*!< transitions evaluated in order before the run action                       */
+    uint8_t nr_transitions;                 /*!< number of entries in transitions                                           */
+} SM_STATE_s;
+
+/**
+ * Constant description of a state machine
+ */
+typedef struct {
+    const SM_STATE_s *states;               /*!< state table, the first entry is the initial state                          */
+    uint8_t nr_states;                      /*!< number of entries in states                                                */
+    SM_ACTION_f cyclic;                     /*!< called on every trigger independent of the timer, may be NULL_PTR          */
+    uint16_t cycletime;                     /*!< time elapsed between two triggers in timer units                           */
+    uint8_t noreq;                          /*!< value of the module specific "no request" state request                    */
+} SM_CONFIG_s;
+
+/**
+ * Entry of the transition trace
+ */
+typedef struct {
+    uint32_t timestamp;                     /*!< MCU timestamp of the transition                                            */
+    uint8_t from;                           /*!< state id that was left                                                     */
+    uint8_t fromsubstate;                   /*!< substate at the time the state was left                                    */
+    uint8_t to;                             /*!< state id that was entered                                                  */
+} SM_TRACE_ENTRY_s;
+
+/**
+ * Run time data of a state machine
+ */
+typedef struct {
+    const SM_CONFIG_s *cfg;                 /*!< constant description of the state machine                                  */
+    uint16_t timer;                         /*!< time before the state machine processes the next state, in timer units    */
+    uint8_t statereq;                       /*!< current state request made to the state machine                            */
+    uint8_t index;                          /*!< index of the current state in the state table                              */
+    uint8_t substate;                       /*!< current substate, managed by the run actions of the module                 */
+    uint8_t laststate;                      /*!< state id before the last transition                                        */
+    uint8_t lastsubstate;                   /*!< substate before the last transition                                        */
+    uint8_t entrypending;                   /*!< TRUE if the entry action of the current state has not been called yet     */
+    uint8_t triggerentry;                   /*!< counter for re-entrance protection (function running flag)                 */
+    uint32_t ErrRequestCounter;             /*!< counts the number of illegal requests to the state machine                 */
+    uint32_t statetime;                     /*!< time spent in the current state in timer units                             */
+    uint32_t counter;                       /*!< number of processed triggers                                               */
+    SM_TRACE_ENTRY_s trace[SM_TRACE_LENGTH];    /*!< ring buffer of the last transitions                                    */
+    uint8_t traceidx;                       /*!< next write position in trace                                               */
+    uint8_t tracecount;                     /*!< number of valid entries in trace                                           */
+} SM_MACHINE_s;
+
+/*================== Constant and Variable Definitions ====================*/
+
+/*================== Function Prototypes ==================================*/
+
+/**
+ * @brief   trigger function of a state machine
+ *
+ * @details Calls the cyclic action, counts down the wait timer and, once it
+ *          elapsed, processes the current state: the entry action if the
+ *          state was just entered, otherwise the transitions in table order,
+ *          then the timeout and finally the run action.
+ *          The function is protected against re-entrance.
+ *
+ * @param   sm  state machine to trigger
+ */
+extern void SM_Trigger(SM_MACHINE_s *sm);
+
+/**
+ * @brief   performs a transition to the given state
+ *
+ * @details Calls the exit action of the current state, records the transition
+ *          in the trace and switches to the target state with substate
+ *          SM_ENTRY. The entry action of the target is called on the next
+ *          processed trigger.
+ *
+ * @param   sm      state machine
+ * @param   target  id of the target state
+ * @param   timer   wait time before the target state is processed
+ */
+extern void SM_Transition(SM_MACHINE_s *sm, uint8_t target, uint16_t timer);
+
+/**
+ * @brief   sets the substate and the wait time of a state machine
+ *
+ * @param   sm          state machine
+ * @param   substate    new substate
+ * @param   timer       wait time before the state machine is processed again
+ */
+extern void SM_SetSubstate(SM_MACHINE_s *sm, uint8_t substate, uint16_t timer);
+
+/**
+ * @brief   sets a state request after validating it
+ *
+ * @details The validation function is called within a critical section. The
+ *          request is stored only if it returns 0.
+ *
+ * @param   sm          state machine
+ * @param   statereq    state request
+ * @param   check       module specific validation function
+ *
+ * @return  return value of check
+ */
+extern uint8_t SM_SetStateRequest(SM_MACHINE_s *sm, uint8_t statereq, SM_CHECKREQUEST_f check);
+
+/**
+ * @brief   gets the pending state request without resetting it
+ *
+ * @param   sm  state machine
+ *
+ * @return  pending state request
+ */
+extern uint8_t SM_GetStateRequest(SM_MACHINE_s *sm);
+
+/**
+ * @brief   transfers the pending state request to the state machine
+ *
+ * @details The pending request is reset to the "no request" value of the
+ *          state machine.
+ *
+ * @param   sm  state machine
+ *
+ * @return  pending state request
+ */
+extern uint8_t SM_TransferStateRequest(SM_MACHINE_s *sm);
+
+/**
+ * @brief   gets the id of the current state
+ *
+ * @param   sm  state machine
+ *
+ * @return  id of the current state
+ */
+extern uint8_t SM_GetState(SM_MACHINE_s *sm);
+
+/**
+ * @brief   copies the transition trace, oldest entry first
+ *
+ * @param   sm      state machine
+ * @param   dest    destination buffer
+ * @param   length  number of entries available in dest
+ *
+ * @return  number of entries copied
+ */
+extern uint8_t SM_GetTrace(SM_MACHINE_s *sm, SM_TRACE_ENTRY_s *dest, uint8_t length);
+
+/*================== Function Implementations =============================*/
+
+#endif /* SM_H_ */
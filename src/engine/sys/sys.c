@@ -43,132 +43,163 @@
 #include "database_cfg.h"
 #include "isoguard.h"
 #include "sox.h"
+#include "soh.h"
+#include "thermal.h"
 #include "bal.h"
+#include "bal_energy.h"
+#include "sm.h"
 
 /*================== Macros and Definitions ===============================*/
 
-/**
- * Saves the last state and the last substate
- */
-#define SYS_SAVELASTSTATES()    sys_state.laststate = sys_state.state; \
-                                sys_state.lastsubstate = sys_state.substate
+/*================== Function Prototypes ==================================*/
+
+static uint8_t SYS_CheckStateRequest(uint8_t statereq);
+
+static uint8_t SYS_IsInterlockInitialized(void);
+static uint8_t SYS_IsContactorInitialized(void);
+static uint8_t SYS_IsBalancingInitialized(void);
+static uint8_t SYS_IsFirstMeasurementCycleFinished(void);
+#if CURRENT_SENSOR_PRESENT == TRUE
+static uint8_t SYS_IsCurrentSensorPresent(void);
+#endif
+static uint8_t SYS_IsBmsInitialized(void);
+
+static void SYS_EntryInitializeInterlock(void);
+static void SYS_ExitInitializeInterlock(void);
+static void SYS_EntryInitializeContactors(void);
+static void SYS_EntryInitializeBalancing(void);
+static void SYS_ExitInitializeBalancing(void);
+static void SYS_EntryFirstMeasurementCycle(void);
+static void SYS_EntryInitializeMisc(void);
+static void SYS_EntryInitializeBms(void);
+static void SYS_RunPoll(void);
+static void SYS_RunPollMedium(void);
+static void SYS_RunIdle(void);
 
 /*================== Constant and Variable Definitions ====================*/
 
-/**
- * contains the state of the contactor state machine
- *
- */
-static SYS_STATE_s sys_state = {
-    .timer                  = 0,
-    .statereq               = SYS_STATE_NO_REQUEST,
-    .state                  = SYS_STATEMACH_UNINITIALIZED,
-    .substate               = SYS_ENTRY,
-    .laststate              = SYS_STATEMACH_UNINITIALIZED,
-    .lastsubstate           = 0,
-    .triggerentry           = 0,
-    .ErrRequestCounter      = 0,
+static const SM_TRANSITION_s sys_uninitialized_transitions[] = {
+    {SYS_STATE_INIT_REQUEST,    NULL_PTR,                               SYS_STATEMACH_INITIALIZATION,               SYS_STATEMACH_SHORTTIME_MS},
+    {SM_REQ_ANY,                NULL_PTR,                               SM_STATE_REJECT,                            0},
 };
 
-/*================== Function Prototypes ==================================*/
+static const SM_TRANSITION_s sys_initialization_transitions[] = {
+    {SM_REQ_NONE,               NULL_PTR,                               SYS_STATEMACH_INITIALIZED,                  SYS_STATEMACH_SHORTTIME_MS},
+};
 
-static SYS_RETURN_TYPE_e SYS_CheckStateRequest(SYS_STATE_REQUEST_e statereq);
-static SYS_STATE_REQUEST_e SYS_GetStateRequest(void);
-static SYS_STATE_REQUEST_e SYS_TransferStateRequest(void);
-static uint8_t SYS_CheckReEntrance(void);
+static const SM_TRANSITION_s sys_initialized_transitions[] = {
+    {SM_REQ_NONE,               NULL_PTR,                               SYS_STATEMACH_INITIALIZE_INTERLOCK,         SYS_STATEMACH_SHORTTIME_MS},
+};
 
-/*================== Function Implementations =============================*/
+static const SM_TRANSITION_s sys_initialize_interlock_transitions[] = {
+    {SM_REQ_NONE,               SYS_IsInterlockInitialized,             SYS_STATEMACH_INITIALIZE_CONTACTORS,        SYS_STATEMACH_SHORTTIME_MS},
+};
 
-/**
- * @brief   re-entrance check of SYS state machine trigger function
- *
- * This function is not re-entrant and should only be called time- or event-triggered.
- * It increments the triggerentry counter from the state variable ltc_state.
- * It should never be called by two different processes, so if it is the case, triggerentry
- * should never be higher than 0 when this function is called.
- *
- *
- * @return  retval  0 if no further instance of the function is active, 0xff else
- *
- */
-static uint8_t SYS_CheckReEntrance(void) {
-    uint8_t retval = 0;
+static const SM_TRANSITION_s sys_initialize_contactors_transitions[] = {
+    {SM_REQ_NONE,               SYS_IsContactorInitialized,             SYS_STATEMACH_INITIALIZE_BALANCING,         SYS_STATEMACH_SHORTTIME_MS},
+};
 
-    taskENTER_CRITICAL();
-    if (!sys_state.triggerentry) {
-        sys_state.triggerentry++;
-    } else {
-        retval = 0xFF;  // multiple calls of function
-    }
-    taskEXIT_CRITICAL();
+static const SM_TRANSITION_s sys_initialize_balancing_transitions[] = {
+    {SM_REQ_NONE,               SYS_IsBalancingInitialized,             SYS_STATEMACH_FIRST_MEASUREMENT_CYCLE,      SYS_STATEMACH_SHORTTIME_MS},
+};
 
-    return retval;
-}
+static const SM_TRANSITION_s sys_first_measurement_cycle_transitions[] = {
+#if CURRENT_SENSOR_PRESENT == TRUE
+    {SM_REQ_NONE,               SYS_IsFirstMeasurementCycleFinished,    SYS_STATEMACH_CHECK_CURRENT_SENSOR_PRESENCE, SYS_STATEMACH_SHORTTIME_MS},
+#else
+    {SM_REQ_NONE,               SYS_IsFirstMeasurementCycleFinished,    SYS_STATEMACH_INITIALIZE_MISC,              SYS_STATEMACH_SHORTTIME_MS},
+#endif
+};
 
+#if CURRENT_SENSOR_PRESENT == TRUE
+static const SM_TRANSITION_s sys_check_current_sensor_presence_transitions[] = {
+    {SM_REQ_NONE,               SYS_IsCurrentSensorPresent,             SYS_STATEMACH_INITIALIZE_MISC,              SYS_STATEMACH_SHORTTIME_MS},
+};
+#endif
 
+static const SM_TRANSITION_s sys_initialize_misc_transitions[] = {
+    {SM_REQ_NONE,               NULL_PTR,                               SYS_STATEMACH_INITIALIZE_BMS,               SYS_STATEMACH_MEDIUMTIME_MS},
+};
 
+static const SM_TRANSITION_s sys_initialize_bms_transitions[] = {
+    {SM_REQ_NONE,               SYS_IsBmsInitialized,                   SYS_STATEMACH_RUNNING,                      SYS_STATEMACH_SHORTTIME_MS},
+};
 
 /**
- * @brief   gets the current state request.
- *
- * This function is used in the functioning of the SYS state machine.
- *
- * @return  retval  current state request, taken from SYS_STATE_REQUEST_e
+ * state table of the SYS state machine, the first entry is the initial state
  */
-static SYS_STATE_REQUEST_e SYS_GetStateRequest(void) {
-    SYS_STATE_REQUEST_e retval = SYS_STATE_NO_REQUEST;
-
-    taskENTER_CRITICAL();
-    retval    = sys_state.statereq;
-    taskEXIT_CRITICAL();
-
-    return (retval);
-}
-
-
-SYS_STATEMACH_e SYS_GetState(void) {
-    return (sys_state.state);
-}
+static const SM_STATE_s sys_states[] = {
+    /* id                                           entry                               run                 exit                            timeout, target, substate */
+    {SYS_STATEMACH_UNINITIALIZED,                   NULL_PTR,                           NULL_PTR,           NULL_PTR,                       0, 0, 0,
+        sys_uninitialized_transitions,              SM_NR_OF(sys_uninitialized_transitions)},
+    {SYS_STATEMACH_INITIALIZATION,                  NULL_PTR,                           NULL_PTR,           NULL_PTR,                       0, 0, 0,
+        sys_initialization_transitions,             SM_NR_OF(sys_initialization_transitions)},
+    {SYS_STATEMACH_INITIALIZED,                     NULL_PTR,                           NULL_PTR,           NULL_PTR,                       0, 0, 0,
+        sys_initialized_transitions,                SM_NR_OF(sys_initialized_transitions)},
+    {SYS_STATEMACH_INITIALIZE_INTERLOCK,            SYS_EntryInitializeInterlock,       SYS_RunPoll,        SYS_ExitInitializeInterlock,
+        SYS_STATEMACH_INITIALIZATION_TIMEOUT,       SYS_STATEMACH_ERROR,                SYS_ILCK_INIT_ERROR,
+        sys_initialize_interlock_transitions,       SM_NR_OF(sys_initialize_interlock_transitions)},
+    {SYS_STATEMACH_INITIALIZE_CONTACTORS,           SYS_EntryInitializeContactors,      SYS_RunPoll,        NULL_PTR,
+        SYS_STATEMACH_INITIALIZATION_TIMEOUT,       SYS_STATEMACH_ERROR,                SYS_CONT_INIT_ERROR,
+        sys_initialize_contactors_transitions,      SM_NR_OF(sys_initialize_contactors_transitions)},
+    {SYS_STATEMACH_INITIALIZE_BALANCING,            SYS_EntryInitializeBalancing,       SYS_RunPoll,        SYS_ExitInitializeBalancing,
+        SYS_STATEMACH_INITIALIZATION_TIMEOUT,       SYS_STATEMACH_ERROR,                SYS_CONT_INIT_ERROR,
+        sys_initialize_balancing_transitions,       SM_NR_OF(sys_initialize_balancing_transitions)},
+    {SYS_STATEMACH_FIRST_MEASUREMENT_CYCLE,         SYS_EntryFirstMeasurementCycle,     SYS_RunPollMedium,  NULL_PTR,
+        SYS_STATEMACH_INITIALIZATION_TIMEOUT,       SYS_STATEMACH_ERROR,                SYS_MEAS_INIT_ERROR,
+        sys_first_measurement_cycle_transitions,    SM_NR_OF(sys_first_measurement_cycle_transitions)},
+#if CURRENT_SENSOR_PRESENT == TRUE
+    {SYS_STATEMACH_CHECK_CURRENT_SENSOR_PRESENCE,   NULL_PTR,                           SYS_RunPollMedium,  NULL_PTR,
+        SYS_STATEMACH_INITIALIZATION_TIMEOUT,       SYS_STATEMACH_ERROR,                SYS_CURRENT_SENSOR_PRESENCE_ERROR,
+        sys_check_current_sensor_presence_transitions, SM_NR_OF(sys_check_current_sensor_presence_transitions)},
+#endif
+    {SYS_STATEMACH_INITIALIZE_MISC,                 SYS_EntryInitializeMisc,            NULL_PTR,           NULL_PTR,                       0, 0, 0,
+        sys_initialize_misc_transitions,            SM_NR_OF(sys_initialize_misc_transitions)},
+    {SYS_STATEMACH_INITIALIZE_BMS,                  SYS_EntryInitializeBms,             SYS_RunPoll,        NULL_PTR,
+        SYS_STATEMACH_INITIALIZATION_TIMEOUT,       SYS_STATEMACH_ERROR,                SYS_BMS_INIT_ERROR,
+        sys_initialize_bms_transitions,             SM_NR_OF(sys_initialize_bms_transitions)},
+    {SYS_STATEMACH_RUNNING,                         NULL_PTR,                           SYS_RunIdle,        NULL_PTR,                       0, 0, 0,
+        NULL_PTR,                                   0},
+    {SYS_STATEMACH_ERROR,                           NULL_PTR,                           SYS_RunIdle,        NULL_PTR,                       0, 0, 0,
+        NULL_PTR,                                   0},
+};
 
+static const SM_CONFIG_s sys_sm_cfg = {
+    .states         = sys_states,
+    .nr_states      = SM_NR_OF(sys_states),
+    .cyclic         = NULL_PTR,
+    .cycletime      = 1,
+    .noreq          = SYS_STATE_NO_REQUEST,
+};
 
 /**
- * @brief   transfers the current state request to the state machine.
- *
- * This function takes the current state request from cont_state and transfers it to the state machine.
- * It resets the value from cont_state to SYS_STATE_NO_REQUEST
- *
- * @return  retVal          current state request, taken from SYS_STATE_REQUEST_e
- *
+ * contains the state of the SYS state machine
  */
-static SYS_STATE_REQUEST_e SYS_TransferStateRequest(void) {
-    SYS_STATE_REQUEST_e retval = SYS_STATE_NO_REQUEST;
+static SM_MACHINE_s sys_sm = {
+    .cfg                    = &sys_sm_cfg,
+    .timer                  = 0,
+    .statereq               = SYS_STATE_NO_REQUEST,
+    .index                  = 0,
+    .substate               = SYS_ENTRY,
+    .laststate              = SYS_STATEMACH_UNINITIALIZED,
+    .lastsubstate           = 0,
+    .entrypending           = FALSE,
+    .triggerentry           = 0,
+    .ErrRequestCounter      = 0,
+};
 
-    taskENTER_CRITICAL();
-    retval    = sys_state.statereq;
-    sys_state.statereq = SYS_STATE_NO_REQUEST;
-    taskEXIT_CRITICAL();
+/*================== Function Implementations =============================*/
 
-    return (retval);
+SYS_STATEMACH_e SYS_GetState(void) {
+    return ((SYS_STATEMACH_e)SM_GetState(&sys_sm));
 }
 
 
-
 SYS_RETURN_TYPE_e SYS_SetStateRequest(SYS_STATE_REQUEST_e statereq) {
-    SYS_RETURN_TYPE_e retVal = SYS_STATE_NO_REQUEST;
-
-    taskENTER_CRITICAL();
-    retVal = SYS_CheckStateRequest(statereq);
-
-    if (retVal == SYS_OK) {
-            sys_state.statereq  = statereq;
-        }
-    taskEXIT_CRITICAL();
-
-    return (retVal);
+    return ((SYS_RETURN_TYPE_e)SM_SetStateRequest(&sys_sm, statereq, SYS_CheckStateRequest));
 }
 
 
-
 /**
  * @brief   checks the state requests that are made.
  *
@@ -179,15 +210,15 @@ SYS_RETURN_TYPE_e SYS_SetStateRequest(SYS_STATE_REQUEST_e statereq) {
  *
  * @return              result of the state request that was made, taken from SYS_RETURN_TYPE_e
  */
-static SYS_RETURN_TYPE_e SYS_CheckStateRequest(SYS_STATE_REQUEST_e statereq) {
+static uint8_t SYS_CheckStateRequest(uint8_t statereq) {
     if (statereq == SYS_STATE_ERROR_REQUEST) {
         return SYS_OK;
     }
 
-    if (sys_state.statereq == SYS_STATE_NO_REQUEST) {
+    if (sys_sm.statereq == SYS_STATE_NO_REQUEST) {
         // init only allowed from the uninitialized state
         if (statereq == SYS_STATE_INIT_REQUEST) {
-            if (sys_state.state == SYS_STATEMACH_UNINITIALIZED) {
+            if (SM_GetState(&sys_sm) == SYS_STATEMACH_UNINITIALIZED) {
                 return SYS_OK;
             } else {
                 return SYS_ALREADY_INITIALIZED;
@@ -202,286 +233,134 @@ static SYS_RETURN_TYPE_e SYS_CheckStateRequest(SYS_STATE_REQUEST_e statereq) {
 
 
 void SYS_Trigger(void) {
-    //  STD_RETURN_TYPE_e retVal=E_OK;
-    SYS_STATE_REQUEST_e statereq = SYS_STATE_NO_REQUEST;
-    ILCK_STATEMACH_e ilckstate = ILCK_STATEMACH_UNDEFINED;
-    CONT_STATEMACH_e contstate = CONT_STATEMACH_UNDEFINED;
-    BAL_STATEMACH_e balstate = BAL_STATEMACH_UNDEFINED;
-    BMS_STATEMACH_e bmsstate = BMS_STATEMACH_UNDEFINED;
+    DIAG_SysMonNotify(DIAG_SYSMON_SYS_ID, 0);  // task is running, state = ok
 
+    SM_Trigger(&sys_sm);
+}
 
-    DIAG_SysMonNotify(DIAG_SYSMON_SYS_ID, 0);  // task is running, state = ok
-    // Check re-entrance of function
-    if (SYS_CheckReEntrance()) {
-        return;
+/*================== Guards ===============================================*/
+
+/**
+ * @brief   guard: interlock state machine waits for its first request
+ */
+static uint8_t SYS_IsInterlockInitialized(void) {
+    return (ILCK_GetState() == ILCK_STATEMACH_WAIT_FIRST_REQUEST);
+}
+
+/**
+ * @brief   guard: contactor state machine reached standby
+ */
+static uint8_t SYS_IsContactorInitialized(void) {
+    return (CONT_GetState() == CONT_STATEMACH_STANDBY);
+}
+
+/**
+ * @brief   guard: balancing state machine is initialized
+ */
+static uint8_t SYS_IsBalancingInitialized(void) {
+    BAL_STATEMACH_e balstate = BAL_GetState();
+
+    return (balstate == BAL_STATEMACH_INITIALIZED || balstate == BAL_STATEMACH_INACTIVE);
+}
+
+/**
+ * @brief   guard: first measurement cycle is complete
+ */
+static uint8_t SYS_IsFirstMeasurementCycleFinished(void) {
+    return (MEAS_IsFirstMeasurementCycleFinished() == TRUE);
+}
+
+#if CURRENT_SENSOR_PRESENT == TRUE
+/**
+ * @brief   guard: current sensor answers on CAN
+ */
+static uint8_t SYS_IsCurrentSensorPresent(void) {
+    return (CANS_IsCurrentSensorPresent() == TRUE);
+}
+#endif
+
+/**
+ * @brief   guard: BMS state machine is initialized
+ */
+static uint8_t SYS_IsBmsInitialized(void) {
+    BMS_STATEMACH_e bmsstate = BMS_GetState();
+
+    return (bmsstate == BMS_STATEMACH_IDLE || bmsstate == BMS_STATEMACH_STANDBY);
+}
+
+/*================== Actions ==============================================*/
+
+static void SYS_EntryInitializeInterlock(void) {
+    ILCK_SetStateRequest(ILCK_STATE_INIT_REQUEST);
+    SM_SetSubstate(&sys_sm, SYS_WAIT_INITIALIZATION_INTERLOCK, SYS_STATEMACH_SHORTTIME_MS);
+}
+
+static void SYS_ExitInitializeInterlock(void) {
+    ILCK_SetStateRequest(ILCK_STATE_OPEN_REQUEST);
+}
+
+static void SYS_EntryInitializeContactors(void) {
+    CONT_SetStateRequest(CONT_STATE_INIT_REQUEST);
+    SM_SetSubstate(&sys_sm, SYS_WAIT_INITIALIZATION_CONT, SYS_STATEMACH_SHORTTIME_MS);
+}
+
+static void SYS_EntryInitializeBalancing(void) {
+    BAL_SetStateRequest(BAL_STATE_INIT_REQUEST);
+    SM_SetSubstate(&sys_sm, SYS_WAIT_INITIALIZATION_BAL, SYS_STATEMACH_SHORTTIME_MS);
+}
+
+static void SYS_ExitInitializeBalancing(void) {
+    if (BALANCING_DEFAULT_INACTIVE == TRUE) {
+        BAL_SetStateRequest(BAL_STATE_INACTIVE_OVERRIDE_REQUEST);
     }
+}
 
-    if (sys_state.timer) {
-        if (--sys_state.timer) {
-            sys_state.triggerentry--;
-            return;  // handle state machine only if timer has elapsed
-        }
+static void SYS_EntryFirstMeasurementCycle(void) {
+    MEAS_StartMeasurement();
+    SM_SetSubstate(&sys_sm, SYS_WAIT_FIRST_MEASUREMENT_CYCLE, 0);
+}
+
+static void SYS_EntryInitializeMisc(void) {
+#if CURRENT_SENSOR_PRESENT == TRUE
+    SOF_Init();
+    if (CANS_IsCurrentSensorCCPresent() == TRUE) {
+        SOC_Init(TRUE);
+    } else {
+        SOC_Init(FALSE);
     }
+#else
+    SOC_Init(FALSE);
+#endif
+    SOH_Init();
+    SOE_Init();
+    THM_Init();
+#if BAL_ENERGY_ACCOUNTING == TRUE
+    BAL_EnergyInit();
+#endif
+    CANS_Enable_Periodic(TRUE);
+    ISO_Init();
+    sys_sm.timer = SYS_STATEMACH_MEDIUMTIME_MS;
+}
 
-    /****Happens every time the state machine is triggered**************/
-
-
-    switch (sys_state.state) {
-        /****************************UNINITIALIZED***********************************/
-        case SYS_STATEMACH_UNINITIALIZED:
-            // waiting for Initialization Request
-            statereq = SYS_TransferStateRequest();
-            if (statereq == SYS_STATE_INIT_REQUEST) {
-                SYS_SAVELASTSTATES();
-                sys_state.timer = SYS_STATEMACH_SHORTTIME_MS;
-                sys_state.state = SYS_STATEMACH_INITIALIZATION;
-                sys_state.substate = SYS_ENTRY;
-            } else if (statereq == SYS_STATE_NO_REQUEST) {
-                // no actual request pending //
-            } else {
-                sys_state.ErrRequestCounter++;   // illegal request pending
-            }
-            break;
-        /****************************INITIALIZATION**********************************/
-        case SYS_STATEMACH_INITIALIZATION:
-
-            SYS_SAVELASTSTATES();
-            //Initializations done here
-            sys_state.timer = SYS_STATEMACH_SHORTTIME_MS;
-            sys_state.state = SYS_STATEMACH_INITIALIZED;
-            sys_state.substate = SYS_ENTRY;
-            break;
-
-        /****************************INITIALIZED*************************************/
-        case SYS_STATEMACH_INITIALIZED:
-            SYS_SAVELASTSTATES();
-            sys_state.timer = SYS_STATEMACH_SHORTTIME_MS;
-            sys_state.state = SYS_STATEMACH_INITIALIZE_INTERLOCK;
-            sys_state.substate = SYS_ENTRY;
-            break;
-
-        /****************************INITIALIZE INTERLOCK*************************************/
-        case SYS_STATEMACH_INITIALIZE_INTERLOCK:
-            SYS_SAVELASTSTATES();
-
-            if (sys_state.substate == SYS_ENTRY) {
-                ILCK_SetStateRequest(ILCK_STATE_INIT_REQUEST);
-                sys_state.timer = SYS_STATEMACH_SHORTTIME_MS;
-                sys_state.substate = SYS_WAIT_INITIALIZATION_INTERLOCK;
-                sys_state.InitCounter = 0;
-                break;
-            } else if (sys_state.substate == SYS_WAIT_INITIALIZATION_INTERLOCK) {
-                ilckstate = ILCK_GetState();
-                if (ilckstate == ILCK_STATEMACH_WAIT_FIRST_REQUEST) {
-                    ILCK_SetStateRequest(ILCK_STATE_OPEN_REQUEST);
-                    sys_state.timer = SYS_STATEMACH_SHORTTIME_MS;
-                    sys_state.state = SYS_STATEMACH_INITIALIZE_CONTACTORS;
-                    sys_state.substate = SYS_ENTRY;
-                    break;
-                } else {
-                    if (sys_state.InitCounter > (1000/SYS_TASK_CYCLE_CONTEXT_MS)) {
-                        sys_state.timer = SYS_STATEMACH_SHORTTIME_MS;
-                        sys_state.state = SYS_STATEMACH_ERROR;
-                        sys_state.substate = SYS_ILCK_INIT_ERROR;
-                        break;
-                    }
-                    sys_state.timer = SYS_STATEMACH_SHORTTIME_MS;
-                    sys_state.InitCounter++;
-                    break;
-                }
-            }
+static void SYS_EntryInitializeBms(void) {
+    BMS_SetStateRequest(BMS_STATE_INIT_REQUEST);
+    SM_SetSubstate(&sys_sm, SYS_WAIT_INITIALIZATION_BMS, SYS_STATEMACH_SHORTTIME_MS);
+}
 
-            break;
-
-        /****************************INITIALIZE CONTACTORS*************************************/
-        case SYS_STATEMACH_INITIALIZE_CONTACTORS:
-            SYS_SAVELASTSTATES();
-
-            if (sys_state.substate == SYS_ENTRY) {
-                CONT_SetStateRequest(CONT_STATE_INIT_REQUEST);
-                sys_state.timer = SYS_STATEMACH_SHORTTIME_MS;
-                sys_state.substate = SYS_WAIT_INITIALIZATION_CONT;
-                sys_state.InitCounter = 0;
-                break;
-            } else if (sys_state.substate == SYS_WAIT_INITIALIZATION_CONT) {
-                contstate = CONT_GetState();
-                if (contstate == CONT_STATEMACH_STANDBY) {
-                    sys_state.timer = SYS_STATEMACH_SHORTTIME_MS;
-                    sys_state.state = SYS_STATEMACH_INITIALIZE_BALANCING;
-                    sys_state.substate = SYS_ENTRY;
-                    break;
-                } else {
-                    if (sys_state.InitCounter > (1000/SYS_TASK_CYCLE_CONTEXT_MS)) {
-                        sys_state.timer = SYS_STATEMACH_SHORTTIME_MS;
-                        sys_state.state = SYS_STATEMACH_ERROR;
-                        sys_state.substate = SYS_CONT_INIT_ERROR;
-                        break;
-                    }
-                    sys_state.timer = SYS_STATEMACH_SHORTTIME_MS;
-                    sys_state.InitCounter++;
-                    break;
-                }
-            }
+/**
+ * @brief   run action while waiting for another state machine, the timeout is handled by the engine
+ */
+static void SYS_RunPoll(void) {
+    sys_sm.timer = SYS_STATEMACH_SHORTTIME_MS;
+}
+
+/**
+ * @brief   run action while waiting for the measurement, the timeout is handled by the engine
+ */
+static void SYS_RunPollMedium(void) {
+    sys_sm.timer = SYS_STATEMACH_MEDIUMTIME_MS;
+}
 
-            break;
-
-            /****************************INITIALIZE BALANCING*************************************/
-            case SYS_STATEMACH_INITIALIZE_BALANCING:
-                SYS_SAVELASTSTATES();
-                if (sys_state.substate == SYS_ENTRY) {
-                    BAL_SetStateRequest(BAL_STATE_INIT_REQUEST);
-                    sys_state.timer = SYS_STATEMACH_SHORTTIME_MS;
-                    sys_state.substate = SYS_WAIT_INITIALIZATION_BAL;
-                    sys_state.InitCounter = 0;
-                    break;
-                } else if (sys_state.substate == SYS_WAIT_INITIALIZATION_BAL) {
-                    balstate = BAL_GetState();
-                    if (balstate == BAL_STATEMACH_INITIALIZED || balstate == BAL_STATEMACH_INACTIVE) {
-                        if (BALANCING_DEFAULT_INACTIVE == TRUE) {
-                            BAL_SetStateRequest(BAL_STATE_INACTIVE_OVERRIDE_REQUEST);
-                        }
-                        sys_state.timer = SYS_STATEMACH_SHORTTIME_MS;
-                        sys_state.state = SYS_STATEMACH_FIRST_MEASUREMENT_CYCLE;
-                        sys_state.substate = SYS_ENTRY;
-                        break;
-                    } else {
-                        if (sys_state.InitCounter > (1000/SYS_TASK_CYCLE_CONTEXT_MS)) {
-                            sys_state.timer = SYS_STATEMACH_SHORTTIME_MS;
-                            sys_state.state = SYS_STATEMACH_ERROR;
-                            sys_state.substate = SYS_CONT_INIT_ERROR;
-                            break;
-                        }
-                        sys_state.timer = SYS_STATEMACH_SHORTTIME_MS;
-                        sys_state.InitCounter++;
-                        break;
-                    }
-                }
-
-                break;
-
-            /****************************ENABLE CAN*************************************/
-            case SYS_STATEMACH_FIRST_MEASUREMENT_CYCLE:
-                SYS_SAVELASTSTATES();
-                if (sys_state.substate == SYS_ENTRY) {
-                    MEAS_StartMeasurement();
-                    sys_state.InitCounter = 0;
-                    sys_state.substate = SYS_WAIT_FIRST_MEASUREMENT_CYCLE;
-                } else if (sys_state.substate == SYS_WAIT_FIRST_MEASUREMENT_CYCLE) {
-                    if (MEAS_IsFirstMeasurementCycleFinished() == TRUE) {
-                        sys_state.timer = SYS_STATEMACH_SHORTTIME_MS;
-                        if (CURRENT_SENSOR_PRESENT == TRUE)
-                            sys_state.state = SYS_STATEMACH_CHECK_CURRENT_SENSOR_PRESENCE;
-                        else
-                            sys_state.state = SYS_STATEMACH_INITIALIZE_MISC;
-                        sys_state.substate = SYS_ENTRY;
-                        break;
-                    } else {
-                        if (sys_state.InitCounter > (1000/SYS_TASK_CYCLE_CONTEXT_MS)) {
-                            sys_state.timer = SYS_STATEMACH_SHORTTIME_MS;
-                            sys_state.state = SYS_STATEMACH_ERROR;
-                            sys_state.substate = SYS_MEAS_INIT_ERROR;
-                            break;
-                        } else {
-                            sys_state.timer = SYS_STATEMACH_MEDIUMTIME_MS;
-                            sys_state.InitCounter++;
-                            break;
-                        }
-                    }
-                }
-                break;
-
-            /****************************CHECK CURRENT SENSOR PRESENCE*************************************/
-            case SYS_STATEMACH_CHECK_CURRENT_SENSOR_PRESENCE:
-                SYS_SAVELASTSTATES();
-
-                if (sys_state.substate == SYS_ENTRY) {
-                    sys_state.InitCounter = 0;
-                    sys_state.substate = SYS_WAIT_CURRENT_SENSOR_PRESENCE;
-                } else if (sys_state.substate == SYS_WAIT_CURRENT_SENSOR_PRESENCE) {
-                    if (CANS_IsCurrentSensorPresent() == TRUE) {
-                        SOF_Init();
-                        if (CANS_IsCurrentSensorCCPresent() == TRUE) {
-                            SOC_Init(TRUE);
-                        } else {
-                            SOC_Init(FALSE);
-                        }
-                        CANS_Enable_Periodic(TRUE);
-                        sys_state.timer = SYS_STATEMACH_SHORTTIME_MS;
-                        sys_state.state = SYS_STATEMACH_INITIALIZE_MISC;
-                        sys_state.substate = SYS_ENTRY;
-                        break;
-                    } else {
-                        if (sys_state.InitCounter > (1000/SYS_TASK_CYCLE_CONTEXT_MS)) {
-                            sys_state.timer = SYS_STATEMACH_SHORTTIME_MS;
-                            sys_state.state = SYS_STATEMACH_ERROR;
-                            sys_state.substate = SYS_CURRENT_SENSOR_PRESENCE_ERROR;
-                            break;
-                        } else {
-                            sys_state.timer = SYS_STATEMACH_MEDIUMTIME_MS;
-                            sys_state.InitCounter++;
-                            break;
-                        }
-                    }
-                }
-                break;
-
-            /****************************INITIALIZED_MISC*************************************/
-            case SYS_STATEMACH_INITIALIZE_MISC:
-                SYS_SAVELASTSTATES();
-
-                if (CURRENT_SENSOR_PRESENT == FALSE) {
-                    CANS_Enable_Periodic(TRUE);
-                    SOC_Init(FALSE);
-                }
-                ISO_Init();
-
-                sys_state.timer = SYS_STATEMACH_MEDIUMTIME_MS;
-                sys_state.state = SYS_STATEMACH_INITIALIZE_BMS;
-                sys_state.substate = SYS_ENTRY;
-                break;
-
-            /****************************INITIALIZE BMS*************************************/
-            case SYS_STATEMACH_INITIALIZE_BMS:
-                SYS_SAVELASTSTATES();
-
-                if (sys_state.substate == SYS_ENTRY) {
-                    BMS_SetStateRequest(BMS_STATE_INIT_REQUEST);
-                    sys_state.timer = SYS_STATEMACH_SHORTTIME_MS;
-                    sys_state.substate = SYS_WAIT_INITIALIZATION_BMS;
-                    sys_state.InitCounter = 0;
-                    break;
-                } else if (sys_state.substate == SYS_WAIT_INITIALIZATION_BMS) {
-                    bmsstate = BMS_GetState();
-                    if (bmsstate == BMS_STATEMACH_IDLE || bmsstate == BMS_STATEMACH_STANDBY) {
-                        sys_state.timer = SYS_STATEMACH_SHORTTIME_MS;
-                        sys_state.state = SYS_STATEMACH_RUNNING;
-                        sys_state.substate = SYS_ENTRY;
-                        break;
-                    } else {
-                        if (sys_state.InitCounter > (1000/SYS_TASK_CYCLE_CONTEXT_MS)) {
-                            sys_state.timer = SYS_STATEMACH_SHORTTIME_MS;
-                            sys_state.state = SYS_STATEMACH_ERROR;
-                            sys_state.substate = SYS_BMS_INIT_ERROR;
-                            break;
-                        }
-                        sys_state.timer = SYS_STATEMACH_SHORTTIME_MS;
-                        sys_state.InitCounter++;
-                        break;
-                    }
-                }
-                break;
-
-        /****************************RUNNNIG*************************************/
-        case SYS_STATEMACH_RUNNING:
-            SYS_SAVELASTSTATES();
-            sys_state.timer = SYS_STATEMACH_LONGTIME_MS;
-            break;
-
-        /****************************ERROR*************************************/
-        case SYS_STATEMACH_ERROR:
-            SYS_SAVELASTSTATES();
-            sys_state.timer = SYS_STATEMACH_LONGTIME_MS;
-            break;
-    }  // end switch(sys_state.state)
-    sys_state.triggerentry--;
+static void SYS_RunIdle(void) {
+    sys_sm.timer = SYS_STATEMACH_LONGTIME_MS;
 }
@@ -142,21 +142,6 @@ typedef enum {
 
 
 
-/**
- * This structure contains all the variables relevant for the CONT state machine.
- * The user can get the current state of the CONT state machine with this variable
- */
-typedef struct {
-    uint16_t timer;                         /*!< time in ms before the state machine processes the next state, e.g. in counts of 1ms    */
-    SYS_STATE_REQUEST_e statereq;           /*!< current state request made to the state machine                                        */
-    SYS_STATEMACH_e state;                  /*!< state of Driver State Machine                                                          */
-    SYS_STATEMACH_SUB_e substate;                       /*!< current substate of the state machine                                                  */
-    SYS_STATEMACH_e laststate;              /*!< previous state of the state machine                                                    */
-    SYS_STATEMACH_SUB_e lastsubstate;                   /*!< previous substate of the state machine                                                 */
-    uint32_t ErrRequestCounter;             /*!< counts the number of illegal requests to the SYS state machine */
-    uint16_t InitCounter;                   /*!< Timeout to wait for initialization of state machine state machine */
-    uint8_t triggerentry;                   /*!< counter for re-entrance protection (function running flag) */
-} SYS_STATE_s;
 
 
 /*================== Function Prototypes ==================================*/
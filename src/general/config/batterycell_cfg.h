@@ -164,4 +164,25 @@
  */
 #define BC_CAPACITY 3500
 
+/**
+ * @ingroup CONFIG_BATTERYCELL
+ * cell chemistries with an open circuit voltage table in sox_ocv_cfg.c
+ */
+#define BC_CHEMISTRY_LTO    0
+#define BC_CHEMISTRY_LFP    1
+#define BC_CHEMISTRY_NMC    2
+
+/**
+ * @ingroup CONFIG_BATTERYCELL
+ * cell chemistry, selects the open circuit voltage table used to initialize
+ * and recalibrate the SOC
+ * \par Type:
+ * select(3)
+ * \par Default:
+ * BC_CHEMISTRY_LTO
+*/
+#define BC_CHEMISTRY BC_CHEMISTRY_LTO
+//#define BC_CHEMISTRY BC_CHEMISTRY_LFP
+//#define BC_CHEMISTRY BC_CHEMISTRY_NMC
+
 #endif /* BATTERYCELL_CFG_H_ */
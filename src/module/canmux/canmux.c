@@ -0,0 +1,206 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    canmux.c
+ * @author  foxBMS Team
+ * @date    19.10.2026 (date of creation)
+ * @ingroup DRIVERS
+ * @prefix  CANMUX
+ *
+ * @brief   Multiplexed cell data messages
+ *
+ */
+
+/*================== Includes =============================================*/
+#include "general.h"
+#include "canmux.h"
+
+#include "can.h"
+#include "cans_dbc.h"
+#include "database.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/**
+ * number of cells or sensors in one message
+ */
+#define CANMUX_CELLS_PER_MSG            3
+
+#define CANMUX_VOLT_GROUPS              ((BS_NR_OF_BAT_CELLS_PER_MODULE + CANMUX_CELLS_PER_MSG - 1) / CANMUX_CELLS_PER_MSG)
+#define CANMUX_TEMP_GROUPS              ((BS_NR_OF_TEMP_SENSORS_PER_MODULE + CANMUX_CELLS_PER_MSG - 1) / CANMUX_CELLS_PER_MSG)
+#define CANMUX_FRAMES_PER_MODULE        (CANMUX_VOLT_GROUPS + CANMUX_TEMP_GROUPS)
+#define CANMUX_FRAMES_PER_ROUND         (BS_NR_OF_MODULES * CANMUX_FRAMES_PER_MODULE)
+
+/**
+ * bandwidth available per call of CANMUX_Trigger(), unit: bit
+ */
+#define CANMUX_BITS_PER_TICK            ((CANMUX_BANDWIDTH * CANMUX_TICK_MS) / 1000)
+
+#if BS_NR_OF_MODULES > 256
+#error "CANMUX: the module multiplexer supports up to 256 modules"
+#endif
+
+#if (BS_NR_OF_BAT_CELLS_PER_MODULE > 32) || (BS_NR_OF_TEMP_SENSORS_PER_MODULE > 16)
+#error "CANMUX: the PEC flags of the database support up to 32 cells and 16 sensors per module"
+#endif
+
+#if (CANMUX_MAX_FRAMES_PER_TICK < 1) || (CANMUX_MAX_FRAMES_PER_TICK >= CAN0_TRANSMIT_BUFFER_LENGTH)
+#error "CANMUX: CANMUX_MAX_FRAMES_PER_TICK must be within 1 and CAN0_TRANSMIT_BUFFER_LENGTH - 1"
+#endif
+
+/**
+ * state of the round-robin over all modules
+ */
+typedef struct {
+    uint16_t next;          /*!< next message of the round, module * CANMUX_FRAMES_PER_MODULE + group   */
+    uint16_t round_time;    /*!< time since the start of the round, unit: ms                           */
+    uint32_t credit;        /*!< bandwidth not used yet, unit: bit                                      */
+} CANMUX_STATE_s;
+
+/*================== Constant and Variable Definitions ====================*/
+static CANMUX_STATE_s canmux_state = {
+        .next = 0,
+        .round_time = CANMUX_ROUND_TIME_MS,
+        .credit = 0,
+};
+
+static DATA_BLOCK_CELLVOLTAGE_s canmux_cellvoltage;
+static DATA_BLOCK_CELLTEMPERATURE_s canmux_celltemperature;
+
+/*================== Function Prototypes ==================================*/
+static uint32_t CANMUX_PackFrame(uint16_t msgIdx, uint64_t *frame);
+static uint8_t CANMUX_GetValidFlags(uint32_t pecs, uint16_t first, uint16_t nr_of_cells);
+
+/*================== Function Implementations =============================*/
+
+void CANMUX_Trigger(void) {
+    uint8_t data[8];
+    uint64_t frame = 0;
+    uint32_t id = 0;
+    uint8_t nr_of_frames = 0;
+
+    if (canmux_state.round_time < CANMUX_ROUND_TIME_MS) {
+        canmux_state.round_time += CANMUX_TICK_MS;
+    }
+
+    // unused bandwidth is kept for at most one message, so the messages are not sent in bursts
+    canmux_state.credit += CANMUX_BITS_PER_TICK;
+    if (canmux_state.credit > CANMUX_BITS_PER_TICK + CANMUX_FRAME_BITS) {
+        canmux_state.credit = CANMUX_BITS_PER_TICK + CANMUX_FRAME_BITS;
+    }
+
+    if (canmux_state.next == 0) {
+        if (canmux_state.round_time < CANMUX_ROUND_TIME_MS) {
+            return;
+        }
+        // new round, all messages of the round are sent from the same snapshot
+        canmux_state.round_time = 0;
+        DB_ReadBlock(&canmux_cellvoltage, DATA_BLOCK_ID_CELLVOLTAGE);
+        DB_ReadBlock(&canmux_celltemperature, DATA_BLOCK_ID_CELLTEMPERATURE);
+    }
+
+    while ((canmux_state.credit >= CANMUX_FRAME_BITS) && (nr_of_frames < CANMUX_MAX_FRAMES_PER_TICK)) {
+        id = CANMUX_PackFrame(canmux_state.next, &frame);
+        CANS_DBC_FrameToData(frame, data, 8);
+        if (CAN_Send(CAN_NODE0, id, data, 8, 0) != E_OK) {
+            // transmit buffer full, the message is sent with the next call
+            break;
+        }
+        canmux_state.credit -= CANMUX_FRAME_BITS;
+        nr_of_frames++;
+        canmux_state.next++;
+        if (canmux_state.next >= CANMUX_FRAMES_PER_ROUND) {
+            canmux_state.next = 0;
+            break;
+        }
+    }
+}
+
+
+/**
+ * @brief   packs a message of the round
+ *
+ * @param   msgIdx  message number within the round
+ * @param   frame   packed message
+ *
+ * @return  CAN identifier of the message
+ */
+static uint32_t CANMUX_PackFrame(uint16_t msgIdx, uint64_t *frame) {
+    CANS_CellVoltagesMux_s volt;
+    CANS_CellTemperaturesMux_s temp;
+    uint16_t module = msgIdx / CANMUX_FRAMES_PER_MODULE;
+    uint16_t group = msgIdx % CANMUX_FRAMES_PER_MODULE;
+    uint16_t first = 0;
+    uint16_t offset = 0;
+    uint32_t id = 0;
+
+    if (group < CANMUX_VOLT_GROUPS) {
+        first = group * CANMUX_CELLS_PER_MSG;
+        offset = (module * BS_NR_OF_BAT_CELLS_PER_MODULE) + first;
+        volt.module = module;
+        volt.group = group;
+        volt.valid = CANMUX_GetValidFlags(canmux_cellvoltage.valid_voltPECs[module], first, BS_NR_OF_BAT_CELLS_PER_MODULE);
+        volt.cell_0 = canmux_cellvoltage.voltage[offset];
+        volt.cell_1 = (first + 1 < BS_NR_OF_BAT_CELLS_PER_MODULE) ? canmux_cellvoltage.voltage[offset + 1] : 0;
+        volt.cell_2 = (first + 2 < BS_NR_OF_BAT_CELLS_PER_MODULE) ? canmux_cellvoltage.voltage[offset + 2] : 0;
+        *frame = CANS_PackCellVoltagesMux(&volt);
+        id = CANS_CELLVOLTAGESMUX_ID;
+    } else {
+        group -= CANMUX_VOLT_GROUPS;
+        first = group * CANMUX_CELLS_PER_MSG;
+        offset = (module * BS_NR_OF_TEMP_SENSORS_PER_MODULE) + first;
+        temp.module = module;
+        temp.group = group;
+        temp.valid = CANMUX_GetValidFlags(canmux_celltemperature.valid_temperaturePECs[module], first, BS_NR_OF_TEMP_SENSORS_PER_MODULE);
+        temp.cell_0 = canmux_celltemperature.temperature[offset];
+        temp.cell_1 = (first + 1 < BS_NR_OF_TEMP_SENSORS_PER_MODULE) ? canmux_celltemperature.temperature[offset + 1] : 0;
+        temp.cell_2 = (first + 2 < BS_NR_OF_TEMP_SENSORS_PER_MODULE) ? canmux_celltemperature.temperature[offset + 2] : 0;
+        *frame = CANS_PackCellTemperaturesMux(&temp);
+        id = CANS_CELLTEMPERATURESMUX_ID;
+    }
+    return id;
+}
+
+
+/**
+ * @brief   returns the PEC error flags of the cells of a message
+ *
+ * @details Cells beyond the number of cells of the module are flagged as error.
+ *
+ * @param   pecs            PEC error flags of the module, bit n = cell n
+ * @param   first           first cell of the message
+ * @param   nr_of_cells     number of cells of the module
+ *
+ * @return  error flags, bit 0 = first cell
+ */
+static uint8_t CANMUX_GetValidFlags(uint32_t pecs, uint16_t first, uint16_t nr_of_cells) {
+    uint8_t flags = 0x07 & (pecs >> first);
+    uint16_t i = 0;
+
+    for (i = 0; i < CANMUX_CELLS_PER_MSG; i++) {
+        if (first + i >= nr_of_cells) {
+            flags |= (1 << i);
+        }
+    }
+    return flags;
+}
@@ -0,0 +1,64 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    canmux.h
+ * @author  foxBMS Team
+ * @date    19.10.2026 (date of creation)
+ * @ingroup DRIVERS
+ * @prefix  CANMUX
+ *
+ * @brief   Multiplexed cell data messages
+ *
+ * All cell voltages are sent with the single identifier
+ * CANS_CELLVOLTAGESMUX_ID and all cell temperatures with
+ * CANS_CELLTEMPERATURESMUX_ID (see cansignal_cfg.dbc). The first two bytes of
+ * each message carry the module number and the group of three cells as
+ * multiplexer, so the number of identifiers does not depend on
+ * BS_NR_OF_MODULES. The messages of all modules are sent round-robin within
+ * the bus bandwidth configured in canmux_cfg.h.
+ */
+
+#ifndef CANMUX_H_
+#define CANMUX_H_
+
+/*================== Includes =============================================*/
+#include "canmux_cfg.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/*================== Constant and Variable Definitions ====================*/
+
+/*================== Function Prototypes ==================================*/
+
+/**
+ * @brief   sends the next multiplexed cell data messages
+ *
+ * @details Must be called every CANMUX_TICK_MS. A new round over all modules
+ *          starts with a copy of the cell voltages and temperatures of the
+ *          database, at most every CANMUX_ROUND_TIME_MS.
+ */
+extern void CANMUX_Trigger(void);
+
+/*================== Function Implementations =============================*/
+
+#endif /* CANMUX_H_ */
@@ -47,11 +47,32 @@
 
 /*================== Macros and Definitions ===============================*/
 
+/**
+ * run time state of a persistence policy
+ */
+typedef struct {
+    uint8_t pending;                            /*!< TRUE if a change is held back          */
+    uint32_t timestamp;                         /*!< time of the oldest held back change    */
+    NVM_POLICY_STATISTICS_s statistics;         /*!< statistics of the policy               */
+} NVM_POLICY_STATE_s;
+
+/*================== Function Prototypes ==================================*/
+static void NVM_CommitSoc(void);
+static void NVM_CommitContactorcnt(void);
+static void NVM_CommitOperatingHours(void);
+static void NVM_CommitBalancing(void);
+static void NVM_CommitSoh(void);
+static uint8_t NVM_PolicyUpdate(NVM_POLICY_e policy, float change);
+static float NVM_OperatingHoursChange(const BKPSRAM_OPERATING_HOURS_s *now, const BKPSRAM_OPERATING_HOURS_s *last);
+static float NVM_RelativeChange(float now, float last);
 
 /*================== Constant and Variable Definitions ====================*/
 BKPSRAM_CH_NVSOC_s MEM_BKP_SRAM bkpsram_nvsoc;
 BKPSRAM_CH_CONT_COUNT_s MEM_BKP_SRAM bkpsram_contactors_count;
 BKPSRAM_CH_OP_HOURS_s MEM_BKP_SRAM bkpsram_operating_hours;
+BKPSRAM_CH_SOH_s MEM_BKP_SRAM bkpsram_soh;
+BKPSRAM_CH_SOH_CELLS_s MEM_BKP_SRAM bkpsram_soh_cells;
+BKPSRAM_CH_BALANCING_s MEM_BKP_SRAM bkpsram_balancing;
 MAIN_STATUS_s MEM_BKP_SRAM main_state;
 BKPSRAM_OPERATING_HOURS_s MEM_BKP_SRAM bkpsram_op_hours;
 
@@ -74,21 +95,82 @@ const BKPSRAM_CH_OP_HOURS_s default_operating_hours = {
 
 };
 
-/*================== Function Prototypes ==================================*/
+/**
+ * persistence policies, indexed by NVM_POLICY_e
+ */
+const NVM_POLICY_CFG_s nvm_policy_cfg[NVM_POLICY_MAX] = {
+    /* threshold, max_age (ms), length, commit */
+    { 0.5,    60000,  sizeof(BKPSRAM_CH_NVSOC_s),       &NVM_CommitSoc            },  /*!< NVM_POLICY_SOC, 0.5%       */
+    { 10.0,   10000,  sizeof(BKPSRAM_CH_CONT_COUNT_s),  &NVM_CommitContactorcnt   },  /*!< NVM_POLICY_CONTACTOR       */
+    { 300.0,  600000, sizeof(BKPSRAM_CH_OP_HOURS_s),    &NVM_CommitOperatingHours },  /*!< NVM_POLICY_OPERATING_HOURS */
+    { 100.0,  3600000, sizeof(BKPSRAM_CH_BALANCING_s),  &NVM_CommitBalancing      },  /*!< NVM_POLICY_BALANCING, 100mAh */
+    { 1.0,    3600000, sizeof(BKPSRAM_CH_SOH_s) + sizeof(BKPSRAM_CH_SOH_CELLS_s), &NVM_CommitSoh },  /*!< NVM_POLICY_SOH, 1% */
+};
+
+static NVM_POLICY_STATE_s nvm_policy_state[NVM_POLICY_MAX];
+
+/**
+ * values at the last time the EEPROM channels were marked dirty, the persistence policies measure
+ * the change against them. They are zero after a reset, so the first update marks the channel dirty.
+ */
+static SOX_SOC_s nvm_soc;
+static DIAG_CONTACTOR_s nvm_contactorcnt;
+static BAL_ENERGY_NVM_s nvm_balancing;
+static SOH_NVM_s nvm_soh;
+
+const BKPSRAM_CH_SOH_s default_soh = {
+    .data.capacity_mean      = SOX_CELL_CAPACITY,
+    .data.capacity_min       = SOX_CELL_CAPACITY,
+    .data.capacity_max       = SOX_CELL_CAPACITY,
+    .data.resistance_mean    = SOH_RESISTANCE_BOL,
+    .data.resistance_min     = SOH_RESISTANCE_BOL,
+    .data.resistance_max     = SOH_RESISTANCE_BOL,
+    .data.capacity_updates   = 0,
+    .data.reserved           = 0
+};
+
+/* no cells stored, SOH_Init() starts the cells with the pack values */
+const BKPSRAM_CH_SOH_CELLS_s default_soh_cells = {
+    .data.resistance         = {0},
+    .data.capacity           = {0},
+    .data.nr_of_cells        = 0,
+    .data.reserved           = 0
+};
+
+const BKPSRAM_CH_BALANCING_s default_balancing = {
+    .data.charge             = {0},
+    .data.observation_time   = 0
+};
 
 /*================== Function Implementations =============================*/
 
 void NVM_Set_soc(SOX_SOC_s* ptr) {
     uint32_t interrupt_status = 0;
+    float change = 0.0;
+    float delta = 0.0;
 
     /* Disable interrupts */
     interrupt_status=MCU_DisableINT();
 
-    EEPR_SetChDirtyFlag(EEPR_CH_NVSOC);
+    /* the backup SRAM always holds the latest value, only the EEPROM write is held back */
     bkpsram_nvsoc.data = *ptr;
 
     /* calculate checksum*/
-    bkpsram_nvsoc.checksum = EEPR_CalcChecksum((uint8_t*)(ptr),sizeof(bkpsram_nvsoc)-4);
+    bkpsram_nvsoc.checksum = EEPR_CalcChecksum((uint8_t*)(&bkpsram_nvsoc),sizeof(bkpsram_nvsoc)-4);
+
+    /* largest change of min, max and mean since the last EEPROM write */
+    change = ptr->mean - nvm_soc.mean;
+    if (change < 0.0) { change = -change; }
+    delta = ptr->min - nvm_soc.min;
+    if (delta < 0.0) { delta = -delta; }
+    if (delta > change) { change = delta; }
+    delta = ptr->max - nvm_soc.max;
+    if (delta < 0.0) { delta = -delta; }
+    if (delta > change) { change = delta; }
+
+    if (NVM_PolicyUpdate(NVM_POLICY_SOC, change) == TRUE) {
+        NVM_CommitSoc();
+    }
 
     /* Enable interrupts */
     MCU_RestoreINT(interrupt_status);
@@ -109,17 +191,32 @@ STD_RETURN_TYPE_e NVM_Get_soc(SOX_SOC_s *dest_ptr) {
 
 void NVM_Set_contactorcnt(DIAG_CONTACTOR_s *ptr) {
     uint32_t interrupt_status = 0;
+    float change = 0.0;
+    uint8_t i = 0;
 
     /* Disable interrupts */
     interrupt_status = MCU_DisableINT();
 
-    EEPR_SetChDirtyFlag(EEPR_CH_CONTACTOR);
-    /* update bkpsram values */
     //@FIXME: check pointer (nullpointer)
+    /* the backup SRAM always holds the latest value, only the EEPROM write is held back */
     bkpsram_contactors_count.data = *ptr;
 
     /* calculate checksum*/
-    bkpsram_contactors_count.checksum = EEPR_CalcChecksum((uint8_t *)(ptr),sizeof(bkpsram_contactors_count)-4);
+    bkpsram_contactors_count.checksum = EEPR_CalcChecksum((uint8_t *)(&bkpsram_contactors_count),sizeof(bkpsram_contactors_count)-4);
+
+    /* switching events since the last EEPROM write, the counters only increase */
+    for (i = 0; i < BS_NR_OF_CONTACTORS; i++) {
+        change += (float)(uint16_t)(ptr->cont_switch_closed[i] - nvm_contactorcnt.cont_switch_closed[i]);
+        change += (float)(uint16_t)(ptr->cont_switch_opened[i] - nvm_contactorcnt.cont_switch_opened[i]);
+        /* every hard switch is written immediately */
+        if (ptr->cont_switch_opened_hard_at_current[i] != nvm_contactorcnt.cont_switch_opened_hard_at_current[i]) {
+            change += nvm_policy_cfg[NVM_POLICY_CONTACTOR].threshold;
+        }
+    }
+
+    if (NVM_PolicyUpdate(NVM_POLICY_CONTACTOR, change) == TRUE) {
+        NVM_CommitContactorcnt();
+    }
 
     /* Enable interrupts */
     MCU_RestoreINT(interrupt_status);
@@ -182,16 +279,17 @@ void NVM_OperatingHoursTrigger(void) {
 void NVM_SetOperatingHours(void) {
 
     uint32_t interrupt_status = 0;
+    float change = 0.0;
 
     /* Disable interrupts */
     interrupt_status = MCU_DisableINT();
 
-    EEPR_SetChDirtyFlag(EEPR_CH_OPERATING_HOURS);
-    /* update bkpsram values */
-    bkpsram_operating_hours.data = bkpsram_op_hours;
+    /* the running timer bkpsram_op_hours is already kept in the backup SRAM, only the channel copy is held back */
+    change = NVM_OperatingHoursChange(&bkpsram_op_hours, &bkpsram_operating_hours.data);
 
-    /* calculate checksum*/
-    bkpsram_operating_hours.checksum = EEPR_CalcChecksum((uint8_t *)(&bkpsram_operating_hours),sizeof(bkpsram_operating_hours)-4);
+    if (NVM_PolicyUpdate(NVM_POLICY_OPERATING_HOURS, change) == TRUE) {
+        NVM_CommitOperatingHours();
+    }
 
     /* Enable interrupts */
     MCU_RestoreINT(interrupt_status);
@@ -212,3 +310,309 @@ STD_RETURN_TYPE_e NVM_GetOperatingHours(BKPSRAM_OPERATING_HOURS_s *dest_ptr){
     return ret_val;
 }
 
+
+void NVM_Set_soh(SOH_NVM_s *ptr) {
+    uint32_t interrupt_status = 0;
+    float change = 0.0;
+    float delta = 0.0;
+
+    /* Disable interrupts */
+    interrupt_status = MCU_DisableINT();
+
+    /* the backup SRAM always holds the latest value, only the EEPROM write is held back */
+    bkpsram_soh.data = *ptr;
+
+    /* calculate checksum*/
+    bkpsram_soh.checksum = EEPR_CalcChecksum((uint8_t *)(&bkpsram_soh),sizeof(bkpsram_soh)-4);
+
+    /* largest relative change of the resistances since the last EEPROM write */
+    change = NVM_RelativeChange(ptr->resistance_mean, nvm_soh.resistance_mean);
+    delta = NVM_RelativeChange(ptr->resistance_min, nvm_soh.resistance_min);
+    if (delta > change) { change = delta; }
+    delta = NVM_RelativeChange(ptr->resistance_max, nvm_soh.resistance_max);
+    if (delta > change) { change = delta; }
+    /* every capacity estimation is written immediately */
+    if (ptr->capacity_updates != nvm_soh.capacity_updates) {
+        change += nvm_policy_cfg[NVM_POLICY_SOH].threshold;
+    }
+
+    if (NVM_PolicyUpdate(NVM_POLICY_SOH, change) == TRUE) {
+        NVM_CommitSoh();
+    }
+
+    /* Enable interrupts */
+    MCU_RestoreINT(interrupt_status);
+}
+
+STD_RETURN_TYPE_e NVM_Get_soh(SOH_NVM_s *dest_ptr) {
+    STD_RETURN_TYPE_e ret_val;
+
+    if(EEPR_CalcChecksum((uint8_t*)&bkpsram_soh, sizeof(bkpsram_soh)-4) == bkpsram_soh.checksum){
+        //data valid
+        *dest_ptr = bkpsram_soh.data;
+        ret_val = E_OK;
+    }else{
+        //data invalid
+        ret_val = E_NOT_OK;
+    }
+    return ret_val;
+}
+
+
+void NVM_Set_soh_cells(SOH_NVM_CELLS_s *ptr) {
+    uint32_t interrupt_status = 0;
+
+    /* Disable interrupts */
+    interrupt_status = MCU_DisableINT();
+
+    /* the EEPROM write follows the pack values, see NVM_CommitSoh() */
+    bkpsram_soh_cells.data = *ptr;
+
+    /* calculate checksum*/
+    bkpsram_soh_cells.checksum = EEPR_CalcChecksum((uint8_t *)(&bkpsram_soh_cells),sizeof(bkpsram_soh_cells)-4);
+
+    /* Enable interrupts */
+    MCU_RestoreINT(interrupt_status);
+}
+
+STD_RETURN_TYPE_e NVM_Get_soh_cells(SOH_NVM_CELLS_s *dest_ptr) {
+    STD_RETURN_TYPE_e ret_val;
+
+    if(EEPR_CalcChecksum((uint8_t*)&bkpsram_soh_cells, sizeof(bkpsram_soh_cells)-4) == bkpsram_soh_cells.checksum){
+        //data valid
+        *dest_ptr = bkpsram_soh_cells.data;
+        ret_val = E_OK;
+    }else{
+        //data invalid
+        ret_val = E_NOT_OK;
+    }
+    return ret_val;
+}
+
+
+void NVM_Set_balancing(BAL_ENERGY_NVM_s *ptr) {
+    uint32_t interrupt_status = 0;
+    float change = 0.0;
+    uint16_t i = 0;
+
+    /* Disable interrupts */
+    interrupt_status = MCU_DisableINT();
+
+    /* the backup SRAM always holds the latest value, only the EEPROM write is held back */
+    bkpsram_balancing.data = *ptr;
+
+    /* calculate checksum*/
+    bkpsram_balancing.checksum = EEPR_CalcChecksum((uint8_t *)(&bkpsram_balancing),sizeof(bkpsram_balancing)-4);
+
+    /* charge bled since the last EEPROM write in mAh, the counters only increase */
+    for (i = 0; i < BAL_ENERGY_NR_OF_CELLS; i++) {
+        change += (float)(ptr->charge[i] - nvm_balancing.charge[i]) / 3600.0;
+    }
+    /* the observation time keeps the counters pending, so they are written after the maximum age */
+    change += (float)(ptr->observation_time - nvm_balancing.observation_time) / 3600.0;
+
+    if (NVM_PolicyUpdate(NVM_POLICY_BALANCING, change) == TRUE) {
+        NVM_CommitBalancing();
+    }
+
+    /* Enable interrupts */
+    MCU_RestoreINT(interrupt_status);
+}
+
+STD_RETURN_TYPE_e NVM_Get_balancing(BAL_ENERGY_NVM_s *dest_ptr) {
+    STD_RETURN_TYPE_e ret_val;
+
+    if(EEPR_CalcChecksum((uint8_t*)&bkpsram_balancing, sizeof(bkpsram_balancing)-4) == bkpsram_balancing.checksum){
+        //data valid
+        *dest_ptr = bkpsram_balancing.data;
+        ret_val = E_OK;
+    }else{
+        //data invalid
+        ret_val = E_NOT_OK;
+    }
+    return ret_val;
+}
+
+
+void NVM_PolicyTrigger(void) {
+    uint32_t interrupt_status = 0;
+    uint32_t timestamp = MCU_GetTimeStamp();
+    uint8_t i = 0;
+
+    for (i = 0; i < NVM_POLICY_MAX; i++) {
+        interrupt_status = MCU_DisableINT();
+        if (nvm_policy_state[i].pending == TRUE && (timestamp - nvm_policy_state[i].timestamp) >= nvm_policy_cfg[i].max_age) {
+            nvm_policy_state[i].pending = FALSE;
+            nvm_policy_state[i].statistics.writes++;
+            nvm_policy_state[i].statistics.forced++;
+            nvm_policy_cfg[i].commit();
+        }
+        MCU_RestoreINT(interrupt_status);
+    }
+}
+
+
+void NVM_PolicyFlush(void) {
+    uint32_t interrupt_status = 0;
+    uint8_t i = 0;
+
+    for (i = 0; i < NVM_POLICY_MAX; i++) {
+        interrupt_status = MCU_DisableINT();
+        if (nvm_policy_state[i].pending == TRUE) {
+            nvm_policy_state[i].pending = FALSE;
+            nvm_policy_state[i].statistics.writes++;
+            nvm_policy_state[i].statistics.forced++;
+            nvm_policy_cfg[i].commit();
+        }
+        MCU_RestoreINT(interrupt_status);
+    }
+}
+
+
+void NVM_GetPolicyStatistics(NVM_POLICY_e policy, NVM_POLICY_STATISTICS_s *dest_ptr) {
+    uint32_t interrupt_status = 0;
+
+    if (policy < NVM_POLICY_MAX && dest_ptr != NULL_PTR) {
+        interrupt_status = MCU_DisableINT();
+        *dest_ptr = nvm_policy_state[policy].statistics;
+        MCU_RestoreINT(interrupt_status);
+    }
+}
+
+
+/**
+ * @brief   decides if a new value of a persistence policy is written to the EEPROM
+ *
+ * @details Must be called with disabled interrupts. If the EEPROM channel is not marked dirty, the
+ *          write is held back and NVM_PolicyTrigger() marks it dirty after the maximum age of the policy.
+ *
+ * @param   policy  persistence policy
+ * @param   change  change of the new value since the last EEPROM write, unit of the policy
+ *
+ * @return  TRUE if the EEPROM channel has to be marked dirty now, otherwise FALSE
+ */
+static uint8_t NVM_PolicyUpdate(NVM_POLICY_e policy, float change) {
+    NVM_POLICY_STATE_s *state = &nvm_policy_state[policy];
+    uint8_t retval = FALSE;
+
+    state->statistics.updates++;
+    if (change < 0.0) {
+        change = -change;
+    }
+
+    if (change >= nvm_policy_cfg[policy].threshold) {
+        state->pending = FALSE;
+        state->statistics.writes++;
+        retval = TRUE;
+    } else {
+        if (change > 0.0 && state->pending == FALSE) {
+            state->pending = TRUE;
+            state->timestamp = MCU_GetTimeStamp();
+        }
+        state->statistics.bytes_saved += nvm_policy_cfg[policy].length;
+    }
+    return retval;
+}
+
+
+/**
+ * @brief   marks the EEPROM channel of the SOC dirty
+ *
+ * @return  void
+ */
+static void NVM_CommitSoc(void) {
+    EEPR_SetChDirtyFlag(EEPR_CH_NVSOC);
+    nvm_soc = bkpsram_nvsoc.data;
+}
+
+
+/**
+ * @brief   marks the EEPROM channel of the contactor counters dirty
+ *
+ * @return  void
+ */
+static void NVM_CommitContactorcnt(void) {
+    EEPR_SetChDirtyFlag(EEPR_CH_CONTACTOR);
+    nvm_contactorcnt = bkpsram_contactors_count.data;
+}
+
+
+/**
+ * @brief   copies the operating hours timer to the backup SRAM channel and marks the EEPROM channel dirty
+ *
+ * @return  void
+ */
+static void NVM_CommitOperatingHours(void) {
+    EEPR_SetChDirtyFlag(EEPR_CH_OPERATING_HOURS);
+    /* update bkpsram values */
+    bkpsram_operating_hours.data = bkpsram_op_hours;
+
+    /* calculate checksum*/
+    bkpsram_operating_hours.checksum = EEPR_CalcChecksum((uint8_t *)(&bkpsram_operating_hours),sizeof(bkpsram_operating_hours)-4);
+}
+
+
+/**
+ * @brief   marks the EEPROM channel of the balancing counters dirty
+ *
+ * @return  void
+ */
+static void NVM_CommitBalancing(void) {
+    EEPR_SetChDirtyFlag(EEPR_CH_BALANCING);
+    nvm_balancing = bkpsram_balancing.data;
+}
+
+
+/**
+ * @brief   marks the EEPROM channels of the state of health and of its cell values dirty
+ *
+ * @return  void
+ */
+static void NVM_CommitSoh(void) {
+    EEPR_SetChDirtyFlag(EEPR_CH_STATISTICS);
+    EEPR_SetChDirtyFlag(EEPR_CH_SOH_CELLS);
+    nvm_soh = bkpsram_soh.data;
+}
+
+
+/**
+ * @brief   calculates the difference of two operating hours timers
+ *
+ * The difference is taken field by field in integers, so the precision does not depend on the
+ * total operating time.
+ *
+ * @param   now     current operating hours timer
+ * @param   last    operating hours timer at the last write
+ *
+ * @return  operating time between both timers in s
+ */
+static float NVM_OperatingHoursChange(const BKPSRAM_OPERATING_HOURS_s *now, const BKPSRAM_OPERATING_HOURS_s *last) {
+    int32_t seconds = 0;
+
+    seconds = ((int32_t)now->Timer_d - (int32_t)last->Timer_d) * 86400
+            + ((int32_t)now->Timer_h - (int32_t)last->Timer_h) * 3600
+            + ((int32_t)now->Timer_min - (int32_t)last->Timer_min) * 60
+            + ((int32_t)now->Timer_sec - (int32_t)last->Timer_sec);
+    return ((float)seconds);
+}
+
+
+/**
+ * @brief   calculates the relative change of a value
+ *
+ * @param   now     current value
+ * @param   last    value at the last write
+ *
+ * @return  change in %, a change from 0 counts like 100%
+ */
+static float NVM_RelativeChange(float now, float last) {
+    float change = 100.0;
+
+    if (last > 0.0) {
+        change = (now - last) * 100.0 / last;
+        if (change < 0.0) {
+            change = -change;
+        }
+    }
+    return change;
+}
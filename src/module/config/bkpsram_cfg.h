@@ -37,6 +37,8 @@
 /*================== Includes =============================================*/
 
 #include "sox.h"
+#include "soh.h"
+#include "bal_energy.h"
 #include "diag.h"
 #include "main.h"
 
@@ -93,13 +95,82 @@ typedef struct {
     uint32_t checksum;
 } BKPSRAM_CH_OP_HOURS_s;
 
+/**
+ * capacity and internal resistance of the cells estimated by the SOH,
+ * checksum over the SOH data
+ */
+typedef struct {
+    SOH_NVM_s data;
+    uint32_t checksum;
+} BKPSRAM_CH_SOH_s;
+
+/**
+ * resistance and capacity of each cell estimated by the SOH,
+ * checksum over the cell data
+ */
+typedef struct {
+    SOH_NVM_CELLS_s data;
+    uint32_t checksum;
+} BKPSRAM_CH_SOH_CELLS_s;
+
+/**
+ * charge bled from each cell by the balancing and its observation time,
+ * checksum over the balancing data
+ */
+typedef struct {
+    BAL_ENERGY_NVM_s data;
+    uint32_t checksum;
+} BKPSRAM_CH_BALANCING_s;
+
+/**
+ * persistence policies of the NVM data that change during operation
+ */
+typedef enum {
+    NVM_POLICY_SOC              = 0,    /*!< SOC, change in %                           */
+    NVM_POLICY_CONTACTOR        = 1,    /*!< contactor counters, change in events       */
+    NVM_POLICY_OPERATING_HOURS  = 2,    /*!< operating hours, change in s               */
+    NVM_POLICY_BALANCING        = 3,    /*!< balancing counters, change in mAh          */
+    NVM_POLICY_SOH              = 4,    /*!< state of health, change of resistance in % */
+    NVM_POLICY_MAX              = 5,    /*!< number of policies                         */
+} NVM_POLICY_e;
+
+/**
+ * configuration of a persistence policy. A new value is always written to the backup SRAM, so it
+ * survives a reset. The EEPROM channel is only marked dirty if the value changed by at least
+ * threshold since the last EEPROM write. Smaller changes are held back for at most max_age or
+ * until NVM_PolicyFlush() is called.
+ */
+typedef struct {
+    float threshold;                /*!< change since the last EEPROM write that is written immediately */
+    uint32_t max_age;               /*!< maximum time a change is held back, unit: ms               */
+    uint16_t length;                /*!< size of the channel in the EEPROM, unit: bytes             */
+    void (*commit)(void);           /*!< marks the EEPROM channel dirty                             */
+} NVM_POLICY_CFG_s;
+
+/**
+ * statistics of a persistence policy, the write-rate reduction is 1 - writes/updates
+ */
+typedef struct {
+    uint32_t updates;               /*!< values passed to the NVM                                   */
+    uint32_t writes;                /*!< EEPROM channel marked dirty                                */
+    uint32_t forced;                /*!< writes forced by the age or NVM_PolicyFlush()              */
+    uint32_t bytes_saved;           /*!< EEPROM bytes a backup of every update would have written  */
+} NVM_POLICY_STATISTICS_s;
+
 /*================== Constant and Variable Definitions ====================*/
 extern BKPSRAM_CH_NVSOC_s MEM_BKP_SRAM bkpsram_nvsoc;
 extern BKPSRAM_CH_CONT_COUNT_s MEM_BKP_SRAM bkpsram_contactors_count;
 extern BKPSRAM_CH_OP_HOURS_s MEM_BKP_SRAM bkpsram_operating_hours;
+extern BKPSRAM_CH_SOH_s MEM_BKP_SRAM bkpsram_soh;
+extern BKPSRAM_CH_SOH_CELLS_s MEM_BKP_SRAM bkpsram_soh_cells;
+extern BKPSRAM_CH_BALANCING_s MEM_BKP_SRAM bkpsram_balancing;
 extern const BKPSRAM_CH_NVSOC_s default_nvsoc;
 extern const BKPSRAM_CH_CONT_COUNT_s default_contactors_count;
 extern const BKPSRAM_CH_OP_HOURS_s default_operating_hours;
+extern const BKPSRAM_CH_SOH_s default_soh;
+extern const BKPSRAM_CH_SOH_CELLS_s default_soh_cells;
+extern const BKPSRAM_CH_BALANCING_s default_balancing;
+extern const NVM_POLICY_CFG_s nvm_policy_cfg[NVM_POLICY_MAX];
 
 extern MAIN_STATUS_s MEM_BKP_SRAM main_state;
 
@@ -147,6 +218,92 @@ extern void NVM_SetOperatingHours(void);
 */
 extern STD_RETURN_TYPE_e NVM_GetOperatingHours(BKPSRAM_OPERATING_HOURS_s *dest_ptr);
 
+/**
+ * @brief  Sets the state of health data saved in the backup SRAM
+ *
+ * @details The data is written according to NVM_POLICY_SOH, a new capacity estimation is
+ *          written immediately. The cell values of NVM_Set_soh_cells() are written to the
+ *          EEPROM together with the pack values, so NVM_Set_soh_cells() has to be called before.
+ *
+ * @param  ptr pointer where the state of health data is stored
+ * @return void
+*/
+extern void NVM_Set_soh(SOH_NVM_s *ptr);
+
+/**
+ * @brief  Gets the state of health data saved in the backup SRAM
+ *
+ * @param  dest_ptr pointer where the state of health data should be stored to
+ * @return E_OK if the checksum is valid, otherwise E_NOT_OK
+*/
+extern STD_RETURN_TYPE_e NVM_Get_soh(SOH_NVM_s *dest_ptr);
+
+/**
+ * @brief  Sets the resistance and capacity of each cell saved in the backup SRAM
+ *
+ * @details The EEPROM channel is written with the pack values of NVM_Set_soh().
+ *
+ * @param  ptr pointer where the cell data is stored
+ * @return void
+*/
+extern void NVM_Set_soh_cells(SOH_NVM_CELLS_s *ptr);
+
+/**
+ * @brief  Gets the resistance and capacity of each cell saved in the backup SRAM
+ *
+ * @param  dest_ptr pointer where the cell data should be stored to
+ * @return E_OK if the checksum is valid, otherwise E_NOT_OK
+*/
+extern STD_RETURN_TYPE_e NVM_Get_soh_cells(SOH_NVM_CELLS_s *dest_ptr);
+
+/**
+ * @brief  Sets the balancing counters saved in the backup SRAM
+ *
+ * @details The counters are written according to NVM_POLICY_BALANCING, one hour of
+ *          observation time counts like 1mAh of bled charge.
+ *
+ * @param  ptr pointer where the balancing counters are stored
+ * @return void
+*/
+extern void NVM_Set_balancing(BAL_ENERGY_NVM_s *ptr);
+
+/**
+ * @brief  Gets the balancing counters saved in the backup SRAM
+ *
+ * @param  dest_ptr pointer where the balancing counters should be stored to
+ * @return E_OK if the checksum is valid, otherwise E_NOT_OK
+*/
+extern STD_RETURN_TYPE_e NVM_Get_balancing(BAL_ENERGY_NVM_s *dest_ptr);
+
+/**
+ * @brief   writes the changes that were held back longer than their maximum age
+ *
+ * @details Must be called cyclically, e.g., every 100ms.
+ *
+ * @return  void
+ */
+extern void NVM_PolicyTrigger(void);
+
+/**
+ * @brief   writes all held back changes to the EEPROM
+ *
+ * @details Must be called before the system is switched off and is called on every state change
+ *          of the BMS.
+ *
+ * @return  void
+ */
+extern void NVM_PolicyFlush(void);
+
+/**
+ * @brief   gets the statistics of a persistence policy
+ *
+ * @param   policy      persistence policy
+ * @param   dest_ptr    pointer where the statistics are copied to
+ *
+ * @return  void
+ */
+extern void NVM_GetPolicyStatistics(NVM_POLICY_e policy, NVM_POLICY_STATISTICS_s *dest_ptr);
+
 /*================== Function Implementations =============================*/
 
 #endif /* BKSPSRAM_CFG_H_ */
@@ -46,6 +46,7 @@
 #include "can_cfg.h"
 #include "rcc_cfg.h"
 #include "mcu.h"
+#include "isotp_cfg.h"
 
 /*================== Macros and Definitions ===============================*/
 
@@ -261,6 +262,9 @@ const CAN_MSG_TX_TYPE_s can_CAN0_messages_tx[] = {
 
         { 0x130, 8, 100, 30, NULL_PTR },  //!< Maximum allowed current
         { 0x131, 8, 100, 30, NULL_PTR },  //!< SOP
+        { 0x132, 8, 100, 30, NULL_PTR },  //!< Current budgets
+        { 0x133, 8, 100, 30, NULL_PTR },  //!< Derating
+        { 0x134, 8, 100, 30, NULL_PTR },  //!< SOP currents
         { 0x140, 8, 1000, 30, NULL_PTR },  //!< SOC
         { 0x150, 8, 5000, 30, NULL_PTR },  //!< SOH
         { 0x160, 8, 1000, 30, NULL_PTR },  //!< SOE
@@ -269,6 +273,7 @@ const CAN_MSG_TX_TYPE_s can_CAN0_messages_tx[] = {
         { 0x180, 8, 100, 30, NULL_PTR },  //!< Cell temperatures Min Max Average
         { 0x190, 8, 1000, 30, NULL_PTR },  //!< Tempering
         { 0x1A0, 8, 1000, 30, NULL_PTR },  //!< Insulation
+        { 0x1B0, 8, 5000, 30, NULL_PTR },  //!< Balancing charge and cell self-discharge
 
         { 0x1D0, 8, 1000, 40, NULL_PTR },  //!< Running average power 0
         { 0x1D1, 8, 1000, 40, NULL_PTR },  //!< Running average power 1
@@ -277,6 +282,7 @@ const CAN_MSG_TX_TYPE_s can_CAN0_messages_tx[] = {
         { 0x1E1, 8, 1000, 40, NULL_PTR },  //!< Running average current 1
         { 0x1E2, 8, 1000, 40, NULL_PTR },  //!< Running average current 2
 
+#if CAN_USE_CELLDATA_MUX == 0
         { 0x200, 8, 200, 20, NULL_PTR },  //!< Cell voltages module 0 cells 0 1 2
         { 0x201, 8, 200, 20, NULL_PTR },  //!< Cell voltages module 0 cells 3 4 5
         { 0x202, 8, 200, 20, NULL_PTR },  //!< Cell voltages module 0 cells 6 7 8
@@ -356,6 +362,7 @@ const CAN_MSG_TX_TYPE_s can_CAN0_messages_tx[] = {
         { 0x2F1, 8, 200, 170, NULL_PTR },  //!< Cell temperatures module 7 cells 3 4 5
         { 0x2F2, 8, 200, 170, NULL_PTR },  //!< Cell temperatures module 7 cells 6 7 8
         { 0x2F3, 8, 200, 170, NULL_PTR },  //!< Cell temperatures module 7 cells 9 10 11
+#endif /* CAN_USE_CELLDATA_MUX == 0 */
 
 
 #ifdef CAN_ISABELLENHUETTE_TRIGGERED
@@ -403,6 +410,12 @@ CAN_MSG_RX_TYPE_s can0_RxMsgs[] = {
         { 0x528, 0xFFFF, 8, 0, CAN_FIFO0, NULL },    /*!< current sensor E-C in cyclic mode  */
 #endif
         { 0x100, 0xFFFF, 8, 0, CAN_FIFO0, NULL },    /*!< debug message      */
+#if CAN_USE_ISOTP == 1
+        { ISOTP_SESSION0_RX_ID, 0xFFFF, 8, 0, CAN_FIFO0, NULL },    /*!< ISO-TP request session 0  */
+#if ISOTP_NR_OF_SESSIONS > 1
+        { ISOTP_SESSION1_RX_ID, 0xFFFF, 8, 0, CAN_FIFO0, NULL },    /*!< ISO-TP request session 1  */
+#endif
+#endif
 };
 
 
@@ -244,6 +244,33 @@
 #define CAN_ISABELLENHUETTE_CYCLIC
 // #define CAN_ISABELLENHUETTE_TRIGGERED
 
+/**
+ * @ingroup CONFIG_CAN
+ * Enables the multiplexed cell data messages (see canmux.h and canmux_cfg.h)
+ * instead of one message per module and cell group (0x200 - 0x2F3), which
+ * cover at most 8 modules
+ * \par Type:
+ * int
+ * \par Range:
+ * x == 0 or x == 1
+ * \par Default:
+ * 0
+*/
+#define CAN_USE_CELLDATA_MUX             0
+
+/**
+ * @ingroup CONFIG_CAN
+ * Enables the ISO-TP transport layer for bulk reads of database blocks,
+ * EEPROM channels and the DIAG error entries (see isotp.h and isotp_cfg.h)
+ * \par Type:
+ * int
+ * \par Range:
+ * x == 0 or x == 1
+ * \par Default:
+ * 1
+*/
+#define CAN_USE_ISOTP                    1
+
 /**
  * @ingroup CONFIG_CAN
  * Defines CAN message ID to perform a software reset
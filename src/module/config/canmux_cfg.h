@@ -0,0 +1,118 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    canmux_cfg.h
+ * @author  foxBMS Team
+ * @date    19.10.2026 (date of creation)
+ * @ingroup DRIVERS_CONF
+ * @prefix  CANMUX
+ *
+ * @brief   Configuration of the multiplexed cell data messages
+ *
+ */
+
+#ifndef CANMUX_CFG_H_
+#define CANMUX_CFG_H_
+
+/*================== Includes =============================================*/
+#include "batterysystem_cfg.h"
+#include "can_cfg.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/**
+ * @ingroup CONFIG_CANMUX
+ * Periodic calling time of CANMUX_Trigger()
+ * \par Type:
+ * int
+ * \par Unit:
+ * ms
+ * \par Default:
+ * 10
+*/
+#define CANMUX_TICK_MS                  10
+
+/**
+ * @ingroup CONFIG_CANMUX
+ * Bus bandwidth reserved for the multiplexed cell data messages on CAN0.
+ * The messages of all modules are sent round-robin, so the time for one
+ * round over all modules is
+ * BS_NR_OF_MODULES * frames per module * CANMUX_FRAME_BITS / CANMUX_BANDWIDTH,
+ * e.g., 36 modules with 12 cells and 4 sensors: 216 * 135bit / 100kbit/s = 292ms
+ * \par Type:
+ * int
+ * \par Unit:
+ * bit/s
+ * \par Range:
+ * 0 < x < CAN0_BAUDRATE
+ * \par Default:
+ * 100000
+*/
+#define CANMUX_BANDWIDTH                100000
+
+/**
+ * @ingroup CONFIG_CANMUX
+ * Length of a message with 8 data bytes and 11 bit identifier including
+ * worst case bit stuffing and interframe space
+ * \par Type:
+ * int
+ * \par Unit:
+ * bit
+ * \par Default:
+ * 135
+*/
+#define CANMUX_FRAME_BITS               135
+
+/**
+ * @ingroup CONFIG_CANMUX
+ * Minimum time between the start of two rounds over all modules. Limits the
+ * bus load of small systems to the cycle time of the single messages.
+ * \par Type:
+ * int
+ * \par Unit:
+ * ms
+ * \par Default:
+ * 200
+*/
+#define CANMUX_ROUND_TIME_MS            200
+
+/**
+ * @ingroup CONFIG_CANMUX
+ * Maximum number of messages passed to the CAN0 transmit buffer per call of
+ * CANMUX_Trigger(), keeps room in the buffer for the messages of the CANS
+ * \par Type:
+ * int
+ * \par Range:
+ * 0 < x < CAN0_TRANSMIT_BUFFER_LENGTH
+ * \par Default:
+ * CAN0_TRANSMIT_BUFFER_LENGTH / 2
+*/
+#define CANMUX_MAX_FRAMES_PER_TICK      (CAN0_TRANSMIT_BUFFER_LENGTH / 2)
+
+/*================== Constant and Variable Definitions ====================*/
+
+/*================== Function Prototypes ==================================*/
+
+/*================== Function Implementations =============================*/
+
+#endif /* CANMUX_CFG_H_ */
@@ -42,33 +42,53 @@
 #include "general.h"
 #include "cansignal_cfg.h"
 
+#include "cans_dbc.h"
 #include "database.h"
 #include "mcu.h"
 #include "sox.h"
+#include "sox_cc.h"
+#include "ffr.h"
+#include "budget.h"
+#include "derating.h"
+#include "isotp.h"
 
 /*================== Function Prototypes ==================================*/
 
 static float cans_checkLimits(float value, uint32_t sigIdx);
+#if CAN_USE_CELLDATA_MUX == 0
+static uint32_t cans_getFrameSignal(uint64_t frame, uint32_t sigIdx);
+#endif
 
 // TX/Getter functions
+#if CAN_USE_CELLDATA_MUX == 0
 static uint32_t cans_getvolt(uint32_t, void *);
+static uint32_t cans_gettemp(uint32_t, void *);
+#endif
 static uint32_t cans_gettempering(uint32_t, void *);
 static uint32_t cans_getcanerr(uint32_t, void *);
-static uint32_t cans_gettemp(uint32_t, void *);
 static uint32_t cans_getsoc(uint32_t, void *);
+static uint32_t cans_getsoh(uint32_t, void *);
+static uint32_t cans_getsoe(uint32_t, void *);
 static uint32_t cans_getMaxAllowedCurrent(uint32_t, void *);
 static uint32_t cans_getMaxAllowedPower(uint32_t, void *);
+static uint32_t cans_getcurrentbudget(uint32_t, void *);
+static uint32_t cans_getderating(uint32_t, void *);
+static uint32_t cans_getsopcurrent(uint32_t, void *);
 static uint32_t cans_getpower(uint32_t, void *);
 static uint32_t cans_getcurr(uint32_t, void *);
 static uint32_t cans_getminmaxvolt(uint32_t, void *);
 static uint32_t cans_getminmaxtemp(uint32_t, void *);
 static uint32_t cans_getisoguard(uint32_t, void *);
+static uint32_t cans_getbalancingleakage(uint32_t, void *);
 
 
 // RX/Setter functions
 static uint32_t cans_setcurr(uint32_t, void *);
 static uint32_t cans_setstaterequest(uint32_t, void *);
 static uint32_t cans_setdebug(uint32_t, void *);
+#if CAN_USE_ISOTP == 1
+static uint32_t cans_setisotp(uint32_t, void *);
+#endif
 
 
 #ifdef CAN_ISABELLENHUETTE_TRIGGERED
@@ -77,8 +97,15 @@ static uint32_t cans_gettriggercurrent(uint32_t sigIdx, void *value);
 /*================== Macros and Definitions ===============================*/
 static DATA_BLOCK_CURRENT_s cans_current_tab;
 
+#if CAN_USE_CELLDATA_MUX == 0
 #define CANS_MODULSIGNALS_VOLT      (CAN0_SIG_Mod0_temp_valid_0_2 - CAN0_SIG_Mod0_volt_valid_0_2)
 #define CANS_MODULSIGNALS_TEMP      (CAN0_SIG_Mod1_volt_valid_0_2 - CAN0_SIG_Mod0_temp_valid_0_2)
+#define CANS_MODULSIGNALS           (CANS_MODULSIGNALS_VOLT + CANS_MODULSIGNALS_TEMP)
+
+/* cell data messages: valid flags followed by the values of three cells, same layout for both */
+#define CANS_CELLMSG_SIGNALS        CANS_CELLVOLTAGES_NR_OF_SIGNALS
+#define CANS_CELLMSG_CELLS          3
+#endif
 
 
 /*================== Constant and Variable Definitions ====================*/
@@ -117,16 +144,35 @@ const CANS_signal_s cans_CAN0_signals_tx[] = {
         { {CAN0_MSG_SOP}, 32, 16, 0, 6553.5, 10, 0, NULL_PTR, &cans_getMaxAllowedPower },  //!< CAN0_SIG_MaxDischargePower
         { {CAN0_MSG_SOP}, 48, 16, 0, 6553.5, 10, 0, NULL_PTR, &cans_getMaxAllowedPower },  //!< CAN0_SIG_MaxDischargePower_Peak
 
+        { {CAN0_MSG_CurrentBudget}, 0, 16, 0, 6553.5, 10, 0, NULL_PTR, &cans_getcurrentbudget },  //!< CAN0_SIG_PeakTimeCharge
+        { {CAN0_MSG_CurrentBudget}, 16, 16, 0, 6553.5, 10, 0, NULL_PTR, &cans_getcurrentbudget },  //!< CAN0_SIG_PeakTimeDischarge
+        { {CAN0_MSG_CurrentBudget}, 32, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_getcurrentbudget },  //!< CAN0_SIG_BudgetUsageCharge
+        { {CAN0_MSG_CurrentBudget}, 40, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_getcurrentbudget },  //!< CAN0_SIG_BudgetUsageDischarge
+        { {CAN0_MSG_CurrentBudget}, 48, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_getcurrentbudget },  //!< CAN0_SIG_BudgetGradeCharge
+        { {CAN0_MSG_CurrentBudget}, 56, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_getcurrentbudget },  //!< CAN0_SIG_BudgetGradeDischarge
+
+        { {CAN0_MSG_Derating}, 0, 8, 0, 100, 1, 0, NULL_PTR, &cans_getderating },  //!< CAN0_SIG_DeratingCharge
+        { {CAN0_MSG_Derating}, 8, 8, 0, 100, 1, 0, NULL_PTR, &cans_getderating },  //!< CAN0_SIG_DeratingDischarge
+        { {CAN0_MSG_Derating}, 16, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_getderating },  //!< CAN0_SIG_DeratingDisconnect
+        { {CAN0_MSG_Derating}, 24, 16, 0, 6553.5, 10, 0, NULL_PTR, &cans_getderating },  //!< CAN0_SIG_RampDownTime
+
+        { {CAN0_MSG_SOPCurrent}, 0, 10, 0, 1023, 1, 0, NULL_PTR, &cans_getsopcurrent },  //!< CAN0_SIG_SOPDischargeCurrent_2s
+        { {CAN0_MSG_SOPCurrent}, 10, 10, 0, 1023, 1, 0, NULL_PTR, &cans_getsopcurrent },  //!< CAN0_SIG_SOPDischargeCurrent_10s
+        { {CAN0_MSG_SOPCurrent}, 20, 10, 0, 1023, 1, 0, NULL_PTR, &cans_getsopcurrent },  //!< CAN0_SIG_SOPDischargeCurrent_30s
+        { {CAN0_MSG_SOPCurrent}, 30, 10, 0, 1023, 1, 0, NULL_PTR, &cans_getsopcurrent },  //!< CAN0_SIG_SOPChargeCurrent_2s
+        { {CAN0_MSG_SOPCurrent}, 40, 10, 0, 1023, 1, 0, NULL_PTR, &cans_getsopcurrent },  //!< CAN0_SIG_SOPChargeCurrent_10s
+        { {CAN0_MSG_SOPCurrent}, 50, 10, 0, 1023, 1, 0, NULL_PTR, &cans_getsopcurrent },  //!< CAN0_SIG_SOPChargeCurrent_30s
+
         { {CAN0_MSG_SOC}, 0, 16, 0, 100, 100, 0, NULL_PTR, &cans_getsoc },  //!< CAN0_SIG_SOC_mean
         { {CAN0_MSG_SOC}, 16, 16, 0, 100, 100, 0, NULL_PTR, &cans_getsoc },  //!< CAN0_SIG_SOC_min
         { {CAN0_MSG_SOC}, 32, 16, 0, 100, 100, 0, NULL_PTR, &cans_getsoc },  //!< CAN0_SIG_SOC_max
 
-        { {CAN0_MSG_SOH}, 0, 16, 0, 0, 100, 0, NULL_PTR, NULL_PTR },  //!< CAN0_SIG_SOH_mean
-        { {CAN0_MSG_SOH}, 16, 16, 0, 0, 100, 0, NULL_PTR, NULL_PTR },  //!< CAN0_SIG_SOH_min
-        { {CAN0_MSG_SOH}, 32, 16, 0, 0, 100, 0, NULL_PTR, NULL_PTR },  //!< CAN0_SIG_SOH_max
+        { {CAN0_MSG_SOH}, 0, 16, 0, 100, 100, 0, NULL_PTR, &cans_getsoh },  //!< CAN0_SIG_SOH_mean
+        { {CAN0_MSG_SOH}, 16, 16, 0, 100, 100, 0, NULL_PTR, &cans_getsoh },  //!< CAN0_SIG_SOH_min
+        { {CAN0_MSG_SOH}, 32, 16, 0, 100, 100, 0, NULL_PTR, &cans_getsoh },  //!< CAN0_SIG_SOH_max
 
-        { {CAN0_MSG_SOE}, 0, 16, 0, 0, 100, 0, NULL_PTR, NULL_PTR },  //!< CAN0_SIG_SOE
-        { {CAN0_MSG_SOE}, 16, 32, 0, 0, 1, 0, NULL_PTR, NULL_PTR },  //!< CAN0_SIG_RemainingEnergy
+        { {CAN0_MSG_SOE}, 0, 16, 0, 100, 100, 0, NULL_PTR, &cans_getsoe },  //!< CAN0_SIG_SOE
+        { {CAN0_MSG_SOE}, 16, 32, 0, 1000000, 1, 0, NULL_PTR, &cans_getsoe },  //!< CAN0_SIG_RemainingEnergy
 
         { {CAN0_MSG_MinMaxCellVolt}, 0, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getminmaxvolt },  //!< CAN0_SIG_Cellvolt_mean
         { {CAN0_MSG_MinMaxCellVolt}, 16, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getminmaxvolt },  //!< CAN0_SIG_Cellvolt_min
@@ -149,6 +195,12 @@ const CANS_signal_s cans_CAN0_signals_tx[] = {
         { {CAN0_MSG_Insulation}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_getisoguard },  //!< CAN0_SIG_InsulationStatus
         { {CAN0_MSG_Insulation}, 8, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getisoguard },  //!< CAN0_SIG_InsulationValue
 
+        { {CAN0_MSG_BalancingLeakage}, 0, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getbalancingleakage },  //!< CAN0_SIG_LeakageMax
+        { {CAN0_MSG_BalancingLeakage}, 16, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getbalancingleakage },  //!< CAN0_SIG_LeakageMaxCell
+        { {CAN0_MSG_BalancingLeakage}, 32, 16, 0, 6553.5, 10, 0, NULL_PTR, &cans_getbalancingleakage },  //!< CAN0_SIG_BalancedCharge
+        { {CAN0_MSG_BalancingLeakage}, 48, 15, 0, 0x7FFF, 1, 0, NULL_PTR, &cans_getbalancingleakage },  //!< CAN0_SIG_LeakageObservationTime
+        { {CAN0_MSG_BalancingLeakage}, 63, 1, 0, 1, 1, 0, NULL_PTR, &cans_getbalancingleakage },  //!< CAN0_SIG_LeakageValid
+
         { {CAN0_MSG_Power_0}, 0, 32, -2500000, 4292467295, 1, 2500000, NULL_PTR, &cans_getpower },  //!< CAN0_SIG_RunAverage_Power_1s
         { {CAN0_MSG_Power_0}, 32, 32, -2500000, 4292467295, 1, 2500000, NULL_PTR, &cans_getpower },  //!< CAN0_SIG_RunAverage_Power_5s
         { {CAN0_MSG_Power_1}, 0, 32, -2500000, 4292467295, 1, 2500000, NULL_PTR, &cans_getpower },  //!< CAN0_SIG_RunAverage_Power_10s
@@ -163,293 +215,103 @@ const CANS_signal_s cans_CAN0_signals_tx[] = {
         { {CAN0_MSG_Current_2}, 0, 32, -2500000, 4292467295, 1, 2500000, NULL_PTR, &cans_getcurr },  //!< CAN0_SIG_RunAverage_Current_60s
         { {CAN0_MSG_Current_2}, 32, 32, -2500000, 4292467295, 1, 2500000, NULL_PTR, &cans_getcurr },  //!< CAN0_SIG_RunAverage_Current_config
 
+#if CAN_USE_CELLDATA_MUX == 0
         // Module 0 cell voltages
-        { {CAN0_MSG_Mod0_Cellvolt_0}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod0_volt_valid_0_2
-        { {CAN0_MSG_Mod0_Cellvolt_0}, 8, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod0_volt_0
-        { {CAN0_MSG_Mod0_Cellvolt_0}, 24, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod0_volt_1
-        { {CAN0_MSG_Mod0_Cellvolt_0}, 40, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod0_volt_2
-        { {CAN0_MSG_Mod0_Cellvolt_1}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod0_volt_valid_3_5
-        { {CAN0_MSG_Mod0_Cellvolt_1}, 8, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod0_volt_3
-        { {CAN0_MSG_Mod0_Cellvolt_1}, 24, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod0_volt_4
-        { {CAN0_MSG_Mod0_Cellvolt_1}, 40, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod0_volt_5
-        { {CAN0_MSG_Mod0_Cellvolt_2}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod0_volt_valid_6_8
-        { {CAN0_MSG_Mod0_Cellvolt_2}, 8, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod0_volt_6
-        { {CAN0_MSG_Mod0_Cellvolt_2}, 24, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod0_volt_7
-        { {CAN0_MSG_Mod0_Cellvolt_2}, 40, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod0_volt_8
-        { {CAN0_MSG_Mod0_Cellvolt_3}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod0_volt_valid_9_11
-        { {CAN0_MSG_Mod0_Cellvolt_3}, 8, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod0_volt_9
-        { {CAN0_MSG_Mod0_Cellvolt_3}, 24, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod0_volt_10
-        { {CAN0_MSG_Mod0_Cellvolt_3}, 40, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod0_volt_11
+        CANS_CELLVOLTAGES_SIGNALS(CAN0_MSG_Mod0_Cellvolt_0, NULL_PTR, &cans_getvolt),  //!< CAN0_SIG_Mod0_volt_valid_0_2 .. CAN0_SIG_Mod0_volt_2
+        CANS_CELLVOLTAGES_SIGNALS(CAN0_MSG_Mod0_Cellvolt_1, NULL_PTR, &cans_getvolt),  //!< CAN0_SIG_Mod0_volt_valid_3_5 .. CAN0_SIG_Mod0_volt_5
+        CANS_CELLVOLTAGES_SIGNALS(CAN0_MSG_Mod0_Cellvolt_2, NULL_PTR, &cans_getvolt),  //!< CAN0_SIG_Mod0_volt_valid_6_8 .. CAN0_SIG_Mod0_volt_8
+        CANS_CELLVOLTAGES_SIGNALS(CAN0_MSG_Mod0_Cellvolt_3, NULL_PTR, &cans_getvolt),  //!< CAN0_SIG_Mod0_volt_valid_9_11 .. CAN0_SIG_Mod0_volt_11
 
         // Module 0 cell temperatures
-        { {CAN0_MSG_Mod0_Celltemp_0}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod0_volt_valid_0_2
-        { {CAN0_MSG_Mod0_Celltemp_0}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod0_temp_0
-        { {CAN0_MSG_Mod0_Celltemp_0}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod0_temp_1
-        { {CAN0_MSG_Mod0_Celltemp_0}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod0_temp_2
-        { {CAN0_MSG_Mod0_Celltemp_1}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod0_volt_valid_3_5
-        { {CAN0_MSG_Mod0_Celltemp_1}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod0_temp_3
-        { {CAN0_MSG_Mod0_Celltemp_1}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod0_temp_4
-        { {CAN0_MSG_Mod0_Celltemp_1}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod0_temp_5
-        { {CAN0_MSG_Mod0_Celltemp_2}, 0, 8, 0, 0xFF, 1, 0, &cans_gettemp },  //!< CAN0_SIG_Mod0_volt_valid_6_8
-        { {CAN0_MSG_Mod0_Celltemp_2}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod0_temp_6
-        { {CAN0_MSG_Mod0_Celltemp_2}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod0_temp_7
-        { {CAN0_MSG_Mod0_Celltemp_2}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod0_temp_8
-        { {CAN0_MSG_Mod0_Celltemp_3}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod0_volt_valid_9_11
-        { {CAN0_MSG_Mod0_Celltemp_3}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod0_temp_9
-        { {CAN0_MSG_Mod0_Celltemp_3}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod0_temp_10
-        { {CAN0_MSG_Mod0_Celltemp_3}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod0_temp_11
+        CANS_CELLTEMPERATURES_SIGNALS(CAN0_MSG_Mod0_Celltemp_0, NULL_PTR, &cans_gettemp),  //!< CAN0_SIG_Mod0_temp_valid_0_2 .. CAN0_SIG_Mod0_temp_2
+        CANS_CELLTEMPERATURES_SIGNALS(CAN0_MSG_Mod0_Celltemp_1, NULL_PTR, &cans_gettemp),  //!< CAN0_SIG_Mod0_temp_valid_3_5 .. CAN0_SIG_Mod0_temp_5
+        CANS_CELLTEMPERATURES_SIGNALS(CAN0_MSG_Mod0_Celltemp_2, NULL_PTR, &cans_gettemp),  //!< CAN0_SIG_Mod0_temp_valid_6_8 .. CAN0_SIG_Mod0_temp_8
+        CANS_CELLTEMPERATURES_SIGNALS(CAN0_MSG_Mod0_Celltemp_3, NULL_PTR, &cans_gettemp),  //!< CAN0_SIG_Mod0_temp_valid_9_11 .. CAN0_SIG_Mod0_temp_11
 
         // Module 1 cell voltages
-        { {CAN0_MSG_Mod1_Cellvolt_0}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod1_volt_valid_0_2
-        { {CAN0_MSG_Mod1_Cellvolt_0}, 8, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod1_volt_0
-        { {CAN0_MSG_Mod1_Cellvolt_0}, 24, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod1_volt_1
-        { {CAN0_MSG_Mod1_Cellvolt_0}, 40, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod1_volt_2
-        { {CAN0_MSG_Mod1_Cellvolt_1}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod1_volt_valid_3_5
-        { {CAN0_MSG_Mod1_Cellvolt_1}, 8, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod1_volt_3
-        { {CAN0_MSG_Mod1_Cellvolt_1}, 24, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod1_volt_4
-        { {CAN0_MSG_Mod1_Cellvolt_1}, 40, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod1_volt_5
-        { {CAN0_MSG_Mod1_Cellvolt_2}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod1_volt_valid_6_8
-        { {CAN0_MSG_Mod1_Cellvolt_2}, 8, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod1_volt_6
-        { {CAN0_MSG_Mod1_Cellvolt_2}, 24, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod1_volt_7
-        { {CAN0_MSG_Mod1_Cellvolt_2}, 40, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod1_volt_8
-        { {CAN0_MSG_Mod1_Cellvolt_3}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod1_volt_valid_9_11
-        { {CAN0_MSG_Mod1_Cellvolt_3}, 8, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod1_volt_9
-        { {CAN0_MSG_Mod1_Cellvolt_3}, 24, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod1_volt_10
-        { {CAN0_MSG_Mod1_Cellvolt_3}, 40, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod1_volt_11
+        CANS_CELLVOLTAGES_SIGNALS(CAN0_MSG_Mod1_Cellvolt_0, NULL_PTR, &cans_getvolt),  //!< CAN0_SIG_Mod1_volt_valid_0_2 .. CAN0_SIG_Mod1_volt_2
+        CANS_CELLVOLTAGES_SIGNALS(CAN0_MSG_Mod1_Cellvolt_1, NULL_PTR, &cans_getvolt),  //!< CAN0_SIG_Mod1_volt_valid_3_5 .. CAN0_SIG_Mod1_volt_5
+        CANS_CELLVOLTAGES_SIGNALS(CAN0_MSG_Mod1_Cellvolt_2, NULL_PTR, &cans_getvolt),  //!< CAN0_SIG_Mod1_volt_valid_6_8 .. CAN0_SIG_Mod1_volt_8
+        CANS_CELLVOLTAGES_SIGNALS(CAN0_MSG_Mod1_Cellvolt_3, NULL_PTR, &cans_getvolt),  //!< CAN0_SIG_Mod1_volt_valid_9_11 .. CAN0_SIG_Mod1_volt_11
 
         // Module 1 cell temperatures
-        { {CAN0_MSG_Mod1_Celltemp_0}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod1_volt_valid_0_2
-        { {CAN0_MSG_Mod1_Celltemp_0}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod1_temp_0
-        { {CAN0_MSG_Mod1_Celltemp_0}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod1_temp_1
-        { {CAN0_MSG_Mod1_Celltemp_0}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod1_temp_2
-        { {CAN0_MSG_Mod1_Celltemp_1}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod1_volt_valid_3_5
-        { {CAN0_MSG_Mod1_Celltemp_1}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod1_temp_3
-        { {CAN0_MSG_Mod1_Celltemp_1}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod1_temp_4
-        { {CAN0_MSG_Mod1_Celltemp_1}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod1_temp_5
-        { {CAN0_MSG_Mod1_Celltemp_2}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod1_volt_valid_6_8
-        { {CAN0_MSG_Mod1_Celltemp_2}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod1_temp_6
-        { {CAN0_MSG_Mod1_Celltemp_2}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod1_temp_7
-        { {CAN0_MSG_Mod1_Celltemp_2}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod1_temp_8
-        { {CAN0_MSG_Mod1_Celltemp_3}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod1_volt_valid_9_11
-        { {CAN0_MSG_Mod1_Celltemp_3}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod1_temp_9
-        { {CAN0_MSG_Mod1_Celltemp_3}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod1_temp_10
-        { {CAN0_MSG_Mod1_Celltemp_3}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod1_temp_11
+        CANS_CELLTEMPERATURES_SIGNALS(CAN0_MSG_Mod1_Celltemp_0, NULL_PTR, &cans_gettemp),  //!< CAN0_SIG_Mod1_temp_valid_0_2 .. CAN0_SIG_Mod1_temp_2
+        CANS_CELLTEMPERATURES_SIGNALS(CAN0_MSG_Mod1_Celltemp_1, NULL_PTR, &cans_gettemp),  //!< CAN0_SIG_Mod1_temp_valid_3_5 .. CAN0_SIG_Mod1_temp_5
+        CANS_CELLTEMPERATURES_SIGNALS(CAN0_MSG_Mod1_Celltemp_2, NULL_PTR, &cans_gettemp),  //!< CAN0_SIG_Mod1_temp_valid_6_8 .. CAN0_SIG_Mod1_temp_8
+        CANS_CELLTEMPERATURES_SIGNALS(CAN0_MSG_Mod1_Celltemp_3, NULL_PTR, &cans_gettemp),  //!< CAN0_SIG_Mod1_temp_valid_9_11 .. CAN0_SIG_Mod1_temp_11
 
         // Module 2 cell voltages
-        { {CAN0_MSG_Mod2_Cellvolt_0}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod2_volt_valid_0_2
-        { {CAN0_MSG_Mod2_Cellvolt_0}, 8, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod2_volt_0
-        { {CAN0_MSG_Mod2_Cellvolt_0}, 24, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod2_volt_1
-        { {CAN0_MSG_Mod2_Cellvolt_0}, 40, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod2_volt_2
-        { {CAN0_MSG_Mod2_Cellvolt_1}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod2_volt_valid_3_5
-        { {CAN0_MSG_Mod2_Cellvolt_1}, 8, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod2_volt_3
-        { {CAN0_MSG_Mod2_Cellvolt_1}, 24, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod2_volt_4
-        { {CAN0_MSG_Mod2_Cellvolt_1}, 40, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod2_volt_5
-        { {CAN0_MSG_Mod2_Cellvolt_2}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod2_volt_valid_6_8
-        { {CAN0_MSG_Mod2_Cellvolt_2}, 8, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod2_volt_6
-        { {CAN0_MSG_Mod2_Cellvolt_2}, 24, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod2_volt_7
-        { {CAN0_MSG_Mod2_Cellvolt_2}, 40, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod2_volt_8
-        { {CAN0_MSG_Mod2_Cellvolt_3}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod2_volt_valid_9_11
-        { {CAN0_MSG_Mod2_Cellvolt_3}, 8, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod2_volt_9
-        { {CAN0_MSG_Mod2_Cellvolt_3}, 24, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod2_volt_10
-        { {CAN0_MSG_Mod2_Cellvolt_3}, 40, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod2_volt_11
+        CANS_CELLVOLTAGES_SIGNALS(CAN0_MSG_Mod2_Cellvolt_0, NULL_PTR, &cans_getvolt),  //!< CAN0_SIG_Mod2_volt_valid_0_2 .. CAN0_SIG_Mod2_volt_2
+        CANS_CELLVOLTAGES_SIGNALS(CAN0_MSG_Mod2_Cellvolt_1, NULL_PTR, &cans_getvolt),  //!< CAN0_SIG_Mod2_volt_valid_3_5 .. CAN0_SIG_Mod2_volt_5
+        CANS_CELLVOLTAGES_SIGNALS(CAN0_MSG_Mod2_Cellvolt_2, NULL_PTR, &cans_getvolt),  //!< CAN0_SIG_Mod2_volt_valid_6_8 .. CAN0_SIG_Mod2_volt_8
+        CANS_CELLVOLTAGES_SIGNALS(CAN0_MSG_Mod2_Cellvolt_3, NULL_PTR, &cans_getvolt),  //!< CAN0_SIG_Mod2_volt_valid_9_11 .. CAN0_SIG_Mod2_volt_11
 
         // Module 2 cell temperatures
-        { {CAN0_MSG_Mod2_Celltemp_0}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod2_volt_valid_0_2
-        { {CAN0_MSG_Mod2_Celltemp_0}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod2_temp_0
-        { {CAN0_MSG_Mod2_Celltemp_0}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod2_temp_1
-        { {CAN0_MSG_Mod2_Celltemp_0}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod2_temp_2
-        { {CAN0_MSG_Mod2_Celltemp_1}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod2_volt_valid_3_5
-        { {CAN0_MSG_Mod2_Celltemp_1}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod2_temp_3
-        { {CAN0_MSG_Mod2_Celltemp_1}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod2_temp_4
-        { {CAN0_MSG_Mod2_Celltemp_1}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod2_temp_5
-        { {CAN0_MSG_Mod2_Celltemp_2}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod2_volt_valid_6_8
-        { {CAN0_MSG_Mod2_Celltemp_2}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod2_temp_6
-        { {CAN0_MSG_Mod2_Celltemp_2}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod2_temp_7
-        { {CAN0_MSG_Mod2_Celltemp_2}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod2_temp_8
-        { {CAN0_MSG_Mod2_Celltemp_3}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod2_volt_valid_9_11
-        { {CAN0_MSG_Mod2_Celltemp_3}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod2_temp_9
-        { {CAN0_MSG_Mod2_Celltemp_3}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod2_temp_10
-        { {CAN0_MSG_Mod2_Celltemp_3}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod2_temp_11
+        CANS_CELLTEMPERATURES_SIGNALS(CAN0_MSG_Mod2_Celltemp_0, NULL_PTR, &cans_gettemp),  //!< CAN0_SIG_Mod2_temp_valid_0_2 .. CAN0_SIG_Mod2_temp_2
+        CANS_CELLTEMPERATURES_SIGNALS(CAN0_MSG_Mod2_Celltemp_1, NULL_PTR, &cans_gettemp),  //!< CAN0_SIG_Mod2_temp_valid_3_5 .. CAN0_SIG_Mod2_temp_5
+        CANS_CELLTEMPERATURES_SIGNALS(CAN0_MSG_Mod2_Celltemp_2, NULL_PTR, &cans_gettemp),  //!< CAN0_SIG_Mod2_temp_valid_6_8 .. CAN0_SIG_Mod2_temp_8
+        CANS_CELLTEMPERATURES_SIGNALS(CAN0_MSG_Mod2_Celltemp_3, NULL_PTR, &cans_gettemp),  //!< CAN0_SIG_Mod2_temp_valid_9_11 .. CAN0_SIG_Mod2_temp_11
 
         // Module 3 cell voltages
-        { {CAN0_MSG_Mod3_Cellvolt_0}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod3_volt_valid_0_2
-        { {CAN0_MSG_Mod3_Cellvolt_0}, 8, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod3_volt_0
-        { {CAN0_MSG_Mod3_Cellvolt_0}, 24, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod3_volt_1
-        { {CAN0_MSG_Mod3_Cellvolt_0}, 40, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod3_volt_2
-        { {CAN0_MSG_Mod3_Cellvolt_1}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod3_volt_valid_3_5
-        { {CAN0_MSG_Mod3_Cellvolt_1}, 8, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod3_volt_3
-        { {CAN0_MSG_Mod3_Cellvolt_1}, 24, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod3_volt_4
-        { {CAN0_MSG_Mod3_Cellvolt_1}, 40, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod3_volt_5
-        { {CAN0_MSG_Mod3_Cellvolt_2}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod3_volt_valid_6_8
-        { {CAN0_MSG_Mod3_Cellvolt_2}, 8, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod3_volt_6
-        { {CAN0_MSG_Mod3_Cellvolt_2}, 24, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod3_volt_7
-        { {CAN0_MSG_Mod3_Cellvolt_2}, 40, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod3_volt_8
-        { {CAN0_MSG_Mod3_Cellvolt_3}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod3_volt_valid_9_11
-        { {CAN0_MSG_Mod3_Cellvolt_3}, 8, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod3_volt_9
-        { {CAN0_MSG_Mod3_Cellvolt_3}, 24, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod3_volt_10
-        { {CAN0_MSG_Mod3_Cellvolt_3}, 40, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod3_volt_11
+        CANS_CELLVOLTAGES_SIGNALS(CAN0_MSG_Mod3_Cellvolt_0, NULL_PTR, &cans_getvolt),  //!< CAN0_SIG_Mod3_volt_valid_0_2 .. CAN0_SIG_Mod3_volt_2
+        CANS_CELLVOLTAGES_SIGNALS(CAN0_MSG_Mod3_Cellvolt_1, NULL_PTR, &cans_getvolt),  //!< CAN0_SIG_Mod3_volt_valid_3_5 .. CAN0_SIG_Mod3_volt_5
+        CANS_CELLVOLTAGES_SIGNALS(CAN0_MSG_Mod3_Cellvolt_2, NULL_PTR, &cans_getvolt),  //!< CAN0_SIG_Mod3_volt_valid_6_8 .. CAN0_SIG_Mod3_volt_8
+        CANS_CELLVOLTAGES_SIGNALS(CAN0_MSG_Mod3_Cellvolt_3, NULL_PTR, &cans_getvolt),  //!< CAN0_SIG_Mod3_volt_valid_9_11 .. CAN0_SIG_Mod3_volt_11
 
         // Module 3 cell temperatures
-        { {CAN0_MSG_Mod3_Celltemp_0}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod3_volt_valid_0_2
-        { {CAN0_MSG_Mod3_Celltemp_0}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod3_temp_0
-        { {CAN0_MSG_Mod3_Celltemp_0}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod3_temp_1
-        { {CAN0_MSG_Mod3_Celltemp_0}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod3_temp_2
-        { {CAN0_MSG_Mod3_Celltemp_1}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod3_volt_valid_3_5
-        { {CAN0_MSG_Mod3_Celltemp_1}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod3_temp_3
-        { {CAN0_MSG_Mod3_Celltemp_1}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod3_temp_4
-        { {CAN0_MSG_Mod3_Celltemp_1}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod3_temp_5
-        { {CAN0_MSG_Mod3_Celltemp_2}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod3_volt_valid_6_8
-        { {CAN0_MSG_Mod3_Celltemp_2}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod3_temp_6
-        { {CAN0_MSG_Mod3_Celltemp_2}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod3_temp_7
-        { {CAN0_MSG_Mod3_Celltemp_2}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod3_temp_8
-        { {CAN0_MSG_Mod3_Celltemp_3}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod3_volt_valid_9_11
-        { {CAN0_MSG_Mod3_Celltemp_3}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod3_temp_9
-        { {CAN0_MSG_Mod3_Celltemp_3}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod3_temp_10
-        { {CAN0_MSG_Mod3_Celltemp_3}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod3_temp_11
+        CANS_CELLTEMPERATURES_SIGNALS(CAN0_MSG_Mod3_Celltemp_0, NULL_PTR, &cans_gettemp),  //!< CAN0_SIG_Mod3_temp_valid_0_2 .. CAN0_SIG_Mod3_temp_2
+        CANS_CELLTEMPERATURES_SIGNALS(CAN0_MSG_Mod3_Celltemp_1, NULL_PTR, &cans_gettemp),  //!< CAN0_SIG_Mod3_temp_valid_3_5 .. CAN0_SIG_Mod3_temp_5
+        CANS_CELLTEMPERATURES_SIGNALS(CAN0_MSG_Mod3_Celltemp_2, NULL_PTR, &cans_gettemp),  //!< CAN0_SIG_Mod3_temp_valid_6_8 .. CAN0_SIG_Mod3_temp_8
+        CANS_CELLTEMPERATURES_SIGNALS(CAN0_MSG_Mod3_Celltemp_3, NULL_PTR, &cans_gettemp),  //!< CAN0_SIG_Mod3_temp_valid_9_11 .. CAN0_SIG_Mod3_temp_11
 
         // Module 4 cell voltages
-        { {CAN0_MSG_Mod4_Cellvolt_0}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod4_volt_valid_0_2
-        { {CAN0_MSG_Mod4_Cellvolt_0}, 8, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod4_volt_0
-        { {CAN0_MSG_Mod4_Cellvolt_0}, 24, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod4_volt_1
-        { {CAN0_MSG_Mod4_Cellvolt_0}, 40, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod4_volt_2
-        { {CAN0_MSG_Mod4_Cellvolt_1}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod4_volt_valid_3_5
-        { {CAN0_MSG_Mod4_Cellvolt_1}, 8, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod4_volt_3
-        { {CAN0_MSG_Mod4_Cellvolt_1}, 24, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod4_volt_4
-        { {CAN0_MSG_Mod4_Cellvolt_1}, 40, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod4_volt_5
-        { {CAN0_MSG_Mod4_Cellvolt_2}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod4_volt_valid_6_8
-        { {CAN0_MSG_Mod4_Cellvolt_2}, 8, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod4_volt_6
-        { {CAN0_MSG_Mod4_Cellvolt_2}, 24, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod4_volt_7
-        { {CAN0_MSG_Mod4_Cellvolt_2}, 40, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod4_volt_8
-        { {CAN0_MSG_Mod4_Cellvolt_3}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod4_volt_valid_9_11
-        { {CAN0_MSG_Mod4_Cellvolt_3}, 8, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod4_volt_9
-        { {CAN0_MSG_Mod4_Cellvolt_3}, 24, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod4_volt_10
-        { {CAN0_MSG_Mod4_Cellvolt_3}, 40, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod4_volt_11
+        CANS_CELLVOLTAGES_SIGNALS(CAN0_MSG_Mod4_Cellvolt_0, NULL_PTR, &cans_getvolt),  //!< CAN0_SIG_Mod4_volt_valid_0_2 .. CAN0_SIG_Mod4_volt_2
+        CANS_CELLVOLTAGES_SIGNALS(CAN0_MSG_Mod4_Cellvolt_1, NULL_PTR, &cans_getvolt),  //!< CAN0_SIG_Mod4_volt_valid_3_5 .. CAN0_SIG_Mod4_volt_5
+        CANS_CELLVOLTAGES_SIGNALS(CAN0_MSG_Mod4_Cellvolt_2, NULL_PTR, &cans_getvolt),  //!< CAN0_SIG_Mod4_volt_valid_6_8 .. CAN0_SIG_Mod4_volt_8
+        CANS_CELLVOLTAGES_SIGNALS(CAN0_MSG_Mod4_Cellvolt_3, NULL_PTR, &cans_getvolt),  //!< CAN0_SIG_Mod4_volt_valid_9_11 .. CAN0_SIG_Mod4_volt_11
 
         // Module 4 cell temperatures
-        { {CAN0_MSG_Mod4_Celltemp_0}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod4_volt_valid_0_2
-        { {CAN0_MSG_Mod4_Celltemp_0}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod4_temp_0
-        { {CAN0_MSG_Mod4_Celltemp_0}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod4_temp_1
-        { {CAN0_MSG_Mod4_Celltemp_0}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod4_temp_2
-        { {CAN0_MSG_Mod4_Celltemp_1}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod4_volt_valid_3_5
-        { {CAN0_MSG_Mod4_Celltemp_1}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod4_temp_3
-        { {CAN0_MSG_Mod4_Celltemp_1}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod4_temp_4
-        { {CAN0_MSG_Mod4_Celltemp_1}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod4_temp_5
-        { {CAN0_MSG_Mod4_Celltemp_2}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod4_volt_valid_6_8
-        { {CAN0_MSG_Mod4_Celltemp_2}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod4_temp_6
-        { {CAN0_MSG_Mod4_Celltemp_2}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod4_temp_7
-        { {CAN0_MSG_Mod4_Celltemp_2}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod4_temp_8
-        { {CAN0_MSG_Mod4_Celltemp_3}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod4_volt_valid_9_11
-        { {CAN0_MSG_Mod4_Celltemp_3}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod4_temp_9
-        { {CAN0_MSG_Mod4_Celltemp_3}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod4_temp_10
-        { {CAN0_MSG_Mod4_Celltemp_3}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod4_temp_11
+        CANS_CELLTEMPERATURES_SIGNALS(CAN0_MSG_Mod4_Celltemp_0, NULL_PTR, &cans_gettemp),  //!< CAN0_SIG_Mod4_temp_valid_0_2 .. CAN0_SIG_Mod4_temp_2
+        CANS_CELLTEMPERATURES_SIGNALS(CAN0_MSG_Mod4_Celltemp_1, NULL_PTR, &cans_gettemp),  //!< CAN0_SIG_Mod4_temp_valid_3_5 .. CAN0_SIG_Mod4_temp_5
+        CANS_CELLTEMPERATURES_SIGNALS(CAN0_MSG_Mod4_Celltemp_2, NULL_PTR, &cans_gettemp),  //!< CAN0_SIG_Mod4_temp_valid_6_8 .. CAN0_SIG_Mod4_temp_8
+        CANS_CELLTEMPERATURES_SIGNALS(CAN0_MSG_Mod4_Celltemp_3, NULL_PTR, &cans_gettemp),  //!< CAN0_SIG_Mod4_temp_valid_9_11 .. CAN0_SIG_Mod4_temp_11
 
         // Module 5 cell voltages
-        { {CAN0_MSG_Mod5_Cellvolt_0}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod5_volt_valid_0_2
-        { {CAN0_MSG_Mod5_Cellvolt_0}, 8, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod5_volt_0
-        { {CAN0_MSG_Mod5_Cellvolt_0}, 24, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod5_volt_1
-        { {CAN0_MSG_Mod5_Cellvolt_0}, 40, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod5_volt_2
-        { {CAN0_MSG_Mod5_Cellvolt_1}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod5_volt_valid_3_5
-        { {CAN0_MSG_Mod5_Cellvolt_1}, 8, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod5_volt_3
-        { {CAN0_MSG_Mod5_Cellvolt_1}, 24, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod5_volt_4
-        { {CAN0_MSG_Mod5_Cellvolt_1}, 40, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod5_volt_5
-        { {CAN0_MSG_Mod5_Cellvolt_2}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod5_volt_valid_6_8
-        { {CAN0_MSG_Mod5_Cellvolt_2}, 8, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod5_volt_6
-        { {CAN0_MSG_Mod5_Cellvolt_2}, 24, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod5_volt_7
-        { {CAN0_MSG_Mod5_Cellvolt_2}, 40, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod5_volt_8
-        { {CAN0_MSG_Mod5_Cellvolt_3}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod5_volt_valid_9_11
-        { {CAN0_MSG_Mod5_Cellvolt_3}, 8, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod5_volt_9
-        { {CAN0_MSG_Mod5_Cellvolt_3}, 24, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod5_volt_10
-        { {CAN0_MSG_Mod5_Cellvolt_3}, 40, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod5_volt_11
+        CANS_CELLVOLTAGES_SIGNALS(CAN0_MSG_Mod5_Cellvolt_0, NULL_PTR, &cans_getvolt),  //!< CAN0_SIG_Mod5_volt_valid_0_2 .. CAN0_SIG_Mod5_volt_2
+        CANS_CELLVOLTAGES_SIGNALS(CAN0_MSG_Mod5_Cellvolt_1, NULL_PTR, &cans_getvolt),  //!< CAN0_SIG_Mod5_volt_valid_3_5 .. CAN0_SIG_Mod5_volt_5
+        CANS_CELLVOLTAGES_SIGNALS(CAN0_MSG_Mod5_Cellvolt_2, NULL_PTR, &cans_getvolt),  //!< CAN0_SIG_Mod5_volt_valid_6_8 .. CAN0_SIG_Mod5_volt_8
+        CANS_CELLVOLTAGES_SIGNALS(CAN0_MSG_Mod5_Cellvolt_3, NULL_PTR, &cans_getvolt),  //!< CAN0_SIG_Mod5_volt_valid_9_11 .. CAN0_SIG_Mod5_volt_11
 
         // Module 5 cell temperatures
-        { {CAN0_MSG_Mod5_Celltemp_0}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod5_volt_valid_0_2
-        { {CAN0_MSG_Mod5_Celltemp_0}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod5_temp_0
-        { {CAN0_MSG_Mod5_Celltemp_0}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod5_temp_1
-        { {CAN0_MSG_Mod5_Celltemp_0}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod5_temp_2
-        { {CAN0_MSG_Mod5_Celltemp_1}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod5_volt_valid_3_5
-        { {CAN0_MSG_Mod5_Celltemp_1}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod5_temp_3
-        { {CAN0_MSG_Mod5_Celltemp_1}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod5_temp_4
-        { {CAN0_MSG_Mod5_Celltemp_1}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod5_temp_5
-        { {CAN0_MSG_Mod5_Celltemp_2}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod5_volt_valid_6_8
-        { {CAN0_MSG_Mod5_Celltemp_2}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod5_temp_6
-        { {CAN0_MSG_Mod5_Celltemp_2}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod5_temp_7
-        { {CAN0_MSG_Mod5_Celltemp_2}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod5_temp_8
-        { {CAN0_MSG_Mod5_Celltemp_3}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod5_volt_valid_9_11
-        { {CAN0_MSG_Mod5_Celltemp_3}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod5_temp_9
-        { {CAN0_MSG_Mod5_Celltemp_3}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod5_temp_10
-        { {CAN0_MSG_Mod5_Celltemp_3}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod5_temp_11
+        CANS_CELLTEMPERATURES_SIGNALS(CAN0_MSG_Mod5_Celltemp_0, NULL_PTR, &cans_gettemp),  //!< CAN0_SIG_Mod5_temp_valid_0_2 .. CAN0_SIG_Mod5_temp_2
+        CANS_CELLTEMPERATURES_SIGNALS(CAN0_MSG_Mod5_Celltemp_1, NULL_PTR, &cans_gettemp),  //!< CAN0_SIG_Mod5_temp_valid_3_5 .. CAN0_SIG_Mod5_temp_5
+        CANS_CELLTEMPERATURES_SIGNALS(CAN0_MSG_Mod5_Celltemp_2, NULL_PTR, &cans_gettemp),  //!< CAN0_SIG_Mod5_temp_valid_6_8 .. CAN0_SIG_Mod5_temp_8
+        CANS_CELLTEMPERATURES_SIGNALS(CAN0_MSG_Mod5_Celltemp_3, NULL_PTR, &cans_gettemp),  //!< CAN0_SIG_Mod5_temp_valid_9_11 .. CAN0_SIG_Mod5_temp_11
 
         // Module 6 cell voltages
-        { {CAN0_MSG_Mod6_Cellvolt_0}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod6_volt_valid_0_2
-        { {CAN0_MSG_Mod6_Cellvolt_0}, 8, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod6_volt_0
-        { {CAN0_MSG_Mod6_Cellvolt_0}, 24, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod6_volt_1
-        { {CAN0_MSG_Mod6_Cellvolt_0}, 40, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod6_volt_2
-        { {CAN0_MSG_Mod6_Cellvolt_1}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod6_volt_valid_3_5
-        { {CAN0_MSG_Mod6_Cellvolt_1}, 8, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod6_volt_3
-        { {CAN0_MSG_Mod6_Cellvolt_1}, 24, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod6_volt_4
-        { {CAN0_MSG_Mod6_Cellvolt_1}, 40, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod6_volt_5
-        { {CAN0_MSG_Mod6_Cellvolt_2}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod6_volt_valid_6_8
-        { {CAN0_MSG_Mod6_Cellvolt_2}, 8, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod6_volt_6
-        { {CAN0_MSG_Mod6_Cellvolt_2}, 24, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod6_volt_7
-        { {CAN0_MSG_Mod6_Cellvolt_2}, 40, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod6_volt_8
-        { {CAN0_MSG_Mod6_Cellvolt_3}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod6_volt_valid_9_11
-        { {CAN0_MSG_Mod6_Cellvolt_3}, 8, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod6_volt_9
-        { {CAN0_MSG_Mod6_Cellvolt_3}, 24, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod6_volt_10
-        { {CAN0_MSG_Mod6_Cellvolt_3}, 40, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod6_volt_11
+        CANS_CELLVOLTAGES_SIGNALS(CAN0_MSG_Mod6_Cellvolt_0, NULL_PTR, &cans_getvolt),  //!< CAN0_SIG_Mod6_volt_valid_0_2 .. CAN0_SIG_Mod6_volt_2
+        CANS_CELLVOLTAGES_SIGNALS(CAN0_MSG_Mod6_Cellvolt_1, NULL_PTR, &cans_getvolt),  //!< CAN0_SIG_Mod6_volt_valid_3_5 .. CAN0_SIG_Mod6_volt_5
+        CANS_CELLVOLTAGES_SIGNALS(CAN0_MSG_Mod6_Cellvolt_2, NULL_PTR, &cans_getvolt),  //!< CAN0_SIG_Mod6_volt_valid_6_8 .. CAN0_SIG_Mod6_volt_8
+        CANS_CELLVOLTAGES_SIGNALS(CAN0_MSG_Mod6_Cellvolt_3, NULL_PTR, &cans_getvolt),  //!< CAN0_SIG_Mod6_volt_valid_9_11 .. CAN0_SIG_Mod6_volt_11
 
         // Module 6 cell temperatures
-        { {CAN0_MSG_Mod6_Celltemp_0}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod6_volt_valid_0_2
-        { {CAN0_MSG_Mod6_Celltemp_0}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod6_temp_0
-        { {CAN0_MSG_Mod6_Celltemp_0}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod6_temp_1
-        { {CAN0_MSG_Mod6_Celltemp_0}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod6_temp_2
-        { {CAN0_MSG_Mod6_Celltemp_1}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod6_volt_valid_3_5
-        { {CAN0_MSG_Mod6_Celltemp_1}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod6_temp_3
-        { {CAN0_MSG_Mod6_Celltemp_1}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod6_temp_4
-        { {CAN0_MSG_Mod6_Celltemp_1}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod6_temp_5
-        { {CAN0_MSG_Mod6_Celltemp_2}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod6_volt_valid_6_8
-        { {CAN0_MSG_Mod6_Celltemp_2}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod6_temp_6
-        { {CAN0_MSG_Mod6_Celltemp_2}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod6_temp_7
-        { {CAN0_MSG_Mod6_Celltemp_2}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod6_temp_8
-        { {CAN0_MSG_Mod6_Celltemp_3}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod6_volt_valid_9_11
-        { {CAN0_MSG_Mod6_Celltemp_3}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod6_temp_9
-        { {CAN0_MSG_Mod6_Celltemp_3}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod6_temp_10
-        { {CAN0_MSG_Mod6_Celltemp_3}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod6_temp_11
+        CANS_CELLTEMPERATURES_SIGNALS(CAN0_MSG_Mod6_Celltemp_0, NULL_PTR, &cans_gettemp),  //!< CAN0_SIG_Mod6_temp_valid_0_2 .. CAN0_SIG_Mod6_temp_2
+        CANS_CELLTEMPERATURES_SIGNALS(CAN0_MSG_Mod6_Celltemp_1, NULL_PTR, &cans_gettemp),  //!< CAN0_SIG_Mod6_temp_valid_3_5 .. CAN0_SIG_Mod6_temp_5
+        CANS_CELLTEMPERATURES_SIGNALS(CAN0_MSG_Mod6_Celltemp_2, NULL_PTR, &cans_gettemp),  //!< CAN0_SIG_Mod6_temp_valid_6_8 .. CAN0_SIG_Mod6_temp_8
+        CANS_CELLTEMPERATURES_SIGNALS(CAN0_MSG_Mod6_Celltemp_3, NULL_PTR, &cans_gettemp),  //!< CAN0_SIG_Mod6_temp_valid_9_11 .. CAN0_SIG_Mod6_temp_11
 
         // Module 7 cell voltages
-        { {CAN0_MSG_Mod7_Cellvolt_0}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod7_volt_valid_0_2
-        { {CAN0_MSG_Mod7_Cellvolt_0}, 8, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod7_volt_0
-        { {CAN0_MSG_Mod7_Cellvolt_0}, 24, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod7_volt_1
-        { {CAN0_MSG_Mod7_Cellvolt_0}, 40, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod7_volt_2
-        { {CAN0_MSG_Mod7_Cellvolt_1}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod7_volt_valid_3_5
-        { {CAN0_MSG_Mod7_Cellvolt_1}, 8, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod7_volt_3
-        { {CAN0_MSG_Mod7_Cellvolt_1}, 24, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod7_volt_4
-        { {CAN0_MSG_Mod7_Cellvolt_1}, 40, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod7_volt_5
-        { {CAN0_MSG_Mod7_Cellvolt_2}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod7_volt_valid_6_8
-        { {CAN0_MSG_Mod7_Cellvolt_2}, 8, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod7_volt_6
-        { {CAN0_MSG_Mod7_Cellvolt_2}, 24, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod7_volt_7
-        { {CAN0_MSG_Mod7_Cellvolt_2}, 40, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod7_volt_8
-        { {CAN0_MSG_Mod7_Cellvolt_3}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod7_volt_valid_9_11
-        { {CAN0_MSG_Mod7_Cellvolt_3}, 8, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod7_volt_9
-        { {CAN0_MSG_Mod7_Cellvolt_3}, 24, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod7_volt_10
-        { {CAN0_MSG_Mod7_Cellvolt_3}, 40, 16, 0, 0xFFFF, 1, 0, NULL_PTR, &cans_getvolt },  //!< CAN0_SIG_Mod7_volt_11
+        CANS_CELLVOLTAGES_SIGNALS(CAN0_MSG_Mod7_Cellvolt_0, NULL_PTR, &cans_getvolt),  //!< CAN0_SIG_Mod7_volt_valid_0_2 .. CAN0_SIG_Mod7_volt_2
+        CANS_CELLVOLTAGES_SIGNALS(CAN0_MSG_Mod7_Cellvolt_1, NULL_PTR, &cans_getvolt),  //!< CAN0_SIG_Mod7_volt_valid_3_5 .. CAN0_SIG_Mod7_volt_5
+        CANS_CELLVOLTAGES_SIGNALS(CAN0_MSG_Mod7_Cellvolt_2, NULL_PTR, &cans_getvolt),  //!< CAN0_SIG_Mod7_volt_valid_6_8 .. CAN0_SIG_Mod7_volt_8
+        CANS_CELLVOLTAGES_SIGNALS(CAN0_MSG_Mod7_Cellvolt_3, NULL_PTR, &cans_getvolt),  //!< CAN0_SIG_Mod7_volt_valid_9_11 .. CAN0_SIG_Mod7_volt_11
 
         // Module 7 cell temperatures
-        { {CAN0_MSG_Mod7_Celltemp_0}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod4_volt_valid_0_2
-        { {CAN0_MSG_Mod7_Celltemp_0}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod4_temp_0
-        { {CAN0_MSG_Mod7_Celltemp_0}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod4_temp_1
-        { {CAN0_MSG_Mod7_Celltemp_0}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod4_temp_2
-        { {CAN0_MSG_Mod7_Celltemp_1}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod4_volt_valid_3_5
-        { {CAN0_MSG_Mod7_Celltemp_1}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod4_temp_3
-        { {CAN0_MSG_Mod7_Celltemp_1}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod4_temp_4
-        { {CAN0_MSG_Mod7_Celltemp_1}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod4_temp_5
-        { {CAN0_MSG_Mod7_Celltemp_2}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod4_volt_valid_6_8
-        { {CAN0_MSG_Mod7_Celltemp_2}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod4_temp_6
-        { {CAN0_MSG_Mod7_Celltemp_2}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod4_temp_7
-        { {CAN0_MSG_Mod7_Celltemp_2}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod4_temp_8
-        { {CAN0_MSG_Mod7_Celltemp_3}, 0, 8, 0, 0xFF, 1, 0, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod4_volt_valid_9_11
-        { {CAN0_MSG_Mod7_Celltemp_3}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod4_temp_9
-        { {CAN0_MSG_Mod7_Celltemp_3}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod4_temp_10
-        { {CAN0_MSG_Mod7_Celltemp_3}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  //!< CAN0_SIG_Mod4_temp_11
+        CANS_CELLTEMPERATURES_SIGNALS(CAN0_MSG_Mod7_Celltemp_0, NULL_PTR, &cans_gettemp),  //!< CAN0_SIG_Mod4_temp_valid_0_2 .. CAN0_SIG_Mod4_temp_2
+        CANS_CELLTEMPERATURES_SIGNALS(CAN0_MSG_Mod7_Celltemp_1, NULL_PTR, &cans_gettemp),  //!< CAN0_SIG_Mod4_temp_valid_3_5 .. CAN0_SIG_Mod4_temp_5
+        CANS_CELLTEMPERATURES_SIGNALS(CAN0_MSG_Mod7_Celltemp_2, NULL_PTR, &cans_gettemp),  //!< CAN0_SIG_Mod4_temp_valid_6_8 .. CAN0_SIG_Mod4_temp_8
+        CANS_CELLTEMPERATURES_SIGNALS(CAN0_MSG_Mod7_Celltemp_3, NULL_PTR, &cans_gettemp),  //!< CAN0_SIG_Mod4_temp_valid_9_11 .. CAN0_SIG_Mod4_temp_11
+#endif /* CAN_USE_CELLDATA_MUX == 0 */
 
 #ifdef CAN_ISABELLENHUETTE_TRIGGERED
         { {CAN0_MSG_BMS_CurrentTrigger}, 0, 32, 0, 0, 1, 0, NULL_PTR, &cans_gettriggercurrent }  //!< CAN0_SIG_ISA_Trigger
@@ -488,7 +350,13 @@ const CANS_signal_s cans_CAN0_signals_rx[] = {
         { {CAN0_MSG_IVT_EnergyCount}, 0, 8, 0, 255, 1, 0, NULL_PTR, NULL_PTR },  // CAN0_SIG_ISENS7_EC_MuxID
         { {CAN0_MSG_IVT_EnergyCount}, 8, 8, 0, 255, 1, 0, NULL_PTR, NULL_PTR },  // CAN0_SIG_ISENS7_EC_Status
         { {CAN0_MSG_IVT_EnergyCount}, 16, 32, -10000000, 10000000, 1, 0, &cans_setcurr, NULL_PTR },  // CAN0_SIG_ISENS7_EC_Measurement
-        { {CAN0_MSG_DEBUG}, 0, 64, 0, 0xFFFFFFFFFFFFFFFF, 1, 0, &cans_setdebug, NULL_PTR }  // CAN0_SIG_DEBUG_Data
+        { {CAN0_MSG_DEBUG}, 0, 64, 0, 0xFFFFFFFFFFFFFFFF, 1, 0, &cans_setdebug, NULL_PTR },  // CAN0_SIG_DEBUG_Data
+#if CAN_USE_ISOTP == 1
+        { {CAN0_MSG_ISOTP_0}, 0, 64, 0, 0xFFFFFFFFFFFFFFFF, 1, 0, &cans_setisotp, NULL_PTR },  // CAN0_SIG_ISOTP_0_Data
+#if ISOTP_NR_OF_SESSIONS > 1
+        { {CAN0_MSG_ISOTP_1}, 0, 64, 0, 0xFFFFFFFFFFFFFFFF, 1, 0, &cans_setisotp, NULL_PTR },  // CAN0_SIG_ISOTP_1_Data
+#endif
+#endif
 };
 
 const CANS_signal_s cans_CAN1_signals_rx[] = {
@@ -504,221 +372,49 @@ const uint16_t cans_CAN1_signals_rx_length = sizeof(cans_CAN1_signals_rx)/sizeof
 
 /*================== Function Implementations =============================*/
 
+#if CAN_USE_CELLDATA_MUX == 0
 static uint32_t cans_getvolt(uint32_t sigIdx, void *value) {
     static DATA_BLOCK_CELLVOLTAGE_s volt_tab;
-    uint16_t modIdx = 0;
+    static uint64_t frame = 0;
+    CANS_CellVoltages_s msg;
+    uint32_t modIdx = 0;
     uint32_t cellIdx = 0;
-    uint32_t tmp = 0;
-    uint32_t tmpVal = 0;
-    float canData = 0;
+    uint32_t offset = 0;
 
     // first signal to transmit cell voltages
     if (sigIdx == CAN0_SIG_Mod0_volt_valid_0_2) {
         DB_ReadBlock(&volt_tab, DATA_BLOCK_ID_CELLVOLTAGE);
     }
 
-    // Determine module and cell number
-    if (sigIdx - CAN0_SIG_Mod0_volt_valid_0_2 < CANS_MODULSIGNALS_VOLT) {
-        modIdx = 0;
-        cellIdx = sigIdx - CAN0_SIG_Mod0_volt_valid_0_2;
-    } else if (sigIdx - CAN0_SIG_Mod1_volt_valid_0_2 < CANS_MODULSIGNALS_VOLT) {
-        modIdx = 1;
-        cellIdx = sigIdx - CAN0_SIG_Mod1_volt_valid_0_2;
-    } else if (sigIdx - CAN0_SIG_Mod2_volt_valid_0_2 < CANS_MODULSIGNALS_VOLT) {
-        modIdx = 2;
-        cellIdx = sigIdx - CAN0_SIG_Mod2_volt_valid_0_2;
-    } else if (sigIdx - CAN0_SIG_Mod3_volt_valid_0_2 < CANS_MODULSIGNALS_VOLT) {
-        modIdx = 3;
-        cellIdx = sigIdx - CAN0_SIG_Mod3_volt_valid_0_2;
-    } else if (sigIdx - CAN0_SIG_Mod4_volt_valid_0_2 < CANS_MODULSIGNALS_VOLT) {
-        modIdx = 4;
-        cellIdx = sigIdx - CAN0_SIG_Mod4_volt_valid_0_2;
-    } else if (sigIdx - CAN0_SIG_Mod5_volt_valid_0_2 < CANS_MODULSIGNALS_VOLT) {
-        modIdx = 5;
-        cellIdx = sigIdx - CAN0_SIG_Mod5_volt_valid_0_2;
-    } else if (sigIdx - CAN0_SIG_Mod6_volt_valid_0_2 < CANS_MODULSIGNALS_VOLT) {
-        modIdx = 6;
-        cellIdx = sigIdx - CAN0_SIG_Mod6_volt_valid_0_2;
-    } else if (sigIdx - CAN0_SIG_Mod7_volt_valid_0_2 < CANS_MODULSIGNALS_VOLT) {
-        modIdx = 7;
-        cellIdx = sigIdx - CAN0_SIG_Mod7_volt_valid_0_2;
-    }
-
     if (value != NULL_PTR) {
-        switch (sigIdx) {
-            case CAN0_SIG_Mod0_volt_valid_0_2:
-            case CAN0_SIG_Mod1_volt_valid_0_2:
-            case CAN0_SIG_Mod2_volt_valid_0_2:
-            case CAN0_SIG_Mod3_volt_valid_0_2:
-            case CAN0_SIG_Mod4_volt_valid_0_2:  // Valid flags for cell voltages 0 - 2
-            case CAN0_SIG_Mod5_volt_valid_0_2:
-            case CAN0_SIG_Mod6_volt_valid_0_2:
-            case CAN0_SIG_Mod7_volt_valid_0_2:
-                tmp = volt_tab.valid_voltPECs[modIdx];
-                *(uint32_t *)value = 0x07 & tmp;
-                break;
-
-            case CAN0_SIG_Mod0_volt_valid_3_5:
-            case CAN0_SIG_Mod1_volt_valid_3_5:
-            case CAN0_SIG_Mod2_volt_valid_3_5:
-            case CAN0_SIG_Mod3_volt_valid_3_5:
-            case CAN0_SIG_Mod4_volt_valid_3_5:  // Valid flags for cell voltages 3 - 5
-            case CAN0_SIG_Mod5_volt_valid_3_5:
-            case CAN0_SIG_Mod6_volt_valid_3_5:
-            case CAN0_SIG_Mod7_volt_valid_3_5:
-                tmp = volt_tab.valid_voltPECs[modIdx] >> 3;
-                tmpVal = 0x07 & tmp;
-                break;
-
-            case CAN0_SIG_Mod0_volt_valid_6_8:
-            case CAN0_SIG_Mod1_volt_valid_6_8:
-            case CAN0_SIG_Mod2_volt_valid_6_8:
-            case CAN0_SIG_Mod3_volt_valid_6_8:
-            case CAN0_SIG_Mod4_volt_valid_6_8:  // Valid flags for cell voltages 6 - 8
-            case CAN0_SIG_Mod5_volt_valid_6_8:
-            case CAN0_SIG_Mod6_volt_valid_6_8:
-            case CAN0_SIG_Mod7_volt_valid_6_8:
-                tmp = volt_tab.valid_voltPECs[modIdx] >> 6;
-                tmpVal = 0x07 & tmp;
-                break;
-
-            case CAN0_SIG_Mod0_volt_valid_9_11:
-            case CAN0_SIG_Mod1_volt_valid_9_11:
-            case CAN0_SIG_Mod2_volt_valid_9_11:
-            case CAN0_SIG_Mod3_volt_valid_9_11:
-            case CAN0_SIG_Mod4_volt_valid_9_11:  // Valid flags for cell voltages 9 - 11
-            case CAN0_SIG_Mod5_volt_valid_9_11:
-            case CAN0_SIG_Mod6_volt_valid_9_11:
-            case CAN0_SIG_Mod7_volt_valid_9_11:
-                tmp = volt_tab.valid_voltPECs[modIdx] >> 9;
-                tmpVal = 0x07 & tmp;
-                break;
-
-            case CAN0_SIG_Mod0_volt_0:
-            case CAN0_SIG_Mod0_volt_1:
-            case CAN0_SIG_Mod0_volt_2:
-            case CAN0_SIG_Mod1_volt_0:
-            case CAN0_SIG_Mod1_volt_1:
-            case CAN0_SIG_Mod1_volt_2:
-            case CAN0_SIG_Mod2_volt_0:
-            case CAN0_SIG_Mod2_volt_1:
-            case CAN0_SIG_Mod2_volt_2:
-            case CAN0_SIG_Mod3_volt_0:
-            case CAN0_SIG_Mod3_volt_1:
-            case CAN0_SIG_Mod3_volt_2:
-            case CAN0_SIG_Mod4_volt_0:
-            case CAN0_SIG_Mod4_volt_1:
-            case CAN0_SIG_Mod4_volt_2:
-            case CAN0_SIG_Mod5_volt_0:
-            case CAN0_SIG_Mod5_volt_1:
-            case CAN0_SIG_Mod5_volt_2:
-            case CAN0_SIG_Mod6_volt_0:
-            case CAN0_SIG_Mod6_volt_1:
-            case CAN0_SIG_Mod6_volt_2:
-            case CAN0_SIG_Mod7_volt_0:
-            case CAN0_SIG_Mod7_volt_1:
-            case CAN0_SIG_Mod7_volt_2:
-                cellIdx--;  // Because cell 0 - valid flag = 1, decrement by one to get the right index
-                tmpVal = volt_tab.voltage[(modIdx * BS_NR_OF_BAT_CELLS_PER_MODULE) + cellIdx];
-                break;
-
-            case CAN0_SIG_Mod0_volt_3:
-            case CAN0_SIG_Mod0_volt_4:
-            case CAN0_SIG_Mod0_volt_5:
-            case CAN0_SIG_Mod1_volt_3:
-            case CAN0_SIG_Mod1_volt_4:
-            case CAN0_SIG_Mod1_volt_5:
-            case CAN0_SIG_Mod2_volt_3:
-            case CAN0_SIG_Mod2_volt_4:
-            case CAN0_SIG_Mod2_volt_5:
-            case CAN0_SIG_Mod3_volt_3:
-            case CAN0_SIG_Mod3_volt_4:
-            case CAN0_SIG_Mod3_volt_5:
-            case CAN0_SIG_Mod4_volt_3:
-            case CAN0_SIG_Mod4_volt_4:
-            case CAN0_SIG_Mod4_volt_5:
-            case CAN0_SIG_Mod5_volt_3:
-            case CAN0_SIG_Mod5_volt_4:
-            case CAN0_SIG_Mod5_volt_5:
-            case CAN0_SIG_Mod6_volt_3:
-            case CAN0_SIG_Mod6_volt_4:
-            case CAN0_SIG_Mod6_volt_5:
-            case CAN0_SIG_Mod7_volt_3:
-            case CAN0_SIG_Mod7_volt_4:
-            case CAN0_SIG_Mod7_volt_5:
-                cellIdx--;  // Because cell 0 - valid flag = 1, decrement by one to get the right index
-                cellIdx--;  // Because of signal: CAN0_SIG_Modx_volt_valid_3_5
-                tmpVal = volt_tab.voltage[(modIdx * BS_NR_OF_BAT_CELLS_PER_MODULE) + cellIdx];
-                break;
-
-            case CAN0_SIG_Mod0_volt_6:
-            case CAN0_SIG_Mod0_volt_7:
-            case CAN0_SIG_Mod0_volt_8:
-            case CAN0_SIG_Mod1_volt_6:
-            case CAN0_SIG_Mod1_volt_7:
-            case CAN0_SIG_Mod1_volt_8:
-            case CAN0_SIG_Mod2_volt_6:
-            case CAN0_SIG_Mod2_volt_7:
-            case CAN0_SIG_Mod2_volt_8:
-            case CAN0_SIG_Mod3_volt_6:
-            case CAN0_SIG_Mod3_volt_7:
-            case CAN0_SIG_Mod3_volt_8:
-            case CAN0_SIG_Mod4_volt_6:
-            case CAN0_SIG_Mod4_volt_7:
-            case CAN0_SIG_Mod4_volt_8:
-            case CAN0_SIG_Mod5_volt_6:
-            case CAN0_SIG_Mod5_volt_7:
-            case CAN0_SIG_Mod5_volt_8:
-            case CAN0_SIG_Mod6_volt_6:
-            case CAN0_SIG_Mod6_volt_7:
-            case CAN0_SIG_Mod6_volt_8:
-            case CAN0_SIG_Mod7_volt_6:
-            case CAN0_SIG_Mod7_volt_7:
-            case CAN0_SIG_Mod7_volt_8:
-                cellIdx--;  // Because cell 0 - valid flag = 1, decrement by one to get the right index
-                cellIdx--;  // Because of signal: CAN0_SIG_Modx_volt_valid_3_5
-                cellIdx--;  // Because of signal: CAN0_SIG_Modx_volt_valid_6_8
-                tmpVal = volt_tab.voltage[(modIdx * BS_NR_OF_BAT_CELLS_PER_MODULE) + cellIdx];
-                break;
-
-            case CAN0_SIG_Mod0_volt_9:
-            case CAN0_SIG_Mod0_volt_10:
-            case CAN0_SIG_Mod0_volt_11:
-            case CAN0_SIG_Mod1_volt_9:
-            case CAN0_SIG_Mod1_volt_10:
-            case CAN0_SIG_Mod1_volt_11:
-            case CAN0_SIG_Mod2_volt_9:
-            case CAN0_SIG_Mod2_volt_10:
-            case CAN0_SIG_Mod2_volt_11:
-            case CAN0_SIG_Mod3_volt_9:
-            case CAN0_SIG_Mod3_volt_10:
-            case CAN0_SIG_Mod3_volt_11:
-            case CAN0_SIG_Mod4_volt_9:
-            case CAN0_SIG_Mod4_volt_10:
-            case CAN0_SIG_Mod4_volt_11:
-            case CAN0_SIG_Mod5_volt_9:
-            case CAN0_SIG_Mod5_volt_10:
-            case CAN0_SIG_Mod5_volt_11:
-            case CAN0_SIG_Mod6_volt_9:
-            case CAN0_SIG_Mod6_volt_10:
-            case CAN0_SIG_Mod6_volt_11:
-            case CAN0_SIG_Mod7_volt_9:
-            case CAN0_SIG_Mod7_volt_10:
-            case CAN0_SIG_Mod7_volt_11:
-                cellIdx--;  // Because cell 0 - valid flag = 1, decrement by one to get the right index
-                cellIdx--;  // Because of signal: CAN0_SIG_Modx_volt_valid_3_5
-                cellIdx--;  // Because of signal: CAN0_SIG_Modx_volt_valid_6_8
-                cellIdx--;  // Because of signal: CAN0_SIG_Modx_volt_valid_9_11
-                tmpVal = volt_tab.voltage[(modIdx * BS_NR_OF_BAT_CELLS_PER_MODULE) + cellIdx];
-                break;
-
-            default:
-                break;
+        // Determine module and signal within the module
+        offset = sigIdx - CAN0_SIG_Mod0_volt_valid_0_2;
+        modIdx = offset / CANS_MODULSIGNALS;
+        offset = offset % CANS_MODULSIGNALS;
+
+        // valid flags are the first signal of a message -> pack the whole message once
+        if ((offset % CANS_CELLMSG_SIGNALS) == 0) {
+            cellIdx = (offset / CANS_CELLMSG_SIGNALS) * CANS_CELLMSG_CELLS;
+            msg.valid = 0x07;
+            msg.cell_0 = 0;
+            msg.cell_1 = 0;
+            msg.cell_2 = 0;
+            if (modIdx < BS_NR_OF_MODULES) {
+                msg.valid = 0x07 & (volt_tab.valid_voltPECs[modIdx] >> cellIdx);
+                offset = (modIdx * BS_NR_OF_BAT_CELLS_PER_MODULE) + cellIdx;
+                if (cellIdx + 0 < BS_NR_OF_BAT_CELLS_PER_MODULE) {
+                    msg.cell_0 = volt_tab.voltage[offset + 0];
+                }
+                if (cellIdx + 1 < BS_NR_OF_BAT_CELLS_PER_MODULE) {
+                    msg.cell_1 = volt_tab.voltage[offset + 1];
+                }
+                if (cellIdx + 2 < BS_NR_OF_BAT_CELLS_PER_MODULE) {
+                    msg.cell_2 = volt_tab.voltage[offset + 2];
+                }
+            }
+            frame = CANS_PackCellVoltages(&msg);
         }
-        // Check limits
-        canData = cans_checkLimits((float)tmpVal, sigIdx);
-        // Apply offset and factor
-        *(uint32_t *)value = (uint32_t)((canData + cans_CAN0_signals_tx[sigIdx].offset) * cans_CAN0_signals_tx[sigIdx].factor);
+        *(uint32_t *)value = cans_getFrameSignal(frame, sigIdx);
     }
 
     return 0;
@@ -726,223 +422,51 @@ static uint32_t cans_getvolt(uint32_t sigIdx, void *value) {
 
 uint32_t cans_gettemp(uint32_t sigIdx, void *value) {
     static DATA_BLOCK_CELLTEMPERATURE_s temp_tab;
-    uint16_t modIdx = 0;
+    static uint64_t frame = 0;
+    CANS_CellTemperatures_s msg;
+    uint32_t modIdx = 0;
     uint32_t cellIdx = 0;
-    uint32_t tmp = 0;
-    float tmpVal = 0;
-    float canData = 0;
+    uint32_t offset = 0;
 
     // first signal to transmit cell temperatures
     if (sigIdx == CAN0_SIG_Mod0_temp_valid_0_2) {
         DB_ReadBlock(&temp_tab, DATA_BLOCK_ID_CELLTEMPERATURE);
     }
 
-    // Determine module and cell number
-    if (sigIdx - CAN0_SIG_Mod0_temp_valid_0_2 < CANS_MODULSIGNALS_TEMP) {
-        modIdx = 0;
-        cellIdx = sigIdx - CAN0_SIG_Mod0_temp_valid_0_2;
-    } else if (sigIdx - CAN0_SIG_Mod1_temp_valid_0_2 < CANS_MODULSIGNALS_TEMP) {
-        modIdx = 1;
-        cellIdx = sigIdx - CAN0_SIG_Mod1_temp_valid_0_2;
-    } else if (sigIdx - CAN0_SIG_Mod2_temp_valid_0_2 < CANS_MODULSIGNALS_TEMP) {
-        modIdx = 2;
-        cellIdx = sigIdx - CAN0_SIG_Mod2_temp_valid_0_2;
-    } else if (sigIdx - CAN0_SIG_Mod3_temp_valid_0_2 < CANS_MODULSIGNALS_TEMP) {
-        modIdx = 3;
-        cellIdx = sigIdx - CAN0_SIG_Mod3_temp_valid_0_2;
-    } else if (sigIdx - CAN0_SIG_Mod4_temp_valid_0_2 < CANS_MODULSIGNALS_TEMP) {
-        modIdx = 4;
-        cellIdx = sigIdx - CAN0_SIG_Mod4_temp_valid_0_2;
-    } else if (sigIdx - CAN0_SIG_Mod5_temp_valid_0_2 < CANS_MODULSIGNALS_TEMP) {
-        modIdx = 5;
-        cellIdx = sigIdx - CAN0_SIG_Mod5_temp_valid_0_2;
-    } else if (sigIdx - CAN0_SIG_Mod6_temp_valid_0_2 < CANS_MODULSIGNALS_TEMP) {
-        modIdx = 6;
-        cellIdx = sigIdx - CAN0_SIG_Mod6_temp_valid_0_2;
-    } else if (sigIdx - CAN0_SIG_Mod7_temp_valid_0_2 < CANS_MODULSIGNALS_TEMP) {
-        modIdx = 7;
-        cellIdx = sigIdx - CAN0_SIG_Mod7_temp_valid_0_2;
-    }
-
     if (value != NULL_PTR) {
-        switch (sigIdx) {
-            case CAN0_SIG_Mod0_temp_valid_0_2:
-            case CAN0_SIG_Mod1_temp_valid_0_2:
-            case CAN0_SIG_Mod2_temp_valid_0_2:
-            case CAN0_SIG_Mod3_temp_valid_0_2:
-            case CAN0_SIG_Mod4_temp_valid_0_2:
-            case CAN0_SIG_Mod5_temp_valid_0_2:
-            case CAN0_SIG_Mod6_temp_valid_0_2:
-            case CAN0_SIG_Mod7_temp_valid_0_2:
-                tmp = temp_tab.valid_temperaturePECs[modIdx];
-                tmpVal = 0x07 & tmp;
-                break;
-
-            case CAN0_SIG_Mod0_temp_valid_3_5:
-            case CAN0_SIG_Mod1_temp_valid_3_5:
-            case CAN0_SIG_Mod2_temp_valid_3_5:
-            case CAN0_SIG_Mod3_temp_valid_3_5:
-            case CAN0_SIG_Mod4_temp_valid_3_5:
-            case CAN0_SIG_Mod5_temp_valid_3_5:
-            case CAN0_SIG_Mod6_temp_valid_3_5:
-            case CAN0_SIG_Mod7_temp_valid_3_5:
-                tmp = temp_tab.valid_temperaturePECs[modIdx] >> 3;
-                tmpVal = 0x07 & tmp;
-                break;
-
-            case CAN0_SIG_Mod0_temp_valid_6_8:
-            case CAN0_SIG_Mod1_temp_valid_6_8:
-            case CAN0_SIG_Mod2_temp_valid_6_8:
-            case CAN0_SIG_Mod3_temp_valid_6_8:
-            case CAN0_SIG_Mod4_temp_valid_6_8:
-            case CAN0_SIG_Mod5_temp_valid_6_8:
-            case CAN0_SIG_Mod6_temp_valid_6_8:
-            case CAN0_SIG_Mod7_temp_valid_6_8:
-                tmp = temp_tab.valid_temperaturePECs[modIdx] >> 6;
-                tmpVal = 0x07 & tmp;
-                break;
-
-            case CAN0_SIG_Mod0_temp_valid_9_11:
-            case CAN0_SIG_Mod1_temp_valid_9_11:
-            case CAN0_SIG_Mod2_temp_valid_9_11:
-            case CAN0_SIG_Mod3_temp_valid_9_11:
-            case CAN0_SIG_Mod4_temp_valid_9_11:
-            case CAN0_SIG_Mod5_temp_valid_9_11:
-            case CAN0_SIG_Mod6_temp_valid_9_11:
-            case CAN0_SIG_Mod7_temp_valid_9_11:
-                tmp = temp_tab.valid_temperaturePECs[modIdx] >> 9;
-                tmpVal = 0x07 & tmp;
-                break;
-
-            case CAN0_SIG_Mod0_temp_0:
-            case CAN0_SIG_Mod0_temp_1:
-            case CAN0_SIG_Mod0_temp_2:
-            case CAN0_SIG_Mod1_temp_0:
-            case CAN0_SIG_Mod1_temp_1:
-            case CAN0_SIG_Mod1_temp_2:
-            case CAN0_SIG_Mod2_temp_0:
-            case CAN0_SIG_Mod2_temp_1:
-            case CAN0_SIG_Mod2_temp_2:
-            case CAN0_SIG_Mod3_temp_0:
-            case CAN0_SIG_Mod3_temp_1:
-            case CAN0_SIG_Mod3_temp_2:
-            case CAN0_SIG_Mod4_temp_0:
-            case CAN0_SIG_Mod4_temp_1:
-            case CAN0_SIG_Mod4_temp_2:
-            case CAN0_SIG_Mod5_temp_0:
-            case CAN0_SIG_Mod5_temp_1:
-            case CAN0_SIG_Mod5_temp_2:
-            case CAN0_SIG_Mod6_temp_0:
-            case CAN0_SIG_Mod6_temp_1:
-            case CAN0_SIG_Mod6_temp_2:
-            case CAN0_SIG_Mod7_temp_0:
-            case CAN0_SIG_Mod7_temp_1:
-            case CAN0_SIG_Mod7_temp_2:
-                cellIdx--;  // Because cell 0 - valid flag = 1, decrement by one to get the right index
-                tmpVal = temp_tab.temperature[(modIdx * BS_NR_OF_TEMP_SENSORS_PER_MODULE) + cellIdx];
-                break;
-
-            case CAN0_SIG_Mod0_temp_3:
-            case CAN0_SIG_Mod0_temp_4:
-            case CAN0_SIG_Mod0_temp_5:
-            case CAN0_SIG_Mod1_temp_3:
-            case CAN0_SIG_Mod1_temp_4:
-            case CAN0_SIG_Mod1_temp_5:
-            case CAN0_SIG_Mod2_temp_3:
-            case CAN0_SIG_Mod2_temp_4:
-            case CAN0_SIG_Mod2_temp_5:
-            case CAN0_SIG_Mod3_temp_3:
-            case CAN0_SIG_Mod3_temp_4:
-            case CAN0_SIG_Mod3_temp_5:
-            case CAN0_SIG_Mod4_temp_3:
-            case CAN0_SIG_Mod4_temp_4:
-            case CAN0_SIG_Mod4_temp_5:
-            case CAN0_SIG_Mod5_temp_3:
-            case CAN0_SIG_Mod5_temp_4:
-            case CAN0_SIG_Mod5_temp_5:
-            case CAN0_SIG_Mod6_temp_3:
-            case CAN0_SIG_Mod6_temp_4:
-            case CAN0_SIG_Mod6_temp_5:
-            case CAN0_SIG_Mod7_temp_3:
-            case CAN0_SIG_Mod7_temp_4:
-            case CAN0_SIG_Mod7_temp_5:
-                cellIdx--;  // Because cell 0 - valid flag = 1, decrement by one to get the right index
-                cellIdx--;  // Because of signal: CAN0_SIG_Modx_temp_valid_3_5
-                tmpVal = temp_tab.temperature[(modIdx * BS_NR_OF_TEMP_SENSORS_PER_MODULE) + cellIdx];
-                break;
-
-            case CAN0_SIG_Mod0_temp_6:
-            case CAN0_SIG_Mod0_temp_7:
-            case CAN0_SIG_Mod0_temp_8:
-            case CAN0_SIG_Mod1_temp_6:
-            case CAN0_SIG_Mod1_temp_7:
-            case CAN0_SIG_Mod1_temp_8:
-            case CAN0_SIG_Mod2_temp_6:
-            case CAN0_SIG_Mod2_temp_7:
-            case CAN0_SIG_Mod2_temp_8:
-            case CAN0_SIG_Mod3_temp_6:
-            case CAN0_SIG_Mod3_temp_7:
-            case CAN0_SIG_Mod3_temp_8:
-            case CAN0_SIG_Mod4_temp_6:
-            case CAN0_SIG_Mod4_temp_7:
-            case CAN0_SIG_Mod4_temp_8:
-            case CAN0_SIG_Mod5_temp_6:
-            case CAN0_SIG_Mod5_temp_7:
-            case CAN0_SIG_Mod5_temp_8:
-            case CAN0_SIG_Mod6_temp_6:
-            case CAN0_SIG_Mod6_temp_7:
-            case CAN0_SIG_Mod6_temp_8:
-            case CAN0_SIG_Mod7_temp_6:
-            case CAN0_SIG_Mod7_temp_7:
-            case CAN0_SIG_Mod7_temp_8:
-                cellIdx--;  // Because cell 0 - valid flag = 1, decrement by one to get the right index
-                cellIdx--;  // Because of signal: CAN0_SIG_Modx_temp_valid_3_5
-                cellIdx--;  // Because of signal: CAN0_SIG_Modx_temp_valid_6_8
-                tmpVal = temp_tab.temperature[(modIdx * BS_NR_OF_TEMP_SENSORS_PER_MODULE) + cellIdx];
-                break;
-
-            case CAN0_SIG_Mod0_temp_9:
-            case CAN0_SIG_Mod0_temp_10:
-            case CAN0_SIG_Mod0_temp_11:
-            case CAN0_SIG_Mod1_temp_9:
-            case CAN0_SIG_Mod1_temp_10:
-            case CAN0_SIG_Mod1_temp_11:
-            case CAN0_SIG_Mod2_temp_9:
-            case CAN0_SIG_Mod2_temp_10:
-            case CAN0_SIG_Mod2_temp_11:
-            case CAN0_SIG_Mod3_temp_9:
-            case CAN0_SIG_Mod3_temp_10:
-            case CAN0_SIG_Mod3_temp_11:
-            case CAN0_SIG_Mod4_temp_9:
-            case CAN0_SIG_Mod4_temp_10:
-            case CAN0_SIG_Mod4_temp_11:
-            case CAN0_SIG_Mod5_temp_9:
-            case CAN0_SIG_Mod5_temp_10:
-            case CAN0_SIG_Mod5_temp_11:
-            case CAN0_SIG_Mod6_temp_9:
-            case CAN0_SIG_Mod6_temp_10:
-            case CAN0_SIG_Mod6_temp_11:
-            case CAN0_SIG_Mod7_temp_9:
-            case CAN0_SIG_Mod7_temp_10:
-            case CAN0_SIG_Mod7_temp_11:
-                cellIdx--;  // Because cell 0 - valid flag = 1, decrement by one to get the right index
-                cellIdx--;  // Because of signal: CAN0_SIG_Modx_temp_valid_3_5
-                cellIdx--;  // Because of signal: CAN0_SIG_Modx_temp_valid_6_8
-                cellIdx--;  // Because of signal: CAN0_SIG_Modx_temp_valid_9_11
-                tmpVal = temp_tab.temperature[(modIdx * BS_NR_OF_TEMP_SENSORS_PER_MODULE) + cellIdx];
-                break;
-
-            default:
-                break;
+        // Determine module and signal within the module
+        offset = sigIdx - CAN0_SIG_Mod0_volt_valid_0_2;
+        modIdx = offset / CANS_MODULSIGNALS;
+        offset = (offset % CANS_MODULSIGNALS) - CANS_MODULSIGNALS_VOLT;
+
+        // valid flags are the first signal of a message -> pack the whole message once
+        if ((offset % CANS_CELLMSG_SIGNALS) == 0) {
+            cellIdx = (offset / CANS_CELLMSG_SIGNALS) * CANS_CELLMSG_CELLS;
+            msg.valid = 0x07;
+            msg.cell_0 = 0.0;
+            msg.cell_1 = 0.0;
+            msg.cell_2 = 0.0;
+            if (modIdx < BS_NR_OF_MODULES) {
+                msg.valid = 0x07 & (temp_tab.valid_temperaturePECs[modIdx] >> cellIdx);
+                offset = (modIdx * BS_NR_OF_TEMP_SENSORS_PER_MODULE) + cellIdx;
+                if (cellIdx + 0 < BS_NR_OF_TEMP_SENSORS_PER_MODULE) {
+                    msg.cell_0 = temp_tab.temperature[offset + 0];
+                }
+                if (cellIdx + 1 < BS_NR_OF_TEMP_SENSORS_PER_MODULE) {
+                    msg.cell_1 = temp_tab.temperature[offset + 1];
+                }
+                if (cellIdx + 2 < BS_NR_OF_TEMP_SENSORS_PER_MODULE) {
+                    msg.cell_2 = temp_tab.temperature[offset + 2];
+                }
+            }
+            frame = CANS_PackCellTemperatures(&msg);
         }
-        // Check limits
-        canData = cans_checkLimits((float)tmpVal, sigIdx);
-        // Apply offset and factor
-        *(uint32_t *)value = (uint32_t)((canData + cans_CAN0_signals_tx[sigIdx].offset) * cans_CAN0_signals_tx[sigIdx].factor);
+        *(uint32_t *)value = cans_getFrameSignal(frame, sigIdx);
     }
 
     return 0;
 }
+#endif /* CAN_USE_CELLDATA_MUX == 0 */
 
 
 uint32_t cans_gettempering(uint32_t sigIdx, void *value) {
@@ -1079,6 +603,59 @@ uint32_t cans_getsoc(uint32_t sigIdx, void *value) {
 }
 
 
+static uint32_t cans_getsoh(uint32_t sigIdx, void *value) {
+    static DATA_BLOCK_SOH_s soh_tab;
+    DB_ReadBlock(&soh_tab, DATA_BLOCK_ID_SOH);
+    if (value != NULL_PTR) {
+        switch (sigIdx) {
+            case CAN0_SIG_SOH_mean:
+                // CAN signal resolution 0.01%, --> factor 100
+                *(uint32_t *)value = (uint32_t)(soh_tab.soh_mean * cans_CAN0_signals_tx[sigIdx].factor);
+                break;
+            case CAN0_SIG_SOH_min:
+                // CAN signal resolution 0.01%, --> factor 100
+                *(uint32_t *)value = (uint32_t)(soh_tab.soh_min * cans_CAN0_signals_tx[sigIdx].factor);
+                break;
+            case CAN0_SIG_SOH_max:
+                // CAN signal resolution 0.01%, --> factor 100
+                *(uint32_t *)value = (uint32_t)(soh_tab.soh_max * cans_CAN0_signals_tx[sigIdx].factor);
+                break;
+            default:
+                *(uint32_t *)value = 0;
+                break;
+        }
+    }
+    return 0;
+}
+
+
+static uint32_t cans_getsoe(uint32_t sigIdx, void *value) {
+    static DATA_BLOCK_SOX_s sox_tab;
+    float canData = 0;
+
+    if (value != NULL_PTR) {
+        switch (sigIdx) {
+            case CAN0_SIG_SOE:
+                // first signal
+                DB_ReadBlock(&sox_tab, DATA_BLOCK_ID_SOX);
+                // CAN signal resolution 0.01%, --> factor 100
+                canData = cans_checkLimits(sox_tab.soe, sigIdx);
+                *(uint32_t *)value = (uint32_t)(canData * cans_CAN0_signals_tx[sigIdx].factor);
+                break;
+            case CAN0_SIG_RemainingEnergy:
+                // available discharge energy, in resolution of 1Wh
+                canData = cans_checkLimits(sox_tab.energy_discharge, sigIdx);
+                *(uint32_t *)value = (uint32_t)(canData * cans_CAN0_signals_tx[sigIdx].factor);
+                break;
+            default:
+                *(uint32_t *)value = 0;
+                break;
+        }
+    }
+    return 0;
+}
+
+
 static uint32_t cans_getMaxAllowedCurrent(uint32_t sigIdx, void *value) {
     static DATA_BLOCK_SOX_s sox_tab;
     float canData = 0;
@@ -1125,10 +702,145 @@ static uint32_t cans_getMaxAllowedCurrent(uint32_t sigIdx, void *value) {
 }
 
 
+static uint32_t cans_getcurrentbudget(uint32_t sigIdx, void *value) {
+    static BUDG_STATE_s charge;
+    static BUDG_STATE_s discharge;
+    float canData = 0;
+
+    if (value != NULL_PTR) {
+        switch (sigIdx) {
+            case CAN0_SIG_PeakTimeCharge:
+                // first signal
+                BUDG_GetState(BUDG_CHARGE, &charge);
+                BUDG_GetState(BUDG_DISCHARGE, &discharge);
+
+                // remaining peak time transmitted in resolution of 0.1s
+                canData = cans_checkLimits(charge.remaining_peak_ms / 1000.0, sigIdx);
+                *(uint32_t *)value = (uint32_t)((canData + cans_CAN0_signals_tx[sigIdx].offset) * cans_CAN0_signals_tx[sigIdx].factor);
+                break;
+
+            case CAN0_SIG_PeakTimeDischarge:
+                canData = cans_checkLimits(discharge.remaining_peak_ms / 1000.0, sigIdx);
+                *(uint32_t *)value = (uint32_t)((canData + cans_CAN0_signals_tx[sigIdx].offset) * cans_CAN0_signals_tx[sigIdx].factor);
+                break;
+
+            case CAN0_SIG_BudgetUsageCharge:
+                *(uint32_t *)value = charge.usage_perc;
+                break;
+
+            case CAN0_SIG_BudgetUsageDischarge:
+                *(uint32_t *)value = discharge.usage_perc;
+                break;
+
+            case CAN0_SIG_BudgetGradeCharge:
+                *(uint32_t *)value = charge.grade;
+                break;
+
+            case CAN0_SIG_BudgetGradeDischarge:
+                *(uint32_t *)value = discharge.grade;
+                break;
+
+            default:
+                *(uint32_t *)value = 0;
+                break;
+        }
+    }
+    return 0;
+}
+
+
+static uint32_t cans_getderating(uint32_t sigIdx, void *value) {
+    static DRT_STATE_s derating;
+    float canData = 0;
+    uint32_t remaining_ms = 0;
+
+    if (value != NULL_PTR) {
+        switch (sigIdx) {
+            case CAN0_SIG_DeratingCharge:
+                // first signal
+                DRT_GetState(&derating);
+
+                // applied factors of the current limits in %
+                *(uint32_t *)value = derating.charge_permille / 10;
+                break;
+
+            case CAN0_SIG_DeratingDischarge:
+                *(uint32_t *)value = derating.discharge_permille / 10;
+                break;
+
+            case CAN0_SIG_DeratingDisconnect:
+                // 0: none, 1: ramp-down requested, 2: contactors are opened immediately
+                *(uint32_t *)value = derating.disconnect;
+                break;
+
+            case CAN0_SIG_RampDownTime:
+                // time left until the contactors are opened after a ramp-down, in resolution of 0.1s
+                if ((derating.disconnect == DRT_DISCONNECT_RAMP_DOWN) && (derating.ramp_down_ms < DRT_RAMP_DOWN_TIMEOUT_MS)) {
+                    remaining_ms = DRT_RAMP_DOWN_TIMEOUT_MS - derating.ramp_down_ms;
+                }
+                canData = cans_checkLimits(remaining_ms / 1000.0, sigIdx);
+                *(uint32_t *)value = (uint32_t)((canData + cans_CAN0_signals_tx[sigIdx].offset) * cans_CAN0_signals_tx[sigIdx].factor);
+                break;
+
+            default:
+                *(uint32_t *)value = 0;
+                break;
+        }
+    }
+    return 0;
+}
+
+
+static uint32_t cans_getsopcurrent(uint32_t sigIdx, void *value) {
+    static DATA_BLOCK_SOX_s sox_tab;
+    float canData = 0;
+
+    if (value != NULL_PTR) {
+        if (sigIdx == CAN0_SIG_SOPDischargeCurrent_2s) {
+            // first signal
+            DB_ReadBlock(&sox_tab, DATA_BLOCK_ID_SOX);
+        }
+        // signals are ordered by direction and horizon, in resolution of 1A
+        if (sigIdx >= CAN0_SIG_SOPDischargeCurrent_2s && sigIdx <= CAN0_SIG_SOPDischargeCurrent_30s) {
+            canData = cans_checkLimits(sox_tab.sop_current_discharge[sigIdx - CAN0_SIG_SOPDischargeCurrent_2s], sigIdx);
+        } else if (sigIdx >= CAN0_SIG_SOPChargeCurrent_2s && sigIdx <= CAN0_SIG_SOPChargeCurrent_30s) {
+            canData = cans_checkLimits(sox_tab.sop_current_charge[sigIdx - CAN0_SIG_SOPChargeCurrent_2s], sigIdx);
+        }
+        *(uint32_t *)value = (uint32_t)((canData + cans_CAN0_signals_tx[sigIdx].offset) * cans_CAN0_signals_tx[sigIdx].factor);
+    }
+    return 0;
+}
+
+
 static uint32_t cans_getMaxAllowedPower(uint32_t sigIdx, void *value) {
+    static DATA_BLOCK_SOX_s sox_tab;
+    float canData = 0;
 
     if (value != NULL_PTR) {
         switch (sigIdx) {
+            case CAN0_SIG_MaxChargePower:
+                // first signal
+                DB_ReadBlock(&sox_tab, DATA_BLOCK_ID_SOX);
+                // longest SOP horizon, in resolution of 0.1kW
+                canData = cans_checkLimits(sox_tab.sop_power_charge[2] / 1000.0, sigIdx);
+                *(uint32_t *)value = (uint32_t)((canData + cans_CAN0_signals_tx[sigIdx].offset) * cans_CAN0_signals_tx[sigIdx].factor);
+                break;
+
+            case CAN0_SIG_MaxChargePower_Peak:
+                // shortest SOP horizon, in resolution of 0.1kW
+                canData = cans_checkLimits(sox_tab.sop_power_charge[0] / 1000.0, sigIdx);
+                *(uint32_t *)value = (uint32_t)((canData + cans_CAN0_signals_tx[sigIdx].offset) * cans_CAN0_signals_tx[sigIdx].factor);
+                break;
+
+            case CAN0_SIG_MaxDischargePower:
+                canData = cans_checkLimits(sox_tab.sop_power_discharge[2] / 1000.0, sigIdx);
+                *(uint32_t *)value = (uint32_t)((canData + cans_CAN0_signals_tx[sigIdx].offset) * cans_CAN0_signals_tx[sigIdx].factor);
+                break;
+
+            case CAN0_SIG_MaxDischargePower_Peak:
+                canData = cans_checkLimits(sox_tab.sop_power_discharge[0] / 1000.0, sigIdx);
+                *(uint32_t *)value = (uint32_t)((canData + cans_CAN0_signals_tx[sigIdx].offset) * cans_CAN0_signals_tx[sigIdx].factor);
+                break;
 
             default:
                 *(uint32_t *)value = 0;
@@ -1443,6 +1155,8 @@ static uint32_t cans_setcurr(uint32_t sigIdx, void *value) {
                     cans_current_tab.previous_timestamp = cans_current_tab.timestamp;
                     cans_current_tab.timestamp = MCU_GetTimeStamp();
                     cans_current_tab.current = (float)(currentValue);
+                    FFR_CheckCurrent(cans_current_tab.current);
+                    SOC_CcAddSample(currentValue);
                     cans_current_tab.newCurrent++;
                     cans_current_tab.state_current++;
                     DB_WriteBlock(&cans_current_tab, DATA_BLOCK_ID_CURRENT);
@@ -1572,6 +1286,50 @@ uint32_t cans_getisoguard(uint32_t sigIdx, void *value) {
 }
 
 
+static uint32_t cans_getbalancingleakage(uint32_t sigIdx, void *value) {
+    static DATA_BLOCK_BALANCING_ENERGY_s energy_tab;
+    float canData = 0;
+
+    if (value != NULL_PTR) {
+        switch (sigIdx) {
+            case CAN0_SIG_LeakageMax:
+                // first signal
+                DB_ReadBlock(&energy_tab, DATA_BLOCK_ID_BALANCING_ENERGY);
+
+                // highest self-discharge relative to the cell bled the most, in uA
+                canData = cans_checkLimits(energy_tab.leakage_max, sigIdx);
+                *(uint32_t *)value = (uint32_t)((canData + cans_CAN0_signals_tx[sigIdx].offset) * cans_CAN0_signals_tx[sigIdx].factor);
+                break;
+
+            case CAN0_SIG_LeakageMaxCell:
+                *(uint32_t *)value = energy_tab.cell_number_leakage_max;
+                break;
+
+            case CAN0_SIG_BalancedCharge:
+                // charge bled from all cells, in resolution of 0.1Ah
+                canData = cans_checkLimits(energy_tab.charge_total, sigIdx);
+                *(uint32_t *)value = (uint32_t)((canData + cans_CAN0_signals_tx[sigIdx].offset) * cans_CAN0_signals_tx[sigIdx].factor);
+                break;
+
+            case CAN0_SIG_LeakageObservationTime:
+                // in h
+                canData = cans_checkLimits(energy_tab.observation_time / 3600, sigIdx);
+                *(uint32_t *)value = (uint32_t)((canData + cans_CAN0_signals_tx[sigIdx].offset) * cans_CAN0_signals_tx[sigIdx].factor);
+                break;
+
+            case CAN0_SIG_LeakageValid:
+                *(uint32_t *)value = energy_tab.valid;
+                break;
+
+            default:
+                *(uint32_t *)value = 0;
+                break;
+        }
+    }
+    return 0;
+}
+
+
 uint32_t cans_setdebug(uint32_t sigIdx, void *value) {
     uint8_t data[8] = {0, 0, 0, 0, 0, 0, 0, 0};
     static DATA_BLOCK_BALANCING_CONTROL_s balancing_tab;
@@ -1614,6 +1372,22 @@ uint32_t cans_setdebug(uint32_t sigIdx, void *value) {
 }
 
 
+#if CAN_USE_ISOTP == 1
+static uint32_t cans_setisotp(uint32_t sigIdx, void *value) {
+    uint8_t data[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+    uint8_t i = 0;
+
+    if (value != NULL_PTR) {
+        for (i = 0; i < 8; i++) {
+            data[i] = (*(uint64_t *)value >> (8 * i)) & 0xFF;
+        }
+        ISOTP_Receive(sigIdx - CAN0_SIG_ISOTP_0_Data, data);
+    }
+    return 0;
+}
+#endif
+
+
 float cans_checkLimits(float value, uint32_t sigIdx) {
     float retVal = value;
 
@@ -1628,3 +1402,20 @@ float cans_checkLimits(float value, uint32_t sigIdx) {
 
 
 
+
+
+#if CAN_USE_CELLDATA_MUX == 0
+/**
+ * @brief   extracts the raw value of a signal from a packed message
+ *
+ * @param   frame   message packed by a CANS_Pack..() function of cans_dbc.h
+ * @param   sigIdx  index of the signal in cans_CAN0_signals_tx[]
+ *
+ * @return  raw value of the signal
+ */
+static uint32_t cans_getFrameSignal(uint64_t frame, uint32_t sigIdx) {
+    uint64_t mask = ((uint64_t)1 << cans_CAN0_signals_tx[sigIdx].bit_length) - 1;
+
+    return (uint32_t)((frame >> cans_CAN0_signals_tx[sigIdx].bit_position) & mask);
+}
+#endif
@@ -36,6 +36,7 @@
 
 /*================== Includes =============================================*/
 #include "can_cfg.h"
+#include "isotp_cfg.h"
 /*================== Macros and Definitions ===============================*/
 
 /**
@@ -69,6 +70,9 @@ typedef enum {
 
     CAN0_MSG_MaxAllowedCurrent,  //!< Max allowed charge/discharge current
     CAN0_MSG_SOP,  //!< SOP
+    CAN0_MSG_CurrentBudget,  //!< remaining peak time and usage of the current budgets
+    CAN0_MSG_Derating,  //!< derating of the current limits and ramp-down request
+    CAN0_MSG_SOPCurrent,  //!< predicted max charge/discharge currents over 2s, 10s and 30s
     CAN0_MSG_SOC,  //!< SOC
     CAN0_MSG_SOH,  //!< SOH
     CAN0_MSG_SOE,  //!< SOE
@@ -77,6 +81,7 @@ typedef enum {
     CAN0_MSG_MinMaxCellTemp,  //!< min/max/mean cell temperatures
     CAN0_MSG_Tempering,  //!< Tempering
     CAN0_MSG_Insulation,  //!< Insulation
+    CAN0_MSG_BalancingLeakage,  //!< bled charge and highest self-discharge of the cells
     CAN0_MSG_Power_0,  //!< Running average power 1s 5s
     CAN0_MSG_Power_1,  //!< Running average power 10s 30s
     CAN0_MSG_Power_2,  //!< Running average power 60s configurable duration
@@ -84,6 +89,7 @@ typedef enum {
     CAN0_MSG_Current_1,  //!< Running average current 10s 30s
     CAN0_MSG_Current_2,  //!< Running average current 60s configurable duration
 
+#if CAN_USE_CELLDATA_MUX == 0
     CAN0_MSG_Mod0_Cellvolt_0,  //!< Module 0 Cell voltages 0-2
     CAN0_MSG_Mod0_Cellvolt_1,  //!< Module 0 Cell voltages 3-5
     CAN0_MSG_Mod0_Cellvolt_2,  //!< Module 0 Cell voltages 6-8
@@ -155,6 +161,7 @@ typedef enum {
     CAN0_MSG_Mod7_Celltemp_1,  //!< Module 7 Cell temperatures 3-5
     CAN0_MSG_Mod7_Celltemp_2,  //!< Module 7 Cell temperatures 6-8
     CAN0_MSG_Mod7_Celltemp_3,  //!< Module 7 Cell temperatures 9-11
+#endif /* CAN_USE_CELLDATA_MUX == 0 */
 
 #ifdef CAN_ISABELLENHUETTE_TRIGGERED
     CAN0_MSG_BMS_CurrentTrigger,    //!< Cell Voltages Max Min Average
@@ -183,6 +190,12 @@ typedef enum {
     CAN0_MSG_IVT_CoulombCount,               //!< current sensor C-C
     CAN0_MSG_IVT_EnergyCount,                //!< current sensor E-C
     CAN0_MSG_DEBUG,                          //!< debug messages
+#if CAN_USE_ISOTP == 1
+    CAN0_MSG_ISOTP_0,                        //!< ISO-TP request session 0
+#if ISOTP_NR_OF_SESSIONS > 1
+    CAN0_MSG_ISOTP_1,                        //!< ISO-TP request session 1
+#endif
+#endif
 
     /* Insert here symbolic names for CAN1 messages */
 
@@ -225,6 +238,25 @@ typedef enum {
     CAN0_SIG_MaxDischargePower,
     CAN0_SIG_MaxDischargePower_Peak,
 
+    CAN0_SIG_PeakTimeCharge,
+    CAN0_SIG_PeakTimeDischarge,
+    CAN0_SIG_BudgetUsageCharge,
+    CAN0_SIG_BudgetUsageDischarge,
+    CAN0_SIG_BudgetGradeCharge,
+    CAN0_SIG_BudgetGradeDischarge,
+
+    CAN0_SIG_DeratingCharge,
+    CAN0_SIG_DeratingDischarge,
+    CAN0_SIG_DeratingDisconnect,
+    CAN0_SIG_RampDownTime,
+
+    CAN0_SIG_SOPDischargeCurrent_2s,
+    CAN0_SIG_SOPDischargeCurrent_10s,
+    CAN0_SIG_SOPDischargeCurrent_30s,
+    CAN0_SIG_SOPChargeCurrent_2s,
+    CAN0_SIG_SOPChargeCurrent_10s,
+    CAN0_SIG_SOPChargeCurrent_30s,
+
     CAN0_SIG_SOC_mean,
     CAN0_SIG_SOC_min,
     CAN0_SIG_SOC_max,
@@ -257,6 +289,12 @@ typedef enum {
     CAN0_SIG_InsulationStatus,
     CAN0_SIG_InsulationValue,
 
+    CAN0_SIG_LeakageMax,
+    CAN0_SIG_LeakageMaxCell,
+    CAN0_SIG_BalancedCharge,
+    CAN0_SIG_LeakageObservationTime,
+    CAN0_SIG_LeakageValid,
+
     CAN0_SIG_MovMean_Power_1s,
     CAN0_SIG_MovMean_Power_5s,
     CAN0_SIG_MovMean_Power_10s,
@@ -271,6 +309,7 @@ typedef enum {
     CAN0_SIG_MovMean_Current_60s,
     CAN0_SIG_MovMean_Current_config,
 
+#if CAN_USE_CELLDATA_MUX == 0
     CAN0_SIG_Mod0_volt_valid_0_2,
     CAN0_SIG_Mod0_volt_0,
     CAN0_SIG_Mod0_volt_1,
@@ -542,6 +581,7 @@ typedef enum {
     CAN0_SIG_Mod7_temp_9,
     CAN0_SIG_Mod7_temp_10,
     CAN0_SIG_Mod7_temp_11,
+#endif /* CAN_USE_CELLDATA_MUX == 0 */
 
 #ifdef CAN_ISABELLENHUETTE_TRIGGERED
     CAN0_SIG_ISA_Trigger,
@@ -587,7 +627,13 @@ typedef enum {
     CAN0_SIG_IVT_EC_MuxID,        //!< current sensor measurement type
     CAN0_SIG_IVT_EC_Status,        //!< current sensor counter
     CAN0_SIG_IVT_EC_Measurement,  //!< current sensor measurement E-C
-    CAN0_SIG_DEBUG_Data              //!< Data of debug message
+    CAN0_SIG_DEBUG_Data,             //!< Data of debug message
+#if CAN_USE_ISOTP == 1
+    CAN0_SIG_ISOTP_0_Data,           //!< ISO-TP frame session 0
+#if ISOTP_NR_OF_SESSIONS > 1
+    CAN0_SIG_ISOTP_1_Data,           //!< ISO-TP frame session 1
+#endif
+#endif
 } CANS_CAN0_signalsRx_e;
 
 
@@ -35,6 +35,14 @@
 #include "contactor_cfg.h"
 /*================== Macros and Definitions ===============================*/
 
+/**
+ * limit monitor of one contactor feedback: a mismatch is reported after
+ * CONT_FEEDBACK_DELAY_MS and cleared after the feedback matched for the same time
+ */
+#define CONT_FEEDBACK_LMON(diag_ch)     { LMON_UPPER_LIMIT, { LMON_LEVEL_UNUSED, \
+                                          { TRUE, 0, 0, CONT_FEEDBACK_DELAY_MS, CONT_FEEDBACK_DELAY_MS, (diag_ch) }, \
+                                          LMON_LEVEL_UNUSED } }
+
 /*================== Constant and Variable Definitions ====================*/
 
 
@@ -60,6 +68,17 @@ CONT_ELECTRICAL_STATE_s cont_contactor_states[BS_NR_OF_CONTACTORS] = {
 #endif // BS_SEPARATE_POWERLINES == 1
 };
 
+const LMON_CONFIG_s cont_feedback_lmon_cfg[BS_NR_OF_CONTACTORS] = {
+        CONT_FEEDBACK_LMON(DIAG_CH_CONTACTOR_MAIN_PLUS_FEEDBACK),
+        CONT_FEEDBACK_LMON(DIAG_CH_CONTACTOR_PRECHARGE_FEEDBACK),
+        CONT_FEEDBACK_LMON(DIAG_CH_CONTACTOR_MAIN_MINUS_FEEDBACK),
+#if BS_SEPARATE_POWERLINES == 1
+        CONT_FEEDBACK_LMON(DIAG_CH_CONTACTOR_CHARGE_MAIN_PLUS_FEEDBACK),
+        CONT_FEEDBACK_LMON(DIAG_CH_CONTACTOR_CHARGE_PRECHARGE_FEEDBACK),
+        CONT_FEEDBACK_LMON(DIAG_CH_CONTACTOR_CHARGE_MAIN_MINUS_FEEDBACK),
+#endif // BS_SEPARATE_POWERLINES == 1
+};
+
 const uint8_t cont_contactors_config_length = sizeof(cont_contactors_config)/sizeof(cont_contactors_config[0]);
 const uint8_t cont_contactors_states_length = sizeof(cont_contactor_states)/sizeof(cont_contactor_states[0]);
 /*================== Function Prototypes ==================================*/
@@ -38,6 +38,7 @@
 #include "batterysystem_cfg.h"
 #include "io_cfg.h"
 #include "general.h"
+#include "lmon.h"
 /*================== Macros and Definitions ===============================*/
 
 /**
@@ -155,6 +156,12 @@
 
 #define CONT_OSCILLATION_LIMIT 500
 
+/**
+ * Time in ms a contactor feedback has to mismatch its set value before the
+ * error is reported, and to match again before it is cleared
+ */
+#define CONT_FEEDBACK_DELAY_MS ((500) * (CONT_TASK_CYCLE_CONTEXT_MS))
+
 
 /**
  * Number of allowed tries to close contactors
@@ -292,6 +299,11 @@ extern const CONT_CONFIG_s cont_contactors_config[BS_NR_OF_CONTACTORS];
 extern CONT_ELECTRICAL_STATE_s cont_contactor_states[BS_NR_OF_CONTACTORS];
 
 extern const uint8_t cont_contactors_config_length;
+
+/**
+ * limit monitors of the contactor feedbacks, in the order of cont_contactors_config[]
+ */
+extern const LMON_CONFIG_s cont_feedback_lmon_cfg[BS_NR_OF_CONTACTORS];
 extern const uint8_t cont_contactors_states_length;
 
 /*================== Function Prototypes ==================================*/
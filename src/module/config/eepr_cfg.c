@@ -57,7 +57,7 @@
  * */
 #define EEPR_VERSIONNUMBERMAYOR             0
 
-#define EEPR_VERSIONNUMBERMINOR             1
+#define EEPR_VERSIONNUMBERMINOR             3
 
 #define EEPR_HEADERPATTERN                  0xAA551234
 
@@ -78,15 +78,6 @@ const EEPR_HEADER_s eepr_header_default = {
 
 EEPR_HEADER_s eepr_header;
 
-const EEPR_CALIB_STATISTICS_s defaultcalibstatistics = {
-        .u_cell_max = 0,
-        .u_cell_min = 0,
-        .u_temperature_max = 0,
-        .u_temperature_min = 0,
-        .current_max = 0,
-        .current_min = 0,
-};
-
 /**
  * Version number of EEPR Software
  */
@@ -110,10 +101,12 @@ EEPR_CH_CFG_s eepr_ch_cfg[] = {
         {0x0080, sizeof(BKPSRAM_CH_OP_HOURS_s),   EEPR_CH_OPERATING_HOURS, 0x0080 + sizeof(BKPSRAM_CH_OP_HOURS_s) - 4,   EEPR_SW_WRITE_UNPROTECTED, (uint8_t*)&bkpsram_operating_hours},
         {0x0090, sizeof(BKPSRAM_CH_NVSOC_s),      EEPR_CH_NVSOC,           0x0090 + sizeof(BKPSRAM_CH_NVSOC_s) - 4,      EEPR_SW_WRITE_UNPROTECTED, (uint8_t*)&bkpsram_nvsoc },
         {0x00B0, sizeof(BKPSRAM_CH_CONT_COUNT_s), EEPR_CH_CONTACTOR,       0x00B0 + sizeof(BKPSRAM_CH_CONT_COUNT_s) - 4, EEPR_SW_WRITE_UNPROTECTED, (uint8_t*)&bkpsram_contactors_count},
-        {0x00F0, sizeof(EEPR_CALIB_STATISTICS_s), EEPR_CH_STATISTICS,      0x00F0 + sizeof(EEPR_CALIB_STATISTICS_s) - 4, EEPR_SW_WRITE_UNPROTECTED, (NULL_PTR)},
+        {0x00F0, sizeof(BKPSRAM_CH_SOH_s),        EEPR_CH_STATISTICS,      0x00F0 + sizeof(BKPSRAM_CH_SOH_s) - 4,        EEPR_SW_WRITE_UNPROTECTED, (uint8_t*)&bkpsram_soh},
         // FREE EEPRROMS CHANNELS (for future use)
         {0x0110, 0x70,                            EEPR_CH_USER_DATA,       0x0110 + 0x70 - 4,                            EEPR_SW_WRITE_UNPROTECTED, (NULL_PTR)},
-//      {0x0180, ...},
+        {0x0180, sizeof(BKPSRAM_CH_BALANCING_s),  EEPR_CH_BALANCING,       0x0180 + sizeof(BKPSRAM_CH_BALANCING_s) - 4,  EEPR_SW_WRITE_UNPROTECTED, (uint8_t*)&bkpsram_balancing},
+        {0x0200, sizeof(BKPSRAM_CH_SOH_CELLS_s),  EEPR_CH_SOH_CELLS,       0x0200 + sizeof(BKPSRAM_CH_SOH_CELLS_s) - 4,  EEPR_SW_WRITE_UNPROTECTED, (uint8_t*)&bkpsram_soh_cells},
+//      {0x0300, ...},
 };
 
 /* In case of compile errors in the following dummy-declarations,
@@ -132,8 +125,10 @@ extern uint8_t compiler_throw_an_error_3[(0x80 == 0x80)?1:-1]; // EEPROM FORMAT
 extern uint8_t compiler_throw_an_error_4[(sizeof(BKPSRAM_CH_OP_HOURS_s) == 0x10)?1:-1]; // EEPROM FORMAT ERROR! Change of data size. Please note comment above!!!
 extern uint8_t compiler_throw_an_error_5[(sizeof(BKPSRAM_CH_NVSOC_s) == 0x20)?1:-1]; // EEPROM FORMAT ERROR! Change of data size. Please note comment above!!!
 extern uint8_t compiler_throw_an_error_6[(sizeof(BKPSRAM_CH_CONT_COUNT_s) == 0x40)?1:-1]; // EEPROM FORMAT ERROR! Change of data size. Please note comment above!!!
-extern uint8_t compiler_throw_an_error_7[(sizeof(EEPR_CALIB_STATISTICS_s) == 0x20)?1:-1]; // EEPROM FORMAT ERROR! Change of data size. Please note comment above!!!
+extern uint8_t compiler_throw_an_error_7[(sizeof(BKPSRAM_CH_SOH_s) == 0x20)?1:-1]; // EEPROM FORMAT ERROR! Change of data size. Please note comment above!!!
 extern uint8_t compiler_throw_an_error_8[(0x70 == 0x70)?1:-1]; // EEPROM FORMAT ERROR! Change of data size. Please note comment above!!!
+extern uint8_t compiler_throw_an_error_9[(sizeof(BKPSRAM_CH_BALANCING_s) <= 0x80)?1:-1]; // EEPROM FORMAT ERROR! The balancing channel holds up to BAL_ENERGY_MAX_CELLS cells. Please note comment above!!!
+extern uint8_t compiler_throw_an_error_10[(sizeof(BKPSRAM_CH_SOH_CELLS_s) <= 0x100)?1:-1]; // EEPROM FORMAT ERROR! The SOH cell channel holds up to SOH_NVM_MAX_CELLS cells. Please note comment above!!!
 
 
 const uint8_t eepr_nr_of_channels = sizeof(eepr_ch_cfg)/sizeof(eepr_ch_cfg[0]);
@@ -286,6 +281,24 @@ void EEPR_SetDefaultValue(EEPR_CHANNEL_ID_TYPE_e eepr_channel)
             EEPR_SetChDirtyFlag(EEPR_CH_OPERATING_HOURS);
             break;
 
+        case EEPR_CH_STATISTICS:
+            bkpsram_soh.data = default_soh.data;
+            bkpsram_soh.checksum = EEPR_CalcChecksum((uint8_t*)(&bkpsram_soh),sizeof(bkpsram_soh)-4);
+            EEPR_SetChDirtyFlag(EEPR_CH_STATISTICS);
+            break;
+
+        case EEPR_CH_BALANCING:
+            bkpsram_balancing.data = default_balancing.data;
+            bkpsram_balancing.checksum = EEPR_CalcChecksum((uint8_t*)(&bkpsram_balancing),sizeof(bkpsram_balancing)-4);
+            EEPR_SetChDirtyFlag(EEPR_CH_BALANCING);
+            break;
+
+        case EEPR_CH_SOH_CELLS:
+            bkpsram_soh_cells.data = default_soh_cells.data;
+            bkpsram_soh_cells.checksum = EEPR_CalcChecksum((uint8_t*)(&bkpsram_soh_cells),sizeof(bkpsram_soh_cells)-4);
+            EEPR_SetChDirtyFlag(EEPR_CH_SOH_CELLS);
+            break;
+
         case EEPR_CH_HEADER:
             eepr_header = eepr_header_default;
             eepr_header.chksum = EEPR_CalcChecksum((uint8_t*)&eepr_header_default, sizeof(eepr_header_default)-4);
@@ -501,6 +514,24 @@ EEPR_ERRORTYPES_e EEPR_InitChannelData(void)
             errtype = EEPR_NO_ERROR;
             EEPR_SetDefaultValue(EEPR_CH_OPERATING_HOURS);
         }
+        errtype |= EEPR_ReadChannelData(EEPR_CH_STATISTICS);
+        retval |= errtype;
+        if (errtype != EEPR_NO_ERROR) {
+            errtype = EEPR_NO_ERROR;
+            EEPR_SetDefaultValue(EEPR_CH_STATISTICS);
+        }
+        errtype |= EEPR_ReadChannelData(EEPR_CH_BALANCING);
+        retval |= errtype;
+        if (errtype != EEPR_NO_ERROR) {
+            errtype = EEPR_NO_ERROR;
+            EEPR_SetDefaultValue(EEPR_CH_BALANCING);
+        }
+        errtype |= EEPR_ReadChannelData(EEPR_CH_SOH_CELLS);
+        retval |= errtype;
+        if (errtype != EEPR_NO_ERROR) {
+            errtype = EEPR_NO_ERROR;
+            EEPR_SetDefaultValue(EEPR_CH_SOH_CELLS);
+        }
         RTC_NVMRAM_DATAVALID_VARIABLE = 1;      // validate NVNRAM data
     }
     else
@@ -532,6 +563,33 @@ EEPR_ERRORTYPES_e EEPR_InitChannelData(void)
             errtype = EEPR_NO_ERROR;
             EEPR_SetDefaultValue(EEPR_CH_OPERATING_HOURS);
         }
+
+        errtype |= EEPR_RefreshChannelData(EEPR_CH_STATISTICS);
+        retval |= errtype;
+        if (errtype == EEPR_ERR_RD || errtype == (EEPR_ERR_RD | EEPR_ERR_WR)) {
+            // read error can only occur if checksum of bkpsram channel is corrupt -> set default values
+            // ignore possible write error because we definitely want to try writing to EEPROM
+            errtype = EEPR_NO_ERROR;
+            EEPR_SetDefaultValue(EEPR_CH_STATISTICS);
+        }
+
+        errtype |= EEPR_RefreshChannelData(EEPR_CH_BALANCING);
+        retval |= errtype;
+        if (errtype == EEPR_ERR_RD || errtype == (EEPR_ERR_RD | EEPR_ERR_WR)) {
+            // read error can only occur if checksum of bkpsram channel is corrupt -> set default values
+            // ignore possible write error because we definitely want to try writing to EEPROM
+            errtype = EEPR_NO_ERROR;
+            EEPR_SetDefaultValue(EEPR_CH_BALANCING);
+        }
+
+        errtype |= EEPR_RefreshChannelData(EEPR_CH_SOH_CELLS);
+        retval |= errtype;
+        if (errtype == EEPR_ERR_RD || errtype == (EEPR_ERR_RD | EEPR_ERR_WR)) {
+            // read error can only occur if checksum of bkpsram channel is corrupt -> set default values
+            // ignore possible write error because we definitely want to try writing to EEPROM
+            errtype = EEPR_NO_ERROR;
+            EEPR_SetDefaultValue(EEPR_CH_SOH_CELLS);
+        }
     }
     return retval;
 }
@@ -116,6 +116,7 @@ typedef enum {
     EEPR_CHANNEL_7        = 6,
     EEPR_CHANNEL_8        = 7,
     EEPR_CHANNEL_9        = 8,
+    EEPR_CHANNEL_10       = 9,
 
     EEPR_CHANNEL_MAX      = EEPR_CHANNEL_MAX_NR-1,
 } EEPR_CHANNEL_ID_TYPE_e;
@@ -129,6 +130,8 @@ typedef enum {
 #define EEPR_CH_CONTACTOR         EEPR_CHANNEL_6
 #define EEPR_CH_STATISTICS        EEPR_CHANNEL_7
 #define EEPR_CH_USER_DATA         EEPR_CHANNEL_8
+#define EEPR_CH_BALANCING         EEPR_CHANNEL_9
+#define EEPR_CH_SOH_CELLS         EEPR_CHANNEL_10
 
 
 /**
@@ -205,18 +208,6 @@ typedef struct {
 } EEPR_CH_CFG_s;
 
 
-//@FIXME comments missing
-typedef struct {
-    uint16_t     u_cell_max;
-    uint16_t     u_cell_min;
-    uint16_t     u_temperature_max;
-    uint16_t     u_temperature_min;
-    float        current_max;
-    float        current_min;
-    uint32_t     dummy[3];        // for future use
-    uint32_t checksum;            // checksum of data block (must be last position)
-}EEPR_CALIB_STATISTICS_s;
-
 //@FIXME comments missing
 typedef struct {
     uint16_t  versionnumbermajor;     /*!<Versionnumber of major changes in EEPROM software    */
@@ -271,12 +262,6 @@ extern const EEPR_HEADER_s eepr_header_default;
  */
 extern EEPR_BOARD_INFO_s eepr_board_info;
 
-/**
- * default calibration statistics
- */
-
-extern const EEPR_CALIB_STATISTICS_s defaultcalibstatistics;
-
 /**
  * buffer to write or read data in eeprom
  */
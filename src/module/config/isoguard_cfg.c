@@ -47,6 +47,15 @@
 
 /*================== Constant and Variable Definitions ====================*/
 
+const LMON_CONFIG_s iso_lmon_cfg = {
+    LMON_LOWER_LIMIT, {
+        /* enabled, set,                                reset,                              on,   off,  DIAG channel */
+        { TRUE, 2*ISO_RESISTANCE_THRESHOLD,             (5*ISO_RESISTANCE_THRESHOLD)/2,     1000, 2000, LMON_NO_DIAG_CH },
+        { TRUE, ISO_RESISTANCE_THRESHOLD + 1,           ISO_RESISTANCE_THRESHOLD + 50,         0, 1000, LMON_NO_DIAG_CH },
+        LMON_LEVEL_UNUSED,
+    }
+};
+
 /*================== Function Prototypes ==================================*/
 
 /*================== Function Implementations =============================*/
@@ -36,6 +36,7 @@
 #define ISOGUARD_CFG_H_
 
 /*================== Includes =============================================*/
+#include "lmon.h"
 
 /*================== Macros and Definitions ===============================*/
 
@@ -95,6 +96,12 @@
 
 /*================== Constant and Variable Definitions ====================*/
 
+/**
+ * Warning and error level of the insulation resistance in kOhm. The error
+ * level replaces the plain comparison against ISO_RESISTANCE_THRESHOLD.
+ */
+extern const LMON_CONFIG_s iso_lmon_cfg;
+
 /*================== Function Prototypes ==================================*/
 
 /*================== Function Implementations =============================*/
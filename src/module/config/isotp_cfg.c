@@ -0,0 +1,147 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    isotp_cfg.c
+ * @author  foxBMS Team
+ * @date    19.10.2026 (date of creation)
+ * @ingroup DRIVERS_CONF
+ * @prefix  ISOTP
+ *
+ * @brief   Configuration of the ISO-TP transport layer and its services
+ *
+ */
+
+/*================== Includes =============================================*/
+/* recommended include order of header files:
+ * 
+ * 1.    include general.h
+ * 2.    include module's own header
+ * 3...  other headers
+ *
+ */
+#include "general.h"
+#include "isotp_cfg.h"
+
+#include "database.h"
+#include "diag.h"
+#include "eepr_cfg.h"
+#include "os.h"
+#include <string.h>
+
+/*================== Macros and Definitions ===============================*/
+
+/**
+ * length of the positive response header (SID and data identifier)
+ */
+#define ISOTP_RESPONSE_HEADER_LENGTH    3
+
+/*================== Constant and Variable Definitions ====================*/
+
+const ISOTP_SESSION_CFG_s isotp_session_cfg[ISOTP_NR_OF_SESSIONS] = {
+        { ISOTP_SESSION0_RX_ID, ISOTP_SESSION0_TX_ID },
+#if ISOTP_NR_OF_SESSIONS > 1
+        { ISOTP_SESSION1_RX_ID, ISOTP_SESSION1_TX_ID },
+#endif
+};
+
+/*================== Function Prototypes ==================================*/
+static uint16_t ISOTP_NegativeResponse(uint8_t sid, uint8_t nrc, uint8_t *response);
+
+/*================== Function Implementations =============================*/
+
+uint16_t ISOTP_ServiceRequest(const uint8_t *request, uint16_t length, uint8_t *response, uint16_t max_length) {
+    uint16_t did = 0;
+    uint8_t idx = 0;
+    uint16_t data_length = 0;
+    uint8_t *data = &response[ISOTP_RESPONSE_HEADER_LENGTH];
+    uint16_t max_data_length = max_length - ISOTP_RESPONSE_HEADER_LENGTH;
+
+    if (request[0] != ISOTP_SID_READ_DATA_BY_ID) {
+        return ISOTP_NegativeResponse(request[0], ISOTP_NRC_SERVICE_NOT_SUPPORTED, response);
+    }
+    if (length != 3) {
+        return ISOTP_NegativeResponse(request[0], ISOTP_NRC_INCORRECT_LENGTH, response);
+    }
+
+    did = (request[1] << 8) | request[2];
+    idx = request[2];
+
+    switch (did & 0xFF00) {
+        case ISOTP_DID_DATABASE_BLOCK:
+            if (idx >= data_base_dev.nr_of_blockheader) {
+                return ISOTP_NegativeResponse(request[0], ISOTP_NRC_REQUEST_OUT_OF_RANGE, response);
+            }
+            data_length = data_base_dev.blockheaderptr[idx].datalength;
+            if (data_length > max_data_length) {
+                return ISOTP_NegativeResponse(request[0], ISOTP_NRC_RESPONSE_TOO_LONG, response);
+            }
+            DB_ReadBlock(data, (DATA_BLOCK_ID_TYPE_e)idx);
+            break;
+
+        case ISOTP_DID_EEPROM_CHANNEL:
+            // channels without backup SRAM mirror are only accessible in the EEPROM itself
+            if ((idx >= eepr_nr_of_channels) || (eepr_ch_cfg[idx].bkpsramptr == NULL_PTR)) {
+                return ISOTP_NegativeResponse(request[0], ISOTP_NRC_REQUEST_OUT_OF_RANGE, response);
+            }
+            data_length = eepr_ch_cfg[idx].length;
+            if (data_length > max_data_length) {
+                return ISOTP_NegativeResponse(request[0], ISOTP_NRC_RESPONSE_TOO_LONG, response);
+            }
+            OS_TaskEnter_Critical();
+            memcpy(data, eepr_ch_cfg[idx].bkpsramptr, data_length);
+            OS_TaskExit_Critical();
+            break;
+
+        case ISOTP_DID_DIAG_MEMORY:
+            if (idx != 0) {
+                return ISOTP_NegativeResponse(request[0], ISOTP_NRC_REQUEST_OUT_OF_RANGE, response);
+            }
+            data_length = DIAG_GetErrorEntries(data, max_data_length / sizeof(DIAG_ERROR_ENTRY_s)) * sizeof(DIAG_ERROR_ENTRY_s);
+            break;
+
+        default:
+            return ISOTP_NegativeResponse(request[0], ISOTP_NRC_REQUEST_OUT_OF_RANGE, response);
+    }
+
+    response[0] = ISOTP_SID_READ_DATA_BY_ID + ISOTP_POSITIVE_RESPONSE_OFFSET;
+    response[1] = request[1];
+    response[2] = request[2];
+    return ISOTP_RESPONSE_HEADER_LENGTH + data_length;
+}
+
+
+/**
+ * @brief   writes a negative response
+ *
+ * @param   sid         service identifier of the request
+ * @param   nrc         negative response code
+ * @param   response    buffer for the response
+ *
+ * @return  length of the response
+ */
+static uint16_t ISOTP_NegativeResponse(uint8_t sid, uint8_t nrc, uint8_t *response) {
+    response[0] = ISOTP_SID_NEGATIVE_RESPONSE;
+    response[1] = sid;
+    response[2] = nrc;
+    return 3;
+}
@@ -0,0 +1,243 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    isotp_cfg.h
+ * @author  foxBMS Team
+ * @date    19.10.2026 (date of creation)
+ * @ingroup DRIVERS_CONF
+ * @prefix  ISOTP
+ *
+ * @brief   Configuration of the ISO-TP transport layer and its services
+ *
+ */
+
+#ifndef ISOTP_CFG_H_
+#define ISOTP_CFG_H_
+
+/*================== Includes =============================================*/
+#include "can_cfg.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/**
+ * @ingroup CONFIG_ISOTP
+ * Number of sessions, i.e., pairs of request and response identifiers, which
+ * can transfer data at the same time. Each session needs a row in
+ * can0_RxMsgs[], CANS_messagesRx_e and cans_CAN0_signals_rx[].
+ * \par Type:
+ * int
+ * \par Range:
+ * 1 <= x <= 2
+ * \par Default:
+ * 2
+*/
+#define ISOTP_NR_OF_SESSIONS            2
+
+/**
+ * @ingroup CONFIG_ISOTP
+ * CAN identifiers of the requests (tester to BMS) and responses (BMS to
+ * tester) of the sessions
+ * \par Type:
+ * int
+ * \par Default:
+ * 0x7E0/0x7E8 and 0x7E1/0x7E9
+*/
+#define ISOTP_SESSION0_RX_ID            0x7E0
+#define ISOTP_SESSION0_TX_ID            0x7E8
+#define ISOTP_SESSION1_RX_ID            0x7E1
+#define ISOTP_SESSION1_TX_ID            0x7E9
+
+/**
+ * @ingroup CONFIG_ISOTP
+ * Periodic calling time of ISOTP_Trigger()
+ * \par Type:
+ * int
+ * \par Unit:
+ * ms
+ * \par Default:
+ * 10
+*/
+#define ISOTP_TICK_MS                   10
+
+/**
+ * @ingroup CONFIG_ISOTP
+ * Block size sent in the flow control frames of multi-frame requests, i.e.,
+ * number of consecutive frames the tester sends before waiting for the next
+ * flow control frame. 0 means all consecutive frames without further flow
+ * control.
+ * \par Type:
+ * int
+ * \par Range:
+ * 0 <= x <= 255
+ * \par Default:
+ * 8
+*/
+#define ISOTP_BLOCK_SIZE                8
+
+/**
+ * @ingroup CONFIG_ISOTP
+ * Minimum separation time sent in the flow control frames of multi-frame
+ * requests, coded as in ISO 15765-2: 0x00 - 0x7F = 0 - 127ms,
+ * 0xF1 - 0xF9 = 100 - 900us
+ * \par Type:
+ * int
+ * \par Default:
+ * 0
+*/
+#define ISOTP_STMIN                     0x00
+
+/**
+ * @ingroup CONFIG_ISOTP
+ * Maximum time waiting for a flow control frame of the tester (N_Bs) or for
+ * the next consecutive frame of a request (N_Cr). The transfer is aborted
+ * afterwards.
+ * \par Type:
+ * int
+ * \par Unit:
+ * ms
+ * \par Default:
+ * 1000
+*/
+#define ISOTP_TIMEOUT_MS                1000
+
+/**
+ * @ingroup CONFIG_ISOTP
+ * Maximum number of consecutive flow control frames with flow status WAIT
+ * accepted from the tester (N_WFTmax)
+ * \par Type:
+ * int
+ * \par Default:
+ * 10
+*/
+#define ISOTP_MAX_WAIT_FRAMES           10
+
+/**
+ * @ingroup CONFIG_ISOTP
+ * Maximum number of frames passed to the CAN0 transmit buffer per call of
+ * ISOTP_Trigger() for all sessions together, keeps room in the buffer for
+ * the messages of the CANS. With a tester STmin of 0, 4 frames every 10ms
+ * transfer 2.8kB/s, e.g., the cell voltages of 432 cells in about 0.4s.
+ * \par Type:
+ * int
+ * \par Range:
+ * 0 < x < CAN0_TRANSMIT_BUFFER_LENGTH
+ * \par Default:
+ * CAN0_TRANSMIT_BUFFER_LENGTH / 4
+*/
+#define ISOTP_MAX_FRAMES_PER_TICK       (CAN0_TRANSMIT_BUFFER_LENGTH / 4)
+
+/**
+ * @ingroup CONFIG_ISOTP
+ * Value of the unused bytes of the frames, all frames are sent with 8 bytes
+ * \par Type:
+ * int
+ * \par Default:
+ * 0xCC
+*/
+#define ISOTP_PADDING                   0xCC
+
+/**
+ * @ingroup CONFIG_ISOTP
+ * Size of the request buffer of each session. Longer requests are rejected
+ * with flow status overflow.
+ * \par Type:
+ * int
+ * \par Unit:
+ * byte
+ * \par Default:
+ * 64
+*/
+#define ISOTP_RX_BUFFER_LENGTH          64
+
+/**
+ * @ingroup CONFIG_ISOTP
+ * Size of the response buffer of each session. Must hold the largest
+ * database block plus 3 bytes, e.g., the SOH block of 432 cells needs
+ * 3.5kB. Longer responses are rejected with NRC responseTooLong.
+ * \par Type:
+ * int
+ * \par Unit:
+ * byte
+ * \par Range:
+ * 8 <= x <= 4095
+ * \par Default:
+ * 4095
+*/
+#define ISOTP_TX_BUFFER_LENGTH          4095
+
+/**
+ * service identifiers and negative response codes as in ISO 14229-1
+ */
+#define ISOTP_SID_READ_DATA_BY_ID           0x22
+#define ISOTP_SID_NEGATIVE_RESPONSE         0x7F
+#define ISOTP_POSITIVE_RESPONSE_OFFSET      0x40
+
+#define ISOTP_NRC_SERVICE_NOT_SUPPORTED     0x11
+#define ISOTP_NRC_INCORRECT_LENGTH          0x13
+#define ISOTP_NRC_RESPONSE_TOO_LONG         0x14
+#define ISOTP_NRC_REQUEST_OUT_OF_RANGE      0x31
+
+/**
+ * data identifier groups of the ReadDataByIdentifier service, the low byte
+ * of the identifier selects the database block or EEPROM channel
+ */
+#define ISOTP_DID_DATABASE_BLOCK            0x0100
+#define ISOTP_DID_EEPROM_CHANNEL            0x0200
+#define ISOTP_DID_DIAG_MEMORY               0x0300
+
+/**
+ * identifiers of a session
+ */
+typedef struct {
+    uint32_t rx_id;     /*!< CAN identifier of the requests     */
+    uint32_t tx_id;     /*!< CAN identifier of the responses    */
+} ISOTP_SESSION_CFG_s;
+
+/*================== Constant and Variable Definitions ====================*/
+extern const ISOTP_SESSION_CFG_s isotp_session_cfg[ISOTP_NR_OF_SESSIONS];
+
+/*================== Function Prototypes ==================================*/
+
+/**
+ * @brief   processes a complete request of a session
+ *
+ * @details Supported is the service ReadDataByIdentifier (0x22) with one data
+ *          identifier:
+ *          0x01nn: database block nn (DATA_BLOCK_ID_TYPE_e)
+ *          0x02nn: backup SRAM mirror of EEPROM channel nn (EEPR_CHANNEL_ID_TYPE_e)
+ *          0x0300: DIAG error entries, oldest first (DIAG_ERROR_ENTRY_s)
+ *          The data is sent in the memory layout of the microcontroller
+ *          (little endian, structures including padding).
+ *
+ * @param   request         request data starting with the service identifier
+ * @param   length          length of the request
+ * @param   response        buffer for the response
+ * @param   max_length      size of the response buffer
+ *
+ * @return  length of the response
+ */
+extern uint16_t ISOTP_ServiceRequest(const uint8_t *request, uint16_t length, uint8_t *response, uint16_t max_length);
+
+/*================== Function Implementations =============================*/
+
+#endif /* ISOTP_CFG_H_ */
@@ -38,6 +38,9 @@
 #include "cmsis_os.h"
 #include "database.h"
 #include "batterysystem_cfg.h"
+#include "sm.h"
+#include "lmon.h"
+#include "ffr.h"
 /*================== Macros and Definitions ===============================*/
 
 /**
@@ -46,12 +49,6 @@
  */
 static DATA_BLOCK_CURRENT_s cont_current_tab = {0};
 
-/**
- * Saves the last state and the last substate
- */
-#define CONT_SAVELASTSTATES()   cont_state.laststate = cont_state.state; \
-                                cont_state.lastsubstate = cont_state.substate;
-
 #define CONT_OPENALLCONTACTORS()   CONT_SwitchAllContactorsOff();
 
 #define CONT_OPENMINUS()       CONT_SetContactorState(CONT_MINUS_MAIN, CONT_SWITCH_OFF);
@@ -74,36 +71,121 @@ static DATA_BLOCK_CURRENT_s cont_current_tab = {0};
 #define CONT_CLOSECHARGEPRECHARGE()       CONT_SetContactorState(CONT_CHARGE_PLUS_PRECHARGE, CONT_SWITCH_ON);
 #endif // BS_SEPARATE_POWERLINES == 1
 
+/*================== Function Prototypes ==================================*/
+
+static uint8_t CONT_CheckStateRequest(uint8_t statereq);
+static void CONT_CheckFeedback(void);
+static STD_RETURN_TYPE_e CONT_CheckVoltages(void);
+
+static uint8_t CONT_IsOpeningSequenceFinished(void);
+static void CONT_Cyclic(void);
+static void CONT_ExitUninitialized(void);
+static void CONT_EntryInitialization(void);
+static void CONT_EntryOpenContactors(void);
+static void CONT_RunOpenSequence(void);
+static void CONT_RunPrecharge(void);
+
 /*================== Constant and Variable Definitions ====================*/
 
 /**
- * contains the state of the contactor state machine
+ * contains the contactor specific variables of the contactor state machine
  *
  */
 static CONT_STATE_s cont_state = {
+    .OscillationCounter     = 0,
+    .PrechargeTryCounter    = 0,
+    .PrechargeTimeOut       = 0,
+};
+
+static const SM_TRANSITION_s cont_uninitialized_transitions[] = {
+    {CONT_STATE_INIT_REQUEST,       NULL_PTR,                           CONT_STATEMACH_INITIALIZATION,      CONT_STATEMACH_SHORTTIME_MS},
+    {SM_REQ_ANY,                    NULL_PTR,                           SM_STATE_REJECT,                    0},
+};
+
+static const SM_TRANSITION_s cont_initialization_transitions[] = {
+    {SM_REQ_NONE,                   NULL_PTR,                           CONT_STATEMACH_INITIALIZED,         CONT_STATEMACH_SHORTTIME_MS},
+};
+
+static const SM_TRANSITION_s cont_initialized_transitions[] = {
+    {SM_REQ_NONE,                   NULL_PTR,                           CONT_STATEMACH_IDLE,                CONT_STATEMACH_SHORTTIME_MS},
+};
+
+static const SM_TRANSITION_s cont_idle_transitions[] = {
+    {SM_REQ_NONE,                   NULL_PTR,                           CONT_STATEMACH_STANDBY,             CONT_STATEMACH_SHORTTIME_MS},
+};
+
+/* requests are only processed once all contactors are open */
+static const SM_TRANSITION_s cont_standby_transitions[] = {
+    {CONT_STATE_STANDBY_REQUEST,    CONT_IsOpeningSequenceFinished,     SM_STATE_STAY,                      0},
+    {CONT_STATE_NORMAL_REQUEST,     CONT_IsOpeningSequenceFinished,     CONT_STATEMACH_PRECHARGE,           CONT_STATEMACH_SHORTTIME_MS},
+#if BS_SEPARATE_POWERLINES == 1
+    {CONT_STATE_CHARGE_REQUEST,     CONT_IsOpeningSequenceFinished,     CONT_STATEMACH_CHARGE_PRECHARGE,    CONT_STATEMACH_SHORTTIME_MS},
+#endif // BS_SEPARATE_POWERLINES == 1
+    {CONT_STATE_ERROR_REQUEST,      CONT_IsOpeningSequenceFinished,     CONT_STATEMACH_ERROR,               CONT_STATEMACH_SHORTTIME_MS},
+    {SM_REQ_ANY,                    CONT_IsOpeningSequenceFinished,     SM_STATE_REJECT,                    0},
+};
+
+/* PRECHARGE, NORMAL, CHARGE_PRECHARGE and CHARGE can be interrupted anytime */
+static const SM_TRANSITION_s cont_closed_transitions[] = {
+    {CONT_STATE_ERROR_REQUEST,      NULL_PTR,                           CONT_STATEMACH_ERROR,               CONT_STATEMACH_SHORTTIME_MS},
+    {CONT_STATE_STANDBY_REQUEST,    NULL_PTR,                           CONT_STATEMACH_STANDBY,             CONT_STATEMACH_SHORTTIME_MS},
+    {SM_REQ_ANY,                    NULL_PTR,                           SM_STATE_STAY,                      0},
+};
+
+static const SM_TRANSITION_s cont_error_transitions[] = {
+    {CONT_STATE_ERROR_REQUEST,      CONT_IsOpeningSequenceFinished,     SM_STATE_STAY,                      0},
+    {CONT_STATE_STANDBY_REQUEST,    CONT_IsOpeningSequenceFinished,     CONT_STATEMACH_STANDBY,             CONT_STATEMACH_SHORTTIME_MS},
+    {SM_REQ_ANY,                    CONT_IsOpeningSequenceFinished,     SM_STATE_REJECT,                    0},
+};
+
+/**
+ * state table of the CONT state machine, the first entry is the initial state
+ */
+static const SM_STATE_s cont_states[] = {
+    /* id                               entry                       run                     exit        timeout, target, substate   transitions */
+    {CONT_STATEMACH_UNINITIALIZED,      NULL_PTR,                   NULL_PTR,               CONT_ExitUninitialized, 0, 0, 0,    cont_uninitialized_transitions,     SM_NR_OF(cont_uninitialized_transitions)},
+    {CONT_STATEMACH_INITIALIZATION,     CONT_EntryInitialization,   NULL_PTR,               NULL_PTR,   0, 0, 0,    cont_initialization_transitions,    SM_NR_OF(cont_initialization_transitions)},
+    {CONT_STATEMACH_INITIALIZED,        NULL_PTR,                   NULL_PTR,               NULL_PTR,   0, 0, 0,    cont_initialized_transitions,       SM_NR_OF(cont_initialized_transitions)},
+    {CONT_STATEMACH_IDLE,               NULL_PTR,                   NULL_PTR,               NULL_PTR,   0, 0, 0,    cont_idle_transitions,              SM_NR_OF(cont_idle_transitions)},
+    {CONT_STATEMACH_STANDBY,            CONT_EntryOpenContactors,   CONT_RunOpenSequence,   NULL_PTR,   0, 0, 0,    cont_standby_transitions,           SM_NR_OF(cont_standby_transitions)},
+    {CONT_STATEMACH_PRECHARGE,          NULL_PTR,                   CONT_RunPrecharge,      NULL_PTR,   0, 0, 0,    cont_closed_transitions,            SM_NR_OF(cont_closed_transitions)},
+    {CONT_STATEMACH_NORMAL,             NULL_PTR,                   NULL_PTR,               NULL_PTR,   0, 0, 0,    cont_closed_transitions,            SM_NR_OF(cont_closed_transitions)},
+#if BS_SEPARATE_POWERLINES == 1
+    {CONT_STATEMACH_CHARGE_PRECHARGE,   NULL_PTR,                   CONT_RunPrecharge,      NULL_PTR,   0, 0, 0,    cont_closed_transitions,            SM_NR_OF(cont_closed_transitions)},
+    {CONT_STATEMACH_CHARGE,             NULL_PTR,                   NULL_PTR,               NULL_PTR,   0, 0, 0,    cont_closed_transitions,            SM_NR_OF(cont_closed_transitions)},
+#endif // BS_SEPARATE_POWERLINES == 1
+    {CONT_STATEMACH_ERROR,              CONT_EntryOpenContactors,   CONT_RunOpenSequence,   NULL_PTR,   0, 0, 0,    cont_error_transitions,             SM_NR_OF(cont_error_transitions)},
+};
+
+static const SM_CONFIG_s cont_sm_cfg = {
+    .states         = cont_states,
+    .nr_states      = SM_NR_OF(cont_states),
+    .cyclic         = CONT_Cyclic,
+    .cycletime      = CONT_TASK_CYCLE_CONTEXT_MS,
+    .noreq          = CONT_STATE_NO_REQUEST,
+};
+
+/**
+ * contains the state of the contactor state machine
+ */
+static SM_MACHINE_s cont_sm = {
+    .cfg                    = &cont_sm_cfg,
     .timer                  = 0,
     .statereq               = CONT_STATE_NO_REQUEST,
-    .state                  = CONT_STATEMACH_UNINITIALIZED,
+    .index                  = 0,
     .substate               = CONT_ENTRY,
     .laststate              = CONT_STATEMACH_UNINITIALIZED,
     .lastsubstate           = 0,
+    .entrypending           = FALSE,
     .triggerentry           = 0,
     .ErrRequestCounter      = 0,
-    .OscillationCounter     = 0,
-    .PrechargeTryCounter    = 0,
-    .PrechargeTimeOut       = 0,
-    .counter                = 0,
 };
 
+/**
+ * limit monitors of the contactor feedbacks, the monitored value is 1 on a feedback mismatch
+ */
+static LMON_MONITOR_s cont_feedback_lmon[BS_NR_OF_CONTACTORS];
 
-/*================== Function Prototypes ==================================*/
-
-static CONT_RETURN_TYPE_e CONT_CheckStateRequest(CONT_STATE_REQUEST_e statereq);
-static CONT_STATE_REQUEST_e CONT_GetStateRequest(void);
-static CONT_STATE_REQUEST_e CONT_TransferStateRequest(void);
-static uint8_t CONT_CheckReEntrance(void);
-static void CONT_CheckFeedback(void);
-static STD_RETURN_TYPE_e CONT_CheckVoltages(void);
 
 /*================== Function Implementations =============================*/
 
@@ -222,52 +304,6 @@ STD_RETURN_TYPE_e CONT_SwitchAllContactorsOff(void) {
 
 
 
-/**
- * @brief   re-entrance check of CONT state machine trigger function
- *
- * @details This function is not re-entrant and should only be called time- or event-triggered. It
- *          increments the triggerentry counter from the state variable ltc_state.
- *          It should never be called by two different processes, so if it is the case,
- *          triggerentry should never be higher than 0 when this function is called.
- *
- *
- * @return  0 if no further instance of the function is active, 0xff else
- *
- */
-static uint8_t CONT_CheckReEntrance(void) {
-    uint8_t retval = 0;
-
-    taskENTER_CRITICAL();
-    if (!cont_state.triggerentry) {
-        cont_state.triggerentry++;
-    } else {
-        retval = 0xFF;
-    }
-    taskEXIT_CRITICAL();
-    return retval;
-}
-
-
-
-
-/**
- * @brief   gets the current state request.
- *
- * @details This function is used in the functioning of the CONT state machine.
- *
- * @return  return the current pending state request
- */
-static CONT_STATE_REQUEST_e CONT_GetStateRequest(void) {
-    CONT_STATE_REQUEST_e retval = CONT_STATE_NO_REQUEST;
-
-    taskENTER_CRITICAL();
-    retval = cont_state.statereq;
-    taskEXIT_CRITICAL();
-
-    return retval;
-}
-
-
 /**
  * @brief   gets the current state.
  *
@@ -276,34 +312,12 @@ static CONT_STATE_REQUEST_e CONT_GetStateRequest(void) {
  * @return  current state, taken from CONT_STATEMACH_e
  */
 CONT_STATEMACH_e CONT_GetState(void) {
-    return (cont_state.state);
+    return ((CONT_STATEMACH_e)SM_GetState(&cont_sm));
 }
 
 
-
 /**
- * @brief   transfers the current state request to the state machine.
- *
- * @details This function takes the current state request from cont_state and transfers it to the
- *          state machine. It resets the value from cont_state to CONT_STATE_NO_REQUEST
- *
- * @return  current state request, taken from CONT_STATE_REQUEST_e
- *
- */
-static CONT_STATE_REQUEST_e CONT_TransferStateRequest(void) {
-    CONT_STATE_REQUEST_e retval = CONT_STATE_NO_REQUEST;
-
-    taskENTER_CRITICAL();
-    retval    = cont_state.statereq;
-    cont_state.statereq = CONT_STATE_NO_REQUEST;
-    taskEXIT_CRITICAL();
-
-    return (retval);
-}
-
-
-/**
- * @brief   sets the current state request of the state variable cont_state.
+ * @brief   sets the current state request of the contactor state machine.
  *
  * @details This function is used to make a state request to the state machine,e.g, start voltage
  *          measurement, read result of voltage measurement, re-initialization.
@@ -316,17 +330,7 @@ static CONT_STATE_REQUEST_e CONT_TransferStateRequest(void) {
  * @return  CONT_OK if a state request was made, CONT_STATE_NO_REQUEST if no state request was made
  */
 CONT_RETURN_TYPE_e CONT_SetStateRequest(CONT_STATE_REQUEST_e statereq) {
-    CONT_RETURN_TYPE_e retVal = CONT_STATE_NO_REQUEST;
-
-    taskENTER_CRITICAL();
-    retVal = CONT_CheckStateRequest(statereq);
-
-    if (retVal == CONT_OK) {
-            cont_state.statereq   = statereq;
-    }
-    taskEXIT_CRITICAL();
-
-    return retVal;
+    return ((CONT_RETURN_TYPE_e)SM_SetStateRequest(&cont_sm, statereq, CONT_CheckStateRequest));
 }
 
 
@@ -335,43 +339,34 @@ CONT_RETURN_TYPE_e CONT_SetStateRequest(CONT_STATE_REQUEST_e statereq) {
  * @brief   checks the state requests that are made.
  *
  * @details This function checks the validity of the state requests. The results of the checked is
- *          returned immediately.
+ *          returned immediately. It is called by the state machine engine within a critical section.
  *
  * @param   statereq    state request to be checked
  *
  * @return  result of the state request that was made, taken from (type: CONT_RETURN_TYPE_e)
  */
-static CONT_RETURN_TYPE_e CONT_CheckStateRequest(CONT_STATE_REQUEST_e statereq) {
+static uint8_t CONT_CheckStateRequest(uint8_t statereq) {
     if (statereq == CONT_STATE_ERROR_REQUEST) {
         return CONT_OK;
     }
 
-    if (cont_state.statereq == CONT_STATE_NO_REQUEST) {
+    if (cont_sm.statereq == CONT_STATE_NO_REQUEST) {
         // init only allowed from the uninitialized state
         if (statereq == CONT_STATE_INIT_REQUEST) {
-            if (cont_state.state == CONT_STATEMACH_UNINITIALIZED) {
+            if (SM_GetState(&cont_sm) == CONT_STATEMACH_UNINITIALIZED) {
                 return CONT_OK;
             } else {
                 return CONT_ALREADY_INITIALIZED;
             }
         }
 
+        // no closing until the fast fault reaction is reset
+        if (((statereq == CONT_STATE_NORMAL_REQUEST) || (statereq == CONT_STATE_CHARGE_REQUEST)) && (FFR_IsTripped() == TRUE)) {
+            return CONT_ILLEGAL_REQUEST;
+        }
+
         if( (statereq == CONT_STATE_STANDBY_REQUEST) || (statereq == CONT_STATE_NORMAL_REQUEST) || (statereq == CONT_STATE_CHARGE_REQUEST)){
             return CONT_OK;
-        }
-        else if( statereq == CONT_STATE_NORMAL_REQUEST ){
-            if (cont_state.state==CONT_STATEMACH_CHARGE_PRECHARGE || cont_state.state==CONT_STATEMACH_CHARGE) {
-                return CONT_REQUEST_IMPOSSIBLE;
-            } else {
-                return CONT_OK;
-            }
-        }
-        else if( statereq == CONT_STATE_CHARGE_REQUEST ){
-            if (cont_state.state==CONT_STATEMACH_PRECHARGE || cont_state.state==CONT_STATEMACH_NORMAL) {
-                return CONT_REQUEST_IMPOSSIBLE;
-            } else {
-                return CONT_OK;
-            }
         } else {
             return CONT_ILLEGAL_REQUEST;
         }
@@ -389,16 +384,18 @@ static CONT_RETURN_TYPE_e CONT_CheckStateRequest(CONT_STATE_REQUEST_e statereq)
  *          a reentrance.
  */
 void CONT_Trigger(void) {
-    STD_RETURN_TYPE_e retVal = E_OK;
-    CONT_STATE_REQUEST_e statereq = CONT_STATE_NO_REQUEST;
-
-    if (CONT_CheckReEntrance()) {
-        return;
-    }
-
     DIAG_SysMonNotify(DIAG_SYSMON_CONT_ID, 0);  // task is running, state = ok
 
-    if (cont_state.state != CONT_STATEMACH_UNINITIALIZED) {
+    SM_Trigger(&cont_sm);
+}
+
+/**
+ * @brief   cyclic action of the CONT state machine, called on every trigger
+ *
+ * @details Checks the contactor feedback and counts down the oscillation and precharge timeouts.
+ */
+static void CONT_Cyclic(void) {
+    if (SM_GetState(&cont_sm) != CONT_STATEMACH_UNINITIALIZED) {
         CONT_CheckFeedback();
     }
 
@@ -413,432 +410,166 @@ void CONT_Trigger(void) {
             cont_state.PrechargeTimeOut = 0;
         }
     }
+}
 
-    if(cont_state.timer) {
-        if (cont_state.timer > CONT_TASK_CYCLE_CONTEXT_MS) {
-            cont_state.timer -= CONT_TASK_CYCLE_CONTEXT_MS;
-        } else {
-            cont_state.timer = 0;
-        }
-        if(cont_state.timer) {
-            cont_state.triggerentry--;
-            return;    // handle state machine only if timer has elapsed
-        }
-    }
+/**
+ * @brief   guard: all contactors are opened, requests are processed afterwards
+ */
+static uint8_t CONT_IsOpeningSequenceFinished(void) {
+    return (cont_sm.substate == CONT_STANDBY || cont_sm.substate == CONT_ERROR);
+}
 
+/**
+ * @brief   exit action of UNINITIALIZED: sets up the feedback monitors before the first check
+ */
+static void CONT_ExitUninitialized(void) {
+    LMON_Init(cont_feedback_lmon, cont_feedback_lmon_cfg, cont_contactors_config_length);
+}
 
-    switch (cont_state.state) {
-        /****************************UNINITIALIZED***********************************/
-        case CONT_STATEMACH_UNINITIALIZED:
-            // waiting for Initialization Request
-            statereq = CONT_TransferStateRequest();
-            if (statereq == CONT_STATE_INIT_REQUEST) {
-                CONT_SAVELASTSTATES();
-                cont_state.timer = CONT_STATEMACH_SHORTTIME_MS;
-                cont_state.state = CONT_STATEMACH_INITIALIZATION;
-                cont_state.substate = CONT_ENTRY;
-            } else if (statereq == CONT_STATE_NO_REQUEST) {
-                // no actual request pending //
-            } else {
-                cont_state.ErrRequestCounter++;   // illegal request pending
-            }
-            break;
+/**
+ * @brief   entry action of INITIALIZATION
+ */
+static void CONT_EntryInitialization(void) {
+    CONT_OPENALLCONTACTORS();
+    cont_sm.timer = CONT_STATEMACH_SHORTTIME_MS;
+}
 
+/**
+ * @brief   entry action of STANDBY and ERROR: opens the precharge contactors first
+ */
+static void CONT_EntryOpenContactors(void) {
+    cont_state.OscillationCounter = CONT_OSCILLATION_LIMIT;
+    CONT_OPENPRECHARGE();
+    #if BS_SEPARATE_POWERLINES == 1
+        CONT_OPENCHARGEPRECHARGE();
+    #endif
+    if (SM_GetState(&cont_sm) == CONT_STATEMACH_ERROR) {
+        SM_SetSubstate(&cont_sm, CONT_OPEN_FIRST_CONTACTOR, CONT_DELAY_BETWEEN_OPENING_CONTACTORS_MS);
+    } else {
+        SM_SetSubstate(&cont_sm, CONT_OPEN_FIRST_CONTACTOR, CONT_STATEMACH_SHORTTIME_MS);
+    }
+}
 
-        /****************************INITIALIZATION**********************************/
-        case CONT_STATEMACH_INITIALIZATION:
+/**
+ * @brief   run action of STANDBY and ERROR: opens the main contactors
+ *
+ * @details The first contactor opened depends on the current direction. The sequence ends in the
+ *          substate CONT_STANDBY or CONT_ERROR, where the state requests are processed.
+ */
+static void CONT_RunOpenSequence(void) {
+    uint8_t finalsubstate = (SM_GetState(&cont_sm) == CONT_STATEMACH_ERROR) ? CONT_ERROR : CONT_STANDBY;
+
+    if (cont_sm.substate == CONT_OPEN_FIRST_CONTACTOR) {
+        if (BS_CheckCurrent_Direction() == BS_CURRENT_DISCHARGE) {
+            CONT_OPENPLUS();
+            #if BS_SEPARATE_POWERLINES == 1
+                CONT_OPENCHARGEPLUS();
+            #endif
+            SM_SetSubstate(&cont_sm, CONT_OPEN_SECOND_CONTACTOR_MINUS, CONT_DELAY_BETWEEN_OPENING_CONTACTORS_MS);
+        } else {
+            CONT_OPENMINUS();
+            #if BS_SEPARATE_POWERLINES == 1
+                CONT_OPENCHARGEMINUS();
+            #endif
+            SM_SetSubstate(&cont_sm, CONT_OPEN_SECOND_CONTACTOR_PLUS, CONT_DELAY_BETWEEN_OPENING_CONTACTORS_MS);
+        }
+    } else if (cont_sm.substate == CONT_OPEN_SECOND_CONTACTOR_MINUS) {
+        CONT_OPENMINUS();
+        #if BS_SEPARATE_POWERLINES == 1
+            CONT_OPENCHARGEMINUS();
+        #endif
+        SM_SetSubstate(&cont_sm, finalsubstate, CONT_DELAY_AFTER_OPENING_SECOND_CONTACTORS_MS);
+    } else if (cont_sm.substate == CONT_OPEN_SECOND_CONTACTOR_PLUS) {
+        CONT_OPENPLUS();
+        #if BS_SEPARATE_POWERLINES == 1
+            CONT_OPENCHARGEPLUS();
+        #endif
+        SM_SetSubstate(&cont_sm, finalsubstate, CONT_DELAY_AFTER_OPENING_SECOND_CONTACTORS_MS);
+    }
+}
 
-            CONT_SAVELASTSTATES();
-            CONT_OPENALLCONTACTORS();
+/**
+ * @brief   run action of PRECHARGE and CHARGE_PRECHARGE: precharge sequence
+ *
+ * @details The sequence can be interrupted anytime by the transitions of the state. After
+ *          CONT_PRECHARGE_TRIES failed tries the state machine goes to ERROR.
+ */
+static void CONT_RunPrecharge(void) {
+    uint8_t charge = (SM_GetState(&cont_sm) == CONT_STATEMACH_CHARGE_PRECHARGE);
 
-            cont_state.timer = CONT_STATEMACH_SHORTTIME_MS;
-            cont_state.state = CONT_STATEMACH_INITIALIZED;
-            cont_state.substate = CONT_ENTRY;
-
-            break;
-
-        /****************************INITIALIZED*************************************/
-        case CONT_STATEMACH_INITIALIZED:
-            CONT_SAVELASTSTATES();
-            cont_state.timer = CONT_STATEMACH_SHORTTIME_MS;
-            cont_state.state = CONT_STATEMACH_IDLE;
-            cont_state.substate = CONT_ENTRY;
-            break;
-
-        /****************************IDLE*************************************/
-        case CONT_STATEMACH_IDLE:
-            CONT_SAVELASTSTATES();
-            cont_state.timer = CONT_STATEMACH_SHORTTIME_MS;
-            cont_state.state = CONT_STATEMACH_STANDBY;
-            cont_state.substate = CONT_ENTRY;
-            break;
-
-        /****************************STANDBY*************************************/
-        case CONT_STATEMACH_STANDBY:
-            CONT_SAVELASTSTATES();
-
-            //first precharge process
-            if (cont_state.substate == CONT_ENTRY){
-                cont_state.OscillationCounter = CONT_OSCILLATION_LIMIT;
-                CONT_OPENPRECHARGE();
-                #if BS_SEPARATE_POWERLINES == 1
-                    CONT_OPENCHARGEPRECHARGE();
-                #endif
-                cont_state.timer = CONT_STATEMACH_SHORTTIME_MS;
-                cont_state.substate = CONT_OPEN_FIRST_CONTACTOR;
-                break;
-            } else if (cont_state.substate == CONT_OPEN_FIRST_CONTACTOR){
-                if (BS_CheckCurrent_Direction() == BS_CURRENT_DISCHARGE){
-                    CONT_OPENPLUS();
-                    #if BS_SEPARATE_POWERLINES == 1
-                        CONT_OPENCHARGEPLUS();
-                    #endif
-                    cont_state.timer = CONT_DELAY_BETWEEN_OPENING_CONTACTORS_MS;
-                    cont_state.substate = CONT_OPEN_SECOND_CONTACTOR_MINUS;
-                } else{
-                    CONT_OPENMINUS();
-                    #if BS_SEPARATE_POWERLINES == 1
-                        CONT_OPENCHARGEMINUS();
-                    #endif
-                    cont_state.timer = CONT_DELAY_BETWEEN_OPENING_CONTACTORS_MS;
-                    cont_state.substate = CONT_OPEN_SECOND_CONTACTOR_PLUS;
-                }
-                break;
-            } else if (cont_state.substate == CONT_OPEN_SECOND_CONTACTOR_MINUS){
-                CONT_OPENMINUS();
-                #if BS_SEPARATE_POWERLINES == 1
-                    CONT_OPENCHARGEMINUS();
-                #endif
-                cont_state.timer = CONT_DELAY_AFTER_OPENING_SECOND_CONTACTORS_MS;
-                cont_state.substate = CONT_STANDBY;
-                break;
-            } else if (cont_state.substate == CONT_OPEN_SECOND_CONTACTOR_PLUS){
-                CONT_OPENPLUS();
-                #if BS_SEPARATE_POWERLINES == 1
-                    CONT_OPENCHARGEPLUS();
-                #endif
-                cont_state.timer = CONT_DELAY_AFTER_OPENING_SECOND_CONTACTORS_MS;
-                cont_state.substate = CONT_STANDBY;
-                break;
-            } else if (cont_state.substate == CONT_STANDBY) {
-                // when process done, look for requests
-                statereq = CONT_TransferStateRequest();
-                if (statereq == CONT_STATE_STANDBY_REQUEST) {
-                    // we stay already in requested state, nothing to do
-                } else if (statereq == CONT_STATE_NORMAL_REQUEST) {
-                    CONT_SAVELASTSTATES();
-                    cont_state.timer = CONT_STATEMACH_SHORTTIME_MS;
-                    cont_state.state = CONT_STATEMACH_PRECHARGE;
-                    cont_state.substate = CONT_ENTRY;
-                }
+    if (cont_sm.substate == CONT_ENTRY) {
+        if (cont_state.OscillationCounter > 0) {
+            cont_sm.timer = CONT_STATEMACH_SHORTTIME_MS;
+        } else {
+            cont_state.PrechargeTryCounter = 0;
+            SM_SetSubstate(&cont_sm, CONT_PRECHARGE_CLOSE_MINUS, CONT_STATEMACH_SHORTTIME_MS);
+        }
+    } else if (cont_sm.substate == CONT_PRECHARGE_CLOSE_MINUS) {
+        cont_state.PrechargeTryCounter++;
+        cont_state.PrechargeTimeOut = CONT_PRECHARGE_TIMEOUT_MS;
+        if (charge == FALSE) {
+            CONT_CLOSEMINUS();
+        }
+#if BS_SEPARATE_POWERLINES == 1
+        else {
+            CONT_CLOSECHARGEMINUS();
+        }
+#endif // BS_SEPARATE_POWERLINES == 1
+        SM_SetSubstate(&cont_sm, CONT_PRECHARGE_CLOSE_PRECHARGE, CONT_STATEMACH_WAIT_AFTER_CLOSING_MINUS_MS);
+    } else if (cont_sm.substate == CONT_PRECHARGE_CLOSE_PRECHARGE) {
+        if (charge == FALSE) {
+            CONT_CLOSEPRECHARGE();
+        }
 #if BS_SEPARATE_POWERLINES == 1
-                else if( statereq == CONT_STATE_CHARGE_REQUEST) {
-                    CONT_SAVELASTSTATES();
-                    cont_state.timer = CONT_STATEMACH_SHORTTIME_MS;
-                    cont_state.state = CONT_STATEMACH_CHARGE_PRECHARGE;
-                    cont_state.substate = CONT_ENTRY;
-                }
+        else {
+            CONT_CLOSECHARGEPRECHARGE();
+        }
 #endif // BS_SEPARATE_POWERLINES == 1
-                else if(statereq == CONT_STATE_ERROR_REQUEST) {
-                    CONT_SAVELASTSTATES();
-                    cont_state.timer = CONT_STATEMACH_SHORTTIME_MS;
-                    cont_state.state = CONT_STATEMACH_ERROR;
-                    cont_state.substate = CONT_ENTRY;
-                } else if (statereq == CONT_STATE_NO_REQUEST) {
-                    // no actual request pending
-                } else {
-                    cont_state.ErrRequestCounter++;  // illegal request pending
-                }
-                break;
-            }
-            break;
-
-            /****************************PRECHARGE*************************************/
-            case CONT_STATEMACH_PRECHARGE:
-                CONT_SAVELASTSTATES();
-                //  check state requests
-                statereq = CONT_TransferStateRequest();
-                if (statereq == CONT_STATE_ERROR_REQUEST) {
-                    CONT_SAVELASTSTATES();
-                    cont_state.timer = CONT_STATEMACH_SHORTTIME_MS;
-                    cont_state.state = CONT_STATEMACH_ERROR;
-                    cont_state.substate = CONT_ENTRY;
-                    break;
-                }
-                if (statereq == CONT_STATE_STANDBY_REQUEST) {
-                    CONT_SAVELASTSTATES();
-                    cont_state.timer = CONT_STATEMACH_SHORTTIME_MS;
-                    cont_state.state = CONT_STATEMACH_STANDBY;
-                    cont_state.substate = CONT_ENTRY;
-                    break;
-                }
-
-                //precharge process, can be interrupted anytimeby the requests above
-                if (cont_state.substate == CONT_ENTRY){
-                    if (cont_state.OscillationCounter > 0){
-                        cont_state.timer = CONT_STATEMACH_SHORTTIME_MS;
-                        break;
-                    } else {
-                        cont_state.PrechargeTryCounter = 0;
-                        cont_state.timer = CONT_STATEMACH_SHORTTIME_MS;
-                        cont_state.substate = CONT_PRECHARGE_CLOSE_MINUS;
-                        break;
-                    }
-                } else if (cont_state.substate == CONT_PRECHARGE_CLOSE_MINUS) {
-                    cont_state.PrechargeTryCounter++;
-                    cont_state.PrechargeTimeOut = CONT_PRECHARGE_TIMEOUT_MS;
-                    CONT_CLOSEMINUS();
-                    cont_state.timer = CONT_STATEMACH_WAIT_AFTER_CLOSING_MINUS_MS;
-                    cont_state.substate = CONT_PRECHARGE_CLOSE_PRECHARGE;
-                    break;
-                } else if (cont_state.substate == CONT_PRECHARGE_CLOSE_PRECHARGE) {
-                    CONT_CLOSEPRECHARGE();
-                    cont_state.timer = CONT_STATEMACH_WAIT_AFTER_CLOSING_PRECHARGE_MS;
-                    cont_state.substate = CONT_PRECHARGE_CHECK_VOLTAGES;
-                    break;
-                } else if (cont_state.substate == CONT_PRECHARGE_CHECK_VOLTAGES) {
-                    retVal = CONT_CheckVoltages();
-                    if (retVal == E_OK) {
-                        CONT_CLOSEPLUS();
-                        cont_state.timer = CONT_STATEMACH_WAIT_AFTER_CLOSING_PLUS_MS;
-                        cont_state.substate = CONT_PRECHARGE_OPEN_PRECHARGE;
-                        break;
-                    } else if (cont_state.PrechargeTimeOut > 0) {
-                        break;
-                    } else {
-                        if (cont_state.PrechargeTryCounter < CONT_PRECHARGE_TRIES) {
-                            CONT_OPENALLCONTACTORS();
-                            cont_state.timer = CONT_STATEMACH_TIMEAFTERPRECHARGEFAIL_MS;
-                            cont_state.substate = CONT_PRECHARGE_CLOSE_MINUS;
-                            break;
-                        } else {
-                            CONT_OPENALLCONTACTORS();
-                            cont_state.timer = CONT_STATEMACH_SHORTTIME_MS;
-                            cont_state.state = CONT_STATEMACH_ERROR;
-                            cont_state.substate = CONT_ENTRY;
-                            break;
-                        }
-                    }
-                } else if (cont_state.substate == CONT_PRECHARGE_OPEN_PRECHARGE) {
-                    CONT_OPENPRECHARGE();
-                    cont_state.timer = CONT_STATEMACH_WAIT_AFTER_OPENING_PRECHARGE_MS;
-                    cont_state.state = CONT_STATEMACH_NORMAL;
-                    cont_state.substate = CONT_ENTRY;
-                    break;
-                }
-
-                break;
-
-        /****************************NORMAL*************************************/
-        case CONT_STATEMACH_NORMAL:
-            CONT_SAVELASTSTATES();
-            statereq = CONT_TransferStateRequest();
-            if (statereq == CONT_STATE_ERROR_REQUEST) {
-                CONT_SAVELASTSTATES();
-                cont_state.timer = CONT_STATEMACH_SHORTTIME_MS;
-                cont_state.state = CONT_STATEMACH_ERROR;
-                cont_state.substate = CONT_ENTRY;
-                break;
+        SM_SetSubstate(&cont_sm, CONT_PRECHARGE_CHECK_VOLTAGES, CONT_STATEMACH_WAIT_AFTER_CLOSING_PRECHARGE_MS);
+    } else if (cont_sm.substate == CONT_PRECHARGE_CHECK_VOLTAGES) {
+        if (CONT_CheckVoltages() == E_OK) {
+            if (charge == FALSE) {
+                CONT_CLOSEPLUS();
             }
-            if (statereq == CONT_STATE_STANDBY_REQUEST) {
-                CONT_SAVELASTSTATES();
-                cont_state.timer = CONT_STATEMACH_SHORTTIME_MS;
-                cont_state.state = CONT_STATEMACH_STANDBY;
-                cont_state.substate = CONT_ENTRY;
-                break;
-            }
-
-            break;
-
 #if BS_SEPARATE_POWERLINES == 1
-            /****************************CHARGE_PRECHARGE*************************************/
-            case CONT_STATEMACH_CHARGE_PRECHARGE:
-                CONT_SAVELASTSTATES();
-
-                //check state requests
-                statereq=CONT_TransferStateRequest();
-                if (statereq == CONT_STATE_ERROR_REQUEST){
-                    CONT_SAVELASTSTATES();
-                    cont_state.timer = CONT_STATEMACH_SHORTTIME_MS;
-                    cont_state.state = CONT_STATEMACH_ERROR;
-                    cont_state.substate = CONT_ENTRY;
-                    break;
-                }
-                if(statereq == CONT_STATE_STANDBY_REQUEST){
-                    CONT_SAVELASTSTATES();
-                    cont_state.timer = CONT_STATEMACH_SHORTTIME_MS;
-                    cont_state.state = CONT_STATEMACH_STANDBY;
-                    cont_state.substate = CONT_ENTRY;
-                    break;
-                }
-
-                //precharge process, can be interrupted anytimeby the requests above
-                if (cont_state.substate == CONT_ENTRY){
-                    if (cont_state.OscillationCounter > 0){
-                        cont_state.timer = CONT_STATEMACH_SHORTTIME_MS;
-                        break;
-                    } else{
-                        cont_state.PrechargeTryCounter = 0;
-                        cont_state.timer = CONT_STATEMACH_SHORTTIME_MS;
-                        cont_state.substate = CONT_PRECHARGE_CLOSE_MINUS;
-                        break;
-                    }
-                } else if (cont_state.substate == CONT_PRECHARGE_CLOSE_MINUS){
-                    cont_state.PrechargeTryCounter++;
-                    cont_state.PrechargeTimeOut = CONT_PRECHARGE_TIMEOUT_MS;
-                    CONT_CLOSECHARGEMINUS();
-                    cont_state.timer = CONT_STATEMACH_WAIT_AFTER_CLOSING_MINUS_MS;
-                    cont_state.substate = CONT_PRECHARGE_CLOSE_PRECHARGE;
-                    break;
-                }
-                else if (cont_state.substate == CONT_PRECHARGE_CLOSE_PRECHARGE){
-                    CONT_CLOSECHARGEPRECHARGE();
-                    cont_state.timer = CONT_STATEMACH_WAIT_AFTER_CLOSING_PRECHARGE_MS;
-                    cont_state.substate = CONT_PRECHARGE_CHECK_VOLTAGES;
-                    break;
-                } else if (cont_state.substate == CONT_PRECHARGE_CHECK_VOLTAGES){
-                    retVal = CONT_CheckVoltages();
-                    if (retVal == E_OK){
-                        CONT_CLOSECHARGEPLUS();
-                        cont_state.timer = CONT_STATEMACH_WAIT_AFTER_CLOSING_PLUS_MS;
-                        cont_state.substate = CONT_PRECHARGE_OPEN_PRECHARGE;
-                        break;
-                    } else if (cont_state.PrechargeTimeOut>0){
-                        break;
-                    } else{
-                        if (cont_state.PrechargeTryCounter < CONT_PRECHARGE_TRIES){
-                            CONT_OPENALLCONTACTORS();
-                            cont_state.timer = CONT_STATEMACH_TIMEAFTERPRECHARGEFAIL_MS;
-                            cont_state.substate = CONT_PRECHARGE_CLOSE_MINUS;
-                            break;
-                        } else{
-                            CONT_OPENALLCONTACTORS();
-                            cont_state.timer = CONT_STATEMACH_SHORTTIME_MS;
-                            cont_state.state = CONT_STATEMACH_ERROR;
-                            cont_state.substate = CONT_ENTRY;
-                            break;
-                        }
-                    }
-                }
-                else if (cont_state.substate == CONT_PRECHARGE_OPEN_PRECHARGE){
-                    CONT_OPENCHARGEPRECHARGE();
-                    cont_state.timer = CONT_STATEMACH_WAIT_AFTER_OPENING_PRECHARGE_MS;
-                    cont_state.state = CONT_STATEMACH_CHARGE;
-                    cont_state.substate = CONT_ENTRY;
-                    break;
-                }
-
-                break;
-
-        /****************************CHARGE*************************************/
-        case CONT_STATEMACH_CHARGE:
-            CONT_SAVELASTSTATES();
-
-            statereq=CONT_TransferStateRequest();
-            if (statereq == CONT_STATE_ERROR_REQUEST){
-                CONT_SAVELASTSTATES();
-                cont_state.timer = CONT_STATEMACH_SHORTTIME_MS;
-                cont_state.state = CONT_STATEMACH_ERROR;
-                cont_state.substate = CONT_ENTRY;
-                break;
-            }
-            if(statereq == CONT_STATE_STANDBY_REQUEST){
-                CONT_SAVELASTSTATES();
-                cont_state.timer = CONT_STATEMACH_SHORTTIME_MS;
-                cont_state.state = CONT_STATEMACH_STANDBY;
-                cont_state.substate = CONT_ENTRY;
-                break;
+            else {
+                CONT_CLOSECHARGEPLUS();
             }
-
-            break;
 #endif // BS_SEPARATE_POWERLINES == 1
-
-        /****************************ERROR*************************************/
-        case CONT_STATEMACH_ERROR:
-            CONT_SAVELASTSTATES();
-
-            //first error process
-            if (cont_state.substate == CONT_ENTRY){
-                cont_state.OscillationCounter = CONT_OSCILLATION_LIMIT;
-                CONT_OPENPRECHARGE();
-                #if BS_SEPARATE_POWERLINES == 1
-                    CONT_OPENCHARGEPRECHARGE();
-                #endif
-                cont_state.timer = CONT_DELAY_BETWEEN_OPENING_CONTACTORS_MS;
-                cont_state.substate = CONT_OPEN_FIRST_CONTACTOR;
-                break;
-
-            } else if (cont_state.substate == CONT_OPEN_FIRST_CONTACTOR) {
-                if (BS_CheckCurrent_Direction() == BS_CURRENT_DISCHARGE) {
-                    CONT_OPENPLUS();
-                    #if BS_SEPARATE_POWERLINES == 1
-                        CONT_OPENCHARGEPLUS();
-                    #endif
-                    cont_state.timer = CONT_DELAY_BETWEEN_OPENING_CONTACTORS_MS;
-                    cont_state.substate = CONT_OPEN_SECOND_CONTACTOR_MINUS;
-                } else {
-                    CONT_OPENMINUS();
-                    #if BS_SEPARATE_POWERLINES == 1
-                        CONT_OPENCHARGEMINUS();
-                    #endif
-                    cont_state.timer = CONT_DELAY_BETWEEN_OPENING_CONTACTORS_MS;
-                    cont_state.substate = CONT_OPEN_SECOND_CONTACTOR_PLUS;
-                }
-                break;
-
-            } else if (cont_state.substate == CONT_OPEN_SECOND_CONTACTOR_MINUS) {
-                CONT_OPENMINUS();
-                #if BS_SEPARATE_POWERLINES == 1
-                    CONT_OPENCHARGEMINUS();
-                #endif
-                cont_state.timer = CONT_DELAY_AFTER_OPENING_SECOND_CONTACTORS_MS;
-                cont_state.substate = CONT_ERROR;
-                break;
-
-            } else if (cont_state.substate == CONT_OPEN_SECOND_CONTACTOR_PLUS) {
-                CONT_OPENPLUS();
-                #if BS_SEPARATE_POWERLINES == 1
-                    CONT_OPENCHARGEPLUS();
-                #endif
-                cont_state.timer = CONT_DELAY_AFTER_OPENING_SECOND_CONTACTORS_MS;
-                cont_state.substate = CONT_ERROR;
-                break;
-
-            } else if (cont_state.substate == CONT_ERROR) {
-                // when process done, look for requests
-                statereq = CONT_TransferStateRequest();
-                if (statereq == CONT_STATE_ERROR_REQUEST) {
-                    // we stay already in requested state, nothing to do
-                } else if (statereq == CONT_STATE_STANDBY_REQUEST) {
-                    CONT_SAVELASTSTATES();
-                    cont_state.timer = CONT_STATEMACH_SHORTTIME_MS;
-                    cont_state.state = CONT_STATEMACH_STANDBY;
-                    cont_state.substate = CONT_ENTRY;
-                } else if (statereq == CONT_STATE_NO_REQUEST) {
-                    // no actual request pending
-                } else {
-                    cont_state.ErrRequestCounter++;   // illegal request pending
-                }
-                break;
-            }
-            break;
-
-        default:
-            break;
-    }  // end switch(cont_state.state)
-
-    cont_state.triggerentry--;
-    cont_state.counter++;
+            SM_SetSubstate(&cont_sm, CONT_PRECHARGE_OPEN_PRECHARGE, CONT_STATEMACH_WAIT_AFTER_CLOSING_PLUS_MS);
+        } else if (cont_state.PrechargeTimeOut > 0) {
+            // wait for the voltages to settle
+        } else if (cont_state.PrechargeTryCounter < CONT_PRECHARGE_TRIES) {
+            CONT_OPENALLCONTACTORS();
+            SM_SetSubstate(&cont_sm, CONT_PRECHARGE_CLOSE_MINUS, CONT_STATEMACH_TIMEAFTERPRECHARGEFAIL_MS);
+        } else {
+            CONT_OPENALLCONTACTORS();
+            SM_Transition(&cont_sm, CONT_STATEMACH_ERROR, CONT_STATEMACH_SHORTTIME_MS);
+        }
+    } else if (cont_sm.substate == CONT_PRECHARGE_OPEN_PRECHARGE) {
+        if (charge == FALSE) {
+            CONT_OPENPRECHARGE();
+            SM_Transition(&cont_sm, CONT_STATEMACH_NORMAL, CONT_STATEMACH_WAIT_AFTER_OPENING_PRECHARGE_MS);
+        }
+#if BS_SEPARATE_POWERLINES == 1
+        else {
+            CONT_OPENCHARGEPRECHARGE();
+            SM_Transition(&cont_sm, CONT_STATEMACH_CHARGE, CONT_STATEMACH_WAIT_AFTER_OPENING_PRECHARGE_MS);
+        }
+#endif // BS_SEPARATE_POWERLINES == 1
+    }
 }
 
 /**
  * @brief   checks the feedback of the contactors
  *
- * @details makes a DIAG entry for each contactor when the feedback does not match the set value
+ * @details passes a mismatch between feedback and set value of each contactor to its limit
+ *          monitor, which makes the debounced DIAG entry
  */
 void CONT_CheckFeedback(void) {
     DATA_BLOCK_CONTFEEDBACK_s contfeedback_tab;
     CONT_ELECTRICAL_STATE_TYPE_s feedback;
+    int32_t mismatch[BS_NR_OF_CONTACTORS];
     uint16_t contactor_feedback_state = 0;
 
     DB_ReadBlock(&contfeedback_tab, DATA_BLOCK_ID_CONTFEEDBACK);
@@ -874,61 +605,11 @@ void CONT_CheckFeedback(void) {
         contfeedback_tab.contactor_feedback &= (~0x3F);
         contfeedback_tab.contactor_feedback |= contactor_feedback_state;
 
-        if (feedback != CONT_GetContactorSetValue(i) ) {
-
-            switch(i){
-                case CONT_PLUS_MAIN:
-                    DIAG_Handler(DIAG_CH_CONTACTOR_MAIN_PLUS_FEEDBACK,DIAG_EVENT_NOK,0, NULL_PTR);
-                    break;
-                case CONT_MINUS_MAIN:
-                    DIAG_Handler(DIAG_CH_CONTACTOR_MAIN_MINUS_FEEDBACK,DIAG_EVENT_NOK,0, NULL_PTR);
-                    break;
-                case CONT_PLUS_PRECHARGE:
-                    DIAG_Handler(DIAG_CH_CONTACTOR_PRECHARGE_FEEDBACK,DIAG_EVENT_NOK,0, NULL_PTR);
-                    break;
-#if BS_SEPARATE_POWERLINES == 1
-                case CONT_CHARGE_PLUS_MAIN:
-                    DIAG_Handler(DIAG_CH_CONTACTOR_CHARGE_MAIN_PLUS_FEEDBACK,DIAG_EVENT_NOK,0, NULL_PTR);
-                    break;
-                case CONT_CHARGE_MINUS_MAIN:
-                    DIAG_Handler(DIAG_CH_CONTACTOR_CHARGE_MAIN_MINUS_FEEDBACK,DIAG_EVENT_NOK,0, NULL_PTR);
-                    break;
-                case CONT_CHARGE_PLUS_PRECHARGE:
-                    DIAG_Handler(DIAG_CH_CONTACTOR_CHARGE_PRECHARGE_FEEDBACK,DIAG_EVENT_NOK,0, NULL_PTR);
-                    break;
-#endif // BS_SEPARATE_POWERLINES == 1
-                default:
-                    break;
-            }
-        }
-        else{
-            switch(i){
-                case CONT_PLUS_MAIN:
-                    DIAG_Handler(DIAG_CH_CONTACTOR_MAIN_PLUS_FEEDBACK,DIAG_EVENT_OK,0, NULL_PTR);
-                    break;
-                case CONT_MINUS_MAIN:
-                    DIAG_Handler(DIAG_CH_CONTACTOR_MAIN_MINUS_FEEDBACK,DIAG_EVENT_OK,0, NULL_PTR);
-                    break;
-                case CONT_PLUS_PRECHARGE:
-                    DIAG_Handler(DIAG_CH_CONTACTOR_PRECHARGE_FEEDBACK,DIAG_EVENT_OK,0, NULL_PTR);
-                    break;
-#if BS_SEPARATE_POWERLINES == 1
-                case CONT_CHARGE_PLUS_MAIN:
-                    DIAG_Handler(DIAG_CH_CONTACTOR_CHARGE_MAIN_PLUS_FEEDBACK,DIAG_EVENT_OK,0, NULL_PTR);
-                    break;
-                case CONT_CHARGE_MINUS_MAIN:
-                    DIAG_Handler(DIAG_CH_CONTACTOR_CHARGE_MAIN_MINUS_FEEDBACK,DIAG_EVENT_OK,0, NULL_PTR);
-                    break;
-                case CONT_CHARGE_PLUS_PRECHARGE:
-                    DIAG_Handler(DIAG_CH_CONTACTOR_CHARGE_PRECHARGE_FEEDBACK,DIAG_EVENT_OK,0, NULL_PTR);
-                    break;
-#endif // BS_SEPARATE_POWERLINES == 1
-                default:
-                    break;
-            }
-        }
+        mismatch[i] = (feedback != CONT_GetContactorSetValue(i)) ? 1 : 0;
     }
 
+    LMON_Evaluate(cont_feedback_lmon, mismatch, cont_contactors_config_length);
+
     DB_WriteBlock(&contfeedback_tab, DATA_BLOCK_ID_CONTFEEDBACK);
 }
 
@@ -179,22 +179,13 @@ typedef enum {
 } CONT_RETURN_TYPE_e;
 
 /**
- * This structure contains all the variables relevant for the CONT state machine.
- * The user can get the current state of the CONT state machine with this variable
+ * This structure contains the contactor specific variables of the CONT state machine.
+ * The generic part (state, substate, timer, requests) is handled by the state machine engine.
  */
 typedef struct {
-    uint16_t timer;                          /*!< time in ms before the state machine processes the next state, e.g. in counts of 1ms    */
-    CONT_STATE_REQUEST_e statereq;           /*!< current state request made to the state machine                                        */
-    CONT_STATEMACH_e state;                  /*!< state of Driver State Machine                                                          */
-    CONT_STATEMACH_SUB_e substate;           /*!< current substate of the state machine                                                  */
-    CONT_STATEMACH_e laststate;              /*!< previous state of the state machine                                                    */
-    CONT_STATEMACH_SUB_e lastsubstate;       /*!< previous substate of the state machine                                                 */
-    uint32_t ErrRequestCounter;              /*!< counts the number of illegal requests to the LTC state machine    */
     uint16_t OscillationCounter;             /*!< timeout to prevent oscillation of contactors */
     uint8_t PrechargeTryCounter;             /*!< timeout to prevent oscillation of contactors */
     uint16_t PrechargeTimeOut;               /*!< time to wait when precharge has been closed for voltages to settle */
-    uint8_t triggerentry;                    /*!< counter for re-entrance protection (function running flag) */
-    uint8_t counter;                         /*!< general purpose counter */
 } CONT_STATE_s;
 
 /*================== Function Prototypes ==================================*/
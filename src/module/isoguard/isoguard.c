@@ -80,6 +80,11 @@
  *
  */
 
+/**
+ * limit monitor of the insulation resistance
+ */
+static LMON_MONITOR_s iso_lmon;
+
 /*================== Function Prototypes ==================================*/
 
 
@@ -90,6 +95,7 @@ void ISO_Init(void) {
 #ifdef ISO_ISOGUARD_ENABLE
     /* Initialize Software-Module */
     IR155_Init(ISO_CYCLE_TIME);
+    LMON_Init(&iso_lmon, &iso_lmon_cfg, 1);
 
     /* Enable Hardware-Bender-Module */
     IR155_ENABLE_BENDER_HW();
@@ -125,6 +131,7 @@ void ISO_MeasureInsulation(void) {
 
     STD_RETURN_TYPE_e retVal = E_NOT_OK;
     uint32_t resistance = 0;
+    int32_t value = LMON_VALUE_HOLD;
     IR155_STATE_e state = IR155_STATE_UNDEFINED;
     static DATA_BLOCK_ISOMETER_s ISO_measData = {    // database structure
             .valid = 1,
@@ -146,8 +153,12 @@ void ISO_MeasureInsulation(void) {
         ISO_measData.valid = 0;
     }
 
-    if(retVal == E_OK && resistance > ISO_RESISTANCE_THRESHOLD &&
-            (state == IR155_RESIST_MEAS_GOOD || state == IR155_RESIST_ESTIM_GOOD)) {
+    if(retVal == E_OK && (state == IR155_RESIST_MEAS_GOOD || state == IR155_RESIST_ESTIM_GOOD)) {
+        value = (int32_t)resistance;
+    }
+    LMON_Evaluate(&iso_lmon, &value, 1);
+
+    if(value != LMON_VALUE_HOLD && LMON_GetLevel(&iso_lmon) < LMON_LEVEL_ERROR) {
         ISO_measData.state = 0;     // Good resistance measured
     } else {
         ISO_measData.state = 1;     // Invalid resistance measured or error occured;
@@ -163,3 +174,8 @@ void ISO_MeasureInsulation(void) {
     DIAG_SysMonNotify(DIAG_SYSMON_ISOGUARD_ID, 0);        // task is running, state = ok
 }
 
+
+LMON_LEVEL_e ISO_GetInsulationLevel(void) {
+    return LMON_GetLevel(&iso_lmon);
+}
+
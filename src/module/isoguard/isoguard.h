@@ -64,6 +64,14 @@ extern void ISO_ReInit(void);
  */
 extern void ISO_MeasureInsulation(void);
 
+/**
+ * @brief   gets the debounced level of the insulation resistance
+ *
+ * @return  LMON_LEVEL_WARNING if the resistance approaches ISO_RESISTANCE_THRESHOLD,
+ *          LMON_LEVEL_ERROR if it is below, otherwise LMON_LEVEL_OK
+ */
+extern LMON_LEVEL_e ISO_GetInsulationLevel(void);
+
 /*================== Function Implementations =============================*/
 
 #endif /* ISOGUARD_H_ */
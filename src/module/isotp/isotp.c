@@ -0,0 +1,406 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    isotp.c
+ * @author  foxBMS Team
+ * @date    19.10.2026 (date of creation)
+ * @ingroup DRIVERS
+ * @prefix  ISOTP
+ *
+ * @brief   ISO-TP (ISO 15765-2) transport layer on CAN0
+ *
+ */
+
+/*================== Includes =============================================*/
+#include "general.h"
+#include "isotp.h"
+
+#include "can.h"
+#include <string.h>
+
+/*================== Macros and Definitions ===============================*/
+
+#define ISOTP_FRAME_LENGTH              8
+
+/**
+ * frame types, high nibble of the first byte (protocol control information)
+ */
+#define ISOTP_PCI_SINGLE_FRAME          0x00
+#define ISOTP_PCI_FIRST_FRAME           0x10
+#define ISOTP_PCI_CONSECUTIVE_FRAME     0x20
+#define ISOTP_PCI_FLOW_CONTROL          0x30
+
+/**
+ * flow status of the flow control frames, ISOTP_FS_NONE = no flow control frame to send
+ */
+#define ISOTP_FS_CONTINUE_TO_SEND       0x00
+#define ISOTP_FS_WAIT                   0x01
+#define ISOTP_FS_OVERFLOW               0x02
+#define ISOTP_FS_NONE                   0xFF
+
+/**
+ * number of data bytes in the frame types
+ */
+#define ISOTP_SF_MAX_DATA               7
+#define ISOTP_FF_DATA                   6
+#define ISOTP_CF_DATA                   7
+
+#define ISOTP_TIMEOUT_TICKS             (ISOTP_TIMEOUT_MS / ISOTP_TICK_MS)
+
+#if (ISOTP_NR_OF_SESSIONS < 1) || (ISOTP_NR_OF_SESSIONS > 2)
+#error "ISOTP: isotp_session_cfg[] configures up to 2 sessions"
+#endif
+
+#if (ISOTP_MAX_FRAMES_PER_TICK < 1) || (ISOTP_MAX_FRAMES_PER_TICK >= CAN0_TRANSMIT_BUFFER_LENGTH)
+#error "ISOTP: ISOTP_MAX_FRAMES_PER_TICK must be within 1 and CAN0_TRANSMIT_BUFFER_LENGTH - 1"
+#endif
+
+#if (ISOTP_TX_BUFFER_LENGTH < ISOTP_FRAME_LENGTH) || (ISOTP_TX_BUFFER_LENGTH > 4095)
+#error "ISOTP: ISOTP_TX_BUFFER_LENGTH must be within 8 and 4095, first frames with 32 bit length are not supported"
+#endif
+
+/**
+ * states of a session
+ */
+typedef enum {
+    ISOTP_STATE_IDLE        = 0,    /*!< waiting for a request                              */
+    ISOTP_STATE_RX          = 1,    /*!< receiving the consecutive frames of a request      */
+    ISOTP_STATE_PROCESS     = 2,    /*!< request complete, response not processed yet       */
+    ISOTP_STATE_TX_FIRST    = 3,    /*!< single or first frame of the response to send      */
+    ISOTP_STATE_TX_WAIT_FC  = 4,    /*!< waiting for a flow control frame of the tester     */
+    ISOTP_STATE_TX          = 5,    /*!< sending the consecutive frames of the response     */
+} ISOTP_STATE_e;
+
+/**
+ * state and buffers of a session
+ */
+typedef struct {
+    ISOTP_STATE_e state;                        /*!< state of the transfer                                          */
+    uint8_t fc_status;                          /*!< flow status of the flow control frame to send                  */
+    uint8_t sn;                                 /*!< sequence number of the next consecutive frame                  */
+    uint8_t block_cnt;                          /*!< consecutive frames left until the next flow control frame      */
+    uint8_t bs;                                 /*!< block size of the tester, 0 = no further flow control frames   */
+    uint8_t stmin_ticks;                        /*!< STmin of the tester, unit: calls of ISOTP_Trigger()            */
+    uint8_t stmin_wait;                         /*!< calls to wait until the next consecutive frame                 */
+    uint8_t wait_cnt;                           /*!< flow control frames with flow status WAIT received             */
+    uint16_t timer;                             /*!< calls since the last frame of the tester                       */
+    uint16_t rx_length;                         /*!< length of the request                                          */
+    uint16_t rx_pos;                            /*!< bytes of the request received                                  */
+    uint16_t tx_length;                         /*!< length of the response                                         */
+    uint16_t tx_pos;                            /*!< bytes of the response sent                                     */
+    uint8_t rx_buf[ISOTP_RX_BUFFER_LENGTH];     /*!< request                                                        */
+    uint8_t tx_buf[ISOTP_TX_BUFFER_LENGTH];     /*!< response                                                       */
+} ISOTP_SESSION_s;
+
+/*================== Constant and Variable Definitions ====================*/
+static ISOTP_SESSION_s isotp_session[ISOTP_NR_OF_SESSIONS];
+
+/**
+ * session served first in the next call of ISOTP_Trigger()
+ */
+static uint8_t isotp_first_session = 0;
+
+/*================== Function Prototypes ==================================*/
+static uint8_t ISOTP_Transmit(uint8_t session, uint8_t budget);
+static STD_RETURN_TYPE_e ISOTP_SendFrame(uint8_t session, uint8_t *data, uint8_t length);
+static uint8_t ISOTP_GetSTminTicks(uint8_t stmin);
+
+/*================== Function Implementations =============================*/
+
+void ISOTP_Receive(uint8_t session, const uint8_t *data) {
+    ISOTP_SESSION_s *sess = NULL_PTR;
+    uint16_t length = 0;
+
+    if (session >= ISOTP_NR_OF_SESSIONS) {
+        return;
+    }
+    sess = &isotp_session[session];
+
+    switch (data[0] & 0xF0) {
+        case ISOTP_PCI_SINGLE_FRAME:
+            // a new request replaces an incomplete one, requests during a response are ignored
+            length = data[0] & 0x0F;
+            if ((length == 0) || (length > ISOTP_SF_MAX_DATA) || (sess->state > ISOTP_STATE_RX)) {
+                break;
+            }
+            memcpy(sess->rx_buf, &data[1], length);
+            sess->rx_length = length;
+            sess->fc_status = ISOTP_FS_NONE;
+            sess->state = ISOTP_STATE_PROCESS;
+            break;
+
+        case ISOTP_PCI_FIRST_FRAME:
+            length = ((data[0] & 0x0F) << 8) | data[1];
+            if (sess->state > ISOTP_STATE_RX) {
+                break;
+            }
+            if ((length == 0) || (length > ISOTP_RX_BUFFER_LENGTH)) {
+                // length 0 announces a 32 bit length, which does not fit either
+                sess->fc_status = ISOTP_FS_OVERFLOW;
+                sess->state = ISOTP_STATE_IDLE;
+                break;
+            }
+            if (length <= ISOTP_SF_MAX_DATA) {
+                sess->state = ISOTP_STATE_IDLE;
+                break;
+            }
+            memcpy(sess->rx_buf, &data[2], ISOTP_FF_DATA);
+            sess->rx_length = length;
+            sess->rx_pos = ISOTP_FF_DATA;
+            sess->sn = 1;
+            sess->block_cnt = ISOTP_BLOCK_SIZE;
+            sess->timer = 0;
+            sess->fc_status = ISOTP_FS_CONTINUE_TO_SEND;
+            sess->state = ISOTP_STATE_RX;
+            break;
+
+        case ISOTP_PCI_CONSECUTIVE_FRAME:
+            if (sess->state != ISOTP_STATE_RX) {
+                break;
+            }
+            if ((data[0] & 0x0F) != sess->sn) {
+                // lost or repeated frame, the request is discarded
+                sess->fc_status = ISOTP_FS_NONE;
+                sess->state = ISOTP_STATE_IDLE;
+                break;
+            }
+            length = sess->rx_length - sess->rx_pos;
+            if (length > ISOTP_CF_DATA) {
+                length = ISOTP_CF_DATA;
+            }
+            memcpy(&sess->rx_buf[sess->rx_pos], &data[1], length);
+            sess->rx_pos += length;
+            sess->sn = (sess->sn + 1) & 0x0F;
+            sess->timer = 0;
+            if (sess->rx_pos >= sess->rx_length) {
+                sess->state = ISOTP_STATE_PROCESS;
+            } else if (ISOTP_BLOCK_SIZE != 0) {
+                sess->block_cnt--;
+                if (sess->block_cnt == 0) {
+                    sess->block_cnt = ISOTP_BLOCK_SIZE;
+                    sess->fc_status = ISOTP_FS_CONTINUE_TO_SEND;
+                }
+            }
+            break;
+
+        case ISOTP_PCI_FLOW_CONTROL:
+            if (sess->state != ISOTP_STATE_TX_WAIT_FC) {
+                break;
+            }
+            sess->timer = 0;
+            switch (data[0] & 0x0F) {
+                case ISOTP_FS_CONTINUE_TO_SEND:
+                    sess->bs = data[1];
+                    sess->block_cnt = data[1];
+                    sess->stmin_ticks = ISOTP_GetSTminTicks(data[2]);
+                    sess->stmin_wait = 0;
+                    sess->wait_cnt = 0;
+                    sess->state = ISOTP_STATE_TX;
+                    break;
+                case ISOTP_FS_WAIT:
+                    sess->wait_cnt++;
+                    if (sess->wait_cnt > ISOTP_MAX_WAIT_FRAMES) {
+                        sess->state = ISOTP_STATE_IDLE;
+                    }
+                    break;
+                default:
+                    // overflow or invalid flow status, the response is discarded
+                    sess->state = ISOTP_STATE_IDLE;
+                    break;
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+
+void ISOTP_Trigger(void) {
+    ISOTP_SESSION_s *sess = NULL_PTR;
+    uint8_t data[ISOTP_FRAME_LENGTH];
+    uint8_t budget = ISOTP_MAX_FRAMES_PER_TICK;
+    uint8_t session = 0;
+    uint8_t i = 0;
+
+    for (i = 0; i < ISOTP_NR_OF_SESSIONS; i++) {
+        // the first session changes with every call, so all sessions get frames when the budget is short
+        session = (isotp_first_session + i) % ISOTP_NR_OF_SESSIONS;
+        sess = &isotp_session[session];
+
+        if ((sess->state == ISOTP_STATE_RX) || (sess->state == ISOTP_STATE_TX_WAIT_FC)) {
+            sess->timer++;
+            if (sess->timer > ISOTP_TIMEOUT_TICKS) {
+                sess->fc_status = ISOTP_FS_NONE;
+                sess->state = ISOTP_STATE_IDLE;
+            }
+        }
+
+        if ((sess->fc_status != ISOTP_FS_NONE) && (budget > 0)) {
+            data[0] = ISOTP_PCI_FLOW_CONTROL | sess->fc_status;
+            data[1] = ISOTP_BLOCK_SIZE;
+            data[2] = ISOTP_STMIN;
+            if (ISOTP_SendFrame(session, data, 3) == E_OK) {
+                sess->fc_status = ISOTP_FS_NONE;
+                budget--;
+            }
+        }
+
+        if (sess->state == ISOTP_STATE_PROCESS) {
+            sess->tx_length = ISOTP_ServiceRequest(sess->rx_buf, sess->rx_length, sess->tx_buf, ISOTP_TX_BUFFER_LENGTH);
+            sess->tx_pos = 0;
+            sess->state = (sess->tx_length > 0) ? ISOTP_STATE_TX_FIRST : ISOTP_STATE_IDLE;
+        }
+
+        budget = ISOTP_Transmit(session, budget);
+    }
+    isotp_first_session = (isotp_first_session + 1) % ISOTP_NR_OF_SESSIONS;
+}
+
+
+/**
+ * @brief   sends the next frames of the response of a session
+ *
+ * @details At most one consecutive frame is sent per call if the tester
+ *          requested a STmin, as the frames passed in one call leave the
+ *          transmit buffer back to back.
+ *
+ * @param   session     session
+ * @param   budget      number of frames which can be sent in this call
+ *
+ * @return  number of frames left to send in this call
+ */
+static uint8_t ISOTP_Transmit(uint8_t session, uint8_t budget) {
+    ISOTP_SESSION_s *sess = &isotp_session[session];
+    uint8_t data[ISOTP_FRAME_LENGTH];
+    uint16_t length = 0;
+
+    if ((sess->state == ISOTP_STATE_TX_FIRST) && (budget > 0)) {
+        if (sess->tx_length <= ISOTP_SF_MAX_DATA) {
+            data[0] = ISOTP_PCI_SINGLE_FRAME | sess->tx_length;
+            memcpy(&data[1], sess->tx_buf, sess->tx_length);
+            if (ISOTP_SendFrame(session, data, 1 + sess->tx_length) == E_OK) {
+                sess->state = ISOTP_STATE_IDLE;
+                budget--;
+            }
+        } else {
+            data[0] = ISOTP_PCI_FIRST_FRAME | (sess->tx_length >> 8);
+            data[1] = sess->tx_length & 0xFF;
+            memcpy(&data[2], sess->tx_buf, ISOTP_FF_DATA);
+            if (ISOTP_SendFrame(session, data, ISOTP_FRAME_LENGTH) == E_OK) {
+                sess->tx_pos = ISOTP_FF_DATA;
+                sess->sn = 1;
+                sess->timer = 0;
+                sess->wait_cnt = 0;
+                sess->state = ISOTP_STATE_TX_WAIT_FC;
+                budget--;
+            }
+        }
+        return budget;
+    }
+
+    if (sess->state != ISOTP_STATE_TX) {
+        return budget;
+    }
+    if (sess->stmin_wait > 0) {
+        sess->stmin_wait--;
+        if (sess->stmin_wait > 0) {
+            return budget;
+        }
+    }
+
+    while (budget > 0) {
+        length = sess->tx_length - sess->tx_pos;
+        if (length > ISOTP_CF_DATA) {
+            length = ISOTP_CF_DATA;
+        }
+        data[0] = ISOTP_PCI_CONSECUTIVE_FRAME | sess->sn;
+        memcpy(&data[1], &sess->tx_buf[sess->tx_pos], length);
+        if (ISOTP_SendFrame(session, data, 1 + length) != E_OK) {
+            // transmit buffer full, the frame is sent with the next call
+            break;
+        }
+        budget--;
+        sess->tx_pos += length;
+        sess->sn = (sess->sn + 1) & 0x0F;
+        if (sess->tx_pos >= sess->tx_length) {
+            sess->state = ISOTP_STATE_IDLE;
+            break;
+        }
+        if (sess->bs != 0) {
+            sess->block_cnt--;
+            if (sess->block_cnt == 0) {
+                sess->timer = 0;
+                sess->state = ISOTP_STATE_TX_WAIT_FC;
+                break;
+            }
+        }
+        if (sess->stmin_ticks > 0) {
+            sess->stmin_wait = sess->stmin_ticks;
+            break;
+        }
+    }
+    return budget;
+}
+
+
+/**
+ * @brief   pads a frame to 8 bytes and passes it to the CAN0 transmit buffer
+ *
+ * @param   session     session
+ * @param   data        frame, ISOTP_FRAME_LENGTH bytes
+ * @param   length      number of used bytes
+ *
+ * @return  E_OK if the frame was buffered, E_NOT_OK if the buffer is full
+ */
+static STD_RETURN_TYPE_e ISOTP_SendFrame(uint8_t session, uint8_t *data, uint8_t length) {
+    uint8_t i = 0;
+
+    for (i = length; i < ISOTP_FRAME_LENGTH; i++) {
+        data[i] = ISOTP_PADDING;
+    }
+    return CAN_Send(CAN_NODE0, isotp_session_cfg[session].tx_id, data, ISOTP_FRAME_LENGTH, 0);
+}
+
+
+/**
+ * @brief   converts the STmin of a flow control frame into calls of ISOTP_Trigger()
+ *
+ * @param   stmin   STmin as in ISO 15765-2
+ *
+ * @return  calls of ISOTP_Trigger() between two consecutive frames, 0 = no separation
+ */
+static uint8_t ISOTP_GetSTminTicks(uint8_t stmin) {
+    uint8_t stmin_ms = 0;
+
+    if (stmin <= 0x7F) {
+        stmin_ms = stmin;
+    } else if ((stmin >= 0xF1) && (stmin <= 0xF9)) {
+        // 100us - 900us, rounded up
+        stmin_ms = 1;
+    } else {
+        // reserved values are treated as the maximum
+        stmin_ms = 0x7F;
+    }
+    return (stmin_ms + ISOTP_TICK_MS - 1) / ISOTP_TICK_MS;
+}
@@ -0,0 +1,75 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    isotp.h
+ * @author  foxBMS Team
+ * @date    19.10.2026 (date of creation)
+ * @ingroup DRIVERS
+ * @prefix  ISOTP
+ *
+ * @brief   ISO-TP (ISO 15765-2) transport layer on CAN0
+ *
+ * Transfers requests and responses longer than one CAN frame as a first
+ * frame followed by consecutive frames. The receiver of a multi-frame
+ * transfer controls the sender with flow control frames (block size and
+ * minimum separation time STmin). Each session configured in isotp_cfg.h
+ * has its own request and response identifiers and buffers, so several
+ * testers can transfer data at the same time. Complete requests are
+ * processed by ISOTP_ServiceRequest().
+ */
+
+#ifndef ISOTP_H_
+#define ISOTP_H_
+
+/*================== Includes =============================================*/
+#include "isotp_cfg.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/*================== Constant and Variable Definitions ====================*/
+
+/*================== Function Prototypes ==================================*/
+
+/**
+ * @brief   processes a frame received with the request identifier of a session
+ *
+ * @details Called by the CANS for the received frames, must be called from
+ *          the same task as ISOTP_Trigger(). The frames of the tester must
+ *          have 8 data bytes.
+ *
+ * @param   session     session of the request identifier
+ * @param   data        data of the frame
+ */
+extern void ISOTP_Receive(uint8_t session, const uint8_t *data);
+
+/**
+ * @brief   processes the complete requests and sends the flow control and
+ *          response frames of all sessions
+ *
+ * @details Must be called every ISOTP_TICK_MS after CANS_MainFunction().
+ */
+extern void ISOTP_Trigger(void);
+
+/*================== Function Implementations =============================*/
+
+#endif /* ISOTP_H_ */
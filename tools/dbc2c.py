@@ -0,0 +1,534 @@
+# @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der
+#   angewandten Forschung e.V. All rights reserved.
+#
+# BSD 3-Clause License
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+# 1.  Redistributions of source code must retain the above copyright notice,
+#     this list of conditions and the following disclaimer.
+# 2.  Redistributions in binary form must reproduce the above copyright notice,
+#     this list of conditions and the following disclaimer in the documentation
+#     and/or other materials provided with the distribution.
+# 3.  Neither the name of the copyright holder nor the names of its
+#     contributors may be used to endorse or promote products derived from this
+#     software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+# LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+# CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+# SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+# INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+# CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+#
+# We kindly request you to use one or more of the following phrases to refer to
+# foxBMS in your hardware, software, documentation or advertising materials:
+#
+# &Prime;This product uses parts of foxBMS&reg;&Prime;
+#
+# &Prime;This product includes parts of foxBMS&reg;&Prime;
+#
+# &Prime;This product is derived from foxBMS&reg;&Prime;
+
+"""Generates CAN message packers from a DBC description.
+
+Usage:
+    python tools/dbc2c.py src/module/config/cansignal_cfg.dbc -o <dir> [--name cans_dbc] [--prefix CANS]
+
+The build calls this script (see src/module/wscript and the makefile) and
+places <name>.c and <name>.h into the build directory. The output only depends
+on the DBC file, it carries no date. For every message BO_ of the DBC file the
+header declares
+
+    <PREFIX>_<Message>_s             signals of the message in physical values
+    <PREFIX>_<MESSAGE>_ID / _DLC     CAN identifier and data length code
+    <PREFIX>_Pack<Message>()         physical values -> 64 bit frame
+    <PREFIX>_Unpack<Message>()       64 bit frame -> physical values
+    <PREFIX>_<MESSAGE>_SIGNALS()     entries of the message in the signal table
+
+A frame is the CAN payload read as little endian 64 bit integer, i.e., bit n of
+the frame is DBC start bit n of an Intel (@1) signal and the bit position used
+by CANS_signal_s. <PREFIX>_DBC_FrameToData() and <PREFIX>_DBC_DataToFrame()
+convert between a frame and the payload bytes. The packers clamp each signal
+to its [min|max] range and convert it with one shift and mask per signal, so
+a message costs one function call instead of one callback per signal.
+
+The compile-time signal table of the CAN signal layer (cans_CAN0_signals_tx[]
+in cansignal_cfg.c) takes the entries of a message from
+<PREFIX>_<MESSAGE>_SIGNALS(msg, setter, getter). It expands to one
+CANS_signal_s initializer per signal in the order of the DBC file, with the
+bit position, bit length and range of the DBC and the scaling of the signal
+layer, raw = (physical + offset) * factor. <PREFIX>_<MESSAGE>_NR_OF_SIGNALS is
+the number of entries.
+
+Signals with factor 1 and offset 0 are passed as integers, all others as
+float. Scaled signals are rounded to the nearest raw value, halfway cases away
+from zero.
+
+Supported DBC subset: BO_, SG_ (Intel byte order only) and the comments
+CM_ BO_ / CM_ SG_. Overlapping signals, signals exceeding the DLC and signals
+whose [min|max] range does not fit into their raw value are rejected.
+
+The tests are in tools/test_dbc2c.py.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+LICENSE = '''/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+'''
+
+RE_MESSAGE = re.compile(r'^BO_\s+(\d+)\s+(\w+)\s*:\s*(\d+)\s+(\w+)')
+RE_SIGNAL = re.compile(r'^SG_\s+(\w+)\s*:\s*(\d+)\|(\d+)@([01])([+-])\s*'
+                       r'\(\s*([^,\s]+)\s*,\s*([^)\s]+)\s*\)\s*'
+                       r'\[\s*([^|\s]+)\s*\|\s*([^\]\s]+)\s*\]\s*"([^"]*)"')
+RE_COMMENT = re.compile(r'^CM_\s+(BO_|SG_)\s+(\d+)\s+(?:(\w+)\s+)?"([^"]*)"\s*;')
+
+
+class Signal(object):
+    """one SG_ entry of a message"""
+
+    def __init__(self, name, start, length, is_signed, factor, offset, minimum, maximum, unit):
+        self.name = name
+        self.start = start
+        self.length = length
+        self.is_signed = is_signed
+        self.factor = factor
+        self.offset = offset
+        self.minimum = minimum
+        self.maximum = maximum
+        self.unit = unit
+        self.comment = ''
+
+    def is_integer(self):
+        """signals without scaling are passed as integers"""
+        return (self.factor == 1.0 and self.offset == 0.0 and
+                self.minimum == int(self.minimum) and self.maximum == int(self.maximum))
+
+    def c_type(self):
+        """type of the signal in the message structure"""
+        if not self.is_integer():
+            return 'float'
+        for bits in (8, 16, 32, 64):
+            if self.length <= bits:
+                return '%sint%d_t' % ('' if self.is_signed else 'u', bits)
+
+    def mask(self):
+        """mask of the signal, right aligned"""
+        return (1 << self.length) - 1
+
+    def raw_range(self):
+        """lowest and highest raw value of the signal"""
+        if self.is_signed:
+            return -(1 << (self.length - 1)), (1 << (self.length - 1)) - 1
+        return 0, self.mask()
+
+    def to_raw(self, value):
+        """raw value of a physical value, rounded like the generated packers"""
+        scaled = (value - self.offset) / self.factor
+        if scaled < 0.0:
+            return -int(0.5 - scaled)
+        return int(scaled + 0.5)
+
+
+class Message(object):
+    """one BO_ entry with its signals"""
+
+    def __init__(self, can_id, name, dlc):
+        self.can_id = can_id
+        self.name = name
+        self.dlc = dlc
+        self.signals = []
+        self.comment = ''
+
+
+def fail(path, line, text):
+    sys.exit('error: %s:%d: %s' % (path, line, text))
+
+
+def read_dbc(path):
+    """returns the list of messages of a DBC file"""
+    messages = []
+    by_id = {}
+    with open(path) as f:
+        lines = f.readlines()
+    for number, raw in enumerate(lines, 1):
+        line = raw.strip()
+        if line.startswith('BO_ '):
+            match = RE_MESSAGE.match(line)
+            if match is None:
+                fail(path, number, 'malformed message')
+            can_id = int(match.group(1)) & 0x1FFFFFFF
+            if can_id in by_id:
+                fail(path, number, 'message id 0x%X defined twice' % can_id)
+            dlc = int(match.group(3))
+            if not 0 <= dlc <= 8:
+                fail(path, number, 'DLC %d out of range 0..8' % dlc)
+            message = Message(can_id, match.group(2), dlc)
+            messages.append(message)
+            by_id[can_id] = message
+        elif line.startswith('SG_ '):
+            match = RE_SIGNAL.match(line)
+            if match is None:
+                fail(path, number, 'malformed or unsupported signal')
+            if not messages:
+                fail(path, number, 'signal outside of a message')
+            name, start, length, order, sign, factor, offset, minimum, maximum, unit = match.groups()
+            if order != '1':
+                fail(path, number, 'signal %s: only Intel byte order (@1) is supported' % name)
+            signal = Signal(name, int(start), int(length), sign == '-',
+                            float(factor), float(offset), float(minimum), float(maximum), unit)
+            if signal.factor == 0.0:
+                fail(path, number, 'signal %s: factor must not be 0' % name)
+            if not 1 <= signal.length <= 64:
+                fail(path, number, 'signal %s: length must be 1..64' % name)
+            messages[-1].signals.append(signal)
+        elif line.startswith('CM_ '):
+            match = RE_COMMENT.match(line)
+            if match is None:
+                continue
+            kind, can_id, name, text = match.groups()
+            message = by_id.get(int(can_id) & 0x1FFFFFFF)
+            if message is None:
+                fail(path, number, 'comment for unknown message %s' % can_id)
+            if kind == 'BO_':
+                message.comment = text
+            else:
+                for signal in message.signals:
+                    if signal.name == name:
+                        signal.comment = text
+                        break
+                else:
+                    fail(path, number, 'comment for unknown signal %s' % name)
+    return messages
+
+
+def check(messages):
+    """rejects signals exceeding the DLC or overlapping other signals"""
+    for message in messages:
+        used = 0
+        names = set()
+        for signal in message.signals:
+            if signal.name in names:
+                sys.exit('error: %s: signal %s defined twice' % (message.name, signal.name))
+            names.add(signal.name)
+            if signal.start + signal.length > 8 * message.dlc:
+                sys.exit('error: %s: signal %s exceeds the DLC of %d' %
+                         (message.name, signal.name, message.dlc))
+            bits = signal.mask() << signal.start
+            if used & bits:
+                sys.exit('error: %s: signal %s overlaps another signal' % (message.name, signal.name))
+            used |= bits
+            lowest, highest = signal.raw_range()
+            for value in (signal.minimum, signal.maximum):
+                if not lowest <= signal.to_raw(value) <= highest:
+                    sys.exit('error: %s: signal %s: %s does not fit into %d bit' %
+                             (message.name, signal.name, value, signal.length))
+
+
+def c_float(value):
+    """float literal"""
+    text = '%.9g' % value
+    if 'e' not in text and '.' not in text:
+        text += '.0'
+    return text + 'f'
+
+
+def c_int(value, is_signed):
+    """integer literal"""
+    if is_signed:
+        return '(%d)' % value if value < 0 else '%d' % value
+    return '%du' % value if value <= 0xFFFFFFFF else '%dull' % value
+
+
+def table_entry(signal):
+    """CANS_signal_s initializer of one signal, scaled as raw = (physical + offset) * factor"""
+    return '{ {(msg)}, %d, %d, %s, %s, %s, %s, (setter), (getter) }' % (
+        signal.start, signal.length, c_float(signal.minimum), c_float(signal.maximum),
+        c_float(1.0 / signal.factor), c_float(0.0 - signal.offset))
+
+
+def header_block(name, kind, prefix, brief, source):
+    out = [LICENSE]
+    out.append('/**')
+    out.append(' * @file    %s.%s' % (name, kind))
+    out.append(' * @author  foxBMS Team')
+    out.append(' * @ingroup DRIVERS_CONF')
+    out.append(' * @prefix  %s' % prefix)
+    out.append(' *')
+    out.append(' * @brief   %s' % brief)
+    out.append(' *')
+    out.append(' * @details Generated by tools/dbc2c.py from %s, do not edit.' % source)
+    out.append(' *')
+    out.append(' */')
+    out.append('')
+    return out
+
+
+def to_h(messages, name, prefix, source):
+    """generates the header with the message structures and the packer prototypes"""
+    guard = '%s_H_' % name.upper()
+    out = header_block(name, 'h', prefix, 'CAN message packers', source)
+    out.append('#ifndef %s' % guard)
+    out.append('#define %s' % guard)
+    out.append('')
+    out.append('/*================== Includes =============================================*/')
+    out.append('#include "general.h"')
+    out.append('')
+    out.append('/*================== Macros and Definitions ===============================*/')
+    out.append('')
+    for message in messages:
+        upper = message.name.upper()
+        out.append('/**')
+        out.append(' * %s' % (message.comment or message.name))
+        out.append(' */')
+        out.append('#define %s_%s_ID    0x%03X' % (prefix, upper, message.can_id))
+        out.append('#define %s_%s_DLC   %d' % (prefix, upper, message.dlc))
+        out.append('')
+        out.append('typedef struct {')
+        for signal in message.signals:
+            text = signal.comment or signal.name
+            if signal.unit:
+                text += ' in %s' % signal.unit
+            out.append('    %s %s;    /*!< %s */' % (signal.c_type(), signal.name, text))
+        out.append('} %s_%s_s;' % (prefix, message.name))
+        out.append('')
+        out.append('/**')
+        out.append(' * entries of the %s signals in the signal table of the CAN signal layer,' % message.name)
+        out.append(' * one CANS_signal_s initializer per signal in the order of the DBC file')
+        out.append(' */')
+        out.append('#define %s_%s_NR_OF_SIGNALS    %d' % (prefix, upper, len(message.signals)))
+        entries = [table_entry(signal) for signal in message.signals]
+        out.append('#define %s_%s_SIGNALS(msg, setter, getter) \\' % (prefix, upper))
+        for number, entry in enumerate(entries):
+            out.append('    %s%s' % (entry, ', \\' if number + 1 < len(entries) else ''))
+        out.append('')
+        out.append('')
+    out.append('/*================== Constant and Variable Definitions ====================*/')
+    out.append('')
+    out.append('/*================== Function Prototypes ==================================*/')
+    out.append('')
+    out.append('/**')
+    out.append(' * @brief   copies a frame to the payload bytes of a CAN message')
+    out.append(' *')
+    out.append(' * @param   frame   payload as little endian 64 bit integer')
+    out.append(' * @param   data    payload bytes')
+    out.append(' * @param   dlc     number of bytes to write')
+    out.append(' */')
+    out.append('extern void %s_DBC_FrameToData(uint64_t frame, uint8_t *data, uint8_t dlc);' % prefix)
+    out.append('')
+    out.append('/**')
+    out.append(' * @brief   reads the payload bytes of a CAN message into a frame')
+    out.append(' *')
+    out.append(' * @param   data    payload bytes')
+    out.append(' * @param   dlc     number of bytes to read')
+    out.append(' *')
+    out.append(' * @return  payload as little endian 64 bit integer')
+    out.append(' */')
+    out.append('extern uint64_t %s_DBC_DataToFrame(const uint8_t *data, uint8_t dlc);' % prefix)
+    for message in messages:
+        out.append('')
+        out.append('/**')
+        out.append(' * @brief   packs the %s message' % message.name)
+        out.append(' *')
+        out.append(' * @param   msg     signals in physical values, clamped to their range')
+        out.append(' *')
+        out.append(' * @return  frame of the message')
+        out.append(' */')
+        out.append('extern uint64_t %s_Pack%s(const %s_%s_s *msg);' % (prefix, message.name, prefix, message.name))
+        out.append('')
+        out.append('/**')
+        out.append(' * @brief   unpacks the %s message' % message.name)
+        out.append(' *')
+        out.append(' * @param   frame   frame of the message')
+        out.append(' * @param   msg     signals in physical values')
+        out.append(' */')
+        out.append('extern void %s_Unpack%s(uint64_t frame, %s_%s_s *msg);' % (prefix, message.name, prefix, message.name))
+    out.append('')
+    out.append('/*================== Function Implementations =============================*/')
+    out.append('')
+    out.append('#endif /* %s */' % guard)
+    return '\n'.join(out)
+
+
+def pack_signal(signal):
+    """returns the lines that clamp, scale and insert one signal into frame"""
+    field = 'msg->%s' % signal.name
+    shift = ' << %d' % signal.start if signal.start else ''
+    mask = '0x%Xull' % signal.mask()
+    if signal.is_integer():
+        minimum, maximum = int(signal.minimum), int(signal.maximum)
+        if signal.is_signed:
+            out = ['    sraw = %s;' % field]
+            out.append('    if (sraw < %s) {' % c_int(minimum, True))
+            out.append('        sraw = %s;' % c_int(minimum, True))
+            out.append('    } else if (sraw > %s) {' % c_int(maximum, True))
+            out.append('        sraw = %s;' % c_int(maximum, True))
+            out.append('    }')
+            out.append('    raw = (uint64_t)sraw;')
+        else:
+            out = ['    raw = (uint64_t)%s;' % field]
+            if minimum > 0:
+                out.append('    if (raw < %s) {' % c_int(minimum, False))
+                out.append('        raw = %s;' % c_int(minimum, False))
+                out.append('    }')
+            if maximum < signal.mask():
+                out.append('    if (raw > %s) {' % c_int(maximum, False))
+                out.append('        raw = %s;' % c_int(maximum, False))
+                out.append('    }')
+    else:
+        out = ['    phys = %s;' % field]
+        out.append('    if (phys < %s) {' % c_float(signal.minimum))
+        out.append('        phys = %s;' % c_float(signal.minimum))
+        out.append('    } else if (phys > %s) {' % c_float(signal.maximum))
+        out.append('        phys = %s;' % c_float(signal.maximum))
+        out.append('    }')
+        scaled = 'phys'
+        if signal.offset != 0.0:
+            scaled = '(phys %s %s)' % ('+' if signal.offset < 0 else '-', c_float(abs(signal.offset)))
+        if signal.factor != 1.0:
+            scaled = '%s * %s' % (scaled, c_float(1.0 / signal.factor))
+        if signal.is_signed:
+            out.append('    phys = %s;' % scaled)
+            out.append('    if (phys < 0.0f) {')
+            out.append('        raw = (uint64_t)(int64_t)(phys - 0.5f);')
+            out.append('    } else {')
+            out.append('        raw = (uint64_t)(int64_t)(phys + 0.5f);')
+            out.append('    }')
+        else:
+            out.append('    raw = (uint64_t)(%s + 0.5f);' % scaled)
+    out.append('    frame |= (raw & %s)%s;' % (mask, shift))
+    return out
+
+
+def unpack_signal(signal):
+    """returns the lines that extract and scale one signal from frame"""
+    mask = '0x%Xull' % signal.mask()
+    if signal.start:
+        out = ['    raw = (frame >> %d) & %s;' % (signal.start, mask)]
+    else:
+        out = ['    raw = frame & %s;' % mask]
+    value = 'raw'
+    if signal.is_signed:
+        if signal.length < 64:
+            out.append('    if (raw & 0x%Xull) {' % (1 << (signal.length - 1)))
+            out.append('        raw |= ~%s;' % mask)
+            out.append('    }')
+        value = '(int64_t)raw'
+    if signal.is_integer():
+        out.append('    msg->%s = (%s)%s;' % (signal.name, signal.c_type(), value))
+    else:
+        scaled = '(float)%s' % value
+        if signal.factor != 1.0:
+            scaled += ' * %s' % c_float(signal.factor)
+        if signal.offset != 0.0:
+            scaled += ' %s %s' % ('-' if signal.offset < 0 else '+', c_float(abs(signal.offset)))
+        out.append('    msg->%s = %s;' % (signal.name, scaled))
+    return out
+
+
+def to_c(messages, name, prefix, source):
+    """generates the source with the packers"""
+    out = header_block(name, 'c', prefix, 'CAN message packers', source)
+    out.append('/*================== Includes =============================================*/')
+    out.append('#include "general.h"')
+    out.append('#include "%s.h"' % name)
+    out.append('')
+    out.append('/*================== Macros and Definitions ===============================*/')
+    out.append('')
+    out.append('/*================== Constant and Variable Definitions ====================*/')
+    out.append('')
+    out.append('/*================== Function Prototypes ==================================*/')
+    out.append('')
+    out.append('/*================== Function Implementations =============================*/')
+    out.append('')
+    out.append('void %s_DBC_FrameToData(uint64_t frame, uint8_t *data, uint8_t dlc) {' % prefix)
+    out.append('    uint8_t i = 0;')
+    out.append('')
+    out.append('    for (i = 0; i < dlc; i++) {')
+    out.append('        data[i] = (uint8_t)(frame >> (8 * i));')
+    out.append('    }')
+    out.append('}')
+    out.append('')
+    out.append('')
+    out.append('uint64_t %s_DBC_DataToFrame(const uint8_t *data, uint8_t dlc) {' % prefix)
+    out.append('    uint64_t frame = 0;')
+    out.append('    uint8_t i = 0;')
+    out.append('')
+    out.append('    for (i = 0; i < dlc; i++) {')
+    out.append('        frame |= (uint64_t)data[i] << (8 * i);')
+    out.append('    }')
+    out.append('    return frame;')
+    out.append('}')
+    for message in messages:
+        floats = any(not s.is_integer() for s in message.signals)
+        signed = any(s.is_integer() and s.is_signed for s in message.signals)
+        out.append('')
+        out.append('')
+        out.append('uint64_t %s_Pack%s(const %s_%s_s *msg) {' % (prefix, message.name, prefix, message.name))
+        out.append('    uint64_t frame = 0;')
+        out.append('    uint64_t raw = 0;')
+        if signed:
+            out.append('    int64_t sraw = 0;')
+        if floats:
+            out.append('    float phys = 0.0f;')
+        for signal in message.signals:
+            out.append('')
+            out.extend(pack_signal(signal))
+        out.append('    return frame;')
+        out.append('}')
+        out.append('')
+        out.append('')
+        out.append('void %s_Unpack%s(uint64_t frame, %s_%s_s *msg) {' % (prefix, message.name, prefix, message.name))
+        out.append('    uint64_t raw = 0;')
+        for signal in message.signals:
+            out.append('')
+            out.extend(unpack_signal(signal))
+        out.append('}')
+    return '\n'.join(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('dbc', help='DBC file')
+    parser.add_argument('-o', '--output', default='.', help='directory of the generated files')
+    parser.add_argument('--name', default='cans_dbc', help='base name of the generated files')
+    parser.add_argument('--prefix', default='CANS', help='prefix of the generated symbols')
+    args = parser.parse_args()
+    messages = read_dbc(args.dbc)
+    check(messages)
+    source = os.path.basename(args.dbc)
+    with open(os.path.join(args.output, args.name + '.h'), 'w') as f:
+        f.write(to_h(messages, args.name, args.prefix, source) + '\n')
+    with open(os.path.join(args.output, args.name + '.c'), 'w') as f:
+        f.write(to_c(messages, args.name, args.prefix, source) + '\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,151 @@
+# @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der
+#   angewandten Forschung e.V. All rights reserved.
+#
+# BSD 3-Clause License
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+# 1.  Redistributions of source code must retain the above copyright notice,
+#     this list of conditions and the following disclaimer.
+# 2.  Redistributions in binary form must reproduce the above copyright notice,
+#     this list of conditions and the following disclaimer in the documentation
+#     and/or other materials provided with the distribution.
+# 3.  Neither the name of the copyright holder nor the names of its
+#     contributors may be used to endorse or promote products derived from this
+#     software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+# LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+# CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+# SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+# INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+# CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+#
+# We kindly request you to use one or more of the following phrases to refer to
+# foxBMS in your hardware, software, documentation or advertising materials:
+#
+# &Prime;This product uses parts of foxBMS&reg;&Prime;
+#
+# &Prime;This product includes parts of foxBMS&reg;&Prime;
+#
+# &Prime;This product is derived from foxBMS&reg;&Prime;
+
+"""Exports the state tables of the table-driven state machines as graphviz dot.
+
+Usage:
+    python tools/sm2dot.py src/application/bms/bms.c > bms.dot
+    dot -Tsvg bms.dot -o bms.svg
+
+The tool parses the SM_STATE_s and SM_TRANSITION_s tables of a source file
+(see src/engine/sm/sm.h). Transitions are drawn solid, timeouts dotted and
+transitions that are made by calls of SM_Transition() inside a state action
+are drawn dashed. Preprocessor conditionals are ignored, i.e., all table
+entries are drawn.
+"""
+
+import argparse
+import re
+import sys
+
+RE_COMMENT = re.compile(r'/\*.*?\*/|//[^\n]*', re.S)
+RE_TABLE = re.compile(
+    r'static\s+const\s+(SM_STATE_s|SM_TRANSITION_s)\s+(\w+)\s*\[\s*\]\s*=\s*\{(.*?)\};',
+    re.S)
+RE_ROW = re.compile(r'\{([^{}]*)\}')
+RE_FUNCTION = re.compile(r'\n(?:static\s+)?\w+\s+(\w+)\s*\([^;{]*\)\s*\{')
+RE_CALL = re.compile(r'SM_Transition\s*\(\s*&?\s*\w+\s*,\s*(\w+)')
+
+SPECIAL_REQUESTS = {'SM_REQ_ANY': 'any request', 'SM_REQ_NONE': ''}
+
+
+def strip(source):
+    """removes comments and preprocessor lines"""
+    source = RE_COMMENT.sub('', source)
+    return '\n'.join(l for l in source.splitlines()
+                     if not l.lstrip().startswith('#'))
+
+
+def parse_rows(body):
+    """returns the table rows as lists of stripped fields"""
+    return [[f.strip() for f in row.split(',')] for row in RE_ROW.findall(body)]
+
+
+def parse_actions(source):
+    """returns a dict: function name -> targets of SM_Transition() calls"""
+    actions = {}
+    matches = list(RE_FUNCTION.finditer(source))
+    for i, match in enumerate(matches):
+        end = matches[i + 1].start() if i + 1 < len(matches) else len(source)
+        targets = RE_CALL.findall(source[match.end():end])
+        if targets:
+            actions[match.group(1)] = targets
+    return actions
+
+
+def label(request, guard, timer):
+    """builds the edge label of a transition"""
+    parts = []
+    request = SPECIAL_REQUESTS.get(request, request)
+    if request:
+        parts.append(request)
+    if guard not in ('NULL_PTR', 'NULL', '0'):
+        parts.append('[%s]' % guard)
+    if timer not in ('0', ''):
+        parts.append('/ %s' % timer)
+    return '\\n'.join(parts)
+
+
+def to_dot(path):
+    """converts all state tables of a source file to a dot graph"""
+    with open(path) as f:
+        source = strip(f.read())
+    transitions = {}
+    states = []
+    for kind, name, body in RE_TABLE.findall(source):
+        if kind == 'SM_TRANSITION_s':
+            transitions[name] = parse_rows(body)
+        else:
+            states.append((name, parse_rows(body)))
+    actions = parse_actions(source)
+
+    out = ['digraph sm {', '    rankdir=LR;', '    node [shape=box, style=rounded];']
+    for table, rows in states:
+        out.append('    /* %s */' % table)
+        for i, row in enumerate(rows):
+            if len(row) < 8:
+                continue
+            state, entry, run, exit_, timeout, timeoutstate = row[:6]
+            shape = ' peripheries=2' if i == 0 else ''
+            out.append('    %s [label="%s\\nentry: %s\\nrun: %s\\nexit: %s"%s];' %
+                       (state, state, entry, run, exit_, shape))
+            for request, guard, target, timer in transitions.get(row[7], []):
+                if target == 'SM_STATE_REJECT':
+                    continue
+                if target == 'SM_STATE_STAY':
+                    target = state
+                out.append('    %s -> %s [label="%s"];' %
+                           (state, target, label(request, guard, timer)))
+            if timeout not in ('0', ''):
+                out.append('    %s -> %s [style=dotted, label="timeout %s"];' %
+                           (state, timeoutstate, timeout))
+            for action in set((entry, run, exit_)):
+                for target in actions.get(action, []):
+                    out.append('    %s -> %s [style=dashed, label="%s"];' %
+                               (state, target, action))
+    out.append('}')
+    return '\n'.join(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('source', help='C source file containing the state tables')
+    args = parser.parse_args()
+    sys.stdout.write(to_dot(args.source) + '\n')
+
+
+if __name__ == '__main__':
+    main()
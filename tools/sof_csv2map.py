@@ -0,0 +1,213 @@
+# @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der
+#   angewandten Forschung e.V. All rights reserved.
+#
+# BSD 3-Clause License
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+# 1.  Redistributions of source code must retain the above copyright notice,
+#     this list of conditions and the following disclaimer.
+# 2.  Redistributions in binary form must reproduce the above copyright notice,
+#     this list of conditions and the following disclaimer in the documentation
+#     and/or other materials provided with the distribution.
+# 3.  Neither the name of the copyright holder nor the names of its
+#     contributors may be used to endorse or promote products derived from this
+#     software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+# LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+# CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+# SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+# INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+# CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+#
+# We kindly request you to use one or more of the following phrases to refer to
+# foxBMS in your hardware, software, documentation or advertising materials:
+#
+# &Prime;This product uses parts of foxBMS&reg;&Prime;
+#
+# &Prime;This product includes parts of foxBMS&reg;&Prime;
+#
+# &Prime;This product is derived from foxBMS&reg;&Prime;
+
+"""Converts a cell datasheet CSV into the current limit maps of the SOF.
+
+Usage:
+    python tools/sof_csv2map.py cell.csv > src/application/config/sox_map_cfg.c
+
+The CSV file contains one row per operating point of the datasheet:
+
+    temperature_degC,soc_perc,charge_cont_A,charge_peak_A,discharge_cont_A,discharge_peak_A
+    -10,0,0,0,20,20
+    ...
+
+The temperature and SOC breakpoints are taken from the rows, every
+combination of them must be given exactly once. The generated source defines
+sox_sof_map (see SOX_SOF_MAP_s in src/application/config/sox_cfg.h) with the
+breakpoints in degC and 0.01% and the currents in 0.1A. With --max-charge and
+--max-discharge the currents are clipped, e.g., to BC_CURRENTMAX_CHARGE and
+BC_CURRENTMAX_DISCHARGE of batterycell_cfg.h.
+"""
+
+import argparse
+import csv
+import datetime
+import sys
+
+MAX_POINTS = 16     # SOX_SOF_MAP_MAX_POINTS
+COLUMNS = ('temperature_degC', 'soc_perc',
+           'charge_cont_A', 'charge_peak_A', 'discharge_cont_A', 'discharge_peak_A')
+MAPS = (('charge_cont', 'SOX_SOF_MAP_CHARGE_CONT', 'maximum continuous charge current'),
+        ('charge_peak', 'SOX_SOF_MAP_CHARGE_PEAK', 'maximum peak charge current'),
+        ('discharge_cont', 'SOX_SOF_MAP_DISCHA_CONT', 'maximum continuous discharge current'),
+        ('discharge_peak', 'SOX_SOF_MAP_DISCHA_PEAK', 'maximum peak discharge current'))
+
+LICENSE = '''/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+'''
+
+
+def read_points(path):
+    """returns a dict: (temperature, soc) -> tuple of the four currents in A"""
+    points = {}
+    with open(path) as f:
+        rows = [r for r in csv.reader(f) if r and not r[0].lstrip().startswith('#')]
+    if [c.strip() for c in rows[0]] != list(COLUMNS):
+        sys.exit('error: header must be %s' % ','.join(COLUMNS))
+    for line, row in enumerate(rows[1:], 2):
+        if len(row) != len(COLUMNS):
+            sys.exit('error: row %d: expected %d columns' % (line, len(COLUMNS)))
+        temperature = int(round(float(row[0])))
+        soc = int(round(float(row[1]) * 100))
+        if (temperature, soc) in points:
+            sys.exit('error: row %d: operating point given twice' % line)
+        points[(temperature, soc)] = tuple(float(v) for v in row[2:])
+    return points
+
+
+def check_axis(name, axis, low, high):
+    """checks the number of breakpoints and their range"""
+    if not 2 <= len(axis) <= MAX_POINTS:
+        sys.exit('error: %s needs 2 to %d breakpoints, got %d' % (name, MAX_POINTS, len(axis)))
+    if axis[0] < low or axis[-1] > high:
+        sys.exit('error: %s breakpoints must be within %d..%d' % (name, low, high))
+
+
+def to_deciampere(value, limit):
+    """converts a current in A to the table resolution of 0.1A"""
+    if limit is not None:
+        value = min(value, limit)
+    if not 0.0 <= value <= 6553.5:
+        sys.exit('error: current %.1fA out of range 0..6553.5A' % value)
+    return int(round(value * 10))
+
+
+def to_c(points, max_charge, max_discharge, source):
+    """generates the C source of the current limit maps"""
+    temperatures = sorted(set(t for t, _ in points))
+    socs = sorted(set(s for _, s in points))
+    check_axis('temperature', temperatures, -32768, 32767)
+    check_axis('SOC', socs, 0, 10000)
+    for t in temperatures:
+        for s in socs:
+            if (t, s) not in points:
+                sys.exit('error: operating point %ddegC, %.2f%% missing' % (t, s / 100.0))
+
+    out = [LICENSE]
+    out.append('/**')
+    out.append(' * @file    sox_map_cfg.c')
+    out.append(' * @author  foxBMS Team')
+    out.append(' * @date    %s (date of creation)' % datetime.date.today().strftime('%d.%m.%Y'))
+    out.append(' * @ingroup APPLICATION_CONF')
+    out.append(' * @prefix  SOX')
+    out.append(' *')
+    out.append(' * @brief   Current limit maps of the SOF')
+    out.append(' *')
+    out.append(' * @details Generated by tools/sof_csv2map.py from %s, do not edit.' % source)
+    out.append(' *')
+    out.append(' */')
+    out.append('')
+    out.append('/*================== Includes =============================================*/')
+    out.append('#include "general.h"')
+    out.append('#include "sox_cfg.h"')
+    out.append('')
+    out.append('/*================== Macros and Definitions ===============================*/')
+    out.append('')
+    out.append('/*================== Constant and Variable Definitions ====================*/')
+    out.append('/**')
+    out.append(' * temperature breakpoints of the current limit maps in degC')
+    out.append(' */')
+    out.append('static const int16_t sox_map_temperature[] = { %s };' %
+               ', '.join(str(t) for t in temperatures))
+    out.append('')
+    out.append('/**')
+    out.append(' * SOC breakpoints of the current limit maps in 0.01%')
+    out.append(' */')
+    out.append('static const int16_t sox_map_soc[] = { %s };' % ', '.join(str(s) for s in socs))
+    for i, (name, _, text) in enumerate(MAPS):
+        limit = max_charge if name.startswith('charge') else max_discharge
+        out.append('')
+        out.append('/**')
+        out.append(' * %s in 0.1A, one row per temperature breakpoint' % text)
+        out.append(' */')
+        out.append('static const uint16_t sox_map_%s[] = {' % name)
+        for t in temperatures:
+            values = ['%5d,' % to_deciampere(points[(t, s)][i], limit) for s in socs]
+            out.append('    /* %4ddegC */ %s' % (t, ' '.join(values)))
+        out.append('};')
+    out.append('')
+    out.append('const SOX_SOF_MAP_s sox_sof_map = {')
+    out.append('    .temperature    = sox_map_temperature,')
+    out.append('    .nr_temperature = %d,' % len(temperatures))
+    out.append('    .soc            = sox_map_soc,')
+    out.append('    .nr_soc         = %d,' % len(socs))
+    out.append('    .current        = {')
+    for name, index, _ in MAPS:
+        out.append('        [%s] = sox_map_%s,' % (index, name))
+    out.append('    },')
+    out.append('};')
+    out.append('')
+    out.append('/*================== Function Prototypes ==================================*/')
+    out.append('')
+    out.append('/*================== Function Implementations =============================*/')
+    return '\n'.join(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('csv', help='datasheet CSV file')
+    parser.add_argument('--max-charge', type=float, default=None,
+                        help='clip the charge currents to this value in A')
+    parser.add_argument('--max-discharge', type=float, default=None,
+                        help='clip the discharge currents to this value in A')
+    args = parser.parse_args()
+    points = read_points(args.csv)
+    sys.stdout.write(to_c(points, args.max_charge, args.max_discharge,
+                          args.csv.replace('\\', '/').split('/')[-1]) + '\n')
+
+
+if __name__ == '__main__':
+    main()
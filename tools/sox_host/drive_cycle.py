@@ -0,0 +1,140 @@
+# @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der
+#   angewandten Forschung e.V. All rights reserved.
+#
+# BSD 3-Clause License
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+# 1.  Redistributions of source code must retain the above copyright notice,
+#     this list of conditions and the following disclaimer.
+# 2.  Redistributions in binary form must reproduce the above copyright notice,
+#     this list of conditions and the following disclaimer in the documentation
+#     and/or other materials provided with the distribution.
+# 3.  Neither the name of the copyright holder nor the names of its
+#     contributors may be used to endorse or promote products derived from this
+#     software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+# LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+# CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+# SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+# INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+# CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+#
+# We kindly request you to use one or more of the following phrases to refer to
+# foxBMS in your hardware, software, documentation or advertising materials:
+#
+# &Prime;This product uses parts of foxBMS&reg;&Prime;
+#
+# &Prime;This product includes parts of foxBMS&reg;&Prime;
+#
+# &Prime;This product is derived from foxBMS&reg;&Prime;
+
+
+"""Generates synthetic drive cycles for the host harnesses of the SOX.
+
+Usage:
+    python tools/sox_host/drive_cycle.py -o cycle.csv [--hours 4] [--capacity 20] [--soc 90] [--seed 1]
+
+The cycle is a CSV file with one sample per line: time in s, cell current in A
+(positive when discharging) and cell temperature in degC. It is a random
+sequence of the phases
+
+    urban       stop and go: acceleration peaks up to 3C, cruising, recuperation
+                and standstill
+    highway     0.5C to 1.5C with fluctuations
+    rest        no current
+
+The generator follows the SOC of an ideal cell. Below 25% SOC it inserts a
+0.5C charge up to 90% SOC followed by a rest, so a long cycle covers the full
+SOC range several times. The same seed gives the same cycle.
+"""
+
+import argparse
+import random
+
+
+class Cycle(object):
+    """samples of a drive cycle and the SOC of an ideal cell"""
+
+    def __init__(self, period, capacity, soc, temperature):
+        self.period = period
+        self.capacity = capacity
+        self.soc = soc
+        self.temperature = temperature
+        self.samples = []
+
+    def time(self):
+        """duration of the cycle so far in s"""
+        return len(self.samples) * self.period
+
+    def add(self, current, duration):
+        """appends a constant current in A for a duration in s"""
+        for _ in range(max(1, int(round(duration / self.period)))):
+            self.soc -= 100.0 * current * self.period / (3600.0 * self.capacity)
+            self.samples.append((current, self.temperature))
+
+    def urban(self, rng):
+        """stop and go for about 10 minutes"""
+        end = self.time() + 600.0
+        while self.time() < end:
+            self.add(rng.uniform(1.0, 3.0) * self.capacity, rng.uniform(5.0, 15.0))
+            self.add(rng.uniform(0.2, 0.8) * self.capacity, rng.uniform(10.0, 60.0))
+            self.add(-rng.uniform(0.3, 1.0) * self.capacity, rng.uniform(3.0, 8.0))
+            self.add(0.0, rng.uniform(10.0, 40.0))
+
+    def highway(self, rng):
+        """fluctuating load for about 20 minutes"""
+        end = self.time() + 1200.0
+        level = rng.uniform(0.5, 1.5)
+        while self.time() < end:
+            level = min(1.5, max(0.5, level + rng.uniform(-0.1, 0.1)))
+            self.add(level * self.capacity, rng.uniform(2.0, 10.0))
+
+    def rest(self, rng):
+        """no current for 5 to 15 minutes"""
+        self.add(0.0, rng.uniform(300.0, 900.0))
+
+    def charge(self, rng):
+        """0.5C up to 90% SOC and a rest"""
+        while self.soc < 90.0:
+            self.add(-0.5 * self.capacity, 10.0)
+        self.rest(rng)
+
+
+def generate(hours, capacity, soc, temperature, seed, period=0.1):
+    """returns the samples of a drive cycle as list of (current, temperature)"""
+    rng = random.Random(seed)
+    cycle = Cycle(period, capacity, soc, temperature)
+    phases = [cycle.urban, cycle.urban, cycle.highway, cycle.rest]
+    while cycle.time() < 3600.0 * hours:
+        if cycle.soc < 25.0:
+            cycle.charge(rng)
+        else:
+            rng.choice(phases)(rng)
+    return cycle.samples[:int(3600.0 * hours / period)]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('-o', '--output', required=True, help='CSV file of the cycle')
+    parser.add_argument('--hours', type=float, default=4.0, help='duration in h')
+    parser.add_argument('--capacity', type=float, default=20.0, help='cell capacity in Ah')
+    parser.add_argument('--soc', type=float, default=90.0, help='SOC at the start in %%')
+    parser.add_argument('--temperature', type=float, default=25.0, help='cell temperature in degC')
+    parser.add_argument('--period', type=float, default=0.1, help='sample period in s')
+    parser.add_argument('--seed', type=int, default=1, help='seed of the random phases')
+    args = parser.parse_args()
+    samples = generate(args.hours, args.capacity, args.soc, args.temperature, args.seed, args.period)
+    with open(args.output, 'w') as f:
+        f.write('time,current,temperature\n')
+        for number, (current, temperature) in enumerate(samples):
+            f.write('%.1f,%.3f,%.1f\n' % (number * args.period, current, temperature))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,230 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    ekf_bench.c
+ * @author  foxBMS Team
+ * @date    19.10.2026 (date of creation)
+ * @ingroup TOOLS
+ * @prefix  HOST
+ *
+ * @brief   Host benchmark of the extended Kalman filter for the SOC
+ *
+ * A simulated cell is driven by a cycle of drive_cycle.py. Its parameters deviate from the model
+ * of the filter: R0 +20%, R1 +30% and capacity -3%. The measured cell voltage has 2mV noise and
+ * a resolution of 1mV, the measured current an offset of 0.1A. The filter started with a wrong
+ * SOC is compared with coulomb counting started with the true and with the wrong SOC. The errors
+ * are evaluated after HOST_EKF_SETTLE_TIME, the execution time of SOC_EkfUpdate() is measured
+ * for every update.
+ *
+ * Usage: ekf_bench <cycle.csv> [SOC at the start in %] [error of the initial SOC in %]
+ */
+
+/*================== Includes =============================================*/
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "host.h"
+
+#include "general.h"
+#include "sox_ekf.h"
+
+/*================== Macros and Definitions ===============================*/
+#define HOST_EKF_SETTLE_TIME        1800.0      /*!< s before the errors are evaluated          */
+#define HOST_EKF_R0_FACTOR          1.2         /*!< true R0 relative to SOX_EKF_R0             */
+#define HOST_EKF_R1_FACTOR          1.3         /*!< true R1 relative to SOX_EKF_R1             */
+#define HOST_EKF_CAPACITY_FACTOR    0.97        /*!< true capacity relative to SOX_CELL_CAPACITY */
+#define HOST_EKF_VOLTAGE_NOISE      0.002       /*!< standard deviation of the voltage in V     */
+#define HOST_EKF_CURRENT_OFFSET     0.1         /*!< offset of the current sensor in A          */
+
+/**
+ * error statistics of one estimator
+ */
+typedef struct {
+    double sum;         /*!< sum of the squared errors in %^2       */
+    double max;         /*!< largest absolute error in %            */
+    double last;        /*!< error at the end of the cycle in %     */
+    uint32_t n;         /*!< number of evaluated samples            */
+} HOST_ERROR_s;
+
+/*================== Constant and Variable Definitions ====================*/
+static uint64_t host_random = 88172645463325252uLL;
+
+/*================== Function Implementations =============================*/
+
+/**
+ * @brief   normally distributed random number, xorshift and Box-Muller
+ */
+static double HOST_Gauss(void) {
+    double u[2];
+    uint8_t i = 0;
+
+    for (i = 0; i < 2; i++) {
+        host_random ^= host_random << 13;
+        host_random ^= host_random >> 7;
+        host_random ^= host_random << 17;
+        u[i] = ((host_random >> 11) + 0.5) * (1.0 / 9007199254740992.0);
+    }
+    return sqrt(-2.0 * log(u[0])) * cos(6.283185307179586 * u[1]);
+}
+
+/**
+ * @brief   adds the error of one sample to the statistics
+ */
+static void HOST_AddError(HOST_ERROR_s *e, double estimate, double truth) {
+    double error = estimate - truth;
+
+    e->last = error;
+    error = fabs(error);
+    e->sum += error * error;
+    if (error > e->max) {
+        e->max = error;
+    }
+    e->n++;
+}
+
+/**
+ * @brief   prints the statistics of one estimator
+ */
+static void HOST_PrintError(const char *name, const HOST_ERROR_s *e) {
+    printf("%-28s RMS %6.2f%%  max %6.2f%%  end %+6.2f%%\n", name, sqrt(e->sum / e->n), e->max, e->last);
+}
+
+int main(int argc, char **argv) {
+    FILE *file = NULL;
+    char line[128];
+    double t = 0.0;
+    double t_previous = 0.0;
+    double current = 0.0;
+    double temperature = 0.0;
+    double soc_start = 90.0;
+    double soc_error = 20.0;
+    double capacity = HOST_EKF_CAPACITY_FACTOR * SOX_CELL_CAPACITY * 3.6;   /* As */
+    double soc = 0.0;
+    double u1 = 0.0;
+    double u2 = 0.0;
+    double d1 = 0.0;
+    double d2 = 0.0;
+    double dt = 0.0;
+    double voltage = 0.0;
+    double measured_current = 0.0;
+    double cc_true = 0.0;
+    double cc_wrong = 0.0;
+    double sigma = 0.0;
+    float slope = 0.0f;
+    SOX_EKF_s ekf;
+    HOST_ERROR_s error_ekf = {0};
+    HOST_ERROR_s error_cc_true = {0};
+    HOST_ERROR_s error_cc_wrong = {0};
+    uint32_t covered = 0;
+    uint32_t updates = 0;
+    uint64_t start = 0;
+    uint64_t ticks = 0;
+    uint64_t overhead = UINT64_MAX;
+    uint32_t i = 0;
+
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <cycle.csv> [SOC at the start in %%] [error of the initial SOC in %%]\n", argv[0]);
+        return 1;
+    }
+    if (argc > 2) {
+        soc_start = atof(argv[2]);
+    }
+    if (argc > 3) {
+        soc_error = atof(argv[3]);
+    }
+    file = fopen(argv[1], "r");
+    if (file == NULL) {
+        fprintf(stderr, "error: cannot open %s\n", argv[1]);
+        return 1;
+    }
+
+    // overhead of the time measurement itself
+    for (i = 0; i < 1000; i++) {
+        start = HOST_Ticks();
+        ticks = HOST_Ticks() - start;
+        if (ticks < overhead) {
+            overhead = ticks;
+        }
+    }
+    ticks = 0;
+
+    soc = soc_start;
+    cc_true = soc_start;
+    cc_wrong = soc_start + soc_error;
+    SOC_EkfInit(&ekf, (float)(soc_start + soc_error));
+
+    while (fgets(line, sizeof(line), file) != NULL) {
+        if (sscanf(line, "%lf,%lf,%lf", &t, &current, &temperature) != 3) {
+            continue;   // header
+        }
+        dt = t - t_previous;
+        t_previous = t;
+        if (dt <= 0.0) {
+            continue;
+        }
+
+        // true cell: the RC voltages are exact for a constant current over dt
+        soc -= 100.0 * current * dt / capacity;
+        d1 = exp(-dt / SOX_EKF_TAU1);
+        d2 = exp(-dt / SOX_EKF_TAU2);
+        u1 = d1 * u1 + HOST_EKF_R1_FACTOR * SOX_EKF_R1 * (1.0 - d1) * current;
+        u2 = d2 * u2 + SOX_EKF_R2 * (1.0 - d2) * current;
+        voltage = SOC_GetOcv((float)(0.01 * soc), (int16_t)temperature, &slope) - u1 - u2 - HOST_EKF_R0_FACTOR * SOX_EKF_R0 * current;
+
+        // measurement: voltage with noise in mV, current with offset
+        voltage = 0.001 * floor(1000.0 * (voltage + HOST_EKF_VOLTAGE_NOISE * HOST_Gauss()) + 0.5);
+        measured_current = current + HOST_EKF_CURRENT_OFFSET;
+
+        start = HOST_Ticks();
+        SOC_EkfUpdate(&ekf, (float)measured_current, (float)voltage, (int16_t)temperature, (float)dt);
+        ticks += HOST_Ticks() - start - overhead;
+        updates++;
+
+        cc_true -= 100.0 * measured_current * dt / (3.6 * SOX_CELL_CAPACITY);
+        cc_wrong -= 100.0 * measured_current * dt / (3.6 * SOX_CELL_CAPACITY);
+
+        if (t >= HOST_EKF_SETTLE_TIME) {
+            HOST_AddError(&error_ekf, SOC_EkfGetSoc(&ekf), soc);
+            HOST_AddError(&error_cc_true, cc_true, soc);
+            HOST_AddError(&error_cc_wrong, cc_wrong, soc);
+            sigma = sqrt(SOC_EkfGetVariance(&ekf));
+            if (fabs(SOC_EkfGetSoc(&ekf) - soc) <= 3.0 * sigma) {
+                covered++;
+            }
+        }
+    }
+    fclose(file);
+
+    if (error_ekf.n == 0) {
+        fprintf(stderr, "error: the cycle is shorter than %.0fs\n", HOST_EKF_SETTLE_TIME);
+        return 1;
+    }
+    printf("cycle:                       %.1fh, %u updates, SOC at the start %.1f%%\n", t / 3600.0, updates, soc_start);
+    printf("SOC_EkfUpdate():             %.1f %s per update\n", (double)ticks / updates, HOST_TICKS_UNIT);
+    printf("errors after %.0f min:\n", HOST_EKF_SETTLE_TIME / 60.0);
+    HOST_PrintError("  EKF, start error", &error_ekf);
+    HOST_PrintError("  coulomb counting, true", &error_cc_true);
+    HOST_PrintError("  coulomb counting, error", &error_cc_wrong);
+    printf("  EKF within 3 sigma:        %.1f%% of the samples\n", 100.0 * covered / error_ekf.n);
+    return 0;
+}
@@ -0,0 +1,90 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    host.c
+ * @author  foxBMS Team
+ * @date    19.10.2026 (date of creation)
+ * @ingroup TOOLS
+ * @prefix  HOST
+ *
+ * @brief   Stubs of the modules called by the SOX on the host
+ *
+ */
+
+/*================== Includes =============================================*/
+#include "general.h"
+#include "host.h"
+
+#include "bal_charge.h"
+#include "database.h"
+#include "derating.h"
+#include "eepr.h"
+#include "mcu.h"
+#include "mcu_cfg.h"
+#include "sox.h"
+#include "sox_cc.h"
+
+/*================== Constant and Variable Definitions ====================*/
+uint32_t host_timestamp = 0;
+
+static DWT_Type host_dwt;
+static CoreDebug_Type host_coredebug;
+
+DWT_Type *DWT = &host_dwt;
+CoreDebug_Type *CoreDebug = &host_coredebug;
+
+/*================== Function Implementations =============================*/
+
+STD_RETURN_TYPE_e DB_ReadBlock(void *dataptrtoReceiver, DATA_BLOCK_ID_TYPE_e blockID) {
+    return E_OK;
+}
+
+STD_RETURN_TYPE_e DB_WriteBlock(void *dataptrfromSender, DATA_BLOCK_ID_TYPE_e blockID) {
+    return E_OK;
+}
+
+STD_RETURN_TYPE_e NVM_Get_soc(SOX_SOC_s *dest_ptr) {
+    return E_NOT_OK;
+}
+
+void NVM_Set_soc(SOX_SOC_s *ptr) {
+}
+
+uint32_t MCU_GetTimeStamp(void) {
+    return host_timestamp;
+}
+
+float BAL_GetChargeFactor(void) {
+    return 1.0;
+}
+
+void DRT_GetFactors(float *charge, float *discharge) {
+    *charge = 1.0;
+    *discharge = 1.0;
+}
+
+void SOC_CcGetCounters(SOX_CC_s *counters) {
+    SOX_CC_s zero = {0};
+
+    *counters = zero;
+}
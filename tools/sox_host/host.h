@@ -0,0 +1,82 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    host.h
+ * @author  foxBMS Team
+ * @date    19.10.2026 (date of creation)
+ * @ingroup TOOLS
+ * @prefix  HOST
+ *
+ * @brief   Time measurement and stubs shared by the host harnesses of the SOX
+ *
+ * The harnesses are built and run by sox_host.py. They include sox.c to reach its static
+ * functions, the functions of the other modules called by the SOX are stubbed in host.c.
+ */
+
+#ifndef HOST_H_
+#define HOST_H_
+
+/*================== Includes =============================================*/
+#include <stdint.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+/*================== Macros and Definitions ===============================*/
+
+/**
+ * unit of HOST_Ticks(), the time stamp counter runs at the nominal core clock
+ */
+#if defined(__x86_64__) || defined(__i386__)
+#define HOST_TICKS_UNIT     "TSC cycles"
+#else
+#define HOST_TICKS_UNIT     "ns"
+#endif
+
+/*================== Constant and Variable Definitions ====================*/
+
+/**
+ * time stamp returned by MCU_GetTimeStamp() in ms
+ */
+extern uint32_t host_timestamp;
+
+/*================== Function Implementations =============================*/
+
+/**
+ * @brief   reads the time stamp counter, or the monotonic clock where there is none
+ *
+ * @return  ticks in HOST_TICKS_UNIT
+ */
+static inline uint64_t HOST_Ticks(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000uLL + (uint64_t)now.tv_nsec;
+#endif
+}
+
+#endif /* HOST_H_ */
@@ -0,0 +1,146 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    ocv_bench.c
+ * @author  foxBMS Team
+ * @date    19.10.2026 (date of creation)
+ * @ingroup TOOLS
+ * @prefix  HOST
+ *
+ * @brief   Host benchmark of the open circuit voltage lookup
+ *
+ * Host counterpart of SOC_OcvBenchmark(): SOC_GetFromVoltage() with the binary search is compared
+ * with the linear search in floating point SOC_OcvLinearSearch() on every mV from 50mV below to
+ * 50mV above the table and every degC from -40degC to 80degC. Each search runs over all points
+ * HOST_OCV_ROUNDS times, the fastest round is reported.
+ */
+
+/*================== Includes =============================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include "host.h"
+
+/* compiled together with sox.c to reach the static functions */
+#include "sox.c"
+
+/*================== Macros and Definitions ===============================*/
+#define HOST_OCV_ROUNDS         20
+#define HOST_OCV_TEMP_MIN       (-40)
+#define HOST_OCV_TEMP_MAX       80
+
+/*================== Function Implementations =============================*/
+
+int main(void) {
+    const uint16_t *row = sox_ocv_table.voltage;
+    uint16_t vmin = row[0];
+    uint16_t vmax = row[sox_ocv_table.nr_soc - 1];
+    uint32_t nr_voltage = 0;
+    uint32_t points = 0;
+    uint32_t n = 0;
+    float *linear = NULL;
+    float *binary = NULL;
+    float deviation = 0.0;
+    float max_deviation = 0.0;
+    uint16_t worst_voltage = 0;
+    int16_t worst_temp = 0;
+    uint64_t start = 0;
+    uint64_t ticks = 0;
+    uint64_t best_linear = UINT64_MAX;
+    uint64_t best_binary = UINT64_MAX;
+    uint32_t v = 0;
+    int16_t temp = 0;
+    uint8_t i = 0;
+    uint8_t round = 0;
+
+    // the voltage range covers all rows of the table
+    for (i = 1; i < sox_ocv_table.nr_temperature; i++) {
+        row = &sox_ocv_table.voltage[i * sox_ocv_table.nr_soc];
+        if (row[0] < vmin) {
+            vmin = row[0];
+        }
+        if (row[sox_ocv_table.nr_soc - 1] > vmax) {
+            vmax = row[sox_ocv_table.nr_soc - 1];
+        }
+    }
+    vmin -= 50;
+    vmax += 50;
+    nr_voltage = vmax - vmin + 1;
+    points = nr_voltage * (HOST_OCV_TEMP_MAX - HOST_OCV_TEMP_MIN + 1);
+    linear = malloc(points * sizeof(float));
+    binary = malloc(points * sizeof(float));
+    if (linear == NULL || binary == NULL) {
+        return 1;
+    }
+
+    for (round = 0; round < HOST_OCV_ROUNDS; round++) {
+        n = 0;
+        start = HOST_Ticks();
+        for (temp = HOST_OCV_TEMP_MIN; temp <= HOST_OCV_TEMP_MAX; temp++) {
+            for (v = vmin; v <= vmax; v++) {
+                linear[n++] = SOC_OcvLinearSearch((uint16_t)v, temp);
+            }
+        }
+        ticks = HOST_Ticks() - start;
+        if (ticks < best_linear) {
+            best_linear = ticks;
+        }
+
+        n = 0;
+        start = HOST_Ticks();
+        for (temp = HOST_OCV_TEMP_MIN; temp <= HOST_OCV_TEMP_MAX; temp++) {
+            for (v = vmin; v <= vmax; v++) {
+                binary[n++] = SOC_GetFromVoltage((uint16_t)v, temp);
+            }
+        }
+        ticks = HOST_Ticks() - start;
+        if (ticks < best_binary) {
+            best_binary = ticks;
+        }
+    }
+
+    n = 0;
+    for (temp = HOST_OCV_TEMP_MIN; temp <= HOST_OCV_TEMP_MAX; temp++) {
+        for (v = vmin; v <= vmax; v++) {
+            deviation = linear[n] - binary[n];
+            if (deviation < 0.0) {
+                deviation = -deviation;
+            }
+            if (deviation > max_deviation) {
+                max_deviation = deviation;
+                worst_voltage = (uint16_t)v;
+                worst_temp = temp;
+            }
+            n++;
+        }
+    }
+
+    printf("table:             %u SOC x %u temperature breakpoints\n", sox_ocv_table.nr_soc, sox_ocv_table.nr_temperature);
+    printf("points:            %u (%u..%umV, %d..%ddegC)\n", points, vmin, vmax, HOST_OCV_TEMP_MIN, HOST_OCV_TEMP_MAX);
+    printf("linear search:     %.1f %s per lookup\n", (double)best_linear / points, HOST_TICKS_UNIT);
+    printf("binary search:     %.1f %s per lookup\n", (double)best_binary / points, HOST_TICKS_UNIT);
+    printf("max deviation:     %.4f%% SOC at %umV, %ddegC\n", max_deviation, worst_voltage, worst_temp);
+
+    free(linear);
+    free(binary);
+    return 0;
+}
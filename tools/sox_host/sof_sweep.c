@@ -0,0 +1,165 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    sof_sweep.c
+ * @author  foxBMS Team
+ * @date    19.10.2026 (date of creation)
+ * @ingroup TOOLS
+ * @prefix  HOST
+ *
+ * @brief   Host sweep of the fixed-point SOF ramps over their complete input space
+ *
+ * Host counterpart of SOF_FixedPointCheck(): every ramp of the fixed-point SOF is compared with the
+ * floating-point SOF for every value of its input type, i.e., 0..65535mV, 0..65535 in 0.01% SOC
+ * and -32768..32767degC. The continuous currents may deviate by SOX_SOF_FIXED_POINT_TOLERANCE.
+ * The harness returns 1 if a point exceeds the tolerance. The execution times exclude the
+ * overhead of the time measurement.
+ */
+
+/*================== Includes =============================================*/
+#include <stdio.h>
+#include "host.h"
+
+/* compiled together with sox.c to reach the static functions */
+#include "sox.c"
+
+/*================== Macros and Definitions ===============================*/
+
+/**
+ * result of the sweep over one input
+ */
+typedef struct {
+    const char *name;           /*!< input of the ramps                         */
+    const char *unit;           /*!< unit of the input                          */
+    uint32_t points;            /*!< evaluated input values                     */
+    uint32_t violations;        /*!< currents deviating more than the tolerance */
+    float max_deviation;        /*!< largest deviation in A                     */
+    int32_t worst;              /*!< input value of the largest deviation       */
+    uint64_t ticks_float;       /*!< execution time of the float SOF            */
+    uint64_t ticks_fixed;       /*!< execution time of the fixed-point ramps    */
+} HOST_SWEEP_s;
+
+/*================== Function Implementations =============================*/
+
+/**
+ * @brief   compares the fixed-point currents of one input value with the floating-point reference
+ */
+static void HOST_Compare(HOST_SWEEP_s *sweep, const SOX_SOF_s *reference, int32_t charge, int32_t discha, int32_t x) {
+    float deviation[2];
+    uint8_t i = 0;
+
+    deviation[0] = reference->current_Charge_cont_max - 0.001 * charge;
+    deviation[1] = reference->current_Discha_cont_max - 0.001 * discha;
+    for (i = 0; i < 2; i++) {
+        if (deviation[i] < 0.0) {
+            deviation[i] = -deviation[i];
+        }
+        if (deviation[i] > sweep->max_deviation) {
+            sweep->max_deviation = deviation[i];
+            sweep->worst = x;
+        }
+        if (deviation[i] > SOX_SOF_FIXED_POINT_TOLERANCE) {
+            sweep->violations++;
+        }
+    }
+    sweep->points++;
+}
+
+/**
+ * @brief   prints the result of the sweep over one input
+ */
+static void HOST_Print(const HOST_SWEEP_s *sweep) {
+    printf("%-12s %6u points, max deviation %.4fA at %d%s, %u violations, float %.1f / fixed %.1f %s per point\n",
+           sweep->name, sweep->points, sweep->max_deviation, sweep->worst, sweep->unit, sweep->violations,
+           (double)sweep->ticks_float / sweep->points, (double)sweep->ticks_fixed / sweep->points, HOST_TICKS_UNIT);
+}
+
+int main(void) {
+    HOST_SWEEP_s voltage = { "voltage", "mV" };
+    HOST_SWEEP_s soc = { "SOC", " * 0.01%" };
+    HOST_SWEEP_s temperature = { "temperature", "degC" };
+    SOX_SOF_s reference = {0.0, 0.0, 0.0};
+    int32_t charge = 0;
+    int32_t discha = 0;
+    uint64_t start = 0;
+    uint64_t ticks = 0;
+    uint64_t overhead = UINT64_MAX;
+    int32_t x = 0;
+
+    // overhead of the time measurement itself
+    for (x = 0; x < 1000; x++) {
+        start = HOST_Ticks();
+        ticks = HOST_Ticks() - start;
+        if (ticks < overhead) {
+            overhead = ticks;
+        }
+    }
+
+    SOF_Init();
+
+    for (x = 0; x <= UINT16_MAX; x++) {
+        start = HOST_Ticks();
+        SOF_CalculateVoltageBased((float)x, (float)x, &reference);
+        voltage.ticks_float += HOST_Ticks() - start - overhead;
+
+        start = HOST_Ticks();
+        charge = SOF_Ramp(SOF_RAMP_VOLTAGE_CHARGE, x);
+        discha = SOF_Ramp(SOF_RAMP_VOLTAGE_DISCHA, x);
+        voltage.ticks_fixed += HOST_Ticks() - start - overhead;
+
+        HOST_Compare(&voltage, &reference, charge, discha, x);
+    }
+
+    for (x = 0; x <= UINT16_MAX; x++) {
+        start = HOST_Ticks();
+        SOF_CalculateSocBased((float)x, (float)x, &reference);
+        soc.ticks_float += HOST_Ticks() - start - overhead;
+
+        start = HOST_Ticks();
+        charge = SOF_Ramp(SOF_RAMP_SOC_CHARGE, x);
+        discha = SOF_Ramp(SOF_RAMP_SOC_DISCHA, x);
+        soc.ticks_fixed += HOST_Ticks() - start - overhead;
+
+        HOST_Compare(&soc, &reference, charge, discha, x);
+    }
+
+    for (x = INT16_MIN; x <= INT16_MAX; x++) {
+        start = HOST_Ticks();
+        SOF_CalculateTemperatureBased((float)x, (float)x, &reference);
+        temperature.ticks_float += HOST_Ticks() - start - overhead;
+
+        start = HOST_Ticks();
+        charge = SOF_TemperatureFixed(SOF_RAMP_TLOW_CHARGE, SOF_RAMP_THIGH_CHARGE, x, x);
+        discha = SOF_TemperatureFixed(SOF_RAMP_TLOW_DISCHA, SOF_RAMP_THIGH_DISCHA, x, x);
+        temperature.ticks_fixed += HOST_Ticks() - start - overhead;
+
+        HOST_Compare(&temperature, &reference, charge, discha, x);
+    }
+
+    printf("tolerance    %.4fA\n", SOX_SOF_FIXED_POINT_TOLERANCE);
+    HOST_Print(&voltage);
+    HOST_Print(&soc);
+    HOST_Print(&temperature);
+
+    return (voltage.violations + soc.violations + temperature.violations) > 0 ? 1 : 0;
+}
@@ -0,0 +1,135 @@
+# @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der
+#   angewandten Forschung e.V. All rights reserved.
+#
+# BSD 3-Clause License
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+# 1.  Redistributions of source code must retain the above copyright notice,
+#     this list of conditions and the following disclaimer.
+# 2.  Redistributions in binary form must reproduce the above copyright notice,
+#     this list of conditions and the following disclaimer in the documentation
+#     and/or other materials provided with the distribution.
+# 3.  Neither the name of the copyright holder nor the names of its
+#     contributors may be used to endorse or promote products derived from this
+#     software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+# LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+# CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+# SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+# INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+# CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+#
+# We kindly request you to use one or more of the following phrases to refer to
+# foxBMS in your hardware, software, documentation or advertising materials:
+#
+# &Prime;This product uses parts of foxBMS&reg;&Prime;
+#
+# &Prime;This product includes parts of foxBMS&reg;&Prime;
+#
+# &Prime;This product is derived from foxBMS&reg;&Prime;
+
+
+"""Builds and runs the host harnesses of the SOX.
+
+Usage:
+    python tools/sox_host/sox_host.py ocv
+    python tools/sox_host/sox_host.py ekf [cycle.csv [SOC at the start] [error of the initial SOC]]
+    python tools/sox_host/sox_host.py sof
+
+The harnesses are compiled with the host C compiler (CC, default cc) from the
+sources in src/ and the stubs in tools/sox_host/stubs, which replace the
+drivers and the generated configuration. Each harness includes sox.c to reach
+its static functions. The execution times are measured with the time stamp
+counter of the host, they are only comparable with each other, not with the
+Cortex-M4. The target counterparts are SOC_OcvBenchmark(), SOF_Benchmark() and
+SOF_FixedPointCheck().
+
+    ocv     OCV lookup: binary search against the linear search in float
+    ekf     SOC estimation: extended Kalman filter against coulomb counting on a
+            drive cycle, by default a 4h cycle of drive_cycle.py with seed 1
+    sof     fixed-point SOF ramps against the float SOF over the complete input
+            space, fails if a current deviates more than SOX_SOF_FIXED_POINT_TOLERANCE
+"""
+
+import argparse
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+SRC = os.path.normpath(os.path.join(HERE, os.pardir, os.pardir, 'src'))
+
+INCLUDES = [
+    os.path.join(HERE, 'stubs'),
+    HERE,
+    'general',
+    os.path.join('general', 'config'),
+    os.path.join('general', 'includes'),
+    os.path.join('engine', 'config'),
+    os.path.join('engine', 'diag'),
+    os.path.join('engine', 'lmon'),
+    os.path.join('application', 'bal'),
+    os.path.join('application', 'config'),
+    os.path.join('application', 'derating'),
+    os.path.join('application', 'sox'),
+    os.path.join('module', 'config'),
+]
+
+# configuration of the SOX, sox.c itself is included by the harnesses
+SOX_SOURCES = [
+    os.path.join(HERE, 'host.c'),
+    os.path.join('application', 'config', 'sox_cfg.c'),
+    os.path.join('application', 'config', 'sox_map_cfg.c'),
+    os.path.join('application', 'config', 'sox_ocv_cfg.c'),
+    os.path.join('application', 'sox', 'sox_ekf.c'),
+]
+
+HARNESSES = {
+    'ocv': [os.path.join(HERE, 'ocv_bench.c')] + SOX_SOURCES,
+    'ekf': [os.path.join(HERE, 'ekf_bench.c')] + SOX_SOURCES,
+    'sof': [os.path.join(HERE, 'sof_sweep.c')] + SOX_SOURCES,
+}
+
+
+def build(name, directory, cc):
+    """compiles a harness and returns the path of the executable"""
+    binary = os.path.join(directory, name)
+    command = [cc, '-std=gnu99', '-O2', '-Wall', '-Wno-unused-function', '-Wno-unused-but-set-variable',
+               '-o', binary]
+    command += ['-I' + os.path.join(SRC, path) for path in INCLUDES]
+    command += [os.path.join(SRC, path) for path in HARNESSES[name]]
+    command += ['-lm']
+    subprocess.check_call(command)
+    return binary
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('harness', choices=sorted(HARNESSES), help='harness to run')
+    parser.add_argument('args', nargs=argparse.REMAINDER, help='arguments passed to the harness')
+    args = parser.parse_args()
+    cc = os.environ.get('CC', 'cc')
+    if shutil.which(cc) is None:
+        sys.exit('error: no host C compiler %s' % cc)
+    directory = tempfile.mkdtemp()
+    try:
+        binary = build(args.harness, directory, cc)
+        if args.harness == 'ekf' and not args.args:
+            cycle = os.path.join(directory, 'cycle.csv')
+            subprocess.check_call([sys.executable, os.path.join(HERE, 'drive_cycle.py'), '-o', cycle])
+            args.args = [cycle]
+        sys.exit(subprocess.call([binary] + args.args))
+    finally:
+        shutil.rmtree(directory)
+
+
+if __name__ == '__main__':
+    main()
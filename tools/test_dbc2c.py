@@ -0,0 +1,369 @@
+# @copyright &copy; 2010 - 2018, Fraunhofer-Gesellschaft zur Foerderung der
+#   angewandten Forschung e.V. All rights reserved.
+#
+# BSD 3-Clause License
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+# 1.  Redistributions of source code must retain the above copyright notice,
+#     this list of conditions and the following disclaimer.
+# 2.  Redistributions in binary form must reproduce the above copyright notice,
+#     this list of conditions and the following disclaimer in the documentation
+#     and/or other materials provided with the distribution.
+# 3.  Neither the name of the copyright holder nor the names of its
+#     contributors may be used to endorse or promote products derived from this
+#     software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+# LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+# CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+# SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+# INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+# CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+#
+# We kindly request you to use one or more of the following phrases to refer to
+# foxBMS in your hardware, software, documentation or advertising materials:
+#
+# &Prime;This product uses parts of foxBMS&reg;&Prime;
+#
+# &Prime;This product includes parts of foxBMS&reg;&Prime;
+#
+# &Prime;This product is derived from foxBMS&reg;&Prime;
+
+"""Tests of tools/dbc2c.py.
+
+Usage:
+    python tools/test_dbc2c.py
+
+The parser and generator tests only need Python. The round-trip tests compile
+the generated packers with the host C compiler (CC, default cc) and compare
+the packed frames and unpacked values with the values the DBC description
+defines. They are skipped if no C compiler is found.
+"""
+
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+import unittest
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import dbc2c  # noqa: E402
+
+REPO_DBC = os.path.join(os.path.dirname(os.path.abspath(__file__)), os.pardir,
+                        'src', 'module', 'config', 'cansignal_cfg.dbc')
+
+CC = os.environ.get('CC', 'cc')
+
+DBC = '''VERSION ""
+
+BO_ 290 Status: 8 Vector__XXX
+ SG_ state : 0|4@1+ (1,0) [0|15] "" Vector__XXX
+ SG_ error : 4|4@1- (1,0) [-8|7] "" Vector__XXX
+ SG_ voltage : 8|16@1+ (0.1,0) [0|6553.5] "V" Vector__XXX
+ SG_ current : 24|16@1- (0.01,0) [-300|300] "A" Vector__XXX
+ SG_ temperature : 40|16@1+ (0.01,-128) [-128|527.35] "degC" Vector__XXX
+ SG_ offset : 56|8@1- (0.5,10) [-50|70] "" Vector__XXX
+
+BO_ 2147484433 Counter: 2 Vector__XXX
+ SG_ count : 0|16@1+ (1,0) [0|1000] "" Vector__XXX
+
+CM_ BO_ 290 "status of the system";
+CM_ SG_ 290 current "pack current";
+'''
+
+# general.h of the target pulls in generated headers, the packers only need the integer types
+GENERAL_H = '''#ifndef GENERAL_H_
+#define GENERAL_H_
+#include <stdint.h>
+#endif
+'''
+
+# layout of CANS_signal_s of cansignal_cfg.h, the message index is a union of enums
+CANS_SIGNAL_S = '''typedef uint32_t (*can_callback_funcPtr)(uint32_t, void *);
+typedef union {
+    uint32_t Tx;
+} CANS_messages_t;
+typedef struct {
+    CANS_messages_t msgIdx;
+    uint8_t bit_position;
+    uint8_t bit_length;
+    float min;
+    float max;
+    float factor;
+    float offset;
+    can_callback_funcPtr setter;
+    can_callback_funcPtr getter;
+} CANS_signal_s;
+'''
+
+
+def parse(text):
+    """parses a DBC description given as string"""
+    with tempfile.NamedTemporaryFile('w', suffix='.dbc', delete=False) as f:
+        f.write(text)
+    try:
+        return dbc2c.read_dbc(f.name)
+    finally:
+        os.remove(f.name)
+
+
+def find_compiler():
+    """returns True if the host C compiler is available"""
+    return shutil.which(CC) is not None
+
+
+class TestParser(unittest.TestCase):
+
+    def test_messages(self):
+        messages = parse(DBC)
+        self.assertEqual([m.name for m in messages], ['Status', 'Counter'])
+        self.assertEqual(messages[0].can_id, 0x122)
+        self.assertEqual(messages[0].dlc, 8)
+        self.assertEqual(messages[0].comment, 'status of the system')
+        # the extended frame flag of the DBC identifier is removed
+        self.assertEqual(messages[1].can_id, 0x311)
+
+    def test_signals(self):
+        status = parse(DBC)[0]
+        self.assertEqual([s.name for s in status.signals],
+                         ['state', 'error', 'voltage', 'current', 'temperature', 'offset'])
+        current = status.signals[3]
+        self.assertEqual((current.start, current.length, current.is_signed), (24, 16, True))
+        self.assertEqual((current.factor, current.offset), (0.01, 0.0))
+        self.assertEqual((current.minimum, current.maximum), (-300.0, 300.0))
+        self.assertEqual(current.unit, 'A')
+        self.assertEqual(current.comment, 'pack current')
+
+    def test_types(self):
+        types = [s.c_type() for s in parse(DBC)[0].signals]
+        self.assertEqual(types, ['uint8_t', 'int8_t', 'float', 'float', 'float', 'float'])
+
+    def test_motorola_rejected(self):
+        with self.assertRaises(SystemExit):
+            parse('BO_ 1 A: 8 X\n SG_ s : 7|8@0+ (1,0) [0|255] "" X\n')
+
+    def test_dlc_rejected(self):
+        with self.assertRaises(SystemExit):
+            parse('BO_ 1 A: 9 X\n')
+
+    def test_duplicate_id_rejected(self):
+        with self.assertRaises(SystemExit):
+            parse('BO_ 1 A: 8 X\nBO_ 1 B: 8 X\n')
+
+    def test_unknown_comment_rejected(self):
+        with self.assertRaises(SystemExit):
+            parse('BO_ 1 A: 8 X\nCM_ SG_ 1 s "unknown";\n')
+
+
+class TestCheck(unittest.TestCase):
+
+    def test_valid(self):
+        dbc2c.check(parse(DBC))
+
+    def test_overlap_rejected(self):
+        messages = parse('BO_ 1 A: 8 X\n SG_ a : 0|8@1+ (1,0) [0|255] "" X\n'
+                         ' SG_ b : 4|8@1+ (1,0) [0|255] "" X\n')
+        with self.assertRaises(SystemExit):
+            dbc2c.check(messages)
+
+    def test_exceeding_dlc_rejected(self):
+        messages = parse('BO_ 1 A: 1 X\n SG_ a : 4|8@1+ (1,0) [0|255] "" X\n')
+        with self.assertRaises(SystemExit):
+            dbc2c.check(messages)
+
+    def test_range_rejected(self):
+        # 300 A with 0.01 A resolution does not fit into 15 bit and a sign
+        messages = parse('BO_ 1 A: 8 X\n SG_ a : 0|15@1- (0.01,0) [-300|300] "" X\n')
+        with self.assertRaises(SystemExit):
+            dbc2c.check(messages)
+
+    def test_negative_unsigned_rejected(self):
+        messages = parse('BO_ 1 A: 8 X\n SG_ a : 0|8@1+ (0.1,0) [-1|25] "" X\n')
+        with self.assertRaises(SystemExit):
+            dbc2c.check(messages)
+
+
+class TestGenerator(unittest.TestCase):
+
+    def setUp(self):
+        self.messages = parse(DBC)
+        self.header = dbc2c.to_h(self.messages, 'cans_dbc', 'CANS', 'test.dbc')
+        self.source = dbc2c.to_c(self.messages, 'cans_dbc', 'CANS', 'test.dbc')
+
+    def test_header_includes_types(self):
+        self.assertIn('#include "general.h"', self.header)
+
+    def test_reproducible(self):
+        # the output only depends on the DBC description, e.g. no date of generation
+        self.assertNotIn('@date', self.header)
+        self.assertNotIn('@date', self.source)
+
+    def test_declarations(self):
+        self.assertIn('#define CANS_STATUS_ID    0x122', self.header)
+        self.assertIn('#define CANS_COUNTER_DLC   2', self.header)
+        self.assertIn('extern uint64_t CANS_PackStatus(const CANS_Status_s *msg);', self.header)
+        self.assertIn('extern void CANS_UnpackCounter(uint64_t frame, CANS_Counter_s *msg);', self.header)
+
+    def test_signal_table(self):
+        self.assertIn('#define CANS_STATUS_NR_OF_SIGNALS    6', self.header)
+        self.assertIn('#define CANS_COUNTER_NR_OF_SIGNALS    1', self.header)
+        self.assertIn('#define CANS_STATUS_SIGNALS(msg, setter, getter)', self.header)
+        # the signal layer scales raw = (physical + offset) * factor
+        self.assertIn('{ {(msg)}, 40, 16, -128.0f, 527.35f, 100.0f, 128.0f, (setter), (getter) }', self.header)
+        self.assertIn('{ {(msg)}, 0, 16, 0.0f, 1000.0f, 1.0f, 0.0f, (setter), (getter) }', self.header)
+
+    def test_rounding(self):
+        self.assertIn('raw = (uint64_t)(phys * 10.0f + 0.5f);', self.source)
+        self.assertIn('raw = (uint64_t)(int64_t)(phys - 0.5f);', self.source)
+        self.assertIn('raw = (uint64_t)(int64_t)(phys + 0.5f);', self.source)
+
+    def test_to_raw(self):
+        current = self.messages[0].signals[3]
+        self.assertEqual(current.to_raw(1.234), 123)
+        self.assertEqual(current.to_raw(1.236), 124)
+        self.assertEqual(current.to_raw(-1.234), -123)
+        self.assertEqual(current.to_raw(-1.236), -124)
+
+
+@unittest.skipUnless(find_compiler(), 'no host C compiler')
+class TestRoundTrip(unittest.TestCase):
+    """packs and unpacks the generated messages on the host"""
+
+    def setUp(self):
+        self.directory = tempfile.mkdtemp()
+
+    def tearDown(self):
+        shutil.rmtree(self.directory)
+
+    def build(self, messages, main):
+        """generates the packers, compiles them with main and returns the output lines"""
+        with open(os.path.join(self.directory, 'general.h'), 'w') as f:
+            f.write(GENERAL_H)
+        with open(os.path.join(self.directory, 'cans_dbc.h'), 'w') as f:
+            f.write(dbc2c.to_h(messages, 'cans_dbc', 'CANS', 'test.dbc') + '\n')
+        with open(os.path.join(self.directory, 'cans_dbc.c'), 'w') as f:
+            f.write(dbc2c.to_c(messages, 'cans_dbc', 'CANS', 'test.dbc') + '\n')
+        with open(os.path.join(self.directory, 'main.c'), 'w') as f:
+            f.write(main)
+        binary = os.path.join(self.directory, 'roundtrip')
+        subprocess.check_call([CC, '-std=c99', '-Wall', '-Werror', '-I', self.directory, '-o', binary,
+                               os.path.join(self.directory, 'cans_dbc.c'),
+                               os.path.join(self.directory, 'main.c')])
+        return subprocess.check_output([binary]).decode().split('\n')[:-1]
+
+    @staticmethod
+    def expected(message, values):
+        """frame and unpacked values of one message as defined by the DBC description"""
+        frame = 0
+        unpacked = []
+        for signal, value in zip(message.signals, values):
+            value = min(max(value, signal.minimum), signal.maximum)
+            raw = signal.to_raw(value)
+            frame |= (raw & signal.mask()) << signal.start
+            unpacked.append(raw * signal.factor + signal.offset)
+        return frame, unpacked
+
+    def roundtrip(self, messages, vectors):
+        """packs and unpacks the vectors, a vector is (message, values of all signals)"""
+        main = ['#include <stdio.h>', '#include "cans_dbc.h"', '', 'int main(void) {']
+        for number, (message, values) in enumerate(vectors):
+            struct = 'CANS_%s_s' % message.name
+            main.append('    {')
+            main.append('        %s msg = { %s };' % (struct, ', '.join(repr(v) for v in values)))
+            main.append('        %s out;' % struct)
+            main.append('        uint8_t data[8];')
+            main.append('        uint64_t frame = CANS_Pack%s(&msg);' % message.name)
+            main.append('        CANS_DBC_FrameToData(frame, data, CANS_%s_DLC);' % message.name.upper())
+            main.append('        frame = CANS_DBC_DataToFrame(data, CANS_%s_DLC);' % message.name.upper())
+            main.append('        CANS_Unpack%s(frame, &out);' % message.name)
+            main.append('        printf("%llx\\n", (unsigned long long)frame);')
+            for signal in message.signals:
+                main.append('        printf("%%.9g\\n", (double)out.%s);' % signal.name)
+            main.append('    }')
+        main.append('    return 0;')
+        main.append('}')
+        lines = self.build(messages, '\n'.join(main) + '\n')
+        for message, values in vectors:
+            frame, unpacked = self.expected(message, values)
+            self.assertEqual(int(lines.pop(0), 16), frame, '%s %s' % (message.name, values))
+            for signal, value in zip(message.signals, unpacked):
+                # the target calculates in float
+                self.assertAlmostEqual(float(lines.pop(0)), value, delta=abs(signal.factor) * 1e-3 + abs(value) * 1e-6,
+                                       msg='%s.%s' % (message.name, signal.name))
+
+    def test_status(self):
+        messages = parse(DBC)
+        status, counter = messages
+        vectors = [
+            (status, [0, 0, 0.0, 0.0, 0.0, 0.0]),
+            (status, [15, -8, 6553.5, -300.0, -128.0, -50.0]),
+            (status, [7, 7, 230.04, 12.347, 25.004, 11.2]),
+            # values just below and above the rounding limit
+            (status, [1, -1, 230.049, -12.344, 25.006, 11.24]),
+            (status, [1, -1, 230.051, -12.346, -25.004, -11.26]),
+            # values outside of the range are clamped
+            (status, [1, 2, 7000.0, -1000.0, 600.0, 100.0]),
+            (counter, [1000]),
+            (counter, [4000]),
+        ]
+        self.roundtrip(messages, vectors)
+
+    def test_signal_table(self):
+        """the entries of the signal table describe the signals of the packed frames"""
+        messages = parse(DBC)
+        status, counter = messages
+        main = ['#include <stdio.h>', '#include "cans_dbc.h"', '', CANS_SIGNAL_S,
+                'static const CANS_signal_s table[] = {',
+                '    CANS_STATUS_SIGNALS(3, NULL, NULL),',
+                '    CANS_COUNTER_SIGNALS(4, NULL, NULL),',
+                '};', '',
+                'int main(void) {',
+                '    CANS_Status_s msg = { 7, -3, 230.04, -12.347, 25.004, 11.5 };',
+                '    uint64_t frame = CANS_PackStatus(&msg);',
+                '    uint16_t i = 0;',
+                '',
+                '    for (i = 0; i < CANS_STATUS_NR_OF_SIGNALS + CANS_COUNTER_NR_OF_SIGNALS; i++) {',
+                '        printf("%u %u %u %.9g %.9g %.9g %.9g %llx\\n", (unsigned)table[i].msgIdx.Tx,',
+                '               table[i].bit_position, table[i].bit_length, table[i].min, table[i].max,',
+                '               table[i].factor, table[i].offset,',
+                '               (unsigned long long)((frame >> table[i].bit_position) &',
+                '                                    (((uint64_t)1 << table[i].bit_length) - 1)));',
+                '    }',
+                '    return 0;',
+                '}', '']
+        lines = self.build(messages, '\n'.join(main))
+        self.assertEqual(len(lines), len(status.signals) + len(counter.signals))
+        values = [7, -3, 230.04, -12.347, 25.004, 11.5]
+        for line, signal, value in zip(lines, status.signals, values):
+            fields = line.split()
+            self.assertEqual([int(f) for f in fields[:3]], [3, signal.start, signal.length])
+            self.assertAlmostEqual(float(fields[3]), signal.minimum, places=4)
+            self.assertAlmostEqual(float(fields[4]), signal.maximum, places=4)
+            self.assertAlmostEqual(float(fields[5]), 1.0 / signal.factor, places=4)
+            self.assertAlmostEqual(float(fields[6]), -signal.offset, places=4)
+            # the raw value at the position of the table entry is the packed signal
+            self.assertEqual(int(fields[7], 16), signal.to_raw(value) & signal.mask(), signal.name)
+        self.assertEqual([int(f) for f in lines[-1].split()[:3]], [4, 0, 16])
+
+    def test_repository_dbc(self):
+        messages = dbc2c.read_dbc(REPO_DBC)
+        dbc2c.check(messages)
+        vectors = []
+        for message in messages:
+            for fraction in (0.0, 0.3337, 0.4999, 1.0):
+                values = []
+                for signal in message.signals:
+                    value = signal.minimum + fraction * (signal.maximum - signal.minimum)
+                    values.append(int(value) if signal.is_integer() else round(value, 3))
+                vectors.append((message, values))
+        self.roundtrip(messages, vectors)
+
+
+if __name__ == '__main__':
+    unittest.main()